@@ -22,6 +22,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <Core/KeyCodes.hpp>
 #include <Core/Utils.hpp>
 #include <Core/Project.hpp>
+#include <Core/MemoryTracker.hpp>
 
 #include <Scene/OrthographicCameraController.hpp>
 #include <Scene/Scene.hpp>
@@ -40,6 +41,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <Graphics/Renderer.hpp>
 #include <Graphics/Renderer2D.hpp>
 #include <Graphics/Framebuffer.hpp>
+#include <Graphics/PickingService.hpp>
 #include <Graphics/RenderCommand.hpp>
 #include <Graphics/Buffer.hpp>
 #include <Graphics/VertexArray.hpp>
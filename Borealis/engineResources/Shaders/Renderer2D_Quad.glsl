@@ -2,14 +2,20 @@
 #version 410 core
 			
 layout(location = 0) in vec3 a_Position;
-layout(location = 1) in vec4 a_Color;
-layout(location = 2) in vec2 a_TexCoord;
-layout(location = 3) in int a_TexIndex;
-layout(location = 4) in float a_TilingFactor;
-layout(location = 5) in int a_EntityID;
+layout(location = 1) in vec3 a_AxisX;
+layout(location = 2) in vec3 a_AxisY;
+layout(location = 3) in vec4 a_UVRect;
+layout(location = 4) in vec4 a_Color;
+layout(location = 5) in int a_TexIndex;
+layout(location = 6) in float a_TexLayer;
+layout(location = 7) in float a_TilingFactor;
+layout(location = 8) in int a_EntityID;
 
 uniform mat4 u_ViewProjection;
 
+// Two triangles per instance, corners of the unit quad in 0 1 2 2 3 0 order
+const vec2 c_Corners[6] = vec2[](vec2(0.0, 0.0), vec2(1.0, 0.0), vec2(1.0, 1.0), vec2(1.0, 1.0), vec2(0.0, 1.0), vec2(0.0, 0.0));
+
 out vec2 v_TexCoord;
 out vec4 v_Color;
 flat out int v_TexIndex;
@@ -18,12 +24,15 @@ flat out int v_EntityID;
 
 void main()
 {
+	vec2 corner = c_Corners[gl_VertexID];
+	vec3 position = a_Position + a_AxisX * (corner.x - 0.5) + a_AxisY * (corner.y - 0.5);
+
 	v_Color = a_Color;
-	v_TexCoord = a_TexCoord;
+	v_TexCoord = mix(a_UVRect.xy, a_UVRect.zw, corner);
 	v_TexIndex = a_TexIndex;
 	v_TilingFactor = a_TilingFactor;
 	v_EntityID = a_EntityID;
-	gl_Position = u_ViewProjection * vec4(a_Position, 1.0);	
+	gl_Position = u_ViewProjection * vec4(position, 1.0);	
 }
 
 #type fragment
@@ -43,4 +52,4 @@ void main()
 {
 	color = texture(u_Texture[v_TexIndex], v_TexCoord * v_TilingFactor) * v_Color;
 	entityIDs = v_EntityID;
-}
\ No newline at end of file
+}
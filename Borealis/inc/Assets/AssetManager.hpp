@@ -53,6 +53,48 @@ namespace Borealis
 			return Project::GetEditorAssetsManager()->GetMetaData(handle);
 		}
 
+		/*!***********************************************************************
+			\brief
+				Starts reading the file of a mesh or texture on a worker
+		*************************************************************************/
+		static void PrefetchAsset(AssetHandle handle)
+		{
+			if (mRunTime)
+			{
+				mAssetManager.PrefetchAsset(handle);
+				return;
+			}
+			Project::GetEditorAssetsManager()->PrefetchAsset(handle);
+		}
+
+		/*!***********************************************************************
+			\brief
+				Checks if GetAsset can return the asset without waiting on its file
+		*************************************************************************/
+		static bool IsAssetReady(AssetHandle handle)
+		{
+			if (mRunTime)
+			{
+				return mAssetManager.IsAssetReady(handle);
+			}
+			return Project::GetEditorAssetsManager()->IsAssetReady(handle);
+		}
+
+		/*!***********************************************************************
+			\brief
+				Registers an asset built in memory, so scenes referencing its
+				handle load it without a file
+		*************************************************************************/
+		static void AddMemoryAsset(Ref<Asset> asset, std::string const& name)
+		{
+			if (mRunTime)
+			{
+				mAssetManager.AddMemoryAsset(asset, name);
+				return;
+			}
+			Project::GetEditorAssetsManager()->AddMemoryAsset(asset, name);
+		}
+
 		//TEMP
 		//===============================================================
 		static void InsertMetaData(AssetMetaData data)
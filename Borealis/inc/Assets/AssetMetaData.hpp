@@ -23,6 +23,110 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 
 namespace Borealis
 {
+	enum class AudioFormat
+	{
+		ADPCM,		// IMA ADPCM, about a quarter of the size of PCM
+		PCM
+	};
+
+	enum class AudioLoadMode
+	{
+		Auto,					// Streams clips longer than the threshold, decompresses the rest
+		DecompressOnLoad,
+		CompressedInMemory,
+		Stream
+	};
+
+	/*!***********************************************************************
+		\brief
+			Import settings of an audio asset, kept in its meta file. The
+			asset compiler reads them and writes back whether the clip streams.
+	*************************************************************************/
+	struct AudioImportSettings
+	{
+		AudioFormat Format = AudioFormat::ADPCM;
+		AudioLoadMode LoadMode = AudioLoadMode::Auto;
+		float StreamThreshold = 10.0f;		// Seconds
+		bool ForceMono = false;
+		bool Streaming = false;				// Resolved by the asset compiler
+
+		static std::string FormatToString(AudioFormat format)
+		{
+			return format == AudioFormat::PCM ? "PCM" : "ADPCM";
+		}
+
+		static AudioFormat StringToFormat(std::string const& format)
+		{
+			return format == "PCM" ? AudioFormat::PCM : AudioFormat::ADPCM;
+		}
+
+		static std::string LoadModeToString(AudioLoadMode loadMode)
+		{
+			switch (loadMode)
+			{
+			case AudioLoadMode::DecompressOnLoad:	return "DecompressOnLoad";
+			case AudioLoadMode::CompressedInMemory:	return "CompressedInMemory";
+			case AudioLoadMode::Stream:				return "Stream";
+			default:								return "Auto";
+			}
+		}
+
+		static AudioLoadMode StringToLoadMode(std::string const& loadMode)
+		{
+			if (loadMode == "DecompressOnLoad")		return AudioLoadMode::DecompressOnLoad;
+			if (loadMode == "CompressedInMemory")	return AudioLoadMode::CompressedInMemory;
+			if (loadMode == "Stream")				return AudioLoadMode::Stream;
+			return AudioLoadMode::Auto;
+		}
+	};
+
+	enum class TextureUsage
+	{
+		Auto,		// Picked from the file name, e.g. "_normal" or "_mask"
+		Colour,		// BC7
+		NormalMap,	// BC5, only X and Y are stored
+		Mask		// BC4, single channel
+	};
+
+	/*!***********************************************************************
+		\brief
+			Import settings of a texture asset, kept in its meta file
+	*************************************************************************/
+	struct TextureImportSettings
+	{
+		TextureUsage Usage = TextureUsage::Auto;
+		bool GenerateMips = true;
+
+		static std::string UsageToString(TextureUsage usage)
+		{
+			switch (usage)
+			{
+			case TextureUsage::Colour:		return "Colour";
+			case TextureUsage::NormalMap:	return "NormalMap";
+			case TextureUsage::Mask:		return "Mask";
+			default:						return "Auto";
+			}
+		}
+
+		static TextureUsage StringToUsage(std::string const& usage)
+		{
+			if (usage == "Colour")		return TextureUsage::Colour;
+			if (usage == "NormalMap")	return TextureUsage::NormalMap;
+			if (usage == "Mask")		return TextureUsage::Mask;
+			return TextureUsage::Auto;
+		}
+	};
+
+	/*!***********************************************************************
+		\brief
+			Import settings of a mesh asset, kept in its meta file
+	*************************************************************************/
+	struct MeshImportSettings
+	{
+		uint32_t LodCount = 4;			// Levels of detail including the full mesh
+		float LodReduction = 0.5f;		// Triangles each LOD keeps of the one before
+	};
+
 	struct AssetMetaData
 	{
 		std::string name{};
@@ -35,6 +139,10 @@ namespace Borealis
 
 		std::time_t importDate{};
 		std::time_t cacheCreationDate{};
+
+		AudioImportSettings AudioSettings{};	// Only used by audio assets
+		TextureImportSettings TextureSettings{};	// Only used by textures
+		MeshImportSettings MeshSettings{};	// Only used by meshes
 	};
 }
 
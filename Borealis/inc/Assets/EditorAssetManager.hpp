@@ -15,16 +15,18 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #ifndef EditorAssetManager_HPP
 #define EditorAssetManager_HPP
 
-#include <unordered_map>
 #include <filesystem>
+#include <functional>
 
+#include <Core/FlatHashMap.hpp>
+#include <Core/JobSystem.hpp>
 #include <Core/ProjectInfo.hpp>
 #include <Assets/IAssetManager.hpp>
 #include <Assets/AssetMetaData.hpp>
 
 namespace Borealis
 {
-	using AssetRegistry = std::unordered_map<AssetHandle, AssetMetaData>;
+	using AssetRegistry = FlatHashMap<AssetHandle, AssetMetaData>;
 	class EditorAssetManager : public IAssetManager
 	{
 	public:
@@ -46,12 +48,42 @@ namespace Borealis
 		*************************************************************************/
 		AssetMetaData const& GetMetaData(AssetHandle assetHandle);
 
+		/*!***********************************************************************
+			\brief
+				Starts reading the file of a mesh or texture on a worker, GetAsset
+				then only sets it up. Other assets are loaded by GetAsset
+			\param[in] assetHandle
+				Asset to read
+		*************************************************************************/
+		void PrefetchAsset(AssetHandle assetHandle);
+
+		/*!***********************************************************************
+			\brief
+				Checks if GetAsset can return the asset without waiting on its file
+			\param[in] assetHandle
+				Asset to check
+			\return
+				False while a prefetch of the asset is still reading
+		*************************************************************************/
+		bool IsAssetReady(AssetHandle assetHandle);
+
 		/*!***********************************************************************
 			\brief
 				Get asset registry
 		*************************************************************************/
 		AssetRegistry& GetAssetRegistry();
 
+		/*!***********************************************************************
+			\brief
+				Registers an asset built in memory, so scenes referencing its
+				handle load it without a file
+			\param[in] asset
+				Asset to register, with its handle and type set
+			\param[in] name
+				Name of the asset in the registry
+		*************************************************************************/
+		void AddMemoryAsset(Ref<Asset> asset, std::string const& name);
+
 		/*!***********************************************************************
 			\brief
 				Clear the asset manager
@@ -66,10 +98,21 @@ namespace Borealis
 		*************************************************************************/
 		Ref<Asset> LoadAsset(AssetHandle assetHandle);
 
+		/*
+			Asset whose file is read by a worker. Once the counter is done,
+			mFinish sets it up on the thread that asked for it
+		*/
+		struct PendingAsset
+		{
+			JobCounter mCounter;
+			std::function<Ref<Asset>()> mFinish;
+		};
+
 	private:
 		std::filesystem::path mAssetRegistryPath;
 		AssetRegistry mAssetRegistry;
-		std::unordered_map<AssetHandle, Ref<Asset>> mLoadedAssets;
+		FlatHashMap<AssetHandle, Ref<Asset>> mLoadedAssets;
+		FlatHashMap<AssetHandle, Scope<PendingAsset>> mPendingAssets;
 	};
 }
 
@@ -22,6 +22,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <math.h>
 #include <iostream>
 #include <Scene/Components.hpp>
+#include <Assets/AssetMetaData.hpp>
 
 namespace Borealis
 {
@@ -42,14 +43,21 @@ namespace Borealis
         /*!***********************************************************************
         \brief
             Initializes the audio engine system.
+        \param bNoSound
+            Mixes without an output device, e.g. for headless runs.
         *************************************************************************/
-        static void Init();
+        static void Init(bool bNoSound = false);
 
         /*!***********************************************************************
         \brief
-            Updates the audio engine, managing the state of currently playing sounds.
+            Updates the audio engine once per frame. Pushes the listener and
+            the voice positions set since the last update to FMOD, culls 3D
+            voices out of range and brings them back when the listener gets
+            close, then updates FMOD.
+        \param dt
+            Time since the last update in seconds.
         *************************************************************************/
-        static void Update();
+        static void Update(float dt);
 
         /*!***********************************************************************
         \brief
@@ -71,6 +79,19 @@ namespace Borealis
         *************************************************************************/
         static Audio LoadAudio(const std::string& strAudioName, bool b3d = true, bool bLooping = false, bool bStream = false);
 
+        /*!***********************************************************************
+        \brief
+            Loads an imported audio file without blocking, with the load mode
+            from its import settings. Voices playing it start once it is ready.
+        \param strAudioName
+            The path of the imported audio file.
+        \param settings
+            The import settings of the asset.
+        \param b3d
+            Indicates whether the audio is 3D.
+        *************************************************************************/
+        static Audio LoadAudio(const std::string& strAudioName, const AudioImportSettings& settings, bool b3d = true);
+
         /*!***********************************************************************
         \brief
             Unloads a specific audio file from the engine.
@@ -81,13 +102,16 @@ namespace Borealis
 
         /*!***********************************************************************
         \brief
-            Sets the 3D listener's position and orientation.
+            Sets the 3D listener's position and orientation, applied on the
+            next Update.
         \param vPos
             The position of the listener.
-        \param fVolumedB
-            The volume in decibels for the listener.
+        \param vForward
+            The direction the listener faces.
+        \param vUp
+            The up direction of the listener.
         *************************************************************************/
-        static void Set3DListenerAndOrientation(const Vector3& vPos = Vector3{ 0, 0, 0 }, float fVolumedB = 0.0f);
+        static void Set3DListenerAndOrientation(const Vector3& vPos = Vector3{ 0, 0, 0 }, const Vector3& vForward = Vector3{ 0, 0, -1 }, const Vector3& vUp = Vector3{ 0, 1, 0 });
 
         /*!***********************************************************************
         \brief
@@ -103,12 +127,14 @@ namespace Borealis
         \param bLoop
             Whether the sound should loop.
         \return
-            The ID of the channel where the sound is played.
+            The handle of the voice playing the sound, -1 if it could not be
+            played. Handles of finished voices are never reused.
         *************************************************************************/
         static int PlayAudio(const AudioSourceComponent& audio, const Vector3& vPosition = Vector3{ 0, 0, 0 }, float fVolumedB = 5.0f, bool bMute = false, bool bLoop = false);
         /*!***********************************************************************
         \brief
-            Checks if a sound is playing on the specified channel.
+            Checks if a sound is playing on the specified channel. Voices
+            culled for distance still count as playing.
         \param nChannelId
             The ID of the channel to check.
         \return
@@ -132,7 +158,8 @@ namespace Borealis
 
         /*!***********************************************************************
         \brief
-            Sets the 3D position of the sound on the specified channel.
+            Sets the 3D position of the sound on the specified channel. The
+            positions are sent to FMOD together on the next Update.
         \param nChannelId
             The ID of the channel.
         \param vPosition
@@ -152,13 +179,11 @@ namespace Borealis
 
         /*!***********************************************************************
         \brief
-            Checks if a sound is currently playing on a specified channel.
-        \param nChannelId
-            The ID of the channel to check.
+            Gets the number of voices playing, real and culled.
         \return
-            True if the sound is playing, false otherwise.
+            The number of voices.
         *************************************************************************/
-        bool IsPlaying(int nChannelId) const;
+        static uint32_t GetVoiceCount();
 
         /*!***********************************************************************
         \brief
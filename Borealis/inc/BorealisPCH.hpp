@@ -14,8 +14,10 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 
 #ifndef BOREALIS_PCH_HPP
 #define BOREALIS_PCH_HPP
+#ifdef _WIN32
 #define NOMINMAX
 #include <Windows.h>
+#endif
 #include <iostream>
 #include <sstream>
 #include <algorithm>
@@ -17,6 +17,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 
 #include <Core/Core.hpp>
 #include <Core/WindowManager.hpp>
+#include <Graphics/RenderThread.hpp>
 #include <Core/EventSystem.hpp>
 #include <Core/LayerSystem.hpp>
 #include <Events/EventWindow.hpp>
@@ -27,6 +28,37 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 
 namespace Borealis {
 
+	class GraphicsContext;
+
+	/*!***********************************************************************
+		\brief
+			Properties of the application
+	*************************************************************************/
+	struct ApplicationProperties
+	{
+		std::string mName = "Borealis";
+		RenderThread::Policy mRenderPolicy = RenderThread::Policy::SingleThreaded;
+		bool mIsHeadless = false;		//!< Runs without a window, input, ImGui or graphics device
+		float mFixedTimestep = 0.f;		//!< Seconds per tick, 0 uses the measured frame time
+		bool mIsUnlocked = false;		//!< Ticks fixed steps back to back instead of pacing them in real time
+		uint64_t mMaxFrames = 0;		//!< Closes the application after this many frames, 0 runs until closed
+		std::string mRecordInputPath;	//!< Records the input of the session to this file, empty to not record
+		std::string mReplayInputPath;	//!< Replays a recorded session from this file instead of polling input, empty to not replay
+		std::string mTracePath;			//!< Writes the frames kept by the frame profiler as a Chrome trace on shutdown, empty to not write
+	}; // End of struct ApplicationProperties
+
+	/*!***********************************************************************
+		\brief
+			Command line arguments passed to the application
+	*************************************************************************/
+	struct ApplicationCommandLineArgs
+	{
+		int mCount = 0;
+		char** mArgs = nullptr;
+
+		const char* operator[](int index) const { return mArgs[index]; }
+	}; // End of struct ApplicationCommandLineArgs
+
 	/*!***********************************************************************
 		\brief
 			This class manages the application and the game loop
@@ -38,8 +70,20 @@ namespace Borealis {
 		/*!***********************************************************************
 			\brief
 				Constructor of the class. Initializes the application
+			\param[in] name
+				Name of the application
+			\param[in] renderPolicy
+				Whether rendering runs on a separate render thread
 		*************************************************************************/
-		ApplicationManager(const std::string& name = "Borealis");
+		ApplicationManager(const std::string& name = "Borealis", RenderThread::Policy renderPolicy = RenderThread::Policy::SingleThreaded);
+
+		/*!***********************************************************************
+			\brief
+				Constructor of the class. Initializes the application
+			\param[in] properties
+				Properties of the application, e.g. to run headless
+		*************************************************************************/
+		ApplicationManager(const ApplicationProperties& properties);
 
 		/*!***********************************************************************
 			\brief
@@ -107,6 +151,38 @@ namespace Borealis {
 		*************************************************************************/
 		ImGuiLayer* GetImGuiLayer() const { return mImGuiLayer; }
 
+		/*!***********************************************************************
+			\brief
+				Checks if the application runs without a window
+			\return
+				True if headless
+		*************************************************************************/
+		bool IsHeadless() const { return mProperties.mIsHeadless; }
+
+		/*!***********************************************************************
+			\brief
+				Gets the number of frames run so far
+			\return
+				Frame count
+		*************************************************************************/
+		uint64_t GetFrameCount() const { return mFrameCount; }
+
+		/*!***********************************************************************
+			\brief
+				Sets the code the process exits with, e.g. to fail a CI job
+			\param[in] exitCode
+				Exit code
+		*************************************************************************/
+		void SetExitCode(int exitCode) { mExitCode = exitCode; }
+
+		/*!***********************************************************************
+			\brief
+				Gets the code the process exits with
+			\return
+				Exit code
+		*************************************************************************/
+		int GetExitCode() const { return mExitCode; }
+
 	private:
 
 		/*!***********************************************************************
@@ -130,8 +206,12 @@ namespace Borealis {
 		bool WindowResizeHandler(EventWindowResize& e);
 		
 		LayerSystem mLayerSystem; //<! Layer system of the application
-		WindowManager* mWindowManager; //<! Pointer to the window manager
-		ImGuiLayer* mImGuiLayer; //<! Pointer to the ImGui layer
+		ApplicationProperties mProperties; //<! Properties the application was created with
+		WindowManager* mWindowManager = nullptr; //<! Pointer to the window manager, null when headless
+		ImGuiLayer* mImGuiLayer = nullptr; //<! Pointer to the ImGui layer, null when headless
+		Scope<GraphicsContext> mHeadlessContext; //<! Context handed to the render thread when headless
+		uint64_t mFrameCount = 0; //<! Number of frames run
+		int mExitCode = 0; //<! Code the process exits with
 		bool mIsRunning; //<! Flag to check if the application is running
 		bool mIsMinimized; //<! Flag to check if the application is minimized
 
@@ -144,10 +224,12 @@ namespace Borealis {
 			ApplicationManager. It is to be defined by the client after creating 
 			their own derived application by inheriting from the Application 
 			Manager class.
+		\param[in] args
+			Command line arguments
 		\return
 			Pointer to the ApplicationManager
 	*************************************************************************/
-	ApplicationManager* CreateApplication();
+	ApplicationManager* CreateApplication(ApplicationCommandLineArgs args);
 } // End of namespace Borealis
 
 #endif
\ No newline at end of file
@@ -26,7 +26,12 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #endif
 
 #ifdef _DEB
-	#define BOREALIS_DEBUGBREAK() __debugbreak()
+	#ifdef _WIN32
+		#define BOREALIS_DEBUGBREAK() __debugbreak()
+	#else
+		#include <csignal>
+		#define BOREALIS_DEBUGBREAK() std::raise(SIGTRAP)
+	#endif
 	#define BOREALIS_ENABLE_ASSERTS
 #else
 	#define BOREALIS_DEBUGBREAK()
@@ -25,16 +25,20 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 		BOREALIS_CORE_TRACE("Welcome to the Borealis");
 
 		PROFILE_START("Borealis Startup");
-		auto app = Borealis::CreateApplication();
+		auto app = Borealis::CreateApplication({ argc, argv });
 		PROFILE_END();
 
 		PROFILE_START("Borealis Runtime");
 		app->Run();
 		PROFILE_END();
 
+		int exitCode = app->GetExitCode();
+
 		PROFILE_START("Borealis Shutdown");
 		delete app;
 		PROFILE_END();
+
+		return exitCode;
 	}
 
 #endif
@@ -56,7 +56,7 @@ namespace Borealis {
 			Macro that defines the functions that are required for an event
 			to be used in the engine
 	*************************************************************************/
-	#define SET_EVENT_TYPE(type)			static EventType GetStaticType() { return EventType::##type; }\
+	#define SET_EVENT_TYPE(type)			static EventType GetStaticType() { return EventType::type; }\
 											virtual EventType GetEventType() const override { return GetStaticType(); }\
 											virtual const char* GetName() const override { return #type; }
 	#define SET_EVENT_CATEGORY(category)	virtual int GetCategoryFlags() const override { return category; }
@@ -106,8 +106,6 @@ namespace Borealis {
 	*************************************************************************/
 	class EventDispatcher
 	{
-		template <typename T>
-		using EventFn = std::function<bool(T&)>;
 	public:
 		/*!***********************************************************************
 			\brief
@@ -121,12 +119,13 @@ namespace Borealis {
 			\brief
 				Dispatches the event to the correct function
 			\param[in] func
-				The function to dispatch the event to
+				The function to dispatch the event to, called directly rather
+				than through a std::function
 			\return
 				True if the event was dispatched, false otherwise
 		*************************************************************************/
-		template <typename T>
-		bool Dispatch(EventFn<T> func)
+		template <typename T, typename Fn>
+		bool Dispatch(const Fn& func)
 		{
 			if (mEvent.GetEventType() == T::GetStaticType())
 			{
@@ -0,0 +1,595 @@
+/******************************************************************************/
+/*!
+\file		FlatHashMap.hpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Declares the engine flat hash map and set. Open addressing
+			tables that keep their elements in one array, with a byte of
+			control data per slot so a lookup checks 16 slots at once.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef FLAT_HASH_MAP_HPP
+#define FLAT_HASH_MAP_HPP
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BOREALIS_FLAT_HASH_SSE2 1
+#include <emmintrin.h>
+#else
+#define BOREALIS_FLAT_HASH_SSE2 0
+#endif
+
+namespace Borealis
+{
+	/*!***********************************************************************
+		\brief
+			Transparent string hash. String keyed tables using it with
+			std::equal_to<> look up string_views and literals without
+			building a std::string.
+	*************************************************************************/
+	struct StringHash
+	{
+		using is_transparent = void;
+		size_t operator()(std::string_view value) const { return std::hash<std::string_view>{}(value); }
+	};
+
+	namespace FlatHashDetail
+	{
+		using Control = int8_t;
+		constexpr Control Empty = -128;		// Never used, ends a probe
+		constexpr Control Deleted = -2;		// Erased, a probe carries on past it
+		constexpr size_t GroupWidth = 16;	// Slots matched at once
+		constexpr size_t MinCapacity = GroupWidth;
+
+		/*!***********************************************************************
+			\brief
+				Control bytes of a group of slots. A full slot holds the low 7
+				bits of its hash, so matching a hash is one compare of the group.
+		*************************************************************************/
+		class Group
+		{
+		public:
+#if BOREALIS_FLAT_HASH_SSE2
+			explicit Group(const Control* control) : mControl(_mm_load_si128(reinterpret_cast<const __m128i*>(control))) {}
+
+			uint32_t Match(Control hash) const { return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(hash), mControl))); }
+			uint32_t MatchEmpty() const { return Match(Empty); }
+			uint32_t MatchFree() const { return static_cast<uint32_t>(_mm_movemask_epi8(mControl)); } // Empty and deleted have the sign bit set
+
+		private:
+			__m128i mControl;
+#else
+			explicit Group(const Control* control) : mControl(control) {}
+
+			uint32_t Match(Control hash) const
+			{
+				uint32_t mask = 0;
+				for (uint32_t i = 0; i < GroupWidth; ++i)
+					mask |= static_cast<uint32_t>(mControl[i] == hash) << i;
+				return mask;
+			}
+			uint32_t MatchEmpty() const { return Match(Empty); }
+			uint32_t MatchFree() const
+			{
+				uint32_t mask = 0;
+				for (uint32_t i = 0; i < GroupWidth; ++i)
+					mask |= static_cast<uint32_t>(mControl[i] < 0) << i;
+				return mask;
+			}
+
+		private:
+			const Control* mControl;
+#endif
+		};
+
+		inline uint32_t LowestBit(uint32_t mask)
+		{
+			return static_cast<uint32_t>(std::countr_zero(mask));
+		}
+
+		// Spreads the hash over every bit, std::hash of an integer is the identity on some standard libraries
+		inline uint64_t Mix(size_t hash)
+		{
+			uint64_t mixed = static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15ull;
+			return mixed ^ (mixed >> 32);
+		}
+
+		template <typename Hash, typename Equal>
+		concept Transparent = requires { typename Hash::is_transparent; typename Equal::is_transparent; };
+
+		struct PairKey
+		{
+			template <typename Pair>
+			static const auto& Get(const Pair& pair) { return pair.first; }
+		};
+
+		struct SelfKey
+		{
+			template <typename Key>
+			static const Key& Get(const Key& key) { return key; }
+		};
+
+		/*!***********************************************************************
+			\brief
+				Table shared by the map and the set. Slots are probed a group
+				at a time, visiting every group once in a power of two table.
+				Elements move when the table grows, so references and
+				iterators are only valid until the next insertion.
+		*************************************************************************/
+		template <typename Key, typename Slot, typename KeyOf, typename Hash, typename Equal>
+		class Table
+		{
+		public:
+			using key_type = Key;
+			using value_type = Slot;
+			using size_type = size_t;
+			using hasher = Hash;
+			using key_equal = Equal;
+
+			template <bool IsConst>
+			class Iterator
+			{
+			public:
+				using iterator_category = std::forward_iterator_tag;
+				using value_type = Slot;
+				using difference_type = std::ptrdiff_t;
+				using pointer = std::conditional_t<IsConst, const Slot*, Slot*>;
+				using reference = std::conditional_t<IsConst, const Slot&, Slot&>;
+
+				Iterator() = default;
+				template <bool Const = IsConst> requires Const
+				Iterator(const Iterator<false>& other) : mControl(other.mControl), mSlot(other.mSlot), mEnd(other.mEnd) {}
+
+				reference operator*() const { return *mSlot; }
+				pointer operator->() const { return mSlot; }
+
+				Iterator& operator++()
+				{
+					++mControl;
+					++mSlot;
+					SkipFree();
+					return *this;
+				}
+
+				Iterator operator++(int)
+				{
+					Iterator previous = *this;
+					++*this;
+					return previous;
+				}
+
+				bool operator==(const Iterator& other) const { return mSlot == other.mSlot; }
+
+			private:
+				friend class Table;
+				template <bool> friend class Iterator;
+
+				Iterator(const Control* control, pointer slot, const Control* end) : mControl(control), mSlot(slot), mEnd(end) { SkipFree(); }
+
+				void SkipFree()
+				{
+					while (mControl != mEnd && *mControl < 0)
+					{
+						++mControl;
+						++mSlot;
+					}
+				}
+
+				const Control* mControl = nullptr;
+				pointer mSlot = nullptr;
+				const Control* mEnd = nullptr;
+			};
+
+			using iterator = Iterator<false>;
+			using const_iterator = Iterator<true>;
+
+			Table() = default;
+
+			Table(const Table& other) : mHash(other.mHash), mEqual(other.mEqual)
+			{
+				reserve(other.mSize);
+				for (const Slot& slot : other)
+					InsertUnique(slot);
+			}
+
+			Table(Table&& other) noexcept { Swap(other); }
+
+			Table& operator=(const Table& other)
+			{
+				if (this != &other)
+				{
+					Table copy(other);
+					Swap(copy);
+				}
+				return *this;
+			}
+
+			Table& operator=(Table&& other) noexcept
+			{
+				if (this != &other)
+				{
+					Table moved(std::move(other));
+					Swap(moved);
+				}
+				return *this;
+			}
+
+			~Table() { Release(); }
+
+			iterator begin() { return iterator(mControl, mSlots, mControl + mCapacity); }
+			iterator end() { return iterator(mControl + mCapacity, mSlots + mCapacity, mControl + mCapacity); }
+			const_iterator begin() const { return const_iterator(mControl, mSlots, mControl + mCapacity); }
+			const_iterator end() const { return const_iterator(mControl + mCapacity, mSlots + mCapacity, mControl + mCapacity); }
+			const_iterator cbegin() const { return begin(); }
+			const_iterator cend() const { return end(); }
+
+			size_type size() const { return mSize; }
+			bool empty() const { return mSize == 0; }
+			size_type capacity() const { return mCapacity; }
+
+			void clear()
+			{
+				if (!mCapacity)
+					return;
+
+				DestroySlots();
+				std::fill_n(mControl, mCapacity, Empty);
+				mSize = 0;
+				mGrowthLeft = MaxLoad(mCapacity);
+			}
+
+			/*!***********************************************************************
+				\brief
+					Makes room for a number of elements without growing
+			*************************************************************************/
+			void reserve(size_type count)
+			{
+				if (!count)
+					return;
+
+				size_type capacity = MinCapacity;
+				while (MaxLoad(capacity) < count)
+					capacity *= 2;
+				if (capacity > mCapacity)
+					Rehash(capacity);
+			}
+
+			template <typename K> requires std::is_convertible_v<const K&, const Key&> || Transparent<Hash, Equal>
+			iterator find(const K& key)
+			{
+				size_type index = Find(key);
+				return index == mCapacity ? end() : iterator(mControl + index, mSlots + index, mControl + mCapacity);
+			}
+
+			template <typename K> requires std::is_convertible_v<const K&, const Key&> || Transparent<Hash, Equal>
+			const_iterator find(const K& key) const
+			{
+				size_type index = Find(key);
+				return index == mCapacity ? end() : const_iterator(mControl + index, mSlots + index, mControl + mCapacity);
+			}
+
+			iterator find(const Key& key) { return find<Key>(key); }
+			const_iterator find(const Key& key) const { return find<Key>(key); }
+
+			template <typename K> requires std::is_convertible_v<const K&, const Key&> || Transparent<Hash, Equal>
+			bool contains(const K& key) const { return Find(key) != mCapacity; }
+			bool contains(const Key& key) const { return Find(key) != mCapacity; }
+
+			template <typename K> requires std::is_convertible_v<const K&, const Key&> || Transparent<Hash, Equal>
+			size_type count(const K& key) const { return contains(key) ? 1 : 0; }
+			size_type count(const Key& key) const { return contains(key) ? 1 : 0; }
+
+			std::pair<iterator, bool> insert(const Slot& slot) { return emplace(slot); }
+			std::pair<iterator, bool> insert(Slot&& slot) { return emplace(std::move(slot)); }
+
+			template <typename... Args>
+			std::pair<iterator, bool> emplace(Args&&... args)
+			{
+				// The key has to be known before the slot is found, so the element is built first
+				Slot slot(std::forward<Args>(args)...);
+				auto [index, inserted] = FindOrPrepareInsert(KeyOf::Get(slot));
+				if (inserted)
+					new (mSlots + index) Slot(std::move(slot));
+				return { iterator(mControl + index, mSlots + index, mControl + mCapacity), inserted };
+			}
+
+			template <typename K> requires std::is_convertible_v<const K&, const Key&> || Transparent<Hash, Equal>
+			size_type erase(const K& key)
+			{
+				size_type index = Find(key);
+				if (index == mCapacity)
+					return 0;
+				EraseAt(index);
+				return 1;
+			}
+			size_type erase(const Key& key) { return erase<Key>(key); }
+
+			iterator erase(const_iterator position)
+			{
+				size_type index = static_cast<size_type>(position.mSlot - mSlots);
+				EraseAt(index);
+				return iterator(mControl + index + 1, mSlots + index + 1, mControl + mCapacity);
+			}
+			iterator erase(iterator position) { return erase(const_iterator(position)); }
+
+			hasher hash_function() const { return mHash; }
+			key_equal key_eq() const { return mEqual; }
+
+		protected:
+			/*!***********************************************************************
+				\brief
+					Finds the slot of a key, preparing a free slot if it is not in
+					the table. The caller constructs the element in a new slot.
+				\return
+					Index of the slot, and whether it is new
+			*************************************************************************/
+			template <typename K>
+			std::pair<size_type, bool> FindOrPrepareInsert(const K& key)
+			{
+				size_type index = Find(key);
+				if (index != mCapacity)
+					return { index, false };
+
+				if (!mGrowthLeft)
+				{
+					// Tombstones count against growth, so a table full of them is rebuilt at its own size
+					Rehash(mSize * 2 < MaxLoad(mCapacity) ? mCapacity : std::max(mCapacity * 2, MinCapacity));
+				}
+
+				uint64_t hash = Mix(mHash(key));
+				index = FindFree(hash);
+				if (mControl[index] == Empty)
+					--mGrowthLeft;
+				mControl[index] = static_cast<Control>(hash & 0x7F);
+				++mSize;
+				return { index, true };
+			}
+
+			Slot* GetSlot(size_type index) { return mSlots + index; }
+			iterator MakeIterator(size_type index) { return iterator(mControl + index, mSlots + index, mControl + mCapacity); }
+
+		private:
+			static size_type MaxLoad(size_type capacity) { return capacity - capacity / 8; }
+
+			template <typename K>
+			size_type Find(const K& key) const
+			{
+				if (!mSize)
+					return mCapacity;
+
+				uint64_t hash = Mix(mHash(key));
+				Control h2 = static_cast<Control>(hash & 0x7F);
+				size_type groupMask = mCapacity / GroupWidth - 1;
+				size_type group = static_cast<size_type>(hash >> 7) & groupMask;
+				for (size_type step = 1;; ++step)
+				{
+					size_type base = group * GroupWidth;
+					Group controls(mControl + base);
+					for (uint32_t match = controls.Match(h2); match; match &= match - 1)
+					{
+						size_type index = base + LowestBit(match);
+						if (mEqual(KeyOf::Get(mSlots[index]), key))
+							return index;
+					}
+					if (controls.MatchEmpty() || step > groupMask)
+						return mCapacity;
+					group = (group + step) & groupMask;
+				}
+			}
+
+			size_type FindFree(uint64_t hash) const
+			{
+				size_type groupMask = mCapacity / GroupWidth - 1;
+				size_type group = static_cast<size_type>(hash >> 7) & groupMask;
+				for (size_type step = 1;; ++step)
+				{
+					uint32_t free = Group(mControl + group * GroupWidth).MatchFree();
+					if (free)
+						return group * GroupWidth + LowestBit(free);
+					group = (group + step) & groupMask;
+				}
+			}
+
+			// Inserts an element known not to be in the table, into a table with room for it
+			template <typename S>
+			void InsertUnique(S&& slot)
+			{
+				uint64_t hash = Mix(mHash(KeyOf::Get(slot)));
+				size_type index = FindFree(hash);
+				mControl[index] = static_cast<Control>(hash & 0x7F);
+				new (mSlots + index) Slot(std::forward<S>(slot));
+				--mGrowthLeft;
+				++mSize;
+			}
+
+			void EraseAt(size_type index)
+			{
+				mSlots[index].~Slot();
+				--mSize;
+
+				// Probes stop at a group with an empty slot, so none can pass through this one
+				size_type base = index / GroupWidth * GroupWidth;
+				if (Group(mControl + base).MatchEmpty())
+				{
+					mControl[index] = Empty;
+					++mGrowthLeft;
+				}
+				else
+				{
+					mControl[index] = Deleted;
+				}
+			}
+
+			void Rehash(size_type capacity)
+			{
+				Control* oldControl = mControl;
+				Slot* oldSlots = mSlots;
+				size_type oldCapacity = mCapacity;
+
+				mControl = static_cast<Control*>(::operator new(capacity, std::align_val_t(GroupWidth)));
+				mSlots = std::allocator<Slot>().allocate(capacity);
+				mCapacity = capacity;
+				std::fill_n(mControl, capacity, Empty);
+				mGrowthLeft = MaxLoad(capacity);
+				mSize = 0;
+
+				for (size_type i = 0; i < oldCapacity; ++i)
+				{
+					if (oldControl[i] >= 0)
+					{
+						InsertUnique(std::move(oldSlots[i]));
+						oldSlots[i].~Slot();
+					}
+				}
+
+				if (oldCapacity)
+				{
+					::operator delete(oldControl, std::align_val_t(GroupWidth));
+					std::allocator<Slot>().deallocate(oldSlots, oldCapacity);
+				}
+			}
+
+			void DestroySlots()
+			{
+				if constexpr (!std::is_trivially_destructible_v<Slot>)
+				{
+					for (size_type i = 0; i < mCapacity; ++i)
+					{
+						if (mControl[i] >= 0)
+							mSlots[i].~Slot();
+					}
+				}
+			}
+
+			void Release()
+			{
+				if (!mCapacity)
+					return;
+
+				DestroySlots();
+				::operator delete(mControl, std::align_val_t(GroupWidth));
+				std::allocator<Slot>().deallocate(mSlots, mCapacity);
+				mControl = nullptr;
+				mSlots = nullptr;
+				mCapacity = mSize = mGrowthLeft = 0;
+			}
+
+			void Swap(Table& other) noexcept
+			{
+				std::swap(mControl, other.mControl);
+				std::swap(mSlots, other.mSlots);
+				std::swap(mCapacity, other.mCapacity);
+				std::swap(mSize, other.mSize);
+				std::swap(mGrowthLeft, other.mGrowthLeft);
+				std::swap(mHash, other.mHash);
+				std::swap(mEqual, other.mEqual);
+			}
+
+			Control* mControl = nullptr;
+			Slot* mSlots = nullptr;
+			size_type mCapacity = 0;
+			size_type mSize = 0;
+			size_type mGrowthLeft = 0;	// Empty slots that can be filled before the table grows
+			[[no_unique_address]] Hash mHash;
+			[[no_unique_address]] Equal mEqual;
+		};
+	}
+
+	/*!***********************************************************************
+		\brief
+			Flat hash map. Drop in for std::unordered_map on lookup heavy
+			paths, except that elements move when the table grows. With a
+			transparent hash and std::equal_to<>, lookups take any type the
+			key compares with, such as string_view for string keys.
+	*************************************************************************/
+	template <typename Key, typename Value, typename Hash = std::hash<Key>, typename Equal = std::equal_to<Key>>
+	class FlatHashMap : public FlatHashDetail::Table<Key, std::pair<Key, Value>, FlatHashDetail::PairKey, Hash, Equal>
+	{
+		using Base = FlatHashDetail::Table<Key, std::pair<Key, Value>, FlatHashDetail::PairKey, Hash, Equal>;
+
+	public:
+		using mapped_type = Value;
+		using typename Base::iterator;
+		using typename Base::const_iterator;
+		using Base::Base;
+
+		FlatHashMap() = default;
+		FlatHashMap(std::initializer_list<std::pair<Key, Value>> values)
+		{
+			this->reserve(values.size());
+			for (const auto& value : values)
+				this->insert(value);
+		}
+
+		template <typename K, typename... Args>
+		std::pair<iterator, bool> try_emplace(K&& key, Args&&... args)
+		{
+			auto [index, inserted] = this->FindOrPrepareInsert(key);
+			if (inserted)
+				new (this->GetSlot(index)) std::pair<Key, Value>(std::piecewise_construct, std::forward_as_tuple(std::forward<K>(key)), std::forward_as_tuple(std::forward<Args>(args)...));
+			return { this->MakeIterator(index), inserted };
+		}
+
+		Value& operator[](const Key& key) { return try_emplace(key).first->second; }
+		Value& operator[](Key&& key) { return try_emplace(std::move(key)).first->second; }
+
+		template <typename K> requires FlatHashDetail::Transparent<Hash, Equal>
+		Value& at(const K& key) { return At(*this, key); }
+		template <typename K> requires FlatHashDetail::Transparent<Hash, Equal>
+		const Value& at(const K& key) const { return At(*this, key); }
+		Value& at(const Key& key) { return At(*this, key); }
+		const Value& at(const Key& key) const { return At(*this, key); }
+
+	private:
+		template <typename Self, typename K>
+		static auto& At(Self& self, const K& key)
+		{
+			auto it = self.find(key);
+			if (it == self.end())
+				throw std::out_of_range("FlatHashMap::at");
+			return it->second;
+		}
+	};
+
+	/*!***********************************************************************
+		\brief
+			Flat hash set, the keys only counterpart of FlatHashMap
+	*************************************************************************/
+	template <typename Key, typename Hash = std::hash<Key>, typename Equal = std::equal_to<Key>>
+	class FlatHashSet : public FlatHashDetail::Table<Key, Key, FlatHashDetail::SelfKey, Hash, Equal>
+	{
+		using Base = FlatHashDetail::Table<Key, Key, FlatHashDetail::SelfKey, Hash, Equal>;
+
+	public:
+		using Base::Base;
+
+		FlatHashSet() = default;
+		FlatHashSet(std::initializer_list<Key> keys)
+		{
+			this->reserve(keys.size());
+			for (const Key& key : keys)
+				this->insert(key);
+		}
+	};
+}
+
+#endif
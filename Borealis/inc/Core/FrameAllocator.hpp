@@ -0,0 +1,317 @@
+/******************************************************************************/
+/*!
+\file		FrameAllocator.hpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Declares the linear allocators used for short lived memory. The
+			frame allocator hands out memory that lives for two frames, and
+			each thread has a scratch arena that is rewound at the end of a
+			ScratchScope. Both come with STL allocator adaptors.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef FRAME_ALLOCATOR_HPP
+#define FRAME_ALLOCATOR_HPP
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace Borealis
+{
+	/*!***********************************************************************
+		\brief
+			Bump allocator over a single block. Allocate may be called from any
+			thread. When the block runs out, allocations fall back to the heap
+			and the block grows to the high water mark on the next full rewind,
+			so a steady workload stops touching the heap after a few frames.
+	*************************************************************************/
+	class LinearAllocator
+	{
+	public:
+		/*!***********************************************************************
+			\brief
+				Position to rewind to
+		*************************************************************************/
+		struct Marker
+		{
+			size_t mOffset = 0;
+			size_t mOverflowCount = 0;
+		};
+
+		/*!***********************************************************************
+			\brief
+				Constructor for the allocator
+			\param[in] capacity
+				Initial size of the block in bytes
+		*************************************************************************/
+		explicit LinearAllocator(size_t capacity);
+
+		/*!***********************************************************************
+			\brief
+				Destructor, frees the block and any heap fallbacks
+		*************************************************************************/
+		~LinearAllocator();
+
+		LinearAllocator(const LinearAllocator&) = delete;
+		LinearAllocator& operator=(const LinearAllocator&) = delete;
+
+		/*!***********************************************************************
+			\brief
+				Allocates memory that lives until the allocator is rewound past it
+			\param[in] size
+				Bytes to allocate
+			\param[in] alignment
+				Alignment, a power of two
+			\return
+				The memory
+		*************************************************************************/
+		void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+		/*!***********************************************************************
+			\brief
+				Gets the current position, to rewind to later
+			\return
+				The position
+		*************************************************************************/
+		Marker GetMarker() const;
+
+		/*!***********************************************************************
+			\brief
+				Frees everything allocated after a marker. Must not race with
+				Allocate.
+			\param[in] marker
+				Position to rewind to, an empty marker rewinds everything
+		*************************************************************************/
+		void Rewind(Marker marker);
+
+		/*!***********************************************************************
+			\brief
+				Frees everything. Must not race with Allocate.
+		*************************************************************************/
+		void Reset() { Rewind({}); }
+
+		/*!***********************************************************************
+			\brief
+				Gets the bytes in use, including heap fallbacks
+			\return
+				Bytes in use
+		*************************************************************************/
+		size_t GetUsedBytes() const;
+
+		size_t GetCapacity() const { return mCapacity; }
+
+	private:
+		void* AllocateOverflow(size_t size, size_t alignment);
+
+		uint8_t* mBuffer = nullptr;
+		size_t mCapacity = 0;
+		std::atomic<size_t> mOffset = 0;
+		size_t mPeak = 0;						//!< Most bytes used since the last full rewind
+
+		std::mutex mOverflowMutex;
+		std::vector<void*> mOverflow;			//!< Heap blocks handed out once the block was full
+		std::atomic<size_t> mOverflowBytes = 0;
+	};
+
+	/*!***********************************************************************
+		\brief
+			Double buffered linear allocator for data that has to outlive the
+			frame that made it, e.g. render commands the render thread runs a
+			frame later. Memory allocated in frame N is valid until frame N + 2
+			starts.
+	*************************************************************************/
+	class FrameAllocator
+	{
+	public:
+		/*!***********************************************************************
+			\brief
+				Creates the two frame buffers
+			\param[in] capacity
+				Initial size of each buffer in bytes
+		*************************************************************************/
+		static void Init(size_t capacity = 4 * 1024 * 1024);
+
+		/*!***********************************************************************
+			\brief
+				Frees the frame buffers
+		*************************************************************************/
+		static void Free();
+
+		/*!***********************************************************************
+			\brief
+				Switches to the other buffer and rewinds it. Called once at the
+				top of the frame loop.
+		*************************************************************************/
+		static void NewFrame();
+
+		/*!***********************************************************************
+			\brief
+				Allocates memory for the current frame. Thread safe.
+			\param[in] size
+				Bytes to allocate
+			\param[in] alignment
+				Alignment, a power of two
+			\return
+				The memory
+		*************************************************************************/
+		static void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+		/*!***********************************************************************
+			\brief
+				Constructs an object in frame memory. Destructors are never run,
+				so only trivially destructible types are allowed.
+			\param[in] args
+				Constructor arguments
+			\return
+				The object
+		*************************************************************************/
+		template <typename T, typename... Args>
+		static T* New(Args&&... args)
+		{
+			static_assert(std::is_trivially_destructible_v<T>, "Frame allocated objects are never destroyed");
+			return new (Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+		}
+
+		/*!***********************************************************************
+			\brief
+				Allocates an uninitialised array in frame memory, for trivial
+				types that are written before they are read
+			\param[in] count
+				Number of elements
+			\return
+				The first element
+		*************************************************************************/
+		template <typename T>
+		static T* NewArray(size_t count)
+		{
+			static_assert(std::is_trivially_destructible_v<T>, "Frame allocated objects are never destroyed");
+			return static_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+		}
+
+		/*!***********************************************************************
+			\brief
+				Copies a string into frame memory
+			\param[in] string
+				String to copy
+			\return
+				View of the copy, null terminated
+		*************************************************************************/
+		static std::string_view CopyString(std::string_view string);
+
+		/*!***********************************************************************
+			\brief
+				Gets the bytes allocated in the current frame
+			\return
+				Bytes in use
+		*************************************************************************/
+		static size_t GetUsedBytes();
+	};
+
+	/*!***********************************************************************
+		\brief
+			Per thread arena for temporaries that do not leave a function
+	*************************************************************************/
+	class ScratchAllocator
+	{
+	public:
+		/*!***********************************************************************
+			\brief
+				Gets the arena of the calling thread, creating it on first use
+			\return
+				The arena
+		*************************************************************************/
+		static LinearAllocator& Get();
+	};
+
+	/*!***********************************************************************
+		\brief
+			Rewinds the scratch arena of the calling thread to where it was
+			when the scope was opened. Scratch containers must be destroyed
+			before their scope ends.
+	*************************************************************************/
+	class ScratchScope
+	{
+	public:
+		ScratchScope() : mArena(ScratchAllocator::Get()), mMarker(mArena.GetMarker()) {}
+		~ScratchScope() { mArena.Rewind(mMarker); }
+
+		ScratchScope(const ScratchScope&) = delete;
+		ScratchScope& operator=(const ScratchScope&) = delete;
+
+	private:
+		LinearAllocator& mArena;
+		LinearAllocator::Marker mMarker;
+	};
+
+	/*!***********************************************************************
+		\brief
+			STL allocator over the frame allocator. Deallocation is a no-op,
+			the memory is reclaimed two frames later.
+	*************************************************************************/
+	template <typename T>
+	class FrameStlAllocator
+	{
+	public:
+		using value_type = T;
+
+		FrameStlAllocator() = default;
+		template <typename U>
+		FrameStlAllocator(const FrameStlAllocator<U>&) {}
+
+		T* allocate(size_t count) { return static_cast<T*>(FrameAllocator::Allocate(count * sizeof(T), alignof(T))); }
+		void deallocate(T*, size_t) {}
+
+		template <typename U>
+		bool operator==(const FrameStlAllocator<U>&) const { return true; }
+	};
+
+	/*!***********************************************************************
+		\brief
+			STL allocator over the scratch arena of the thread that made it.
+			Deallocation is a no-op, the memory is reclaimed when the enclosing
+			ScratchScope ends.
+	*************************************************************************/
+	template <typename T>
+	class ScratchStlAllocator
+	{
+	public:
+		using value_type = T;
+
+		ScratchStlAllocator() : mArena(&ScratchAllocator::Get()) {}
+		template <typename U>
+		ScratchStlAllocator(const ScratchStlAllocator<U>& other) : mArena(other.mArena) {}
+
+		T* allocate(size_t count) { return static_cast<T*>(mArena->Allocate(count * sizeof(T), alignof(T))); }
+		void deallocate(T*, size_t) {}
+
+		template <typename U>
+		bool operator==(const ScratchStlAllocator<U>& other) const { return mArena == other.mArena; }
+
+	private:
+		template <typename U>
+		friend class ScratchStlAllocator;
+
+		LinearAllocator* mArena;
+	};
+
+	template <typename T>
+	using FrameVector = std::vector<T, FrameStlAllocator<T>>;
+
+	template <typename T>
+	using ScratchVector = std::vector<T, ScratchStlAllocator<T>>;
+
+	using ScratchString = std::basic_string<char, std::char_traits<char>, ScratchStlAllocator<char>>;
+}
+
+#endif
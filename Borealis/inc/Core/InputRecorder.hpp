@@ -0,0 +1,158 @@
+/******************************************************************************/
+/*!
+\file		InputRecorder.hpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Declares the input recorder, which writes a play session to a
+			binary log and replays it through the InputSystem
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef INPUT_RECORDER_HPP
+#define INPUT_RECORDER_HPP
+#include <fstream>
+#include <string>
+#include <vector>
+#include <Core/Core.hpp>
+#include <Core/InputSystem.hpp>
+
+namespace Borealis
+{
+	/*!***********************************************************************
+		\brief
+			Input received from the window, as passed to the GLFW callbacks
+	*************************************************************************/
+	struct InputEvent
+	{
+		enum class Type : uint8_t
+		{
+			Key,
+			Char,
+			MouseButton,
+			Scroll,
+			CursorPos
+		};
+
+		Type mType;
+		int32_t mCode = 0;		//!< Key, character or mouse button
+		int32_t mScancode = 0;
+		int32_t mAction = 0;	//!< GLFW_PRESS, GLFW_RELEASE or GLFW_REPEAT
+		int32_t mMods = 0;		//!< GLFW_MOD_* flags held
+		double mX = 0.0;		//!< Cursor position or scroll offset
+		double mY = 0.0;
+	};
+
+	/*!***********************************************************************
+		\brief
+			Records and replays input sessions. The log stores the seed of the
+			UUID generator followed by one record per frame holding the frame
+			dt, only the key, mouse and scroll state that changed since the
+			previous frame, and the window events received since then.
+	*************************************************************************/
+	class InputRecorder
+	{
+	public:
+		/*!***********************************************************************
+			\brief
+				Starts writing a log and reseeds the UUID generator
+			\param[in] path
+				File to write
+			\param[in] seed
+				Seed for the UUID generator, stored in the log
+			\return
+				True if the file could be opened
+		*************************************************************************/
+		static bool StartRecording(const std::string& path, uint64_t seed);
+
+		/*!***********************************************************************
+			\brief
+				Opens a log for replay and reseeds the UUID generator with its
+				recorded seed
+			\param[in] path
+				File to read
+			\return
+				True if the file is a valid log
+		*************************************************************************/
+		static bool StartReplay(const std::string& path);
+
+		/*!***********************************************************************
+			\brief
+				Finishes the recording or replay and closes the log
+		*************************************************************************/
+		static void Stop();
+
+		/*!***********************************************************************
+			\brief
+				Appends the current InputSystem state to the log. Called after
+				the input is polled each frame.
+			\param[in] dt
+				Delta time of the frame
+		*************************************************************************/
+		static void RecordFrame(float dt);
+
+		/*!***********************************************************************
+			\brief
+				Applies the next recorded frame to the InputSystem in place of
+				polling the window
+			\param[out] dt
+				Recorded delta time of the frame
+			\return
+				False once the log has no frames left
+		*************************************************************************/
+		static bool ReplayFrame(float& dt);
+
+		/*!***********************************************************************
+			\brief
+				Adds a window event to the frame being recorded. Events arrive
+				while the window is polled at the end of a frame, and are
+				written with the next frame, which is the first to see them.
+			\param[in] event
+				Event received
+		*************************************************************************/
+		static void RecordEvent(const InputEvent& event);
+
+		/*!***********************************************************************
+			\brief
+				Gets the window events of the frame replayed last, to dispatch
+				in place of the live ones
+			\return
+				Events in the order they were received
+		*************************************************************************/
+		static const std::vector<InputEvent>& GetReplayedEvents() { return sEvents; }
+
+		static bool IsRecording() { return sMode == Mode::Recording; }
+		static bool IsReplaying() { return sMode == Mode::Replaying; }
+
+		/*!***********************************************************************
+			\brief
+				Gets the number of frames recorded or replayed so far
+			\return
+				Frame count
+		*************************************************************************/
+		static uint32_t GetFrameCount() { return sFrameCount; }
+
+	private:
+		enum class Mode
+		{
+			None,
+			Recording,
+			Replaying
+		};
+
+		static Mode sMode;
+		static std::fstream sFile;
+		static uint32_t sFrameCount;
+		static float sPrevDt;
+		static float sPrevMouseX;
+		static float sPrevMouseY;
+		static uint16_t sPrevKeys[InputSystem::KeyStateCount];
+		static std::vector<InputEvent> sEvents; //!< Events waiting to be recorded, or the events replayed last
+	};
+}
+
+#endif
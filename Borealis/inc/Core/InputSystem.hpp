@@ -49,7 +49,7 @@ namespace Borealis
 
 		/*!***********************************************************************
 			\brief
-				Get the current mouse position
+				Get the mouse position polled at the start of the frame
 			\return
 				Pair of x and y floats of the mouse position
 		*************************************************************************/
@@ -79,11 +79,16 @@ namespace Borealis
 
 		static void ResetScroll() { ScrollY = 0; }
 
+		static constexpr int KeyStateCount = 349; //!< Size of the key state tables, covers every key and mouse button code
+
 	private:
+		friend class InputRecorder;
 
 		static double ScrollY;
-		static uint16_t KeyCurrentState[349];
-		static uint16_t KeyPrevState[349];
+		static float MouseX;
+		static float MouseY;
+		static uint16_t KeyCurrentState[KeyStateCount];
+		static uint16_t KeyPrevState[KeyStateCount];
 	};
 
 } // End of namespace Borealis
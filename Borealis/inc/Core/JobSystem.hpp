@@ -0,0 +1,124 @@
+/******************************************************************************/
+/*!
+\file		JobSystem.hpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Declares the engine wide work stealing job system
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef JOB_SYSTEM_HPP
+#define JOB_SYSTEM_HPP
+#include <atomic>
+#include <functional>
+#include <Core/Core.hpp>
+
+namespace Borealis
+{
+	/*!***********************************************************************
+		\brief
+			Counter that tracks a group of submitted jobs. Reaches zero once
+			every job submitted against it has finished.
+	*************************************************************************/
+	struct JobCounter
+	{
+		std::atomic<uint32_t> mPending = 0; //!< Number of unfinished jobs
+
+		bool IsDone() const { return mPending.load(std::memory_order_acquire) == 0; }
+	};
+
+	class JobSystem
+	{
+	public:
+		using JobFn = std::function<void()>;
+		using RangeFn = std::function<void(uint32_t begin, uint32_t end)>;
+
+		/*!***********************************************************************
+			\brief
+				Starts the worker threads. The calling thread is registered as the
+				main thread and takes part in work stealing while waiting.
+			\param[in] workerCount
+				Number of worker threads, 0 uses hardware concurrency - 1
+		*************************************************************************/
+		static void Init(uint32_t workerCount = 0);
+
+		/*!***********************************************************************
+			\brief
+				Drains outstanding jobs and joins the worker threads
+		*************************************************************************/
+		static void Free();
+
+		/*!***********************************************************************
+			\brief
+				Queues a job on the calling thread's deque. Safe to call from any
+				thread, including from inside a running job.
+			\param[in] job
+				Function to run
+			\param[in] counter
+				Optional counter, incremented now and decremented when done
+		*************************************************************************/
+		static void Submit(JobFn job, JobCounter* counter = nullptr);
+
+		/*!***********************************************************************
+			\brief
+				Blocks until the counter reaches zero, executing queued jobs on the
+				calling thread in the meantime
+			\param[in] counter
+				Counter to wait on
+		*************************************************************************/
+		static void Wait(JobCounter& counter);
+
+		/*!***********************************************************************
+			\brief
+				Splits [0, count) into chunks of grainSize and runs them across the
+				workers. Returns once every chunk has finished. The calling thread
+				runs the first chunk itself.
+			\param[in] count
+				Number of elements
+			\param[in] grainSize
+				Elements per job
+			\param[in] fn
+				Function called with each [begin, end) chunk
+		*************************************************************************/
+		static void ParallelFor(uint32_t count, uint32_t grainSize, const RangeFn& fn);
+
+		/*!***********************************************************************
+			\brief
+				Pops or steals a single job and runs it on the calling thread
+			\return
+				True if a job was executed
+		*************************************************************************/
+		static bool RunPendingJob();
+
+		/*!***********************************************************************
+			\brief
+				Gets the number of worker threads, excluding the main thread
+			\return
+				Worker thread count
+		*************************************************************************/
+		static uint32_t GetWorkerCount();
+
+		/*!***********************************************************************
+			\brief
+				Gets the index of the calling thread, 0 being the main thread
+			\return
+				Thread index
+		*************************************************************************/
+		static uint32_t GetThreadIndex();
+
+		/*!***********************************************************************
+			\brief
+				Checks if the job system has been initialised
+			\return
+				True if the workers are running
+		*************************************************************************/
+		static bool IsRunning();
+	};
+}
+
+#endif
@@ -0,0 +1,208 @@
+/******************************************************************************/
+/*!
+\file		MemoryTracker.hpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Declares the memory tracker, which counts heap and video memory
+			per subsystem and warns when a subsystem goes over its budget
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef MEMORY_TRACKER_HPP
+#define MEMORY_TRACKER_HPP
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Borealis
+{
+	enum class MemoryTag : uint8_t
+	{
+		General,		//!< Anything allocated outside a tag scope
+		ECS,			//!< Entities and component pools
+		Physics,		//!< Jolt
+		Scripting,		//!< Mono
+		Audio,			//!< FMOD
+		Meshes,			//!< Mesh data on the CPU
+		Textures,		//!< Texture data on the CPU
+		Arenas,			//!< Blocks of the frame and scratch allocators
+		GPUBuffers,		//!< Vertex, element and streaming buffers in video memory
+		GPUTextures,	//!< Textures in video memory
+		Count
+	};
+
+	/*!***********************************************************************
+		\brief
+			Counters of one tag. Totals are since startup, frame values are
+			for the last frame closed by MemoryTracker::NewFrame.
+	*************************************************************************/
+	struct MemoryTagStats
+	{
+		uint64_t LiveBytes = 0;
+		uint64_t PeakBytes = 0;
+		uint64_t TotalAllocations = 0;
+		uint64_t TotalBytes = 0;		//!< Bytes allocated, frees are not subtracted
+		uint64_t FrameAllocations = 0;
+		uint64_t FrameBytes = 0;
+		uint64_t Budget = 0;			//!< Live bytes allowed before warning, 0 for no budget
+	};
+
+	class MemoryTracker
+	{
+	public:
+		/*!***********************************************************************
+			\brief
+				Allocates memory counted under a tag. Used by operator new and
+				the allocator hooks of the third party libraries, which must be
+				installed before the library allocates anything, as Reallocate
+				and Free only take blocks from here.
+			\param[in] size
+				Bytes to allocate
+			\param[in] alignment
+				Alignment of the block
+			\param[in] tag
+				Tag to count the block under
+			\return
+				The block, null if out of memory
+		*************************************************************************/
+		static void* Allocate(size_t size, size_t alignment, MemoryTag tag);
+
+		/*!***********************************************************************
+			\brief
+				Resizes a block from Allocate, keeping its alignment
+			\param[in] ptr
+				Block to resize, may be null
+			\param[in] size
+				New size in bytes
+			\param[in] tag
+				Tag to count the block under if ptr is null
+			\return
+				The resized block, null if out of memory
+		*************************************************************************/
+		static void* Reallocate(void* ptr, size_t size, MemoryTag tag);
+
+		/*!***********************************************************************
+			\brief
+				Frees a block from Allocate, counted against the tag it was
+				allocated with
+			\param[in] ptr
+				Block to free, may be null
+		*************************************************************************/
+		static void Free(void* ptr);
+
+		/*!***********************************************************************
+			\brief
+				Counts video memory created or destroyed by a GPU resource
+			\param[in] tag
+				GPU tag of the resource
+			\param[in] bytes
+				Size of the resource
+		*************************************************************************/
+		static void TrackGpuAllocation(MemoryTag tag, uint64_t bytes);
+		static void TrackGpuFree(MemoryTag tag, uint64_t bytes);
+
+		/*!***********************************************************************
+			\brief
+				Gets the tag that operator new counts allocations of the
+				calling thread under
+			\return
+				Current tag
+		*************************************************************************/
+		static MemoryTag GetCurrentTag();
+
+		/*!***********************************************************************
+			\brief
+				Closes the frame counters and warns about tags that went over
+				their budget. Called once at the top of the frame loop.
+		*************************************************************************/
+		static void NewFrame();
+
+		/*!***********************************************************************
+			\brief
+				Gets the counters of a tag
+			\param[in] tag
+				Tag to get
+			\return
+				Counters of the tag
+		*************************************************************************/
+		static MemoryTagStats GetStats(MemoryTag tag);
+
+		/*!***********************************************************************
+			\brief
+				Gets the counters of every heap tag added together, video memory
+				is left out
+			\return
+				Heap counters
+		*************************************************************************/
+		static MemoryTagStats GetHeapStats();
+
+		/*!***********************************************************************
+			\brief
+				Sets the live bytes a tag may hold before NewFrame warns
+			\param[in] tag
+				Tag to budget
+			\param[in] bytes
+				Budget in bytes, 0 to remove it
+		*************************************************************************/
+		static void SetBudget(MemoryTag tag, uint64_t bytes);
+
+		/*!***********************************************************************
+			\brief
+				Sets a budget from a "<Tag>=<MB>" string, e.g. "Physics=64"
+			\param[in] budget
+				Budget string
+			\return
+				True if the string was valid
+		*************************************************************************/
+		static bool ParseBudget(const std::string& budget);
+
+		/*!***********************************************************************
+			\brief
+				Gets the display name of a tag
+			\param[in] tag
+				Tag to name
+			\return
+				Static name of the tag
+		*************************************************************************/
+		static const char* GetTagName(MemoryTag tag);
+
+		/*!***********************************************************************
+			\brief
+				Checks if a tag counts video memory rather than heap memory
+			\param[in] tag
+				Tag to check
+			\return
+				True for GPU tags
+		*************************************************************************/
+		static bool IsGpuTag(MemoryTag tag) { return tag == MemoryTag::GPUBuffers || tag == MemoryTag::GPUTextures; }
+
+	private:
+		friend class MemoryTagScope;
+		static MemoryTag SetCurrentTag(MemoryTag tag);
+	};
+
+	/*!***********************************************************************
+		\brief
+			Counts every operator new on the calling thread under a tag until
+			the end of the scope. Scopes nest.
+	*************************************************************************/
+	class MemoryTagScope
+	{
+	public:
+		explicit MemoryTagScope(MemoryTag tag) : mPrevious(MemoryTracker::SetCurrentTag(tag)) {}
+		~MemoryTagScope() { MemoryTracker::SetCurrentTag(mPrevious); }
+
+		MemoryTagScope(const MemoryTagScope&) = delete;
+		MemoryTagScope& operator=(const MemoryTagScope&) = delete;
+
+	private:
+		MemoryTag mPrevious;
+	};
+}
+
+#endif
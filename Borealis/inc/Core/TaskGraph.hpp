@@ -0,0 +1,149 @@
+/******************************************************************************/
+/*!
+\file		TaskGraph.hpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Declares the per frame task graph. Tasks declare the components
+			they read and write, and tasks without conflicting access run
+			concurrently on the job system.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef TASK_GRAPH_HPP
+#define TASK_GRAPH_HPP
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <vector>
+#include <entt.hpp>
+
+namespace Borealis
+{
+	class TaskGraph
+	{
+	public:
+		using TaskFn = std::function<void()>;
+
+		struct TaskTiming
+		{
+			const char* mName;		//!< Name of the task
+			float mMilliseconds;	//!< Time the task took in the last Execute
+		};
+
+		/*!***********************************************************************
+			\brief
+				Builder returned by AddTask to declare a task's access set
+		*************************************************************************/
+		class TaskBuilder
+		{
+		public:
+			TaskBuilder(TaskGraph& graph, uint32_t index) : mGraph(graph), mIndex(index) {}
+
+			template <typename... Components>
+			TaskBuilder& Reads()
+			{
+				(mGraph.mTasks[mIndex].mReads.push_back(entt::type_hash<Components>::value()), ...);
+				return *this;
+			}
+
+			template <typename... Components>
+			TaskBuilder& Writes()
+			{
+				(mGraph.mTasks[mIndex].mWrites.push_back(entt::type_hash<Components>::value()), ...);
+				return *this;
+			}
+
+			/*!***********************************************************************
+				\brief
+					Marks the task as exclusive, e.g. scripts that may add or remove
+					components. Exclusive tasks are ordered against every other task.
+			*************************************************************************/
+			TaskBuilder& WritesAll() { mGraph.mTasks[mIndex].mExclusive = true; return *this; }
+
+			/*!***********************************************************************
+				\brief
+					Pins the task to the thread calling Execute, e.g. for GL or Mono
+			*************************************************************************/
+			TaskBuilder& OnMainThread() { mGraph.mTasks[mIndex].mMainThread = true; return *this; }
+
+		private:
+			TaskGraph& mGraph;
+			uint32_t mIndex;
+		};
+
+		/*!***********************************************************************
+			\brief
+				Adds a task. Tasks added earlier run before later tasks they
+				conflict with.
+			\param[in] name
+				Name of the task
+			\param[in] fn
+				Function to run
+			\return
+				Builder to declare the read and write sets
+		*************************************************************************/
+		TaskBuilder AddTask(const char* name, TaskFn fn);
+
+		/*!***********************************************************************
+			\brief
+				Runs every task, respecting the declared dependencies, and returns
+				once all have finished
+		*************************************************************************/
+		void Execute();
+
+		/*!***********************************************************************
+			\brief
+				Removes all tasks, keeping the allocated storage
+		*************************************************************************/
+		void Clear();
+
+		/*!***********************************************************************
+			\brief
+				Gets how long each task took in the last Execute, in the order
+				the tasks were added
+			\return
+				Task timings
+		*************************************************************************/
+		const std::vector<TaskTiming>& GetTimings() const { return mTimings; }
+
+	private:
+		struct Task
+		{
+			const char* mName;
+			TaskFn mFn;
+			std::vector<entt::id_type> mReads;
+			std::vector<entt::id_type> mWrites;
+			std::vector<uint32_t> mSuccessors;
+			uint32_t mDependencyCount = 0;
+			float mMilliseconds = 0.f;
+			bool mExclusive = false;
+			bool mMainThread = false;
+		};
+
+		/*!***********************************************************************
+			\brief
+				Checks if two tasks access the same component with at least one
+				of them writing
+		*************************************************************************/
+		static bool Conflicts(const Task& first, const Task& second);
+
+		void RunTask(uint32_t index);
+		void Schedule(uint32_t index);
+
+		std::vector<Task> mTasks;				//!< Task slots, only the first mTaskCount are in use
+		uint32_t mTaskCount = 0;
+		std::unique_ptr<std::atomic<uint32_t>[]> mRemaining;
+		uint32_t mRemainingCapacity = 0;
+		std::atomic<uint32_t> mCompleted = 0;
+		std::vector<uint32_t> mMainThreadReady;
+		std::mutex mMainThreadMutex;
+		std::vector<TaskTiming> mTimings;
+	};
+}
+
+#endif
@@ -48,6 +48,16 @@ namespace Borealis
 				The UUID as a uint64_t
 		*************************************************************************/
 		operator uint64_t() const { return mUUID; }
+
+		/*!***********************************************************************
+			\brief
+				Reseeds the generator behind the default constructor, which
+				scripts also draw from, so a recorded session can be replayed
+				with the same IDs
+			\param[in] seed
+				Seed of the generator
+		*************************************************************************/
+		static void SetSeed(uint64_t seed);
 	private:
 		uint64_t mUUID; //!< The UUID
 	};  // class UUID
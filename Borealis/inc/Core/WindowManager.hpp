@@ -17,6 +17,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 
 #include <Core/Core.hpp>
 #include <Core/EventSystem.hpp>
+#include <Core/InputRecorder.hpp>
 #include <Graphics/GraphicsContext.hpp>
 namespace Borealis
 {
@@ -125,6 +126,25 @@ namespace Borealis
 		*************************************************************************/
 		void* GetNativeWindow() const { return mWindow; }
 
+		/*!***********************************************************************
+			\brief
+				Getter for the graphics context
+			\return
+				Pointer to the graphics context
+		*************************************************************************/
+		GraphicsContext* GetContext() const { return mContext; }
+
+		/*!***********************************************************************
+			\brief
+				Turns window input into engine events, as the window callbacks
+				do, so replayed input reaches the layers the same way
+			\param[in] event
+				Input received from the window
+			\param[in] callback
+				Function the engine events are passed to
+		*************************************************************************/
+		static void DispatchInput(const InputEvent& event, const EventCallbackFn& callback);
+
 	private:
 		/*!***********************************************************************
 			\brief
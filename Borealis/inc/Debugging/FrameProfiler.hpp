@@ -0,0 +1,201 @@
+/******************************************************************************/
+/*!
+\file		FrameProfiler.hpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Declares the built in frame profiler, which keeps the zones and
+			counters of the last few frames without needing a Tracy client
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef FRAME_PROFILER_HPP
+#define FRAME_PROFILER_HPP
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Borealis
+{
+	/*!***********************************************************************
+		\brief
+			A timed zone. Times are nanoseconds since the profiler started,
+			GPU zones are relative to the first GPU zone of their frame.
+	*************************************************************************/
+	struct ProfileZoneRecord
+	{
+		const char* mName;	//!< Static name of the zone
+		int64_t mStart;		//!< Start time in nanoseconds
+		int64_t mEnd;		//!< End time in nanoseconds
+		uint32_t mThread;	//!< Index of the thread that recorded the zone, 0 is the thread that owns the frame loop
+		uint32_t mDepth;	//!< Nesting depth on that thread
+
+		float GetMilliseconds() const { return (mEnd - mStart) * 1e-6f; }
+	};
+
+	/*!***********************************************************************
+		\brief
+			Value of a named counter at the end of a frame
+	*************************************************************************/
+	struct ProfileCounterRecord
+	{
+		const char* mName;	//!< Static name of the counter
+		double mValue;		//!< Value of the counter
+	};
+
+	/*!***********************************************************************
+		\brief
+			Everything recorded during one frame
+	*************************************************************************/
+	struct ProfiledFrame
+	{
+		uint64_t mIndex = 0;							//!< Frame number
+		int64_t mStart = 0;								//!< Start time in nanoseconds
+		int64_t mEnd = 0;								//!< End time in nanoseconds
+		std::vector<ProfileZoneRecord> mZones;			//!< CPU zones of every thread
+		std::vector<ProfileZoneRecord> mGpuZones;		//!< GPU zones, filled in a few frames later once the queries resolve
+		std::vector<ProfileCounterRecord> mCounters;	//!< Counters set during the frame
+
+		float GetMilliseconds() const { return (mEnd - mStart) * 1e-6f; }
+	};
+
+	class FrameProfiler
+	{
+	public:
+		/*!***********************************************************************
+			\brief
+				Initialises the profiler
+			\param[in] frameCount
+				Number of frames kept in the ring buffer
+		*************************************************************************/
+		static void Init(uint32_t frameCount = 240);
+
+		/*!***********************************************************************
+			\brief
+				Frees the ring buffer
+		*************************************************************************/
+		static void Free();
+
+		/*!***********************************************************************
+			\brief
+				Closes the current frame into the ring buffer and opens the next.
+				Called once at the top of the frame loop.
+		*************************************************************************/
+		static void NewFrame();
+
+		/*!***********************************************************************
+			\brief
+				Gets the number of the frame being recorded
+			\return
+				Frame number, matches the frame count of the application
+		*************************************************************************/
+		static uint64_t GetFrameIndex();
+
+		/*!***********************************************************************
+			\brief
+				Enables or disables recording. Tracy zones are unaffected.
+			\param[in] enabled
+				True to record
+		*************************************************************************/
+		static void SetEnabled(bool enabled);
+		static bool IsEnabled();
+
+		/*!***********************************************************************
+			\brief
+				Freezes the ring buffer so it can be inspected, frames keep
+				running but are not recorded
+			\param[in] paused
+				True to freeze
+		*************************************************************************/
+		static void SetPaused(bool paused);
+		static bool IsPaused();
+
+		/*!***********************************************************************
+			\brief
+				Gets the current time on the profiler clock
+			\return
+				Nanoseconds since the profiler started
+		*************************************************************************/
+		static int64_t Now();
+
+		/*!***********************************************************************
+			\brief
+				Opens a zone on the calling thread. Used by ProfileZone.
+			\param[out] start
+				Start time of the zone
+			\param[out] depth
+				Nesting depth of the zone
+			\return
+				False if recording is off, EndZone must then not be called
+		*************************************************************************/
+		static bool BeginZone(int64_t& start, uint32_t& depth);
+
+		/*!***********************************************************************
+			\brief
+				Closes a zone opened by BeginZone on the calling thread
+			\param[in] name
+				Static name of the zone
+			\param[in] start
+				Start time returned by BeginZone
+			\param[in] depth
+				Depth returned by BeginZone
+		*************************************************************************/
+		static void EndZone(const char* name, int64_t start, uint32_t depth);
+
+		/*!***********************************************************************
+			\brief
+				Sets a named counter for the current frame, also plotted in Tracy
+			\param[in] name
+				Static name of the counter
+			\param[in] value
+				Value of the counter
+		*************************************************************************/
+		static void SetCounter(const char* name, double value);
+
+		/*!***********************************************************************
+			\brief
+				Attaches a resolved GPU zone to the frame that issued it, if that
+				frame is still in the ring buffer
+			\param[in] frameIndex
+				Frame that issued the zone
+			\param[in] zone
+				The zone, timed relative to the frame's first GPU zone
+		*************************************************************************/
+		static void RecordGpuZone(uint64_t frameIndex, const ProfileZoneRecord& zone);
+
+		/*!***********************************************************************
+			\brief
+				Copies the recorded frames
+			\param[out] frames
+				Frames, oldest first
+		*************************************************************************/
+		static void GetFrames(std::vector<ProfiledFrame>& frames);
+
+		/*!***********************************************************************
+			\brief
+				Copies the newest frame whose GPU zones have been read back
+			\param[out] frame
+				The frame
+			\return
+				False if no frame in the ring buffer has GPU zones
+		*************************************************************************/
+		static bool GetLatestGpuFrame(ProfiledFrame& frame);
+
+		/*!***********************************************************************
+			\brief
+				Writes the recorded frames as a Chrome trace, which can be opened
+				in chrome://tracing or Perfetto
+			\param[in] path
+				File to write
+			\return
+				True if written
+		*************************************************************************/
+		static bool ExportChromeTrace(const std::string& path);
+	};
+}
+
+#endif
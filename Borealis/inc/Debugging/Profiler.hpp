@@ -27,6 +27,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <fstream>
 #include <thread>
 #include <glm/glm.hpp>
+#include <Debugging/FrameProfiler.hpp>
 
 namespace Borealis
 {
@@ -115,13 +116,6 @@ namespace Borealis
 		***********************************************************/
 		static void sendAppInfo(const char* message);
 
-		/***********************************************************
-		* @brief Start a custom profiling zone.
-		* @param srcLoc A pointer to the mySourceLocationData struct 
-		   containing information about the profiling zone.
-		***********************************************************/
-		static void startZone(const mySourceLocationData* srcLoc);
-
 		// Destructor that ends the profiling zone
 		~TracyProfiler();
 
@@ -138,6 +132,34 @@ namespace Borealis
 		TracyProfiler& operator=(const TracyProfiler&) = delete;
 	};
 
+	/***********************************************************
+	* @brief Profiling zone that lasts until the end of the scope
+	   it is declared in. Reports to Tracy when a client is
+	   connected and always records into the FrameProfiler.
+	***********************************************************/
+	class ProfileZone {
+	public:
+		/***********************************************************
+		* @brief Begin the zone.
+		* @param srcLoc A pointer to the static mySourceLocationData
+		   struct describing the zone.
+		***********************************************************/
+		explicit ProfileZone(const mySourceLocationData* srcLoc);
+
+		// Ends the zone
+		~ProfileZone();
+
+	private:
+		ProfileZone(const ProfileZone&) = delete;
+		ProfileZone& operator=(const ProfileZone&) = delete;
+
+		const mySourceLocationData* mLocation;
+		int64_t mStart;
+		uint32_t mDepth;
+		bool mRecording;
+		alignas(8) unsigned char mTracyZone[16]; // Storage for the tracy::ScopedZone, which is only visible to Profiler.cpp
+	};
+
 
 }
 
@@ -145,15 +167,17 @@ namespace Borealis
 #if ENGINE_PROFILE
 #define PROFILE_START(name) ::Borealis::TracyProfiler::markFrameStart(name)
 #define PROFILE_END() ::Borealis::TracyProfiler::markFrameEnd()
-#define PROFILE_SCOPE(name) static mySourceLocationData CONCATENATE(__source_location,__LINE__){ name, __FUNCTION__, __FILE__ , (uint32_t)__LINE__, 0 }; \
-::Borealis::TracyProfiler::startZone(&CONCATENATE(__source_location,__LINE__));
-#define PROFILE_FUNCTION() static mySourceLocationData CONCATENATE(__source_location,__LINE__){ nullptr, __FUNCTION__, __FILE__ , (uint32_t)__LINE__, 0 }; \
-::Borealis::TracyProfiler::startZone(&CONCATENATE(__source_location,__LINE__));
+#define PROFILE_SCOPE(name) static const ::Borealis::mySourceLocationData CONCATENATE(__source_location,__LINE__){ name, __FUNCTION__, __FILE__ , (uint32_t)__LINE__, 0 }; \
+::Borealis::ProfileZone CONCATENATE(__profile_zone,__LINE__)(&CONCATENATE(__source_location,__LINE__));
+#define PROFILE_FUNCTION() static const ::Borealis::mySourceLocationData CONCATENATE(__source_location,__LINE__){ nullptr, __FUNCTION__, __FILE__ , (uint32_t)__LINE__, 0 }; \
+::Borealis::ProfileZone CONCATENATE(__profile_zone,__LINE__)(&CONCATENATE(__source_location,__LINE__));
+#define PROFILE_COUNTER(name, value) ::Borealis::FrameProfiler::SetCounter(name, static_cast<double>(value))
 #else
 #define PROFILE_START(name) 
 #define PROFILE_END() 
 #define PROFILE_FUNCTION()
 #define PROFILE_SCOPE(name)
+#define PROFILE_COUNTER(name, value)
 #endif
 
 #endif
\ No newline at end of file
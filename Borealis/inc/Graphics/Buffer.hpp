@@ -87,9 +87,12 @@ namespace Borealis
 				Constructor of the BufferLayout
 			\param[in] elements
 				The elements of the buffer layout
+			\param[in] perInstance
+				True if the elements advance once per instance instead of once
+				per vertex
 		*************************************************************************/
-		BufferLayout(std::initializer_list<BufferElement> elements)
-			: mElements(elements)
+		BufferLayout(std::initializer_list<BufferElement> elements, bool perInstance = false)
+			: mElements(elements), mPerInstance(perInstance)
 		{
 			CalculateOffsetsAndStride();
 		}
@@ -122,6 +125,14 @@ namespace Borealis
 		*************************************************************************/
 		inline uint32_t GetStride() const { return mStride; }
 
+		/*!***********************************************************************
+			\brief
+				Check if the elements advance once per instance
+			\return
+				True if the layout is per instance
+		*************************************************************************/
+		inline bool IsPerInstance() const { return mPerInstance; }
+
 
 	private:
 		/*!***********************************************************************
@@ -131,6 +142,7 @@ namespace Borealis
 		void CalculateOffsetsAndStride();
 		std::vector<BufferElement> mElements; // Elements of the buffer layout
 		uint32_t mStride; // Stride of the buffer layout
+		bool mPerInstance = false; // Elements advance per instance
 	}; // Class BufferLayout
 
 	class VertexBuffer
@@ -15,6 +15,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #ifndef Font_HPP
 #define Font_HPP
 
+#include <array>
 #include <map>
 
 namespace Borealis
@@ -46,6 +47,8 @@ namespace Borealis
 	class Font : public Asset
 	{
 	public:
+		static constexpr uint32_t GlyphTableSize = 256; // Codepoints with a direct slot, ASCII and Latin-1
+
 		Font();
 		Font(FontInfo const& fontInfo);
 		Font(std::filesystem::path const& filePath);
@@ -53,13 +56,41 @@ namespace Borealis
 
 		FontInfo const& GetFontInfo() const;
 
+		/*!***********************************************************************
+			\brief
+				Looks up a glyph by codepoint
+			\param[in] codepoint
+				Unicode codepoint
+			\return
+				The glyph, null if the font does not have it
+		*************************************************************************/
+		FontGlyph const* GetGlyph(uint32_t codepoint) const;
+
+		/*!***********************************************************************
+			\brief
+				Distance from the start of a glyph to the start of the next one,
+				kerning included
+			\param[in] codepoint
+				Codepoint of the glyph
+			\param[in] nextCodepoint
+				Codepoint of the glyph after it
+			\return
+				The advance in font units
+		*************************************************************************/
+		double GetAdvance(uint32_t codepoint, uint32_t nextCodepoint) const;
+
 		Ref<Texture2D> GetAtlasTexture() const;
 		void SetTexture(std::filesystem::path const& fontTexturePath); //Temp
 		static void SetDefaultFont(Ref<Font> defaultFont);
 		static Ref<Font> GetDefaultFont();
 
 	private:
+		// Fills the glyph table from the glyphs of the font info
+		void BuildGlyphTable();
+
 		FontInfo mFontInfo;
+		std::array<FontGlyph, GlyphTableSize> mGlyphTable{};
+		std::array<bool, GlyphTableSize> mHasGlyph{};
 	};
 }
 
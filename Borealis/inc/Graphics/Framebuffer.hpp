@@ -135,6 +135,14 @@ namespace Borealis
 		*************************************************************************/
 		virtual uint32_t GetColorAttachmentRendererID(uint32_t index = 0) const = 0;
 
+		/*!***********************************************************************
+			\brief
+				Get the renderer ID of the Frame Buffer
+			\return
+				The Frame Buffer renderer ID
+		*************************************************************************/
+		virtual uint32_t GetRendererID() const = 0;
+
 		/*!***********************************************************************
 			\brief
 				Get the Frame Buffer Properties
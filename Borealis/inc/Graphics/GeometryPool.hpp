@@ -0,0 +1,136 @@
+/******************************************************************************/
+/*!
+\file		GeometryPool.hpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Declares the geometry pool. Every mesh of a vertex format shares
+			one large vertex buffer, one index buffer and one vertex array,
+			sub-allocated per mesh, so the draws of a whole material can be
+			issued with a single multi draw indirect call.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef GEOMETRY_POOL_HPP
+#define GEOMETRY_POOL_HPP
+#include <cstdint>
+#include <vector>
+#include <glm/glm.hpp>
+
+#include <Core/Core.hpp>
+
+namespace Borealis
+{
+	class GeometryPool
+	{
+	public:
+		enum class VertexFormat : uint8_t
+		{
+			Static,		//!< Position, normal and texture coordinates, the Vertex struct
+			Count
+		};
+
+		/*!***********************************************************************
+			\brief
+				A range of the shared buffers. Returned to the pool when the
+				last mesh holding it is destroyed.
+		*************************************************************************/
+		class Allocation
+		{
+		public:
+			Allocation(VertexFormat format, uint32_t baseVertex, uint32_t vertexCount, uint32_t firstIndex, uint32_t indexCount)
+				: mFormat(format), mBaseVertex(baseVertex), mVertexCount(vertexCount), mFirstIndex(firstIndex), mIndexCount(indexCount) {}
+			Allocation(const Allocation&) = delete;
+			Allocation& operator=(const Allocation&) = delete;
+			~Allocation();
+
+			VertexFormat GetFormat() const { return mFormat; }
+			uint32_t GetBaseVertex() const { return mBaseVertex; }
+			uint32_t GetVertexCount() const { return mVertexCount; }
+			uint32_t GetFirstIndex() const { return mFirstIndex; }
+			uint32_t GetIndexCount() const { return mIndexCount; }
+
+		private:
+			VertexFormat mFormat;
+			uint32_t mBaseVertex;
+			uint32_t mVertexCount;
+			uint32_t mFirstIndex;
+			uint32_t mIndexCount;
+		};
+
+		/*!***********************************************************************
+			\brief
+				Layout of DrawElementsIndirectCommand
+		*************************************************************************/
+		struct DrawCommand
+		{
+			uint32_t mCount;			//!< Indices to draw
+			uint32_t mInstanceCount;
+			uint32_t mFirstIndex;		//!< First index in the shared index buffer
+			int32_t mBaseVertex;		//!< Added to every index
+			uint32_t mBaseInstance;		//!< First entry of the instance data the draw reads
+		};
+
+		/*!***********************************************************************
+			\brief
+				Per draw data, read by the shaders as instanced attributes
+				5 to 8 (transform), 9 (entity ID) and 10 (LOD fade)
+		*************************************************************************/
+		struct InstanceData
+		{
+			glm::mat4 mTransform;
+			int32_t mEntityID;
+			float mLodFade;
+		};
+
+		/*!***********************************************************************
+			\brief
+				Creates the shared buffers and vertex arrays
+		*************************************************************************/
+		static void Init();
+
+		/*!***********************************************************************
+			\brief
+				Deletes the shared buffers, allocations still alive become no-ops
+		*************************************************************************/
+		static void Free();
+
+		/*!***********************************************************************
+			\brief
+				Allocates a range of the shared buffers and uploads geometry into
+				it, growing the buffers when they are full
+			\param[in] format
+				Vertex format of the data
+			\param[in] vertices
+				Vertex data, stride of the format
+			\param[in] vertexCount
+				Number of vertices
+			\param[in] indices
+				Indices, relative to the first vertex
+			\param[in] indexCount
+				Number of indices
+			\return
+				The allocation, null if the pool is not running
+		*************************************************************************/
+		static Ref<Allocation> Allocate(VertexFormat format, const void* vertices, uint32_t vertexCount, const uint32_t* indices, uint32_t indexCount);
+
+		/*!***********************************************************************
+			\brief
+				Draws a batch from the shared buffers of a format with one call
+				on an OpenGL 4.3 context, one call per command on a 4.1 context
+			\param[in] format
+				Vertex format of the meshes drawn
+			\param[in] commands
+				Draws, each reading instance data from its base instance
+			\param[in] instances
+				Instance data of the draws
+		*************************************************************************/
+		static void MultiDraw(VertexFormat format, const std::vector<DrawCommand>& commands, const std::vector<InstanceData>& instances);
+	};
+}
+
+#endif
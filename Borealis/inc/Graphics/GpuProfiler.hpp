@@ -0,0 +1,116 @@
+/******************************************************************************/
+/*!
+\file		GpuProfiler.hpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Declares the GPU profiler, which times render passes with GPU
+			timer queries and reports them to the FrameProfiler
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef GPU_PROFILER_HPP
+#define GPU_PROFILER_HPP
+#include <Core/Core.hpp>
+#include <Debugging/Profiler.hpp>
+
+namespace Borealis
+{
+	class GpuProfiler
+	{
+	public:
+		/*!***********************************************************************
+			\brief
+				Destructor of the GpuProfiler Virtual Class
+		*************************************************************************/
+		virtual ~GpuProfiler() {}
+
+		/*!***********************************************************************
+			\brief
+				Starts timing a zone. Zones may nest.
+			\param[in] name
+				Static name of the zone
+		*************************************************************************/
+		virtual void Begin(const char* name) = 0;
+
+		/*!***********************************************************************
+			\brief
+				Stops timing the innermost open zone
+		*************************************************************************/
+		virtual void End() = 0;
+
+		/*!***********************************************************************
+			\brief
+				Collects the frames whose queries have finished, without waiting
+				on the ones still in flight, and starts the next frame
+		*************************************************************************/
+		virtual void EndFrame() = 0;
+
+		/*!***********************************************************************
+			\brief
+				Create a GpuProfiler depending on Graphics API
+			\param[in] framesInFlight
+				Number of frames of queries that can be pending at once
+			\return
+				The GPU profiler, null if the API has no GPU to time
+		*************************************************************************/
+		static Scope<GpuProfiler> Create(uint32_t framesInFlight = 3);
+
+		/*!***********************************************************************
+			\brief
+				Creates and frees the profiler used by the static functions below
+		*************************************************************************/
+		static void Init();
+		static void Free();
+
+		/*!***********************************************************************
+			\brief
+				Begins a GPU zone. Render side only, call from inside a
+				submitted render command.
+			\param[in] name
+				Static name of the zone
+		*************************************************************************/
+		static void BeginZone(const char* name) { if (sInstance) sInstance->Begin(name); }
+
+		/*!***********************************************************************
+			\brief
+				Ends a GPU zone. Render side only.
+		*************************************************************************/
+		static void EndZone() { if (sInstance) sInstance->End(); }
+
+		/*!***********************************************************************
+			\brief
+				Ends the GPU frame. Render side only, once per frame.
+		*************************************************************************/
+		static void EndGpuFrame() { if (sInstance) sInstance->EndFrame(); }
+
+	private:
+		static Scope<GpuProfiler> sInstance;
+	};
+
+	/*!***********************************************************************
+		\brief
+			GPU zone that lasts until the end of the scope. Render side only.
+	*************************************************************************/
+	class GpuProfileZone
+	{
+	public:
+		explicit GpuProfileZone(const char* name) { GpuProfiler::BeginZone(name); }
+		~GpuProfileZone() { GpuProfiler::EndZone(); }
+
+		GpuProfileZone(const GpuProfileZone&) = delete;
+		GpuProfileZone& operator=(const GpuProfileZone&) = delete;
+	};
+}
+
+#if ENGINE_PROFILE
+#define PROFILE_GPU_SCOPE(name) ::Borealis::GpuProfileZone CONCATENATE(__gpu_zone,__LINE__)(name)
+#else
+#define PROFILE_GPU_SCOPE(name)
+#endif
+
+#endif
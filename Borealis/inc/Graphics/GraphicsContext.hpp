@@ -37,6 +37,18 @@ namespace Borealis
 				Swap the Buffers
 		*************************************************************************/
 		virtual void SwapBuffers() = 0;
+
+		/*!***********************************************************************
+			\brief
+				Makes the context current on the calling thread
+		*************************************************************************/
+		virtual void MakeCurrent() = 0;
+
+		/*!***********************************************************************
+			\brief
+				Releases the context from the calling thread
+		*************************************************************************/
+		virtual void DetachCurrent() = 0;
 	}; // class GraphicsContext
 } // namespace Borealis
 #endif
\ No newline at end of file
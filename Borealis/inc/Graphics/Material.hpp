@@ -14,10 +14,12 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 
 #ifndef MATERIAL_HPP
 #define MATERIAL_HPP
+#include <array>
 #include <unordered_map>
 #include <glm/glm.hpp>
 
 #include <Assets/Asset.hpp>
+#include <Graphics/MaterialBuffer.hpp>
 #include <Graphics/Texture.hpp>
 #include <Graphics/Shader.hpp>
 #include <Core/Core.hpp>
@@ -54,6 +56,37 @@ namespace Borealis
 			UnknownProperty
 		};
 
+		/*!***********************************************************************
+			\brief
+				What drawing with a material needs, packed on the game thread. A
+				state never changes once packed, so the render thread draws with
+				it while the material itself is being edited.
+		*************************************************************************/
+		struct DrawState
+		{
+			Ref<Shader> mShader; //Shader variant compiled for the texture maps
+			std::array<Ref<Texture2D>, UnknownTextureMap> mTextureBindings; //Texture map of each unit
+			MaterialBuffer::Parameters mParameters{}; //Contents of the material's slot
+			mutable MaterialBuffer::Slot mParameterSlot; //Uploaded by the render thread on the first Bind
+
+			/*!***********************************************************************
+				\brief
+					Binds the parameters in the material buffer and the texture
+					maps, uploading the parameters on the first call. Called from
+					the render thread with the state's shader bound.
+			*************************************************************************/
+			void Bind() const;
+
+			/*!***********************************************************************
+				\brief
+					Reports the mip level each texture map needs to the texture
+					streamer
+				\param[in] uvPerPixel
+					UV units one screen pixel covers on the draw, before tiling
+			*************************************************************************/
+			void RequestTextureMips(float uvPerPixel) const;
+		};
+
 		/*!***********************************************************************
 			\brief
 				Constructor for a Material with a shader
@@ -101,7 +134,7 @@ namespace Borealis
 			\texture[in] texture
 				The texture map
 		*************************************************************************/
-		void SetTextureMap(TextureMaps map, Ref<Texture2D> texture) { mTextureMaps[map] = texture; }
+		void SetTextureMap(TextureMaps map, Ref<Texture2D> texture) { mTextureMaps[map] = texture; mDirty = true; }
 
 		/*!***********************************************************************
 			\brief
@@ -111,7 +144,7 @@ namespace Borealis
 			\texture[in] color
 				The color
 		*************************************************************************/
-		void SetTextureMapColor(TextureMaps map, const glm::vec4& color) { mTextureMapColor[map] = color; }
+		void SetTextureMapColor(TextureMaps map, const glm::vec4& color) { SetValue(mTextureMapColor[map], color); }
 
 		/*!***********************************************************************
 			\brief
@@ -121,7 +154,7 @@ namespace Borealis
 			\texture[in] value
 				float to set
 		*************************************************************************/
-		void SetTextureMapFloat(TextureMaps map, float value) { mTextureMapFloat[map] = value; }
+		void SetTextureMapFloat(TextureMaps map, float value) { SetValue(mTextureMapFloat[map], value); }
 
 		/*!***********************************************************************
 			\brief
@@ -131,7 +164,7 @@ namespace Borealis
 			\texture[in] value
 				The value to set
 		*************************************************************************/
-		void SetPropertyFloat(Props prop, float value) { mPropertiesFloat[prop] = value; }
+		void SetPropertyFloat(Props prop, float value) { SetValue(mPropertiesFloat[prop], value); }
 
 		/*!***********************************************************************
 			\brief
@@ -141,15 +174,27 @@ namespace Borealis
 			\texture[in] value
 				The value to set
 		*************************************************************************/
-		void SetPropertyVec2(Props prop, glm::vec2 value) { mPropertiesVec2[prop] = value; }
+		void SetPropertyVec2(Props prop, glm::vec2 value) { SetValue(mPropertiesVec2[prop], value); }
 		
 		/*!***********************************************************************
 			\brief
-				This function sets the uniforms in the material's shader
+				Points the samplers of a material shader at the texture units
+				Bind uses and its MaterialBlock at the material buffer
 			\param[in] shader
-				Temp variable to take in same shader as renderer
+				Bound material shader variant
 		*************************************************************************/
-		void SetUniforms(Ref<Shader> shader);
+		static void SetTextureUnits(Ref<Shader> shader);
+
+		/*!***********************************************************************
+			\brief
+				Gets the state to draw the material with, packing a new one if
+				the material changed since the last call. Called from the game
+				thread, which borrows the graphics context when the texture maps
+				need another shader variant.
+			\return
+				The packed state, retain it for the frame that draws with it
+		*************************************************************************/
+		Ref<DrawState> GetDrawState();
 
 		/*!***********************************************************************
 			\brief
@@ -246,12 +291,32 @@ namespace Borealis
 		*************************************************************************/
 		void Init();
 
+		/*!***********************************************************************
+			\brief
+				Sets a parameter, marking the material to be packed again when it
+				changes
+		*************************************************************************/
+		template <typename T>
+		void SetValue(T& parameter, const T& value)
+		{
+			if (parameter != value)
+			{
+				parameter = value;
+				mDirty = true;
+			}
+		}
+
 		std::unordered_map<TextureMaps, Ref<Texture2D>> mTextureMaps; //Texture maps
 		std::unordered_map<TextureMaps, glm::vec4> mTextureMapColor; //Texture map colors
 		std::unordered_map<TextureMaps, float> mTextureMapFloat; //Texture map floats
 		std::unordered_map<Props, float> mPropertiesFloat; //Properties
 		std::unordered_map<Props, glm::vec2> mPropertiesVec2; //Properties
-		Ref<Shader> mShader; //Shader
+		Ref<Shader> mShader; //Shader variant of mShaderFeatures
+		uint32_t mShaderFeatures = UINT32_MAX; //Texture maps the variant was picked for, one bit per map
+
+		// Packed by GetDrawState for the render thread, so drawing never looks up the maps above
+		Ref<DrawState> mDrawState; //Last packed state
+		bool mDirty = true; //Parameters or maps changed since the last pack
 		std::string mName;
 	}; //class Material
 } //namespace Borealis
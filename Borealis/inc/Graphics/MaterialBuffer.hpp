@@ -0,0 +1,93 @@
+/******************************************************************************/
+/*!
+\file		MaterialBuffer.hpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Declares the material buffer. The parameters of every material
+			live in one uniform buffer, a std140 block each, uploaded when
+			the material changes and bound by range when it is drawn.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef MATERIAL_BUFFER_HPP
+#define MATERIAL_BUFFER_HPP
+#include <cstdint>
+#include <glm/glm.hpp>
+
+namespace Borealis
+{
+	class MaterialBuffer
+	{
+	public:
+		static constexpr uint32_t BindingPoint = 0;	//!< Uniform buffer binding the MaterialBlock of the shaders reads
+		static constexpr uint32_t InvalidSlot = UINT32_MAX;
+
+		/*!***********************************************************************
+			\brief
+				Layout of the MaterialBlock uniform block, std140
+		*************************************************************************/
+		struct Parameters
+		{
+			glm::vec4 mAlbedoColor;
+			glm::vec4 mSpecularColor;
+			glm::vec4 mEmissionColor;
+			glm::vec2 mTiling;
+			glm::vec2 mOffset;
+			float mSmoothness;
+			float mShininess;
+			float mMetallic;
+			float mPadding;
+		};
+		static_assert(sizeof(Parameters) == 80, "Parameters must match the std140 layout of MaterialBlock");
+
+		/*!***********************************************************************
+			\brief
+				Slot of a material in the buffer. Released when destroyed, a
+				copy starts without a slot so two materials never share one.
+		*************************************************************************/
+		class Slot
+		{
+		public:
+			Slot() = default;
+			Slot(const Slot&) {}
+			Slot& operator=(const Slot&) { return *this; }
+			~Slot();
+
+			/*!***********************************************************************
+				\brief
+					Uploads parameters, taking a slot on the first upload
+			*************************************************************************/
+			void Upload(const Parameters& parameters);
+
+			/*!***********************************************************************
+				\brief
+					Binds the slot to the binding point
+			*************************************************************************/
+			void Bind() const;
+
+			bool IsValid() const { return mIndex != InvalidSlot; }
+
+		private:
+			uint32_t mIndex = InvalidSlot;
+		};
+
+		/*!***********************************************************************
+			\brief
+				Creates the buffer
+		*************************************************************************/
+		static void Init();
+
+		/*!***********************************************************************
+			\brief
+				Deletes the buffer, slots still alive become no-ops
+		*************************************************************************/
+		static void Free();
+	};
+}
+
+#endif
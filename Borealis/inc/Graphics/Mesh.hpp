@@ -14,10 +14,12 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 
 #ifndef MESH_HPP
 #define MESH_HPP
+#include <limits>
 #include <vector>
 #include <glm/glm.hpp>
 
 #include <Graphics/Shader.hpp>
+#include <Graphics/GeometryPool.hpp>
 #include <Graphics/Animation/VertexBone.hpp>
 
 namespace Borealis
@@ -80,15 +82,31 @@ namespace Borealis
 
 		/*!***********************************************************************
 			\brief
-				Set up mesh
+				Set up mesh. Uploads the vertices and every LOD into the geometry
+				pool, then drops the CPU copies unless the mesh is flagged for
+				CPU access.
 		*************************************************************************/
 		void SetupMesh();
 
 		/*!***********************************************************************
 			\brief
-				Draw mesh
+				Gets the indirect draw of one level of detail of the mesh
+			\param[in] lod
+				Level of detail to draw, clamped to the coarsest one
+			\param[in] baseInstance
+				Index of the instance data of the draw
+			\return
+				The draw, with a count of 0 if the mesh is not uploaded
 		*************************************************************************/
-		void Draw(const glm::mat4& transform, Ref<Shader> shader, int entityID);
+		GeometryPool::DrawCommand GetDrawCommand(uint32_t lod, uint32_t baseInstance) const;
+
+		/*!***********************************************************************
+			\brief
+				Keeps the vertices and indices on the CPU after SetupMesh, for
+				meshes read back by gameplay or physics. Set before SetupMesh.
+		*************************************************************************/
+		void SetCpuAccess(bool cpuAccess) { mCpuAccess = cpuAccess; }
+		bool HasCpuAccess() const { return mCpuAccess; }
 
 		/*!***********************************************************************
 			\brief
@@ -106,7 +124,34 @@ namespace Borealis
 		uint32_t GetIndicesCount() const;
 		void SetIndicesCount(uint32_t count);
 
+		/*!***********************************************************************
+			\brief
+				Gets the triangle lists of LOD 1 onwards. They index the same
+				vertices as LOD 0 and are uploaded after it by SetupMesh.
+			\return
+				Triangle lists, coarser ones last
+		*************************************************************************/
+		std::vector<std::vector<unsigned int>>& GetLodIndices() { return mLodIndices; }
+
+		/*!***********************************************************************
+			\brief
+				Bounds and areas measured by SetupMesh, kept after the CPU
+				copies are dropped
+		*************************************************************************/
+		const glm::vec3& GetBoundsMin() const { return mBoundsMin; }
+		const glm::vec3& GetBoundsMax() const { return mBoundsMax; }
+		float GetSurfaceArea() const { return mSurfaceArea; }
+		float GetUVArea() const { return mUVArea; }
+
 	private:
+		struct LodRange
+		{
+			uint32_t mFirstIndex = 0;
+			uint32_t mIndexCount = 0;
+		};
+
+		std::vector<std::vector<unsigned int>> mLodIndices;
+		std::vector<LodRange> mLodRanges; // Where each LOD is in the element buffer, LOD 0 first
 		std::vector<unsigned int> mIndices;
 		std::vector<Vertex> mVertices;
 		std::vector<VertexData> mVerticesData;
@@ -114,7 +159,15 @@ namespace Borealis
 		uint32_t mVerticesCount; // Number of vertices
 		uint32_t mIndicesCount; // Number of indices
 
-		unsigned int VAO, VBO, EBO;
+		Ref<GeometryPool::Allocation> mGeometry; // Shared between copies of the mesh
+		bool mCpuAccess = false;
+
+		glm::vec3 mBoundsMin{ std::numeric_limits<float>::max() };
+		glm::vec3 mBoundsMax{ std::numeric_limits<float>::lowest() };
+		float mSurfaceArea = 0.f;
+		float mUVArea = 0.f;
+
+		void ComputeBounds();
 
 
 		void ComputeTangents();
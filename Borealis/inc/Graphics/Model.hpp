@@ -14,6 +14,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 
 #ifndef MODEL_HPP
 #define MODEL_HPP
+#include <limits>
 #include <vector>
 #include <glm/glm.hpp>
 
@@ -36,9 +37,15 @@ namespace Borealis
 	public:
 		/*!***********************************************************************
 			\brief
-				Renders the model
+				Appends the indirect draws of every mesh of the model
+			\param[in] lod
+				Level of detail to draw
+			\param[in] baseInstance
+				Index of the instance data the meshes share
+			\param[out] commands
+				Draws to append to
 		*************************************************************************/
-		void Draw(const glm::mat4& transform, Ref<Shader> shader, int entityID);
+		void AppendDrawCommands(uint32_t lod, uint32_t baseInstance, std::vector<GeometryPool::DrawCommand>& commands) const;
 
 		/*!***********************************************************************
 			\brief
@@ -46,13 +53,82 @@ namespace Borealis
 		*************************************************************************/
 		void LoadModel(std::filesystem::path const& path);
 
+		/*!***********************************************************************
+			\brief
+				Reads the meshes of a model file without setting them up. Only
+				touches the model, so it can run on a worker
+			\param[in] path
+				Path to the model file
+		*************************************************************************/
+		void ReadModel(std::filesystem::path const& path);
+
+		/*!***********************************************************************
+			\brief
+				Sets up the meshes read by ReadModel, on the thread that owns the
+				graphics context
+		*************************************************************************/
+		void SetupMeshes();
+
 		/*!***********************************************************************
 				TO REMOVE
 		*************************************************************************/
 		void SaveModel();
 
+		/*!***********************************************************************
+			\brief
+				Computes the bounding sphere and the UV density of the meshes,
+				used to pick the mip level the textures need on screen. Called
+				once the meshes are filled in.
+		*************************************************************************/
+		void ComputeBounds();
+
+		const glm::vec3& GetBoundsCenter() const { return mBoundsCenter; }
+		float GetBoundsRadius() const { return mBoundsRadius; }
+
+		/*!***********************************************************************
+			\brief
+				Gets how much of the texture space one unit of the model covers
+			\return
+				UV units per model space unit
+		*************************************************************************/
+		float GetUVDensity() const { return mUVDensity; }
+
+		/*!***********************************************************************
+			\brief
+				Gets the number of levels of detail, 1 for models imported
+				without any
+		*************************************************************************/
+		uint32_t GetLodCount() const { return static_cast<uint32_t>(mLodScreenSizes.size()); }
+
+		/*!***********************************************************************
+			\brief
+				Picks the level of detail for the size the model covers on
+				screen. The model only moves to a coarser level once it is a
+				margin below the switch size, so it does not flicker between
+				two levels at the boundary.
+			\param[in] screenSize
+				Height of the bounding sphere over the height of the screen
+			\param[in] currentLod
+				Level drawn last frame
+			\return
+				Level to draw
+		*************************************************************************/
+		uint32_t SelectLod(float screenSize, uint32_t currentLod) const;
+
 		std::vector<Mesh> mMeshes;
+		std::vector<float> mLodErrors{ 0.f }; //!< Largest surface deviation of each level in model space
 	private:
+		/*!***********************************************************************
+			\brief
+				Works out the screen size below which each level deviates less
+				than a pixel. Called after ComputeBounds.
+		*************************************************************************/
+		void ComputeLodScreenSizes();
+
+		std::vector<float> mLodScreenSizes{ std::numeric_limits<float>::max() }; //!< Screen size each level is used below
+		glm::vec3 mBoundsCenter{}; //!< Centre of the bounding sphere in model space
+		float mBoundsRadius = 0.f; //!< Radius of the bounding sphere in model space
+		float mUVDensity = 1.f; //!< UV units per model space unit
 	}; // class Model
 } // namespace Borealis
 #endif
\ No newline at end of file
@@ -0,0 +1,94 @@
+/******************************************************************************/
+/*!
+\file		BufferNullImpl.hpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Declares the Null buffers. Vertex data is kept in system memory
+			so the renderers can still write their batches.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef BUFFER_NULL_IMPL_HPP
+#define BUFFER_NULL_IMPL_HPP
+#include <vector>
+#include <Graphics/Buffer.hpp>
+#include <Graphics/RingBuffer.hpp>
+
+namespace Borealis
+{
+	class NullVertexBuffer : public VertexBuffer
+	{
+	public:
+		void Bind() const override {}
+		void Unbind() const override {}
+		void SetLayout(const BufferLayout& layout) override { mLayout = layout; }
+		void SetData(const void* data, uint32_t size) override {}
+		const BufferLayout& GetLayout() const override { return mLayout; }
+
+	private:
+		BufferLayout mLayout; //!< Layout of the buffer
+	}; // class NullVertexBuffer
+
+	class NullElementBuffer : public ElementBuffer
+	{
+	public:
+		/*!***********************************************************************
+			\brief
+				Constructor for NullElementBuffer
+			\param[in] count
+				Number of indices, reported for draws that use the whole buffer
+		*************************************************************************/
+		NullElementBuffer(uint32_t count) : mCount(count) {}
+
+		void Bind() const override {}
+		void Unbind() const override {}
+		uint32_t GetCount() const override { return mCount; }
+
+	private:
+		uint32_t mCount; //!< Number of indices
+	}; // class NullElementBuffer
+
+	class NullRingBuffer : public RingBuffer
+	{
+	public:
+		/*!***********************************************************************
+			\brief
+				Hands out the same scratch memory for every allocation, since
+				nothing reads it after Commit
+			\param[in] size
+				Size to reserve in bytes
+			\param[in] alignment
+				Unused, the offset is always 0
+			\return
+				The allocation
+		*************************************************************************/
+		Allocation Allocate(uint32_t size, uint32_t alignment) override
+		{
+			if (mScratch.size() < size)
+				mScratch.resize(size);
+			return Allocation{ mScratch.data(), 0, size };
+		}
+
+		void Commit(const Allocation& allocation, uint32_t usedSize) override {}
+		void EndFrame() override {}
+		uint32_t GetRendererID() const override { return 0; }
+		bool IsPersistentlyMapped() const override { return true; }
+
+		void Bind() const override {}
+		void Unbind() const override {}
+		void SetLayout(const BufferLayout& layout) override { mLayout = layout; }
+		void SetData(const void* data, uint32_t size) override {}
+		const BufferLayout& GetLayout() const override { return mLayout; }
+
+	private:
+		BufferLayout mLayout;			//!< Layout of the buffer
+		std::vector<uint8_t> mScratch;	//!< Memory the batches are written to
+	}; // class NullRingBuffer
+} // namespace Borealis
+
+#endif
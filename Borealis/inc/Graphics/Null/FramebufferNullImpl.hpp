@@ -0,0 +1,54 @@
+/******************************************************************************/
+/*!
+\file		FramebufferNullImpl.hpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Declares the Null Frame buffer
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef FRAMEBUFFER_NULL_IMPL_HPP
+#define FRAMEBUFFER_NULL_IMPL_HPP
+#include <Graphics/Framebuffer.hpp>
+
+namespace Borealis
+{
+	class NullFrameBuffer : public FrameBuffer
+	{
+	public:
+		/*!***********************************************************************
+			\brief
+				Constructor for NullFrameBuffer
+			\param[in] properties
+				Properties of the frame buffer
+		*************************************************************************/
+		NullFrameBuffer(const FrameBufferProperties& properties) : mProps(properties) {}
+
+		void Bind() override {}
+		void Unbind() override {}
+		void Resize(uint32_t width, uint32_t height) override { mProps.Width = width; mProps.Height = height; }
+
+		/*!***********************************************************************
+			\brief
+				Nothing is rendered, so no entity is ever under the pixel
+			\return
+				-1
+		*************************************************************************/
+		int ReadPixel(uint32_t attachmentIndex, int x, int y) override { return -1; }
+
+		void ClearAttachment(uint32_t attachmentIndex, int value) override {}
+		uint32_t GetColorAttachmentRendererID(uint32_t index = 0) const override { return 0; }
+		uint32_t GetRendererID() const override { return 0; }
+		const FrameBufferProperties& GetProperties() const override { return mProps; }
+
+	private:
+		FrameBufferProperties mProps; //!< Properties of the frame buffer
+	}; // class NullFrameBuffer
+} // namespace Borealis
+
+#endif
@@ -0,0 +1,32 @@
+/******************************************************************************/
+/*!
+\file		GraphicsContextNullImpl.hpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Declares the Null Graphics Context, used when running without a
+			window
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef GRAPHICS_CONTEXT_NULL_IMPL_HPP
+#define GRAPHICS_CONTEXT_NULL_IMPL_HPP
+#include <Graphics/GraphicsContext.hpp>
+
+namespace Borealis
+{
+	class NullGraphicsContext : public GraphicsContext
+	{
+	public:
+		void Init() override {}
+		void SwapBuffers() override {}
+		void MakeCurrent() override {}
+		void DetachCurrent() override {}
+	}; // class NullGraphicsContext
+} // namespace Borealis
+
+#endif
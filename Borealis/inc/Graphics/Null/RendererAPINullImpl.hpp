@@ -0,0 +1,122 @@
+/******************************************************************************/
+/*!
+\file		RendererAPINullImpl.hpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Declares the Null Renderer API. It issues no graphics calls and
+			only counts what would have been drawn, for headless runs.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef RENDERER_API_NULL_IMPL_HPP
+#define RENDERER_API_NULL_IMPL_HPP
+#include <atomic>
+#include <Graphics/RendererAPI.hpp>
+
+namespace Borealis
+{
+	class NullRendererAPI : public RendererAPI
+	{
+	public:
+		struct Statistics
+		{
+			uint64_t DrawCalls = 0;
+			uint64_t Indices = 0;
+			uint64_t Vertices = 0;
+			uint64_t Instances = 0;
+			uint64_t Clears = 0;
+		};
+
+		void Init() override {}
+
+		void Clear() override;
+
+		void SetClearColor(const float& r, const float& g, const float& b, const float& a) override {}
+
+		void SetClearColor(const glm::vec4& color) override {}
+
+		/*!***********************************************************************
+			\brief
+				Records an indexed draw
+			\param[in] VAO
+				The Vertex Array Object to draw
+			\param[in] indexCount
+				The number of indices, 0 to use the whole element buffer
+			\param[in] baseVertex
+				Unused
+		*************************************************************************/
+		void DrawElements(const Ref<VertexArray>& VAO, uint32_t indexCount = 0, uint32_t baseVertex = 0) override;
+
+		/*!***********************************************************************
+			\brief
+				Records a line draw
+			\param[in] VAO
+				The Vertex Array Object to draw
+			\param[in] vertexCount
+				The number of vertices to draw
+			\param[in] firstVertex
+				Unused
+		*************************************************************************/
+		void DrawLines(const Ref<VertexArray>& VAO, uint32_t vertexCount = 0, uint32_t firstVertex = 0) override;
+
+		/*!***********************************************************************
+			\brief
+				Records an instanced draw
+			\param[in] VAO
+				The Vertex Array Object to draw
+			\param[in] vertexCount
+				The number of vertices per instance
+			\param[in] instanceCount
+				The number of instances to draw
+			\param[in] baseInstance
+				Unused
+		*************************************************************************/
+		void DrawInstanced(const Ref<VertexArray>& VAO, uint32_t vertexCount, uint32_t instanceCount, uint32_t baseInstance = 0) override;
+
+		/*!***********************************************************************
+			\brief
+				Records a multi draw of the geometry pool, which has no vertex
+				array to go through DrawElements with
+			\param[in] indexCount
+				Total number of indices of the draws
+			\param[in] instanceCount
+				Number of instances drawn
+		*************************************************************************/
+		static void DrawMultiIndirect(uint64_t indexCount, uint64_t instanceCount);
+
+		void SetViewport(const uint32_t& x, const uint32_t& y, const uint32_t& width, const uint32_t& height) override {}
+
+		uint32_t GetViewportHeight() const override { return 0; }
+
+		void SetLineThickness(const float& thickness) override {}
+
+		/*!***********************************************************************
+			\brief
+				Gets the totals recorded since the last ResetStatistics
+			\return
+				The statistics
+		*************************************************************************/
+		static Statistics GetStatistics();
+
+		/*!***********************************************************************
+			\brief
+				Resets the recorded totals
+		*************************************************************************/
+		static void ResetStatistics();
+
+	private:
+		// Draws are recorded on whichever thread executes the render commands
+		static std::atomic<uint64_t> sDrawCalls;
+		static std::atomic<uint64_t> sIndices;
+		static std::atomic<uint64_t> sVertices;
+		static std::atomic<uint64_t> sInstances;
+		static std::atomic<uint64_t> sClears;
+	}; // class NullRendererAPI
+} // namespace Borealis
+
+#endif
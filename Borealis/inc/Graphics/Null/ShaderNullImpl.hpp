@@ -0,0 +1,66 @@
+/******************************************************************************/
+/*!
+\file		ShaderNullImpl.hpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Declares the Null Shader, which compiles nothing and ignores
+			uniforms
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef SHADER_NULL_IMPL_HPP
+#define SHADER_NULL_IMPL_HPP
+#include <filesystem>
+#include <Graphics/Shader.hpp>
+
+namespace Borealis
+{
+	class NullShader : public Shader
+	{
+	public:
+		/*!***********************************************************************
+			\brief
+				Constructor for NullShader. Named after the file like the OpenGL
+				shader, so the shader library finds it.
+			\param[in] filepath
+				Path of the shader source
+		*************************************************************************/
+		NullShader(const std::string& filepath) : mName(std::filesystem::path(filepath).stem().string()) {}
+
+		/*!***********************************************************************
+			\brief
+				Constructor for NullShader
+			\param[in] name
+				Name of the shader
+			\param[in] vertexSrc
+				Unused
+			\param[in] fragmentSrc
+				Unused
+		*************************************************************************/
+		NullShader(const std::string& name, const std::string& vertexSrc, const std::string& fragmentSrc) : mName(name) {}
+
+		void Bind() const override {}
+		void Unbind() const override {}
+		const std::string& GetName() const override { return mName; }
+
+		void Set(const char* name, const int& value) override {}
+		void Set(const char* name, const int* values, const uint32_t& count) override {}
+		void Set(const char* name, const float& value) override {}
+		void Set(const char* name, const glm::vec2& value) override {}
+		void Set(const char* name, const glm::vec3& value) override {}
+		void Set(const char* name, const glm::vec4& value) override {}
+		void Set(const char* name, const glm::mat3& value) override {}
+		void Set(const char* name, const glm::mat4& value) override {}
+		void SetBlockBinding(const char* name, uint32_t binding) override {}
+
+	private:
+		std::string mName; //!< Name of the shader
+	}; // class NullShader
+} // namespace Borealis
+
+#endif
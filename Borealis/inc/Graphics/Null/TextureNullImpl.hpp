@@ -0,0 +1,56 @@
+/******************************************************************************/
+/*!
+\file		TextureNullImpl.hpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Declares the Null Texture. Every texture is valid so scenes load
+			without their image data.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef TEXTURE_NULL_IMPL_HPP
+#define TEXTURE_NULL_IMPL_HPP
+#include <Graphics/Texture.hpp>
+
+namespace Borealis
+{
+	class NullTexture2D : public Texture2D
+	{
+	public:
+		/*!***********************************************************************
+			\brief
+				Constructor for NullTexture2D
+			\param[in] textureInfo
+				Size of the texture
+		*************************************************************************/
+		NullTexture2D(const TextureInfo& textureInfo) : mWidth(textureInfo.width), mHeight(textureInfo.height) {}
+
+		/*!***********************************************************************
+			\brief
+				Constructor for NullTexture2D. The file is not read, the texture
+				is 1x1.
+			\param[in] path
+				Path of the texture
+		*************************************************************************/
+		NullTexture2D(const std::string& path) {}
+
+		uint32_t GetWidth() const override { return mWidth; }
+		uint32_t GetHeight() const override { return mHeight; }
+		uint32_t GetRendererID() const override { return 0; }
+		void SetData(void* data, uint32_t size) override {}
+		void Bind(uint32_t unit = 0) const override {}
+		bool IsValid() const override { return true; }
+		bool operator==(const Texture& other) const override { return this == &other; }
+
+	private:
+		uint32_t mWidth = 1;	//!< Width of the texture
+		uint32_t mHeight = 1;	//!< Height of the texture
+	}; // class NullTexture2D
+} // namespace Borealis
+
+#endif
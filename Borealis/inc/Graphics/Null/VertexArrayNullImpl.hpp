@@ -0,0 +1,37 @@
+/******************************************************************************/
+/*!
+\file		VertexArrayNullImpl.hpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Declares the Null Vertex Array
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef VERTEX_ARRAY_NULL_IMPL_HPP
+#define VERTEX_ARRAY_NULL_IMPL_HPP
+#include <Graphics/VertexArray.hpp>
+
+namespace Borealis
+{
+	class NullVertexArray : public VertexArray
+	{
+	public:
+		void Bind() const override {}
+		void Unbind() const override {}
+		void AddVertexBuffer(const Ref<VertexBuffer>& VBO) override { mVBOs.push_back(VBO); }
+		void SetElementBuffer(const Ref<ElementBuffer>& EBO) override { mEBO = EBO; }
+		const std::vector<Ref<VertexBuffer>>& GetVertexBuffers() const override { return mVBOs; }
+		const Ref<ElementBuffer> GetElementBuffer() const override { return mEBO; }
+
+	private:
+		std::vector<Ref<VertexBuffer>> mVBOs;	//!< Attached vertex buffers
+		Ref<ElementBuffer> mEBO;				//!< Attached element buffer
+	}; // class NullVertexArray
+} // namespace Borealis
+
+#endif
@@ -86,6 +86,7 @@ namespace Borealis
 		void Unbind() const override;
 	private:
 		uint32_t mRendererID; //!< Renderer ID of the buffer
+		uint32_t mSize;		  //!< Size of the buffer in bytes
 		BufferLayout mLayout; //!< Layout of the buffer
 	};
 
@@ -100,6 +100,14 @@ namespace Borealis
 		*************************************************************************/
 		uint32_t GetColorAttachmentRendererID(uint32_t index = 0) const { return mColorAttachments[index]; }
 
+		/*!***********************************************************************
+			\brief
+				Get the renderer ID of the Frame Buffer
+			\return
+				Renderer ID of the Frame Buffer
+		*************************************************************************/
+		uint32_t GetRendererID() const override { return mRendererID; }
+
 		/*!***********************************************************************
 			\brief
 				Recreates the Attachments of the FrameBuffer
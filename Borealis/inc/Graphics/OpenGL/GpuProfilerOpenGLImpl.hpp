@@ -0,0 +1,103 @@
+/******************************************************************************/
+/*!
+\file		GpuProfilerOpenGLImpl.hpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Declares the OpenGL GPU profiler, built on GL_TIMESTAMP queries
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef GPU_PROFILER_OPENGL_IMPL_HPP
+#define GPU_PROFILER_OPENGL_IMPL_HPP
+#include <vector>
+#include <glad/glad.h>
+#include <Graphics/GpuProfiler.hpp>
+
+namespace Borealis
+{
+	class OpenGLGpuProfiler : public GpuProfiler
+	{
+	public:
+		/*!***********************************************************************
+			\brief
+				Constructor for OpenGLGpuProfiler
+			\param[in] framesInFlight
+				Number of frames of queries that can be pending at once
+		*************************************************************************/
+		explicit OpenGLGpuProfiler(uint32_t framesInFlight);
+
+		/*!***********************************************************************
+			\brief
+				Destructor for OpenGLGpuProfiler
+		*************************************************************************/
+		~OpenGLGpuProfiler() override;
+
+		/*!***********************************************************************
+			\brief
+				Writes a timestamp query for the start of a zone
+			\param[in] name
+				Static name of the zone
+		*************************************************************************/
+		void Begin(const char* name) override;
+
+		/*!***********************************************************************
+			\brief
+				Writes a timestamp query for the end of the innermost zone
+		*************************************************************************/
+		void End() override;
+
+		/*!***********************************************************************
+			\brief
+				Reads back every frame whose queries are available and moves on
+				to the next set of queries
+		*************************************************************************/
+		void EndFrame() override;
+
+	private:
+		struct Zone
+		{
+			const char* mName;
+			uint32_t mBeginQuery;
+			uint32_t mEndQuery;
+			uint32_t mDepth;
+		};
+
+		struct Frame
+		{
+			uint64_t mIndex = 0;			//!< Frame that issued the queries
+			std::vector<GLuint> mQueries;	//!< Query objects, grown as needed and reused
+			uint32_t mUsed = 0;				//!< Queries written this frame
+			std::vector<Zone> mZones;
+			bool mPending = false;			//!< Queries written but not read back yet
+			bool mDropped = false;			//!< Every set of queries was in flight, nothing is timed this frame
+		};
+
+		/*!***********************************************************************
+			\brief
+				Writes a timestamp into the next free query of the frame
+			\return
+				Index of the query
+		*************************************************************************/
+		uint32_t WriteTimestamp(Frame& frame);
+
+		/*!***********************************************************************
+			\brief
+				Reads the frame back if the GPU has finished it
+			\return
+				True if the frame's queries are free to reuse
+		*************************************************************************/
+		bool Resolve(Frame& frame);
+
+		std::vector<Frame> mFrames;
+		std::vector<uint32_t> mOpenZones;	//!< Zones begun but not ended, innermost last
+		uint32_t mCurrent = 0;
+		uint64_t mFrameIndex = 0;
+	};
+}
+
+#endif
@@ -42,6 +42,18 @@ namespace Borealis
 				Swap the buffers
 		*************************************************************************/
 		virtual void SwapBuffers() override;
+
+		/*!***********************************************************************
+			\brief
+				Makes the context current on the calling thread
+		*************************************************************************/
+		virtual void MakeCurrent() override;
+
+		/*!***********************************************************************
+			\brief
+				Releases the context from the calling thread
+		*************************************************************************/
+		virtual void DetachCurrent() override;
 	private:
 		GLFWwindow* mWindowHandle; //!< The window handle for the context
 	}; // class OpenGLContext
@@ -0,0 +1,153 @@
+/******************************************************************************/
+/*!
+\file		PickingServiceOpenGLImpl.hpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Declares the OpenGL picking service. Reads go into pixel pack
+			buffers guarded by fences, and are mapped once the fence signals.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef PICKING_SERVICE_OPENGL_IMPL_HPP
+#define PICKING_SERVICE_OPENGL_IMPL_HPP
+#include <mutex>
+#include <vector>
+#include <glad/glad.h>
+#include <Graphics/PickingService.hpp>
+
+namespace Borealis
+{
+	class OpenGLPickingService : public PickingService
+	{
+	public:
+		/*!***********************************************************************
+			\brief
+				Constructor for OpenGLPickingService
+			\param[in] ringSize
+				Number of pixel pack buffers
+		*************************************************************************/
+		explicit OpenGLPickingService(uint32_t ringSize);
+
+		/*!***********************************************************************
+			\brief
+				Destructor for OpenGLPickingService
+		*************************************************************************/
+		~OpenGLPickingService() override;
+
+		/*!***********************************************************************
+			\brief
+				Queues a read of a single pixel of an integer attachment
+			\param[in] frameBuffer
+				Frame Buffer to read from
+			\param[in] attachmentIndex
+				Index of the integer attachment
+			\param[in] x
+				X coordinate of the pixel
+			\param[in] y
+				Y coordinate of the pixel
+		*************************************************************************/
+		void QueryPixel(const Ref<FrameBuffer>& frameBuffer, uint32_t attachmentIndex, int x, int y) override;
+
+		/*!***********************************************************************
+			\brief
+				Queues a read of a rectangle of an integer attachment
+			\param[in] frameBuffer
+				Frame Buffer to read from
+			\param[in] attachmentIndex
+				Index of the integer attachment
+			\param[in] x0
+				X coordinate of one corner
+			\param[in] y0
+				Y coordinate of one corner
+			\param[in] x1
+				X coordinate of the opposite corner
+			\param[in] y1
+				Y coordinate of the opposite corner
+		*************************************************************************/
+		void QueryRect(const Ref<FrameBuffer>& frameBuffer, uint32_t attachmentIndex, int x0, int y0, int x1, int y1) override;
+
+		/*!***********************************************************************
+			\brief
+				Collects the reads whose fences have signalled
+		*************************************************************************/
+		void Update() override;
+
+		/*!***********************************************************************
+			\brief
+				Takes the newest pixel result collected since the last call
+			\param[out] value
+				Pixel value
+			\return
+				True if a new result was available
+		*************************************************************************/
+		bool PollPixel(int& value) override;
+
+		/*!***********************************************************************
+			\brief
+				Takes the newest rectangle result collected since the last call
+			\param[out] values
+				Unique values inside the rectangle, excluding -1
+			\return
+				True if a new result was available
+		*************************************************************************/
+		bool PollRect(std::vector<int>& values) override;
+
+	private:
+		enum class QueryType
+		{
+			Pixel,
+			Rect
+		};
+
+		struct Slot
+		{
+			uint32_t mBuffer = 0;		//!< Pixel pack buffer
+			uint32_t mCapacity = 0;		//!< Size of the buffer in bytes
+			GLsync mFence = nullptr;	//!< Signals when the read has landed, null if the slot is free
+			QueryType mType = QueryType::Pixel;
+			uint32_t mCount = 0;		//!< Pixels read
+			uint64_t mSequence = 0;		//!< Order the read was issued in
+		};
+
+		// Shared with the render commands, which may run after the service is destroyed
+		struct State
+		{
+			// Render thread only
+			std::vector<Slot> mSlots;
+			uint32_t mNext = 0;
+			uint64_t mSequence = 0;
+
+			// Results, guarded by mMutex
+			std::mutex mMutex;
+			bool mPixelReady = false;
+			int mPixel = -1;
+			uint64_t mPixelSequence = 0;
+			bool mRectReady = false;
+			std::vector<int> mRect;
+			uint64_t mRectSequence = 0;
+		};
+
+		/*!***********************************************************************
+			\brief
+				Copies a region of an attachment into the next free slot
+		*************************************************************************/
+		static void Issue(State& state, const Ref<FrameBuffer>& frameBuffer, uint32_t attachmentIndex, QueryType type, int x, int y, int width, int height);
+
+		/*!***********************************************************************
+			\brief
+				Reads back a slot if its fence has signalled
+			\return
+				True if the slot is free afterwards
+		*************************************************************************/
+		static bool Collect(State& state, Slot& slot);
+
+		Ref<State> mState;
+	};
+}
+
+#endif
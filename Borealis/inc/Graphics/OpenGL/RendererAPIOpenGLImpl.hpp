@@ -63,8 +63,10 @@ namespace Borealis
 				The VertexArray to draw
 			\param indexCount
 				The number of indices to draw
+			\param baseVertex
+				Offset added to every index
 		*************************************************************************/
-		void DrawElements(const Ref<VertexArray>& VAO, uint32_t indexCount = 0) override;
+		void DrawElements(const Ref<VertexArray>& VAO, uint32_t indexCount = 0, uint32_t baseVertex = 0) override;
 
 		/*!***********************************************************************
 			\brief
@@ -73,8 +75,24 @@ namespace Borealis
 				The VertexArray to draw
 			\param vertexCount
 				The number of vertices to draw
+			\param firstVertex
+				The first vertex to draw
 		*************************************************************************/
-		void DrawLines(const Ref<VertexArray>& VAO, uint32_t vertexCount = 0) override;
+		void DrawLines(const Ref<VertexArray>& VAO, uint32_t vertexCount = 0, uint32_t firstVertex = 0) override;
+
+		/*!***********************************************************************
+			\brief
+				Draw instanced triangles of the vertex array
+			\param VAO
+				The VertexArray to draw
+			\param vertexCount
+				The number of vertices per instance
+			\param instanceCount
+				The number of instances to draw
+			\param baseInstance
+				The first instance of the per instance buffers to draw
+		*************************************************************************/
+		void DrawInstanced(const Ref<VertexArray>& VAO, uint32_t vertexCount, uint32_t instanceCount, uint32_t baseInstance = 0) override;
 
 		/*!***********************************************************************
 			\brief
@@ -90,6 +108,14 @@ namespace Borealis
 		*************************************************************************/
 		void SetViewport(const uint32_t& x, const uint32_t& y, const uint32_t& width, const uint32_t& height) override;
 
+		/*!***********************************************************************
+			\brief
+				Get the height of the current viewport
+			\return
+				The height in pixels
+		*************************************************************************/
+		uint32_t GetViewportHeight() const override;
+
 		/*!***********************************************************************
 			\brief
 				Set the line thickness of the RendererAPI
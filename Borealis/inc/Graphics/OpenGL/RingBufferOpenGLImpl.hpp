@@ -0,0 +1,158 @@
+/******************************************************************************/
+/*!
+\file		RingBufferOpenGLImpl.hpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Declares the OpenGL streaming ring buffer. Uses persistent
+			coherent mapping when the context supports glBufferStorage, and
+			unsynchronised mapping of each allocation otherwise.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef RING_BUFFER_OPENGL_IMPL_HPP
+#define RING_BUFFER_OPENGL_IMPL_HPP
+#include <vector>
+#include <Graphics/RingBuffer.hpp>
+
+namespace Borealis
+{
+	class OpenGLRingBuffer : public RingBuffer
+	{
+	public:
+		/*!***********************************************************************
+			\brief
+				Constructor for OpenGLRingBuffer
+			\param[in] regionSize
+				Size of each frame's region in bytes
+			\param[in] regionCount
+				Number of frames in flight
+		*************************************************************************/
+		OpenGLRingBuffer(uint32_t regionSize, uint32_t regionCount);
+
+		/*!***********************************************************************
+			\brief
+				Destructor for OpenGLRingBuffer
+		*************************************************************************/
+		~OpenGLRingBuffer();
+
+		/*!***********************************************************************
+			\brief
+				Reserves memory in the current frame's region
+			\param[in] size
+				Size to reserve in bytes
+			\param[in] alignment
+				Alignment of the offset
+			\return
+				The allocation
+		*************************************************************************/
+		Allocation Allocate(uint32_t size, uint32_t alignment) override;
+
+		/*!***********************************************************************
+			\brief
+				Makes the written part of an allocation visible to the GPU
+			\param[in] allocation
+				Allocation returned by the last Allocate
+			\param[in] usedSize
+				Number of bytes written
+		*************************************************************************/
+		void Commit(const Allocation& allocation, uint32_t usedSize) override;
+
+		/*!***********************************************************************
+			\brief
+				Fences the current region and moves to the next one
+		*************************************************************************/
+		void EndFrame() override;
+
+		/*!***********************************************************************
+			\brief
+				Get the renderer ID of the buffer
+			\return
+				Renderer ID of the buffer
+		*************************************************************************/
+		uint32_t GetRendererID() const override { return mRendererID; }
+
+		/*!***********************************************************************
+			\brief
+				Checks if the buffer is persistently mapped
+			\return
+				True if writes go straight to the mapped storage
+		*************************************************************************/
+		bool IsPersistentlyMapped() const override { return mMapped != nullptr; }
+
+		/*!***********************************************************************
+			\brief
+				Appends the data to the current frame's region
+			\param[in] data
+				Pointer to the data
+			\param[in] size
+				Size of the data
+		*************************************************************************/
+		void SetData(const void* data, uint32_t size) override;
+
+		/*!***********************************************************************
+			\brief
+				Set the layout of the buffer
+			\param[in] layout
+				Layout of the buffer
+		*************************************************************************/
+		void SetLayout(const BufferLayout& layout) override { mLayout = layout; }
+
+		/*!***********************************************************************
+			\brief
+				Get the layout of the buffer
+			\return
+				Layout of the buffer
+		*************************************************************************/
+		const BufferLayout& GetLayout() const override { return mLayout; }
+
+		/*!***********************************************************************
+			\brief
+				Bind the buffer
+		*************************************************************************/
+		void Bind() const override;
+
+		/*!***********************************************************************
+			\brief
+				Unbind the buffer
+		*************************************************************************/
+		void Unbind() const override;
+
+	private:
+		/*!***********************************************************************
+			\brief
+				Waits for and deletes a region's fence
+			\param[in] region
+				Index of the region
+		*************************************************************************/
+		void WaitForRegion(uint32_t region);
+		/*!***********************************************************************
+			\brief
+				Creates the buffer's storage, mapping it if it can be
+		*************************************************************************/
+		void CreateStorage();
+		/*!***********************************************************************
+			\brief
+				Moves to a new buffer with bigger regions. The old buffer is
+				released straight away, the driver keeps it alive until the
+				draws reading it are done.
+			\param[in] minRegionSize
+				Smallest region size that fits the allocation that overflowed
+		*************************************************************************/
+		void Grow(uint32_t minRegionSize);
+
+		uint32_t mRendererID;			//!< Renderer ID of the buffer
+		BufferLayout mLayout;			//!< Layout of the buffer
+		uint8_t* mMapped = nullptr;		//!< Persistent mapping, null when unsupported
+		uint32_t mRegionSize;			//!< Size of each region
+		uint32_t mRegion = 0;			//!< Region written this frame
+		uint32_t mHead = 0;				//!< Next free byte in the region
+		std::vector<void*> mFences;		//!< Fence per region, signalled when the GPU is done with it
+	};
+}
+
+#endif
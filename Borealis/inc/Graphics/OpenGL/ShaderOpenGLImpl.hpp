@@ -29,6 +29,16 @@ namespace Borealis
 		*************************************************************************/
 		OpenGLShader(const std::string& filepath);
 
+		/*!***********************************************************************
+			\brief
+				Constructor for a variant of a shader file
+			\param filepath
+				The file path to the shader file
+			\param defines
+				Names defined after the version line of every stage
+		*************************************************************************/
+		OpenGLShader(const std::string& filepath, const std::vector<std::string>& defines);
+
 		/*!***********************************************************************
 			\brief
 				Constructor for the OpenGL Shader class
@@ -85,6 +95,17 @@ namespace Borealis
 		void Set(const char* name, const glm::mat3& value) override;
 		void Set(const char* name, const glm::mat4& value) override;
 
+		/*!***********************************************************************
+			\brief
+				Attaches a uniform block to a binding point, ignored when the
+				block was optimised out
+			\param name
+				The name of the block
+			\param binding
+				The binding point
+		*************************************************************************/
+		void SetBlockBinding(const char* name, uint32_t binding) override;
+
 	private:
 		using GLenum = unsigned int;
 
@@ -135,6 +156,37 @@ namespace Borealis
 		*************************************************************************/
 		std::unordered_map<GLenum, std::string> PreProcess(const std::string& source);
 
+		/*!***********************************************************************
+			\brief
+				Adds the defines of a variant to every stage, after the version
+				line
+			\param shaderSources
+				The unordered map of the shader source
+			\param defines
+				Names to define
+		*************************************************************************/
+		void InjectDefines(std::unordered_map<GLenum, std::string>& shaderSources, const std::vector<std::string>& defines);
+
+		/*!***********************************************************************
+			\brief
+				Loads a linked program from the program binary cache
+			\param key
+				Hash of the sources and the driver
+			\return
+				The program, 0 if it is not cached or the driver rejects it
+		*************************************************************************/
+		unsigned int LoadProgramBinary(uint64_t key);
+
+		/*!***********************************************************************
+			\brief
+				Saves a linked program to the program binary cache
+			\param program
+				The program
+			\param key
+				Hash of the sources and the driver
+		*************************************************************************/
+		void SaveProgramBinary(unsigned int program, uint64_t key);
+
 		/*!***********************************************************************
 			\brief
 				Compiles the shader
@@ -0,0 +1,125 @@
+/******************************************************************************/
+/*!
+\file		SpriteTextureCacheOpenGLImpl.hpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Declares the OpenGL sprite texture cache. Pages are 2D texture
+			arrays filled with glCopyImageSubData, so compressed textures are
+			copied on the GPU without a round trip.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef SPRITE_TEXTURE_CACHE_OPENGL_IMPL_HPP
+#define SPRITE_TEXTURE_CACHE_OPENGL_IMPL_HPP
+#include <array>
+#include <unordered_map>
+#include <vector>
+#include <glad/glad.h>
+#include <Graphics/SpriteTextureCache.hpp>
+
+namespace Borealis
+{
+	class OpenGLSpriteTextureCache : public SpriteTextureCache
+	{
+	public:
+		/*!***********************************************************************
+			\brief
+				Constructor for OpenGLSpriteTextureCache
+		*************************************************************************/
+		OpenGLSpriteTextureCache();
+
+		/*!***********************************************************************
+			\brief
+				Destructor for OpenGLSpriteTextureCache
+		*************************************************************************/
+		~OpenGLSpriteTextureCache();
+
+		/*!***********************************************************************
+			\brief
+				Gets where a texture lives in the cache, copying it into a page
+				the first time it is seen
+			\param[in] texture
+				Texture to look up
+			\param[out] location
+				Page and layer of the texture
+			\return
+				False if the texture cannot be placed in an array
+		*************************************************************************/
+		bool Acquire(Texture2D* texture, Location& location) override;
+
+		/*!***********************************************************************
+			\brief
+				Binds a page
+			\param[in] page
+				Page to bind
+			\param[in] unit
+				Texture unit to bind the page to
+		*************************************************************************/
+		void BindPage(uint32_t page, uint32_t unit) const override;
+
+		/*!***********************************************************************
+			\brief
+				Releases the layers of textures that have been destroyed
+		*************************************************************************/
+		void CollectGarbage() override;
+
+		/*!***********************************************************************
+			\brief
+				Checks if the context can copy textures into arrays
+			\return
+				True if glCopyImageSubData and glTexStorage3D are available
+		*************************************************************************/
+		static bool IsSupported();
+
+	private:
+		struct PageFormat
+		{
+			uint32_t mWidth;
+			uint32_t mHeight;
+			uint32_t mLevels;
+			GLenum mInternalFormat;
+			std::array<GLint, 4> mSwizzle;
+
+			bool operator==(const PageFormat& other) const = default;
+		};
+
+		struct Page
+		{
+			PageFormat mFormat;
+			uint32_t mRendererID = 0;
+			uint32_t mCapacity = 0;					//!< Layers allocated
+			uint32_t mUsed = 0;						//!< Layers handed out, including freed ones
+			std::vector<uint32_t> mFreeLayers;		//!< Layers of destroyed textures
+		};
+
+		struct Entry
+		{
+			std::weak_ptr<Texture> mTexture;		//!< Detects the texture being destroyed
+			Location mLocation;
+		};
+
+		/*!***********************************************************************
+			\brief
+				Finds a layer for a texture of the given format, growing or
+				adding a page if needed
+		*************************************************************************/
+		Location AllocateLayer(const PageFormat& format);
+
+		/*!***********************************************************************
+			\brief
+				Reallocates a page with more layers, keeping its contents
+		*************************************************************************/
+		void Grow(Page& page, uint32_t capacity);
+
+		std::vector<Page> mPages;
+		std::unordered_map<const Texture2D*, Entry> mEntries;
+		uint32_t mMaxLayers;
+	};
+}
+
+#endif
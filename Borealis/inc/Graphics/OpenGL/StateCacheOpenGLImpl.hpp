@@ -0,0 +1,150 @@
+/******************************************************************************/
+/*!
+\file		StateCacheOpenGLImpl.hpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Declares the OpenGL state cache. Shadows the bindings and fixed
+			function state of the context so the backend only passes on the
+			calls that change something.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef STATE_CACHE_OPENGL_IMPL_HPP
+#define STATE_CACHE_OPENGL_IMPL_HPP
+#include <cstdint>
+
+namespace Borealis
+{
+	/*!***********************************************************************
+		\brief
+			Every program, vertex array, buffer, texture, framebuffer and
+			blend/depth change of the OpenGL backend goes through here.
+			There is one context, used by one thread at a time, so the
+			shadow is plain static state. Code that changes the context
+			behind the cache's back has to restore it or call Reset.
+	*************************************************************************/
+	class OpenGLStateCache
+	{
+	public:
+		using GLenum = unsigned int;
+		using GLuint = unsigned int;
+
+		/*!***********************************************************************
+			\brief
+				Forgets everything, the next call of each kind is issued
+		*************************************************************************/
+		static void Reset();
+
+		/*!***********************************************************************
+			\brief
+				glUseProgram
+		*************************************************************************/
+		static void UseProgram(GLuint program);
+
+		/*!***********************************************************************
+			\brief
+				glBindVertexArray. The element buffer binding belongs to the
+				vertex array, so it is forgotten on every change.
+		*************************************************************************/
+		static void BindVertexArray(GLuint vertexArray);
+
+		/*!***********************************************************************
+			\brief
+				glBindBuffer, targets the cache does not track are always issued
+		*************************************************************************/
+		static void BindBuffer(GLenum target, GLuint buffer);
+
+		/*!***********************************************************************
+			\brief
+				glBindBufferRange, which also binds the buffer to the target
+			\param[in] target
+				GL_UNIFORM_BUFFER is tracked, other targets are always issued
+			\param[in] index
+				Binding point
+			\param[in] buffer
+				Buffer to bind
+			\param[in] offset
+				Start of the range in bytes
+			\param[in] size
+				Size of the range in bytes
+		*************************************************************************/
+		static void BindBufferRange(GLenum target, uint32_t index, GLuint buffer, int64_t offset, int64_t size);
+
+		/*!***********************************************************************
+			\brief
+				glActiveTexture
+			\param[in] unit
+				Unit index, not GL_TEXTURE0 based
+		*************************************************************************/
+		static void ActiveTexture(uint32_t unit);
+
+		/*!***********************************************************************
+			\brief
+				glBindTexture on the active unit, for uploads
+		*************************************************************************/
+		static void BindTexture(GLenum target, GLuint texture);
+
+		/*!***********************************************************************
+			\brief
+				Binds a texture for sampling, selecting the unit only when the
+				binding changes
+		*************************************************************************/
+		static void BindTextureUnit(uint32_t unit, GLenum target, GLuint texture);
+
+		/*!***********************************************************************
+			\brief
+				glBindFramebuffer. GL_FRAMEBUFFER sets both the draw and read
+				bindings.
+		*************************************************************************/
+		static void BindFramebuffer(GLenum target, GLuint framebuffer);
+
+		/*!***********************************************************************
+			\brief
+				Framebuffer bound to GL_DRAW_FRAMEBUFFER or GL_READ_FRAMEBUFFER,
+				queried from the driver when unknown
+		*************************************************************************/
+		static GLuint GetFramebuffer(GLenum target);
+
+		/*!***********************************************************************
+			\brief
+				glEnable or glDisable
+		*************************************************************************/
+		static void SetCapability(GLenum capability, bool enabled);
+
+		/*!***********************************************************************
+			\brief
+				glBlendFunc
+		*************************************************************************/
+		static void BlendFunc(GLenum source, GLenum destination);
+
+		/*!***********************************************************************
+			\brief
+				glDepthFunc
+		*************************************************************************/
+		static void DepthFunc(GLenum function);
+
+		/*!***********************************************************************
+			\brief
+				glDepthMask
+		*************************************************************************/
+		static void DepthMask(bool write);
+
+		/*!***********************************************************************
+			\brief
+				Deleting an object unbinds it, and the driver may hand its name
+				out again. These delete and forget the shadowed bindings to it.
+		*************************************************************************/
+		static void DeleteProgram(GLuint program);
+		static void DeleteVertexArrays(int32_t count, const GLuint* vertexArrays);
+		static void DeleteBuffers(int32_t count, const GLuint* buffers);
+		static void DeleteTextures(int32_t count, const GLuint* textures);
+		static void DeleteFramebuffers(int32_t count, const GLuint* framebuffers);
+	};
+}
+
+#endif
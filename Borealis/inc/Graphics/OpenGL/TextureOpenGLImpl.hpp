@@ -32,6 +32,16 @@ namespace Borealis
 		*************************************************************************/
 		OpenGLTexture2D(const std::string& path);
 
+		/*!***********************************************************************
+			\brief
+				Constructor for OpenGL Texture2D from an image read from its file
+			\param[in] path
+				Path the image was read from, streamed levels are read from it
+			\param[in] image
+				Image read with gli::load
+		*************************************************************************/
+		OpenGLTexture2D(const std::string& path, const gli::texture& image);
+
 		/*!***********************************************************************
 			\brief
 				Constructor for OpenGL Texture2D
@@ -80,6 +90,53 @@ namespace Borealis
 		*************************************************************************/
 		uint32_t GetRendererID() const override { return mRendererID; }
 
+		/*!***********************************************************************
+			\brief
+				Get the internal format of the texture
+			\return
+				Internal format of the texture
+		*************************************************************************/
+		GLenum GetInternalFormat() const { return mInternalFormat; }
+
+		/*!***********************************************************************
+			\brief
+				Get the number of mip levels of the texture
+			\return
+				Number of mip levels
+		*************************************************************************/
+		uint32_t GetMipLevels() const { return mMipLevels; }
+
+		/*!***********************************************************************
+			\brief
+				Uploads mip levels read by the texture streamer
+			\param[in] firstLevel
+				Finest level in the data
+			\param[in] data
+				Contents of the levels down to the resident ones, finest first
+		*************************************************************************/
+		void UploadMips(uint32_t firstLevel, std::vector<uint8_t> data) override;
+
+		/*!***********************************************************************
+			\brief
+				Frees the mip levels finer than a level
+			\param[in] firstLevel
+				Finest level to keep
+		*************************************************************************/
+		void EvictMips(uint32_t firstLevel) override;
+
+		/*!***********************************************************************
+			\brief
+				Reads a mip level from the texture file, for copies that need
+				levels the streamer has not uploaded. Blocks the caller.
+			\param[in] level
+				Level to read
+			\param[out] data
+				Contents of the level
+			\return
+				False if the texture is not streamed or the read failed
+		*************************************************************************/
+		bool ReadMip(uint32_t level, std::vector<uint8_t>& data) const;
+
 		/*!***********************************************************************
 			\brief
 				Bind the texture
@@ -105,6 +162,10 @@ namespace Borealis
 		uint32_t mRendererID; // Renderer ID of the texture
 		uint32_t mWidth, mHeight, mChannels; // Width, Height and Channels of the texture
 		GLenum mInternalFormat, mDataFormat; // Internal Format and Data Format of the texture
+		uint32_t mMipLevels = 1; // Number of mip levels
+		uint64_t mGpuBytes = 0; // Video memory used by the resident mip levels
+		uint32_t mResidentMip = 0; // Finest mip level uploaded
+		std::shared_ptr<const TextureStreamer::MipLayout> mStreamLayout; // Where the levels are in the file, null if not streamed
 	};
 }
 
@@ -79,8 +79,33 @@ namespace Borealis
 				The Element Buffer of the Vertex Array
 		*************************************************************************/
 		const Ref<ElementBuffer> GetElementBuffer() const override { return mEBO; }
+
+		/*!***********************************************************************
+			\brief
+				Points the per instance attributes at a later instance, for
+				contexts without base instance draws. The Vertex Array must be
+				bound.
+			\param baseInstance
+				Instance the attributes start at
+		*************************************************************************/
+		void SetBaseInstance(uint32_t baseInstance);
 	private:
+		/*!***********************************************************************
+			\brief
+				Specifies the attributes of a Vertex Buffer, starting at an offset
+		*************************************************************************/
+		void SetAttributes(const Ref<VertexBuffer>& VBO, uint32_t firstIndex, uint32_t offset) const;
+
 		std::vector<Ref<VertexBuffer>> mVBOs; //!< The Vertex Buffers of the Vertex Array
+		std::vector<uint32_t> mFirstAttributes; //!< First attribute index of each Vertex Buffer
+		struct RingBinding
+		{
+			uint32_t mIndex; //!< Index of the ring buffer in mVBOs
+			uint32_t mBufferID; //!< Buffer its attributes were specified with
+		};
+		mutable std::vector<RingBinding> mRingBindings; //!< Ring buffers, which move to a new buffer when they grow
+		uint32_t mAttributeCount = 0; //!< Attribute indices used so far
+		uint32_t mBaseInstance = 0; //!< Instance the per instance attributes currently start at
 		Ref<ElementBuffer> mEBO; //!< The Element Buffer of the Vertex Array
 		uint32_t mRendererID; //!< The Renderer ID of the Vertex Array
 	};
@@ -0,0 +1,130 @@
+/******************************************************************************/
+/*!
+\file		ParticleSystem.hpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Declares the particle system. Particles are stored as structure of
+			arrays, simulated with SSE across the job system and drawn as
+			Renderer2D sprite instances.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef PARTICLE_SYSTEM_HPP
+#define PARTICLE_SYSTEM_HPP
+#include <random>
+#include <vector>
+#include <glm/glm.hpp>
+#include <Core/Core.hpp>
+#include <Graphics/Texture.hpp>
+
+namespace Borealis
+{
+	struct ParticleProps
+	{
+		glm::vec3 Position = glm::vec3(0.0f);
+		glm::vec3 Velocity = glm::vec3(0.0f);
+		glm::vec3 VelocityVariation = glm::vec3(0.0f);	//!< Random spread added to the velocity, per axis
+		glm::vec4 ColourBegin = glm::vec4(1.0f);
+		glm::vec4 ColourEnd = glm::vec4(1.0f);
+		float SizeBegin = 1.0f;
+		float SizeEnd = 0.0f;
+		float SizeVariation = 0.0f;
+		float LifeTime = 1.0f;							//!< Seconds
+	};
+
+	class ParticleSystem
+	{
+	public:
+		/*!***********************************************************************
+			\brief
+				Constructor for the particle system
+			\param[in] maxParticles
+				Number of particles that can be alive at once
+		*************************************************************************/
+		explicit ParticleSystem(uint32_t maxParticles = 1000000);
+
+		/*!***********************************************************************
+			\brief
+				Spawns particles. Particles past the capacity are dropped.
+			\param[in] props
+				Properties of the particles
+			\param[in] count
+				Number of particles to spawn
+		*************************************************************************/
+		void Emit(const ParticleProps& props, uint32_t count = 1);
+
+		/*!***********************************************************************
+			\brief
+				Moves the particles and removes the ones that have expired
+			\param[in] dt
+				Delta time in seconds
+		*************************************************************************/
+		void Update(float dt);
+
+		/*!***********************************************************************
+			\brief
+				Builds a sprite instance per particle and submits them to
+				Renderer2D. Call between Renderer2D::Begin and End.
+			\param[in] texture
+				Texture of the particles, null for untextured
+			\param[in] entityID
+				Entity ID written to the picking buffer
+		*************************************************************************/
+		void Submit(Texture2D* texture = nullptr, int entityID = -1);
+
+		/*!***********************************************************************
+			\brief
+				Gets the number of live particles
+			\return
+				Particle count
+		*************************************************************************/
+		uint32_t GetActiveCount() const { return mCount; }
+
+		/*!***********************************************************************
+			\brief
+				Gets the number of particles that can be alive at once
+			\return
+				Capacity
+		*************************************************************************/
+		uint32_t GetCapacity() const { return mCapacity; }
+
+		/*!***********************************************************************
+			\brief
+				Removes every particle
+		*************************************************************************/
+		void Clear() { mCount = 0; }
+
+	private:
+		/*!***********************************************************************
+			\brief
+				Moves the last live particle into a slot
+		*************************************************************************/
+		void MoveParticle(uint32_t from, uint32_t to);
+
+		// Hot data, read and written every update
+		std::vector<float> mPositionX, mPositionY, mPositionZ;
+		std::vector<float> mVelocityX, mVelocityY, mVelocityZ;
+		std::vector<float> mLife;						//!< Seconds left
+
+		// Cold data, only read when building instances
+		std::vector<float> mInvLifeTime;
+		std::vector<float> mRotation;
+		std::vector<float> mSizeBegin, mSizeEnd;
+		std::vector<glm::vec4> mColourBegin, mColourEnd;
+
+		uint32_t mCount = 0;
+		uint32_t mCapacity;
+
+		// Instance arrays handed to the render thread, reused once it lets go of them
+		struct InstanceArray;
+		std::vector<Ref<InstanceArray>> mInstancePool;
+		std::mt19937 mRandom;
+	};
+}
+
+#endif
@@ -0,0 +1,106 @@
+/******************************************************************************/
+/*!
+\file		PickingService.hpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Declares the asynchronous picking service. Entity ID reads are
+			copied into a ring of readback buffers and collected a frame or
+			two later, so picking never stalls the GPU.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef PICKING_SERVICE_HPP
+#define PICKING_SERVICE_HPP
+#include <vector>
+#include <Core/Core.hpp>
+#include <Graphics/Framebuffer.hpp>
+
+namespace Borealis
+{
+	class PickingService
+	{
+	public:
+		/*!***********************************************************************
+			\brief
+				Destructor of the PickingService Virtual Class
+		*************************************************************************/
+		virtual ~PickingService() {}
+
+		/*!***********************************************************************
+			\brief
+				Queues a read of a single pixel of an integer attachment. Dropped
+				if every readback buffer is still in flight.
+			\param[in] frameBuffer
+				Frame Buffer to read from
+			\param[in] attachmentIndex
+				Index of the integer attachment
+			\param[in] x
+				X coordinate of the pixel
+			\param[in] y
+				Y coordinate of the pixel
+		*************************************************************************/
+		virtual void QueryPixel(const Ref<FrameBuffer>& frameBuffer, uint32_t attachmentIndex, int x, int y) = 0;
+
+		/*!***********************************************************************
+			\brief
+				Queues a read of a rectangle of an integer attachment, e.g. for
+				marquee selection. The rectangle is clamped to the Frame Buffer.
+			\param[in] frameBuffer
+				Frame Buffer to read from
+			\param[in] attachmentIndex
+				Index of the integer attachment
+			\param[in] x0
+				X coordinate of one corner
+			\param[in] y0
+				Y coordinate of one corner
+			\param[in] x1
+				X coordinate of the opposite corner
+			\param[in] y1
+				Y coordinate of the opposite corner
+		*************************************************************************/
+		virtual void QueryRect(const Ref<FrameBuffer>& frameBuffer, uint32_t attachmentIndex, int x0, int y0, int x1, int y1) = 0;
+
+		/*!***********************************************************************
+			\brief
+				Collects the reads the GPU has finished. Call once per frame.
+		*************************************************************************/
+		virtual void Update() = 0;
+
+		/*!***********************************************************************
+			\brief
+				Takes the newest pixel result collected since the last call
+			\param[out] value
+				Pixel value
+			\return
+				True if a new result was available
+		*************************************************************************/
+		virtual bool PollPixel(int& value) = 0;
+
+		/*!***********************************************************************
+			\brief
+				Takes the newest rectangle result collected since the last call
+			\param[out] values
+				Unique values inside the rectangle, excluding -1
+			\return
+				True if a new result was available
+		*************************************************************************/
+		virtual bool PollRect(std::vector<int>& values) = 0;
+
+		/*!***********************************************************************
+			\brief
+				Create a PickingService depending on Graphics API
+			\param[in] ringSize
+				Number of reads that can be in flight at once
+			\return
+				The picking service
+		*************************************************************************/
+		static Scope<PickingService> Create(uint32_t ringSize = 3);
+	}; // Class PickingService
+}
+
+#endif
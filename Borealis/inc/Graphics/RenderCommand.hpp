@@ -16,6 +16,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #define RENDER_COMMAND_HPP
 #include <memory>
 #include <Graphics/RendererAPI.hpp>
+#include <Graphics/RenderThread.hpp>
 
 namespace Borealis
 {
@@ -25,10 +26,11 @@ namespace Borealis
 
 		/*!***********************************************************************
 			\brief
-				Initialises the Renderer
+				Initialises the Renderer with the API selected in RendererAPI
 		*************************************************************************/
 		inline static void Init() {
 			PROFILE_FUNCTION();
+			sRendererAPI = RendererAPI::Create();
 			sRendererAPI->Init(); }
 		/*!***********************************************************************
 			\brief
@@ -37,8 +39,10 @@ namespace Borealis
 				The Vertex Array Object to draw
 			\param[in] count
 				The number of elements to draw
+			\param[in] baseVertex
+				Offset added to every index
 		*************************************************************************/
-		inline static void DrawElements(const Ref<VertexArray>& VAO, uint32_t count = 0) { sRendererAPI->DrawElements(VAO, count); }
+		inline static void DrawElements(const Ref<VertexArray>& VAO, uint32_t count = 0, uint32_t baseVertex = 0) { RenderThread::Submit([VAO, count, baseVertex]() { sRendererAPI->DrawElements(VAO, count, baseVertex); }); }
 
 		/*!***********************************************************************
 			\brief
@@ -47,14 +51,30 @@ namespace Borealis
 				The Vertex Array Object to draw
 			\param[in] count
 				The number of elements to draw
+			\param[in] firstVertex
+				The first vertex to draw
 		*************************************************************************/
-		inline static void DrawLines(const Ref<VertexArray>& VAO, uint32_t count = 0) { sRendererAPI->DrawLines(VAO, count); }
+		inline static void DrawLines(const Ref<VertexArray>& VAO, uint32_t count = 0, uint32_t firstVertex = 0) { RenderThread::Submit([VAO, count, firstVertex]() { sRendererAPI->DrawLines(VAO, count, firstVertex); }); }
+
+		/*!***********************************************************************
+			\brief
+				Draw instanced triangles in the VAO
+			\param[in] VAO
+				The Vertex Array Object to draw
+			\param[in] vertexCount
+				The number of vertices per instance
+			\param[in] instanceCount
+				The number of instances to draw
+			\param[in] baseInstance
+				The first instance of the per instance buffers to draw
+		*************************************************************************/
+		inline static void DrawInstanced(const Ref<VertexArray>& VAO, uint32_t vertexCount, uint32_t instanceCount, uint32_t baseInstance = 0) { RenderThread::Submit([VAO, vertexCount, instanceCount, baseInstance]() { sRendererAPI->DrawInstanced(VAO, vertexCount, instanceCount, baseInstance); }); }
 
 		/*!***********************************************************************
 			\brief
 				Clears the Renderer
 		*************************************************************************/
-		inline static void Clear() { sRendererAPI->Clear(); }
+		inline static void Clear() { RenderThread::Submit([]() { sRendererAPI->Clear(); }); }
 
 		/*!***********************************************************************
 			\brief
@@ -68,7 +88,7 @@ namespace Borealis
 			\param[in] a
 				The alpha component of the color
 		*************************************************************************/
-		inline static void SetClearColor(const float& r, const float& g, const float& b, const float& a) { sRendererAPI->SetClearColor(r, g, b, a); }
+		inline static void SetClearColor(const float& r, const float& g, const float& b, const float& a) { RenderThread::Submit([r, g, b, a]() { sRendererAPI->SetClearColor(r, g, b, a); }); }
 
 		/*!***********************************************************************
 			\brief
@@ -76,7 +96,7 @@ namespace Borealis
 			\param[in] color
 				The color to clear the renderer with
 		*************************************************************************/
-		inline static void SetClearColor(const glm::vec4& color) { sRendererAPI->SetClearColor(color); }
+		inline static void SetClearColor(const glm::vec4& color) { RenderThread::Submit([color]() { sRendererAPI->SetClearColor(color); }); }
 
 		/*!***********************************************************************
 			\brief
@@ -90,7 +110,16 @@ namespace Borealis
 			\param[in] height
 				The height of the viewport
 		*************************************************************************/
-		inline static void SetViewport(const uint32_t& x, const uint32_t& y, const uint32_t& width, const uint32_t& height) { sRendererAPI->SetViewport(x, y, width, height); }
+		inline static void SetViewport(const uint32_t& x, const uint32_t& y, const uint32_t& width, const uint32_t& height) { RenderThread::Submit([x, y, width, height]() { sRendererAPI->SetViewport(x, y, width, height); }); }
+
+		/*!***********************************************************************
+			\brief
+				Gets the height of the current viewport. Runs immediately, so it
+				is only meaningful on the render side.
+			\return
+				The height in pixels
+		*************************************************************************/
+		inline static uint32_t GetViewportHeight() { return sRendererAPI->GetViewportHeight(); }
 
 		/*!***********************************************************************
 			\brief
@@ -98,7 +127,7 @@ namespace Borealis
 			\param[in] thickness
 				The thickness of the line
 		*************************************************************************/
-		inline static void SetLineThickness(const float& thickness) { sRendererAPI->SetLineThickness(thickness); }
+		inline static void SetLineThickness(const float& thickness) { RenderThread::Submit([thickness]() { sRendererAPI->SetLineThickness(thickness); }); }
 	private:
 		static std::unique_ptr<RendererAPI> sRendererAPI; /*!< The Renderer API */
 	}; // class RenderCommand
@@ -0,0 +1,131 @@
+/******************************************************************************/
+/*!
+\file		RenderCommandQueue.hpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Declares the linear allocated render command queue. Commands are
+			recorded as packets of a function pointer and the captured
+			arguments, and replayed in order by the render thread.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef RENDER_COMMAND_QUEUE_HPP
+#define RENDER_COMMAND_QUEUE_HPP
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Borealis
+{
+	class RenderCommandQueue
+	{
+	public:
+		/*!***********************************************************************
+			\brief
+				Constructor for the queue
+			\param[in] blockSize
+				Size of each linear block in bytes. Blocks are chained when full
+				so recorded packets never move.
+		*************************************************************************/
+		explicit RenderCommandQueue(uint32_t blockSize = 4 * 1024 * 1024);
+
+		/*!***********************************************************************
+			\brief
+				Destructor, destroys any packets left and frees the blocks
+		*************************************************************************/
+		~RenderCommandQueue();
+
+		RenderCommandQueue(const RenderCommandQueue&) = delete;
+		RenderCommandQueue& operator=(const RenderCommandQueue&) = delete;
+
+		/*!***********************************************************************
+			\brief
+				Records a command. The callable is moved into the queue and lives
+				until Reset, so pointers into its captures stay valid for the
+				whole frame.
+			\param[in] fn
+				Callable to record
+		*************************************************************************/
+		template <typename Fn>
+		void Record(Fn&& fn)
+		{
+			using Command = std::decay_t<Fn>;
+			static_assert(alignof(Command) <= PacketAlignment, "Render command is over aligned");
+
+			void* storage = Allocate(&ExecuteCommand<Command>, std::is_trivially_destructible_v<Command> ? nullptr : &DestroyCommand<Command>, sizeof(Command));
+			new (storage) Command(std::forward<Fn>(fn));
+		}
+
+		/*!***********************************************************************
+			\brief
+				Runs every command recorded since the last Execute
+		*************************************************************************/
+		void Execute();
+
+		/*!***********************************************************************
+			\brief
+				Destroys every recorded command and rewinds the allocator
+		*************************************************************************/
+		void Reset();
+
+		/*!***********************************************************************
+			\brief
+				Gets the number of commands recorded since the last Reset
+			\return
+				Command count
+		*************************************************************************/
+		uint32_t GetCommandCount() const { return mCommandCount; }
+
+		/*!***********************************************************************
+			\brief
+				Gets the number of bytes used since the last Reset
+			\return
+				Bytes used
+		*************************************************************************/
+		uint32_t GetUsedBytes() const { return mUsedBytes; }
+
+	private:
+		using CommandFn = void(*)(void*);
+		static constexpr uint32_t PacketAlignment = 16;
+
+		struct PacketHeader
+		{
+			CommandFn mExecute;		//!< Runs the command
+			CommandFn mDestroy;		//!< Destroys the captures, null if trivial
+			uint32_t mSize;			//!< Size of the packet including this header
+		};
+
+		struct Cursor
+		{
+			uint32_t mBlock = 0;
+			uint32_t mOffset = 0;
+		};
+
+		template <typename Command>
+		static void ExecuteCommand(void* command) { (*static_cast<Command*>(command))(); }
+
+		template <typename Command>
+		static void DestroyCommand(void* command) { static_cast<Command*>(command)->~Command(); }
+
+		void* Allocate(CommandFn execute, CommandFn destroy, uint32_t size);
+
+		template <typename Visitor>
+		void ForEachPacket(Cursor begin, Cursor end, Visitor&& visitor);
+
+		std::vector<uint8_t*> mBlocks;
+		uint32_t mBlockSize;
+		Cursor mWrite;			//!< Next free byte
+		Cursor mExecuted;		//!< First packet not yet executed
+		uint32_t mCommandCount = 0;
+		uint32_t mUsedBytes = 0;
+	};
+}
+
+#endif
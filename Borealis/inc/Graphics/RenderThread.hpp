@@ -0,0 +1,161 @@
+/******************************************************************************/
+/*!
+\file		RenderThread.hpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Declares the render thread. The game thread records render
+			commands for frame N while the render thread, which owns the
+			graphics context, executes frame N-1.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef RENDER_THREAD_HPP
+#define RENDER_THREAD_HPP
+#include <Core/Core.hpp>
+#include <Graphics/RenderCommandQueue.hpp>
+
+namespace Borealis
+{
+	class GraphicsContext;
+
+	class RenderThread
+	{
+	public:
+		enum class Policy
+		{
+			SingleThreaded,	//!< Commands execute as they are submitted, on the calling thread
+			MultiThreaded	//!< Commands execute one frame later on the render thread
+		};
+
+		/*!***********************************************************************
+			\brief
+				Initialises the render thread. In the multithreaded policy the
+				thread is started at the end of the first frame, so everything
+				created during start up still happens on the main thread.
+			\param[in] policy
+				Threading policy
+			\param[in] context
+				Graphics context handed to the render thread
+		*************************************************************************/
+		static void Init(Policy policy, GraphicsContext* context);
+
+		/*!***********************************************************************
+			\brief
+				Executes the outstanding frames, joins the render thread and
+				makes the graphics context current on the calling thread again
+		*************************************************************************/
+		static void Free();
+
+		/*!***********************************************************************
+			\brief
+				Submits a render command. The callable and its captures live until
+				the frame is retired, so anything it captures by value can be
+				referenced by the renderers for the rest of that frame.
+			\param[in] fn
+				Callable to run with the graphics context current
+		*************************************************************************/
+		template <typename Fn>
+		static void Submit(Fn&& fn)
+		{
+			// Nested submissions from a command being executed run straight away
+			if (!IsRecording())
+			{
+				fn();
+				return;
+			}
+
+			RenderCommandQueue& queue = GetSubmitQueue();
+			queue.Record(std::forward<Fn>(fn));
+			if (!IsMultiThreaded())
+				ExecuteSubmitted();
+		}
+
+		/*!***********************************************************************
+			\brief
+				Keeps a resource alive until the frame being recorded is retired,
+				so commands can carry a raw pointer to it instead of a Ref
+			\param[in] resource
+				Resource to keep alive
+			\return
+				Raw pointer to the resource
+		*************************************************************************/
+		template <typename T>
+		static T* Retain(const Ref<T>& resource)
+		{
+			// Outside of recording the command runs before the caller's Ref goes away
+			if (resource && IsRecording() && MarkRetained(resource.get()))
+				AddRetained(resource);
+			return resource.get();
+		}
+
+		/*!***********************************************************************
+			\brief
+				Ends the game thread's frame. Waits for the render thread to finish
+				the previous frame, then hands it the commands of this frame.
+		*************************************************************************/
+		static void EndFrame();
+
+		/*!***********************************************************************
+			\brief
+				Blocks until the render thread has executed every kicked frame
+		*************************************************************************/
+		static void WaitForRenderThread();
+
+		/*!***********************************************************************
+			\brief
+				Gets the threading policy
+			\return
+				Policy the render thread was initialised with
+		*************************************************************************/
+		static Policy GetPolicy();
+
+		/*!***********************************************************************
+			\brief
+				Checks if commands are currently deferred to the render thread
+			\return
+				True if the render thread is running
+		*************************************************************************/
+		static bool IsMultiThreaded();
+
+		/*!***********************************************************************
+			\brief
+				Gets the number of commands the last retired frame recorded
+			\return
+				Command count
+		*************************************************************************/
+		static uint32_t GetLastFrameCommandCount();
+
+		/*!***********************************************************************
+			\brief
+				Borrows the graphics context on the game thread for resource
+				creation, e.g. asset loads. Waits for the render thread to go idle
+				and returns the context to it when destroyed.
+		*************************************************************************/
+		class ScopedContext
+		{
+		public:
+			ScopedContext();
+			~ScopedContext();
+
+			ScopedContext(const ScopedContext&) = delete;
+			ScopedContext& operator=(const ScopedContext&) = delete;
+
+		private:
+			bool mBorrowed = false;
+		};
+
+	private:
+		static bool IsRecording();
+		static RenderCommandQueue& GetSubmitQueue();
+		static void ExecuteSubmitted();
+		static bool MarkRetained(const void* resource);
+		static void AddRetained(Ref<void> resource);
+	};
+}
+
+#endif
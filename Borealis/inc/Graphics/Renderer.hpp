@@ -51,6 +51,12 @@ namespace Borealis
 		*************************************************************************/
 		static void End();
 
+		/*!***********************************************************************
+			\brief
+				Ends the frame on the render side, after the buffers are swapped
+		*************************************************************************/
+		static void EndFrame();
+
 		/*!***********************************************************************
 			\brief
 				Submit a VertexArray to the Renderer
@@ -13,10 +13,12 @@ prior written consent of DigiPen Institute of Technology is prohibited.
  /******************************************************************************/
 #ifndef RENDERER2D_HPP
 #define RENDERER2D_HPP
+#include <string_view>
 #include <Graphics/OrthographicCamera.hpp>
 #include <Graphics/Texture.hpp>
 #include <Graphics/SubTexture2D.hpp>
 #include <Graphics/Font.hpp>
+#include <Graphics/TextLayout.hpp>
 #include <Graphics/Camera.hpp>
 #include <Graphics/EditorCamera.hpp>
 #include <Scene/Components.hpp>
@@ -33,8 +35,62 @@ namespace Borealis
 		static void Begin(const Camera& camera, const glm::mat4& transform);
 		static void End();
 		static void Flush();
+		static void EndFrame(); // Fences this frame's streamed vertices and moves to the next ring region
+
+		/*
+			Per instance record of a quad. The corners are expanded in the vertex
+			shader as Position +- AxisX / 2 +- AxisY / 2, so the axes carry the
+			rotation and scale.
+		*/
+		struct SpriteInstance
+		{
+			glm::vec3 Position;
+			glm::vec3 AxisX;
+			glm::vec3 AxisY;
+			glm::vec4 UVRect; // Min and max texture coordinates
+			glm::vec4 Colour;
+			int TexIndex; // Filled in by the renderer
+			float TexLayer; // Filled in by the renderer
+			float TilingFactor;
+			int EntityID;
+		};
+
+		/*
+			Plain records of scene draws. The scene builds them in frame memory and
+			retains what they point to through RenderThread::Retain, so a render
+			command carries one pointer per pass instead of copies of components.
+		*/
+		struct SpriteSubmission
+		{
+			glm::mat4 Transform;
+			glm::vec4 Colour;
+			Texture2D* Texture; // Null for a flat colour
+			float TilingFactor;
+			int EntityID;
+		};
+
+		struct CircleSubmission
+		{
+			glm::mat4 Transform;
+			glm::vec4 Colour;
+			float Thickness;
+			float Fade;
+			int EntityID;
+		};
+
+		struct TextSubmission
+		{
+			glm::mat4 Transform;
+			glm::vec4 Colour;
+			TextLayout* Layout;
+			int EntityID;
+		};
 
 		static void DrawSprite(const glm::mat4& transform, const SpriteRendererComponent& sprite, int entityID = -1);
+		static void DrawSprites(const SpriteSubmission* sprites, uint32_t count);
+		static void DrawCircles(const CircleSubmission* circles, uint32_t count);
+		static void DrawStrings(const TextSubmission* texts, uint32_t count);
+		static void DrawSprites(const SpriteInstance* instances, uint32_t count, Texture2D* texture = nullptr); // Copies prebuilt instances straight into the batch
 		static void DrawCircle(const glm::mat4& transform, const glm::vec4& colour, float thickness = 1.f, float fade = 0.005f, int entityID = -1);
 		static void DrawLine(const glm::vec3& p0, const glm::vec3& p1, const glm::vec4& colour);
 		static void DrawRect(const glm::vec3& position, const glm::vec2& size, const glm::vec4& colour); // Position and Size
@@ -57,7 +113,22 @@ namespace Borealis
 		static void DrawRotatedQuad(const glm::vec2& position, const float& rotation, const glm::vec2& size, const Ref<SubTexture2D>& texture, const float& tilingFactor = 1.f, const glm::vec4 & = glm::vec4(1.0f));
 		static void DrawRotatedQuad(const glm::vec3& position, const float& rotation, const glm::vec2& size, const Ref<SubTexture2D>& texture, const float& tilingFactor = 1.f, const glm::vec4 & = glm::vec4(1.0f));
 
-		static void DrawString(const std::string& string, Ref<Font> font, const glm::mat4& transform, int entityID);
+		static void DrawString(std::string_view string, Ref<Font> font, const glm::mat4& transform, int entityID);
+
+		/*!***********************************************************************
+			\brief
+				Draws laid out text. Costs a copy of its vertices while its
+				transform, colour and entity stay the same.
+			\param[in] layout
+				Text to draw
+			\param[in] transform
+				World transform of the text
+			\param[in] colour
+				Colour of the text
+			\param[in] entityID
+				Entity the text belongs to
+		*************************************************************************/
+		static void DrawString(TextLayout& layout, const glm::mat4& transform, const glm::vec4& colour, int entityID);
 
 		struct Statistics
 		{
@@ -67,8 +138,15 @@ namespace Borealis
 			uint32_t GetTotalVertexCount() { return QuadCount * 4; }
 			uint32_t GetTotalIndexCount() { return QuadCount * 6; }
 		};
-		static void ResetStats();
-		static Statistics& GetStats();
+
+		/*!***********************************************************************
+			\brief
+				Gets the counters of the last frame the render side finished.
+				Counting restarts in EndFrame, so callers never reset them.
+			\return
+				Copy of the counters
+		*************************************************************************/
+		static Statistics GetLastFrameStats();
 	};
 
 }
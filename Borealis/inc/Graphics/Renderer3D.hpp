@@ -52,6 +52,11 @@ namespace Borealis
 		*************************************************************************/
 		static void Begin(const Camera& camera, const glm::mat4& transform);
 
+		/*!***********************************************************************
+			\brief
+				Draws the meshes submitted since Begin, sorted by shader variant,
+				material, model and depth, and batched by material
+		*************************************************************************/
 		static void End();
 
 		static void AddLight(LightComponent const& lightComponent);
@@ -60,7 +65,8 @@ namespace Borealis
 
 		/*!***********************************************************************
 			\brief
-				Draw the mesh
+				Queues the mesh, it is drawn with the other meshes of its
+				material in End
 			\param[in] transform
 				camera
 			\param[in] meshFilter
@@ -72,6 +78,33 @@ namespace Borealis
 		*************************************************************************/
 		static void DrawMesh(const glm::mat4& transform, const MeshFilterComponent& meshFilter, const MeshRendererComponent& meshRenderer, int entityID = -1);
 
+		/*
+			Plain record of a scene mesh. The scene builds them in frame memory and
+			retains the model and the material's packed state through
+			RenderThread::Retain, so the render thread never reads the material.
+		*/
+		struct MeshSubmission
+		{
+			glm::mat4 mTransform;
+			Model* mModel;
+			const Material::DrawState* mMaterial; // Null for the default material
+			int mEntityID;
+			uint32_t mLod;
+			uint32_t mPreviousLod;
+			float mLodFade;
+		};
+
+		/*!***********************************************************************
+			\brief
+				Queues meshes recorded by the scene, they are drawn with the
+				other meshes of their material in End
+			\param[in] meshes
+				Meshes to queue
+			\param[in] count
+				Number of meshes
+		*************************************************************************/
+		static void DrawMeshes(const MeshSubmission* meshes, uint32_t count);
+
 	private:
 		static LightEngine mLightEngine;
 	};
@@ -18,12 +18,27 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <Graphics/VertexArray.hpp>
 namespace Borealis
 {
+	/*!***********************************************************************
+		\brief
+			Work the backend did in one frame, counted on the render side
+	*************************************************************************/
+	struct RenderStatistics
+	{
+		uint32_t DrawCalls = 0;
+		uint32_t Triangles = 0;
+		uint32_t StateChanges = 0;	//!< Shader, vertex array and framebuffer binds that reached the driver
+		uint32_t TextureBinds = 0;
+		uint32_t StateCallsIssued = 0;	//!< State calls passed on by the state cache
+		uint32_t StateCallsSkipped = 0;	//!< State calls the state cache found redundant
+		uint64_t UploadBytes = 0;	//!< Bytes written to buffers and textures
+	};
+
 	class RendererAPI
 	{
 	public:
 		enum class API
 		{
-			None = 0, OpenGL = 1	
+			None = 0, OpenGL = 1, Null = 2
 		};
 
 		/*!***********************************************************************
@@ -73,8 +88,10 @@ namespace Borealis
 				The Vertex Array Object to draw
 			\param[in] indexCount
 				The number of indices to draw
+			\param[in] baseVertex
+				Offset added to every index, for VAOs streamed from a ring buffer
 		*************************************************************************/
-		virtual void DrawElements(const Ref<VertexArray>& VAO, uint32_t indexCount = 0) = 0;
+		virtual void DrawElements(const Ref<VertexArray>& VAO, uint32_t indexCount = 0, uint32_t baseVertex = 0) = 0;
 
 		/*!***********************************************************************
 			\brief
@@ -83,8 +100,24 @@ namespace Borealis
 				The Vertex Array Object to draw
 			\param[in] vertexCount
 				The number of vertices to draw
+			\param[in] firstVertex
+				The first vertex to draw
+		*************************************************************************/
+		virtual void DrawLines(const Ref<VertexArray>& VAO, uint32_t vertexCount = 0, uint32_t firstVertex = 0) = 0;
+
+		/*!***********************************************************************
+			\brief
+				Draw instanced triangles in the VAO, without an element buffer
+			\param[in] VAO
+				The Vertex Array Object to draw
+			\param[in] vertexCount
+				The number of vertices per instance
+			\param[in] instanceCount
+				The number of instances to draw
+			\param[in] baseInstance
+				The first instance of the per instance buffers to draw
 		*************************************************************************/
-		virtual void DrawLines(const Ref<VertexArray>& VAO, uint32_t vertexCount = 0) = 0;
+		virtual void DrawInstanced(const Ref<VertexArray>& VAO, uint32_t vertexCount, uint32_t instanceCount, uint32_t baseInstance = 0) = 0;
 
 		/*!***********************************************************************
 			\brief
@@ -100,6 +133,14 @@ namespace Borealis
 		*************************************************************************/
 		virtual void SetViewport(const uint32_t& x, const uint32_t& y, const uint32_t& width, const uint32_t& height) = 0;
 
+		/*!***********************************************************************
+			\brief
+				Get the height of the current Viewport
+			\return
+				The height in pixels, 0 if there is no viewport
+		*************************************************************************/
+		virtual uint32_t GetViewportHeight() const = 0;
+
 		/*!***********************************************************************
 			\brief
 				Set the Line Thickness of the RendererAPI
@@ -115,8 +156,51 @@ namespace Borealis
 				The API being used
 		*************************************************************************/
 		inline static API GetAPI() { return sAPI; }
+
+		/*!***********************************************************************
+			\brief
+				Selects the API to create resources with. Must be called before
+				the Renderer is initialised.
+			\param[in] api
+				The API to use, e.g. Null for headless runs
+		*************************************************************************/
+		static void SetAPI(API api);
+
+		/*!***********************************************************************
+			\brief
+				Create a RendererAPI for the API being used
+			\return
+				The RendererAPI
+		*************************************************************************/
+		static Scope<RendererAPI> Create();
+
+		/*!***********************************************************************
+			\brief
+				Gets the counters of the frame being executed. Only touched with
+				the graphics context current, by the backends.
+			\return
+				Counters of the current frame
+		*************************************************************************/
+		inline static RenderStatistics& GetStatistics() { return sStatistics; }
+
+		/*!***********************************************************************
+			\brief
+				Publishes the counters of the frame that just executed and resets
+				them for the next. Called on the render side at the end of a frame.
+		*************************************************************************/
+		static void EndFrameStatistics();
+
+		/*!***********************************************************************
+			\brief
+				Gets the counters of the last frame the render side finished,
+				which is a frame behind with the multithreaded render thread
+			\return
+				Counters of the last finished frame
+		*************************************************************************/
+		static RenderStatistics GetLastFrameStatistics();
 	private:
 		static API sAPI; //!< The API being used
+		static RenderStatistics sStatistics; //!< Counters of the frame being executed
 	}; // class RendererAPI
 
 } // namespace Borealis
@@ -0,0 +1,103 @@
+/******************************************************************************/
+/*!
+\file		RingBuffer.hpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Declares the streaming ring buffer. The buffer is split into one
+			region per frame in flight, and vertices are written straight
+			into GPU visible memory.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef RING_BUFFER_HPP
+#define RING_BUFFER_HPP
+#include <Core/Core.hpp>
+#include <Graphics/Buffer.hpp>
+
+namespace Borealis
+{
+	class RingBuffer : public VertexBuffer
+	{
+	public:
+		struct Allocation
+		{
+			void* mData = nullptr;	//!< Write pointer, valid until Commit
+			uint32_t mOffset = 0;	//!< Offset of the allocation in the buffer
+			uint32_t mSize = 0;		//!< Size reserved
+		};
+
+		/*!***********************************************************************
+			\brief
+				Destructor of the RingBuffer Virtual Class
+		*************************************************************************/
+		virtual ~RingBuffer() {}
+
+		/*!***********************************************************************
+			\brief
+				Reserves memory in the current frame's region. If the region is
+				full, the ring grows into a new buffer rather than waiting for the
+				GPU, so the renderer ID changes and vertex arrays rebind it.
+			\param[in] size
+				Size to reserve in bytes
+			\param[in] alignment
+				Alignment of the offset, e.g. the vertex stride so the data can
+				be drawn with a base vertex
+			\return
+				The allocation
+		*************************************************************************/
+		virtual Allocation Allocate(uint32_t size, uint32_t alignment) = 0;
+
+		/*!***********************************************************************
+			\brief
+				Makes the written part of an allocation visible to the GPU and
+				returns the unused tail to the ring. Must be called before drawing.
+			\param[in] allocation
+				Allocation returned by the last Allocate
+			\param[in] usedSize
+				Number of bytes written
+		*************************************************************************/
+		virtual void Commit(const Allocation& allocation, uint32_t usedSize) = 0;
+
+		/*!***********************************************************************
+			\brief
+				Fences the region used this frame and moves to the next one,
+				waiting if the GPU is still reading from it
+		*************************************************************************/
+		virtual void EndFrame() = 0;
+
+		/*!***********************************************************************
+			\brief
+				Get the renderer ID of the buffer, to bind it to other targets
+			\return
+				Renderer ID of the buffer
+		*************************************************************************/
+		virtual uint32_t GetRendererID() const = 0;
+
+		/*!***********************************************************************
+			\brief
+				Checks if the buffer is persistently mapped
+			\return
+				True if writes go straight to the mapped storage
+		*************************************************************************/
+		virtual bool IsPersistentlyMapped() const = 0;
+
+		/*!***********************************************************************
+			\brief
+				Create a RingBuffer depending on Graphics API
+			\param[in] regionSize
+				Size of each frame's region in bytes
+			\param[in] regionCount
+				Number of frames in flight
+			\return
+				The RingBuffer
+		*************************************************************************/
+		static Ref<RingBuffer> Create(uint32_t regionSize, uint32_t regionCount = 3);
+	}; // Class RingBuffer
+}
+
+#endif
@@ -15,6 +15,10 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #ifndef SHADER_HPP
 #define SHADER_HPP
 
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
 #include <glm/glm.hpp>
 #include <Core/Core.hpp>
 
@@ -58,6 +62,16 @@ namespace Borealis
 		*************************************************************************/
 		static Ref<Shader> Create(const std::string& filepath);
 
+		/*!***********************************************************************
+			\brief
+				Create a variant of a Shader in the corresponding Graphics API
+			\param[in] filepath
+				The Filepath of the Shader
+			\param[in] defines
+				Names defined at the top of every stage of the variant
+		*************************************************************************/
+		static Ref<Shader> Create(const std::string& filepath, const std::vector<std::string>& defines);
+
 		/*!***********************************************************************
 			\brief
 				Create the Shader in the corresponding Graphics API
@@ -87,6 +101,17 @@ namespace Borealis
 		virtual void Set(const char* name, const glm::vec4& value) = 0;
 		virtual void Set(const char* name, const glm::mat3& value) = 0;
 		virtual void Set(const char* name, const glm::mat4& value) = 0;
+
+		/*!***********************************************************************
+			\brief
+				Reads a uniform block of the shader from a uniform buffer binding
+				point
+			\param[in] name
+				The Name of the Uniform Block
+			\param[in] binding
+				The Binding Point
+		*************************************************************************/
+		virtual void SetBlockBinding(const char* name, uint32_t binding) = 0;
 	}; // class Shader
 
 	class ShaderAPI
@@ -152,5 +177,33 @@ namespace Borealis
 		std::unordered_map<std::string, Ref<Shader>> mShaders; //!< Map of Shaders
 	}; // class ShaderAPI
 
+	class ShaderLibrary
+	{
+	public:
+		/*!***********************************************************************
+			\brief
+				Gets a shader variant, compiling it the first time it is asked
+				for. Every caller asking for the same file and define set shares
+				one program.
+			\param[in] filepath
+				The Filepath of the Shader
+			\param[in] defines
+				Names defined in the variant, in any order
+			\return
+				The Shader
+		*************************************************************************/
+		static Ref<Shader> Load(const std::string& filepath, const std::vector<std::string>& defines = {});
+
+		/*!***********************************************************************
+			\brief
+				Releases every shader held by the library
+		*************************************************************************/
+		static void Clear();
+
+	private:
+		static std::unordered_map<std::string, Ref<Shader>> sShaders; //!< Shaders by file and sorted define set
+		static std::mutex sMutex;
+	}; // class ShaderLibrary
+
 } // namespace Borealis
 #endif
\ No newline at end of file
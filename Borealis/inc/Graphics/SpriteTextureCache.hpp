@@ -0,0 +1,79 @@
+/******************************************************************************/
+/*!
+\file		SpriteTextureCache.hpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Declares the sprite texture cache. Sprite textures are copied into
+			texture array pages grouped by size and format, so a batch can
+			draw from far more textures than there are texture units.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef SPRITE_TEXTURE_CACHE_HPP
+#define SPRITE_TEXTURE_CACHE_HPP
+#include <Core/Core.hpp>
+#include <Graphics/Texture.hpp>
+
+namespace Borealis
+{
+	class SpriteTextureCache
+	{
+	public:
+		struct Location
+		{
+			uint32_t mPage = 0;		//!< Texture array the texture was copied into
+			uint32_t mLayer = 0;	//!< Layer of the array
+		};
+
+		/*!***********************************************************************
+			\brief
+				Destructor of the SpriteTextureCache Virtual Class
+		*************************************************************************/
+		virtual ~SpriteTextureCache() {}
+
+		/*!***********************************************************************
+			\brief
+				Gets where a texture lives in the cache, copying it into a page
+				the first time it is seen
+			\param[in] texture
+				Texture to look up
+			\param[out] location
+				Page and layer of the texture
+			\return
+				False if the texture cannot be placed in an array
+		*************************************************************************/
+		virtual bool Acquire(Texture2D* texture, Location& location) = 0;
+
+		/*!***********************************************************************
+			\brief
+				Binds a page
+			\param[in] page
+				Page to bind
+			\param[in] unit
+				Texture unit to bind the page to
+		*************************************************************************/
+		virtual void BindPage(uint32_t page, uint32_t unit) const = 0;
+
+		/*!***********************************************************************
+			\brief
+				Releases the layers of textures that have been destroyed
+		*************************************************************************/
+		virtual void CollectGarbage() = 0;
+
+		/*!***********************************************************************
+			\brief
+				Create a SpriteTextureCache depending on Graphics API
+			\return
+				The cache, or null if texture arrays cannot be built on this
+				context
+		*************************************************************************/
+		static Scope<SpriteTextureCache> Create();
+	}; // Class SpriteTextureCache
+}
+
+#endif
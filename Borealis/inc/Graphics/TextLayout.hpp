@@ -0,0 +1,103 @@
+/******************************************************************************/
+/*!
+\file		TextLayout.hpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Declares the text layout. A string laid out once into quads in
+			the local space of its entity, kept until the text, font or size
+			changes, with the vertices of its last draw kept for reuse.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef TEXT_LAYOUT_HPP
+#define TEXT_LAYOUT_HPP
+#include <string>
+#include <string_view>
+#include <vector>
+#include <glm/glm.hpp>
+#include <Core/Core.hpp>
+
+namespace Borealis
+{
+	class Font;
+
+	struct TextVertex
+	{
+		glm::vec3 Position;
+		glm::vec4 Colour;
+		glm::vec2 TexCoord;
+
+		//Editor only
+		int EntityID;
+	};
+
+	class TextLayout
+	{
+	public:
+		static constexpr uint32_t DefaultFontSize = 16; // Size laid out at one unit per line
+
+		struct Quad
+		{
+			glm::vec2 mMin;		// Bottom left corner, local space
+			glm::vec2 mMax;		// Top right corner, local space
+			glm::vec2 mTexMin;	// Atlas coordinates, normalised
+			glm::vec2 mTexMax;
+		};
+
+		/*!***********************************************************************
+			\brief
+				Lays out a string
+			\param[in] text
+				UTF-8 text, a newline starts a new line
+			\param[in] font
+				Font to lay out with
+			\param[in] fontSize
+				Size of the text, relative to DefaultFontSize
+		*************************************************************************/
+		TextLayout(std::string_view text, const Ref<Font>& font, uint32_t fontSize);
+
+		/*!***********************************************************************
+			\brief
+				Checks if the layout is of the given text, font and size
+		*************************************************************************/
+		bool Matches(std::string_view text, const Ref<Font>& font, uint32_t fontSize) const;
+
+		/*!***********************************************************************
+			\brief
+				Gets the vertices of the quads placed by a transform, four per
+				quad. Rebuilt only when the transform, colour or entity differ
+				from the last call, so only the render thread may call it.
+			\param[in] transform
+				World transform of the text
+			\param[in] colour
+				Colour of the text
+			\param[in] entityID
+				Entity the text belongs to
+			\return
+				The vertices
+		*************************************************************************/
+		const std::vector<TextVertex>& GetVertices(const glm::mat4& transform, const glm::vec4& colour, int entityID);
+
+		const Ref<Font>& GetFont() const { return mFont; }
+		const std::vector<Quad>& GetQuads() const { return mQuads; }
+
+	private:
+		std::string mText;
+		Ref<Font> mFont;
+		uint32_t mFontSize;
+		std::vector<Quad> mQuads;
+
+		// Last draw, reused while it stays the same
+		std::vector<TextVertex> mVertices;
+		glm::mat4 mTransform{ 0.f };
+		glm::vec4 mColour{ 0.f };
+		int mEntityID = -1;
+	};
+}
+
+#endif
@@ -17,6 +17,12 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <string>
 #include <Core/Core.hpp>
 #include <Assets/Asset.hpp>
+#include <Graphics/TextureStreamer.hpp>
+
+namespace gli
+{
+	class texture;
+}
 
 namespace Borealis
 {
@@ -36,8 +42,8 @@ namespace Borealis
 		bool generateMips = true;
 	};
 
-	// Base Class for Textures, Completely Virtual
-	class Texture : public Asset
+	// Base Class for Textures, Completely Virtual. Renderers hold raw pointers and take a Ref only when they keep one.
+	class Texture : public Asset, public std::enable_shared_from_this<Texture>
 	{
 	public:
 		/*!***********************************************************************
@@ -127,8 +133,50 @@ namespace Borealis
 		*************************************************************************/
 		static Ref<Texture2D> Create(const std::string& path);
 
+		/*!***********************************************************************
+			\brief
+				Create a texture2D from an image already read from its file, so
+				the file can be read off the main thread
+			\param[in] path
+				const std::string& - Path the image was read from
+			\param[in] image
+				const gli::texture& - Image read with gli::load
+		*************************************************************************/
+		static Ref<Texture2D> Create(const std::string& path, const gli::texture& image);
+
 		static Ref<Texture2D> GetDefaultTexture();
 
+		/*!***********************************************************************
+			\brief
+				Uploads mip levels read by the texture streamer and samples down
+				to the finest of them
+			\param[in] firstLevel
+				Finest level in the data
+			\param[in] data
+				Contents of the levels from firstLevel up to the finest level
+				that was resident, finest first
+		*************************************************************************/
+		virtual void UploadMips(uint32_t firstLevel, std::vector<uint8_t> data) {}
+
+		/*!***********************************************************************
+			\brief
+				Frees the mip levels finer than a level and stops sampling them
+			\param[in] firstLevel
+				Finest level to keep
+		*************************************************************************/
+		virtual void EvictMips(uint32_t firstLevel) {}
+
+		/*!***********************************************************************
+			\brief
+				Gets the handle the renderers report mip demand with
+			\return
+				Handle, InvalidHandle if the texture is fully resident
+		*************************************************************************/
+		TextureStreamer::Handle GetStreamingHandle() const { return mStreamingHandle; }
+
+	protected:
+		TextureStreamer::Handle mStreamingHandle = TextureStreamer::InvalidHandle;
+
 	private:
 		static Ref<Texture2D> mDefault;
 	}; // Class Texture2D
@@ -0,0 +1,146 @@
+/******************************************************************************/
+/*!
+\file		TextureStreamer.hpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Declares the texture streamer. Imported textures keep only their
+			small mips resident, the renderers report the finest mip each
+			texture needs on screen, and the streamer reads the missing levels
+			from the cache on its own thread within the GPU texture budget,
+			evicting the mips of the least recently used textures first.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef TEXTURE_STREAMER_HPP
+#define TEXTURE_STREAMER_HPP
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Borealis
+{
+	class Texture2D;
+
+	class TextureStreamer
+	{
+	public:
+		using Handle = uint32_t;
+		static constexpr Handle InvalidHandle = UINT32_MAX;
+
+		/*!***********************************************************************
+			\brief
+				Where each mip level of a texture lives in its file
+		*************************************************************************/
+		struct MipLayout
+		{
+			std::string mPath;				//!< File the levels are read from
+			std::vector<uint64_t> mOffsets;	//!< Byte offset of each level in the file
+			std::vector<uint64_t> mSizes;	//!< Bytes of each level
+		};
+
+		/*!***********************************************************************
+			\brief
+				Starts the streaming thread. Textures created before Init are
+				fully resident.
+		*************************************************************************/
+		static void Init();
+
+		/*!***********************************************************************
+			\brief
+				Stops the streaming thread, outstanding reads are dropped
+		*************************************************************************/
+		static void Free();
+
+		/*!***********************************************************************
+			\brief
+				Gets the coarsest level that stays resident for the life of a
+				texture, the levels finer than it are streamed
+			\param[in] width
+				Width of the top level
+			\param[in] height
+				Height of the top level
+			\param[in] levels
+				Number of levels
+			\return
+				The level, 0 if the texture is too small to stream
+		*************************************************************************/
+		static uint32_t GetTailMip(uint32_t width, uint32_t height, uint32_t levels);
+
+		/*!***********************************************************************
+			\brief
+				Starts streaming a texture. Called from any thread once the tail
+				levels are uploaded.
+			\param[in] texture
+				Texture, must unregister before it is destroyed
+			\param[in] layout
+				Where the levels of the texture are in its file
+			\param[in] tailMip
+				Finest level uploaded
+			\return
+				Handle of the texture, or InvalidHandle if the streamer is not
+				running and every level has to be uploaded
+		*************************************************************************/
+		static Handle Register(Texture2D* texture, std::shared_ptr<const MipLayout> layout, uint32_t tailMip);
+
+		/*!***********************************************************************
+			\brief
+				Stops streaming a texture. Called from any thread, waits for an
+				Update in progress so the texture is not touched afterwards.
+			\param[in] handle
+				Handle from Register
+		*************************************************************************/
+		static void Unregister(Handle handle);
+
+		/*!***********************************************************************
+			\brief
+				Reports that a draw samples a texture down to a mip level. Called
+				by the renderers from any thread, the finest level reported in a
+				frame wins.
+			\param[in] handle
+				Handle of the texture, invalid handles are ignored
+			\param[in] mip
+				Finest level the draw needs
+		*************************************************************************/
+		static void RequestMip(Handle handle, uint32_t mip);
+
+		/*!***********************************************************************
+			\brief
+				Applies the reads that finished, evicts and queues new reads.
+				Called once a frame on the game thread after the draws were
+				submitted.
+		*************************************************************************/
+		static void Update();
+
+		/*!***********************************************************************
+			\brief
+				Reads mip levels straight from a file, blocking the caller
+			\param[in] layout
+				Where the levels are
+			\param[in] firstLevel
+				Finest level to read
+			\param[in] lastLevel
+				One past the coarsest level to read
+			\param[out] data
+				Contents of the levels, finest first
+			\return
+				False if the file could not be read
+		*************************************************************************/
+		static bool ReadMips(const MipLayout& layout, uint32_t firstLevel, uint32_t lastLevel, std::vector<uint8_t>& data);
+
+		/*!***********************************************************************
+			\brief
+				Gets the bytes of streamed levels that are resident or being read
+			\return
+				Bytes streamed in
+		*************************************************************************/
+		static uint64_t GetStreamedBytes();
+	};
+}
+
+#endif
@@ -16,6 +16,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #ifndef IMGUI_LAYER_HPP
 #define IMGUI_LAYER_HPP
 #include <Core/Layer.hpp>
+#include <Core/InputRecorder.hpp>
 #include <Events/EventInput.hpp>
 #include <Events/EventWindow.hpp>
 namespace Borealis
@@ -83,6 +84,21 @@ namespace Borealis
 		*************************************************************************/
 		void SetBlockEvents(bool block) { mBlockEvents = block; }
 
+		/*!***********************************************************************
+			\brief
+				Stops ImGui from reading the window, so only replayed input
+				reaches it
+		*************************************************************************/
+		void DetachLiveInput();
+
+		/*!***********************************************************************
+			\brief
+				Passes replayed window input to ImGui
+			\param[in] event
+				Recorded input
+		*************************************************************************/
+		void ReplayInput(const InputEvent& event);
+
 		/*!***********************************************************************
 			\brief
 				Window Resize Event Function
@@ -107,6 +123,9 @@ namespace Borealis
 
 	private:
 		bool mBlockEvents = true; /*!< Whether to block events. */
+		bool mLiveInput = true; /*!< False while ImGui only gets replayed input. */
+		float mReplayMouseX = 0.f; /*!< Last replayed cursor position. */
+		float mReplayMouseY = 0.f;
 		float mTime; /*!< Time for the ImGuiLayer. */
 	};
 } // End of namespace Borealis
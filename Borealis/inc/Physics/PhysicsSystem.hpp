@@ -67,8 +67,15 @@ namespace Borealis
 	* \param radius The ardius of the sphere body.
 	* \param position The position of the sphere body.
 	* \param rigidbody The rigid body component of the sphere body.
+	* \param addToWorld False to create the body outside the world, for a scene still loading.
 	*/
-		static void addSphereBody(float radius, glm::vec3 position, RigidBodyComponent& rigidbody);
+		static void addSphereBody(float radius, glm::vec3 position, RigidBodyComponent& rigidbody, bool addToWorld = true);
+
+		/**
+   * \brief Adds a body created outside the world to it, bodies already in the world are left alone.
+   * \param rigidbody The rigid body component of the body.
+   */
+		static void AddToWorld(RigidBodyComponent& rigidbody);
 
 
 		/**
@@ -14,6 +14,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 
 #ifndef COMPONENTS_HPP
 #define COMPONENTS_HPP
+#include <string_view>
 #include <unordered_set>
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
@@ -24,8 +25,11 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <Graphics/Model.hpp>
 #include <Graphics/Material.hpp>
 #include <Graphics/Font.hpp>
+#include <Graphics/TextLayout.hpp>
+#include <Graphics/ParticleSystem.hpp>
 #include <AI/BehaviourTree/BehaviourTree.hpp>
 #include <Core/UUID.hpp>
+#include <Core/FlatHashMap.hpp>
 #include <Audio/Audio.hpp>
 
 namespace Borealis
@@ -100,6 +104,34 @@ namespace Borealis
 			: Colour(colour), thickness(thickness), fade(fade) {}
 	};
 
+	struct ParticleSystemComponent
+	{
+		ParticleProps Props; // Position is relative to the entity
+		Ref<Texture2D> Texture;
+		float EmitRate = 100.f; // Particles per second
+		uint32_t MaxParticles = 10000;
+
+		// Runtime state, not serialised. Copies start with no particles of their own.
+		Ref<ParticleSystem> System;
+		float EmitAccumulator = 0.f;
+
+		ParticleSystemComponent() = default;
+		ParticleSystemComponent(const ParticleSystemComponent& other)
+			: Props(other.Props), Texture(other.Texture), EmitRate(other.EmitRate), MaxParticles(other.MaxParticles) {}
+		ParticleSystemComponent(ParticleSystemComponent&&) noexcept = default;
+		ParticleSystemComponent& operator=(const ParticleSystemComponent& other)
+		{
+			Props = other.Props;
+			Texture = other.Texture;
+			EmitRate = other.EmitRate;
+			MaxParticles = other.MaxParticles;
+			System = nullptr;
+			EmitAccumulator = 0.f;
+			return *this;
+		}
+		ParticleSystemComponent& operator=(ParticleSystemComponent&&) noexcept = default;
+	};
+
 	struct CameraComponent 
 	{
 		SceneCamera Camera;
@@ -130,7 +162,13 @@ namespace Borealis
 	// To be done:
 	struct MeshFilterComponent
 	{
-		Ref<Model> Model;
+		Ref<Borealis::Model> Model;
+		bool LodCrossFade = true; // Dither between levels of detail instead of popping
+
+		// Runtime level of detail state, not serialised
+		uint32_t Lod = 0;
+		uint32_t PreviousLod = 0;
+		float LodFade = 1.f; // How far Lod has faded in over PreviousLod
 
 		MeshFilterComponent() = default;
 		MeshFilterComponent(const MeshFilterComponent&) = default;
@@ -139,7 +177,7 @@ namespace Borealis
 
 	struct MeshRendererComponent
 	{
-		Ref<Material> Material;
+		Ref<Borealis::Material> Material;
 		bool castShadow = true;
 
 		MeshRendererComponent() = default;
@@ -281,15 +319,31 @@ namespace Borealis
 		std::string text{};
 		uint32_t fontSize = 16;
 		Ref<Font> font;
+		glm::vec4 colour{ 1.f };
+
+		// Laid out when the text, font or size changes. Copies lay out their own, so they keep their own vertex cache.
+		Ref<TextLayout> layout;
 
 		TextComponent() = default;
-		TextComponent(const TextComponent&) = default;
+		TextComponent(const TextComponent& other) : text(other.text), fontSize(other.fontSize), font(other.font), colour(other.colour) {}
+		TextComponent(TextComponent&&) noexcept = default;
+		TextComponent& operator=(const TextComponent& other)
+		{
+			text = other.text;
+			fontSize = other.fontSize;
+			font = other.font;
+			colour = other.colour;
+			layout = nullptr;
+			return *this;
+		}
+		TextComponent& operator=(TextComponent&&) noexcept = default;
 	};
 
 	class ScriptInstance;
 	struct ScriptComponent
 	{
-		std::unordered_map <std::string, Ref<ScriptInstance>> mScripts;
+		// Transparent, so HasScript looks up a string_view, scripts call it every frame
+		FlatHashMap<std::string, Ref<ScriptInstance>, StringHash, std::equal_to<>> mScripts;
 
 		void AddScript(const std::string& name, const Ref<ScriptInstance>& script)
 		{
@@ -301,7 +355,7 @@ namespace Borealis
 			mScripts.erase(name);
 		}
 
-		bool HasScript(const std::string& name)
+		bool HasScript(std::string_view name)
 		{
 			return mScripts.find(name) != mScripts.end();
 		}
@@ -314,6 +368,9 @@ namespace Borealis
 		bool isPlaying = false;
 		float Volume = 1.0f;
 		int channelID = 0;
+		int Priority = 128;			// 0 is the most important, 256 the least
+		float MinDistance = 1.0f;	// Distance the sound starts to attenuate
+		float MaxDistance = 50.0f;	// Distance the sound stops attenuating, voices well past it are culled
 
 		Ref<Audio> audio;
 
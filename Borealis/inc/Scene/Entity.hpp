@@ -18,6 +18,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <Scene/Scene.hpp>
 #include <Scene/Components.hpp>
 #include <Physics/PhysicsSystem.hpp>
+#include <Core/MemoryTracker.hpp>
 
 namespace Borealis
 {
@@ -63,6 +64,7 @@ namespace Borealis
 		template <typename T, typename ...Args>
 		T& AddComponent(Args&&... args)
 		{
+			MemoryTagScope memoryTag(MemoryTag::ECS);
 			T& Component = mScene->mRegistry.emplace<T>(mID, std::forward<Args>(args)...);
 			mScene->OnComponentAdded(*this, Component);
 			return Component;
@@ -126,6 +128,7 @@ namespace Borealis
 		template <typename T, typename...Args>
 		T& AddOrReplaceComponent(Args&& ... args)
 		{
+			MemoryTagScope memoryTag(MemoryTag::ECS);
 			T& Component= mScene->mRegistry.emplace_or_replace<T>(mID, std::forward<Args>(args)...);
 			mScene->OnComponentAdded(*this, Component);
 			return Component;
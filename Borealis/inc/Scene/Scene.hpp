@@ -16,7 +16,10 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #define SCENE_HPP
 #include <entt.hpp>
 #include <Core/UUID.hpp>
+#include <Core/FlatHashMap.hpp>
+#include <Core/TaskGraph.hpp>
 #include <Graphics/EditorCamera.hpp>
+#include <Scene/WorldPartition.hpp>
 namespace Borealis
 {
 	class Entity;
@@ -133,6 +136,15 @@ namespace Borealis
 		*************************************************************************/
 		entt::registry& GetRegistry() { return mRegistry; }
 
+		/*!***********************************************************************
+			\brief
+				Getter for the frame's task graph, e.g. to read the time each
+				system took in the last update
+			\return
+				The task graph
+		*************************************************************************/
+		const TaskGraph& GetFrameGraph() const { return mFrameGraph; }
+
 		/*!***********************************************************************
 			\brief
 				Getter for the name of the scene
@@ -184,6 +196,58 @@ namespace Borealis
 				The primary camera entity
 		*************************************************************************/
 		Entity GetPrimaryCameraEntity();
+
+		/*!***********************************************************************
+			\brief
+				Checks if the runtime has started
+		*************************************************************************/
+		bool IsRuntimeStarted() const { return hasRuntimeStarted; }
+
+		uint32_t GetViewportWidth() const { return mViewportWidth; }
+		uint32_t GetViewportHeight() const { return mViewportHeight; }
+
+		/*!***********************************************************************
+			\brief
+				Getter for the world partition settings, saved with the scene
+		*************************************************************************/
+		const WorldPartition::Settings& GetWorldPartitionSettings() const { return mWorldPartitionSettings; }
+
+		/*!***********************************************************************
+			\brief
+				Setter for the world partition settings, saved with the scene
+		*************************************************************************/
+		void SetWorldPartitionSettings(const WorldPartition::Settings& settings) { mWorldPartitionSettings = settings; }
+
+		/*!***********************************************************************
+			\brief
+				Streams the cells of the partition around the primary camera
+				at the start of every runtime update
+			\param[in] partition
+				The partition of the scene, null to stop streaming
+		*************************************************************************/
+		void SetWorldPartition(Scope<WorldPartition> partition) { mWorldPartition = std::move(partition); }
+
+		/*!***********************************************************************
+			\brief
+				Getter for the streamed world partition
+			\return
+				The partition, null if the scene was loaded whole
+		*************************************************************************/
+		WorldPartition* GetWorldPartition() const { return mWorldPartition.get(); }
+
+		/*!***********************************************************************
+			\brief
+				Keeps the bodies of rigid bodies added from now on out of the
+				physics world, for a scene built while another one runs
+		*************************************************************************/
+		void DeferPhysicsBodies() { mDeferPhysicsBodies = true; }
+
+		/*!***********************************************************************
+			\brief
+				Adds the bodies held back by DeferPhysicsBodies to the physics
+				world and stops holding new ones back
+		*************************************************************************/
+		void AddDeferredPhysicsBodies();
 	private:
 
 		/*!***********************************************************************
@@ -197,11 +261,59 @@ namespace Borealis
 		template<typename T>
 		void OnComponentAdded(Entity entity, T& component);
 
+		/*!***********************************************************************
+			\brief
+				Computes the world matrices of every renderable entity in parallel
+				chunks and copies light positions, ready for submission
+		*************************************************************************/
+		void BuildRenderList();
+
+		/*!***********************************************************************
+			\brief
+				Picks the level of detail of every mesh from the size it covers
+				on screen and advances the cross fades. Called after the render
+				list is built.
+			\param[in] cameraPosition
+				World position of the camera
+			\param[in] projection
+				Projection matrix of the camera
+			\param[in] dt
+				The delta time
+		*************************************************************************/
+		void SelectLods(const glm::vec3& cameraPosition, const glm::mat4& projection, float dt);
+
+		/*!***********************************************************************
+			\brief
+				Submits the lights and meshes of the render list to Renderer3D
+		*************************************************************************/
+		void SubmitMeshes();
+
+		/*!***********************************************************************
+			\brief
+				Submits the sprites, circles, text and particles of the render
+				list to Renderer2D
+		*************************************************************************/
+		void SubmitSprites();
+
+		struct RenderList
+		{
+			std::vector<glm::mat4> mMeshes;	//!< World matrices, in mesh group order
+			std::vector<glm::mat4> mSprites;	//!< World matrices, in sprite group order
+			std::vector<glm::mat4> mCircles;	//!< World matrices, in circle group order
+			std::vector<glm::mat4> mTexts;	//!< World matrices, in text group order
+			std::vector<uint32_t> mSpriteOrder;	//!< Sprite indices sorted by layer then texture
+		};
+
 		entt::registry mRegistry;
+		TaskGraph mFrameGraph;
+		RenderList mRenderList;
 		uint32_t mViewportWidth = 0, mViewportHeight = 0;
 		std::string mName;
 		std::string mScenePath;
-		std::unordered_map<UUID, entt::entity> mEntityMap;
+		FlatHashMap<UUID, entt::entity> mEntityMap;
+		WorldPartition::Settings mWorldPartitionSettings;
+		Scope<WorldPartition> mWorldPartition;
+		bool mDeferPhysicsBodies = false;
 
 		bool hasRuntimeStarted = false;
 
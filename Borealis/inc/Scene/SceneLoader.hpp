@@ -0,0 +1,87 @@
+/******************************************************************************/
+/*!
+\file		SceneLoader.hpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Declares the scene loader. Loads scenes without stalling the
+			frame: the file is parsed on a worker thread, then its assets
+			and entities are brought in on the main thread a slice per
+			frame, and the finished scene replaces the active one at the
+			start of a frame.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef SCENE_LOADER_HPP
+#define SCENE_LOADER_HPP
+#include <functional>
+#include <string>
+#include <Core/Core.hpp>
+
+namespace Borealis
+{
+	class Scene;
+
+	class SceneLoader
+	{
+	public:
+		using LoadedFn = std::function<void(const Ref<Scene>&)>;
+
+		enum class LoadMode
+		{
+			Replace,	// Build a new scene and make it the active one
+			Additive	// Add the entities to the active scene
+		};
+
+		static constexpr float FrameBudget = 0.004f; // Seconds of main thread work per frame
+
+		/*!***********************************************************************
+			\brief
+				Starts loading a scene from the scene library, replacing any
+				load in progress. A partitioned scene replaces the active one
+				with only its persistent entities, and streams its cells in
+				around the camera from then on.
+			\param[in] sceneName
+				The name of the scene in the scene library
+			\param[in] mode
+				Whether to replace the active scene or add to it
+			\param[in] onLoaded
+				Called on the main thread with the scene once the load is done
+		*************************************************************************/
+		static void LoadAsync(std::string sceneName, LoadMode mode = LoadMode::Replace, LoadedFn onLoaded = nullptr);
+
+		/*!***********************************************************************
+			\brief
+				Advances the load in progress within the frame budget. Called
+				by the application at the start of every frame.
+		*************************************************************************/
+		static void Update();
+
+		/*!***********************************************************************
+			\brief
+				Checks if a load is in progress
+		*************************************************************************/
+		static bool IsLoading();
+
+		/*!***********************************************************************
+			\brief
+				Gets how far the load in progress is
+			\return
+				Fraction of the assets and entities brought in, 0 while the file
+				is being parsed
+		*************************************************************************/
+		static float GetProgress();
+
+		/*!***********************************************************************
+			\brief
+				Waits for the worker and drops the load in progress
+		*************************************************************************/
+		static void Free();
+	};
+}
+
+#endif
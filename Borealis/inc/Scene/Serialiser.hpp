@@ -16,6 +16,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #define SERIALISER_HPP
 #include <Core/Core.hpp>
 #include <Scene/Scene.hpp>
+#include <Scene/Entity.hpp>
 #include <yaml-cpp/yaml.h>
 
 namespace YAML
@@ -57,6 +58,36 @@ namespace Borealis
 		*************************************************************************/
 		bool DeserialiseScene(const std::string& filepath);
 
+		/*!***********************************************************************
+			\brief
+				Reads and parses a scene file. Touches no engine state, so it
+				can run on a worker thread.
+			\param[in] filepath
+				The path to the scene file
+			\return
+				The root node, null if the file is not a scene
+		*************************************************************************/
+		static YAML::Node LoadSceneFile(const std::string& filepath);
+
+		/*!***********************************************************************
+			\brief
+				Sets the world partition settings of the scene from a parsed
+				scene file, disabling partitioning if it has none
+			\param[in] data
+				The root node of the scene file
+		*************************************************************************/
+		void DeserialiseWorldPartition(const YAML::Node& data);
+
+		/*!***********************************************************************
+			\brief
+				Creates an entity in the scene from its node in a scene file
+			\param[in] entity
+				The node of the entity
+			\return
+				The created entity
+		*************************************************************************/
+		Entity DeserialiseEntity(const YAML::Node& entity);
+
 		/*!***********************************************************************
 			\brief
 				Serialises the editor style data
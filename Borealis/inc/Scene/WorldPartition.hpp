@@ -0,0 +1,93 @@
+/******************************************************************************/
+/*!
+\file		WorldPartition.hpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Declares the world partition. Splits the entities of a large
+			scene into square cells on the XZ plane and streams the cells
+			in and out of the scene around the camera.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef WORLD_PARTITION_HPP
+#define WORLD_PARTITION_HPP
+#include <unordered_map>
+#include <vector>
+#include <glm/glm.hpp>
+#include <yaml-cpp/yaml.h>
+#include <Core/UUID.hpp>
+
+namespace Borealis
+{
+	class Scene;
+
+	class WorldPartition
+	{
+	public:
+		/*!***********************************************************************
+			\brief
+				Partitioning of a scene, saved with it
+		*************************************************************************/
+		struct Settings
+		{
+			float mCellSize = 0.f;				// Width of a cell, 0 if the scene is not partitioned
+			float mLoadRadius = 0.f;			// Cells with their centre this close to the camera are loaded
+			uint32_t mEntitiesPerFrame = 64;	// Entities created or destroyed per frame at most
+
+			bool IsEnabled() const { return mCellSize > 0.f; }
+		};
+
+		/*!***********************************************************************
+			\brief
+				Splits the entities of a parsed scene into cells. Touches no
+				engine state, so it can run on a worker thread.
+			\param[in] settings
+				Partitioning of the scene
+			\param[in] entities
+				Entities node of the scene file
+			\param[out] persistent
+				Entities kept loaded for the whole scene: those without a
+				transform, cameras, audio listeners, directional lights and
+				scripted entities, which other entities may look up at any time
+		*************************************************************************/
+		WorldPartition(const Settings& settings, const YAML::Node& entities, std::vector<YAML::Node>& persistent);
+
+		/*!***********************************************************************
+			\brief
+				Streams cells around a position. Cells out of range unload
+				before cells in range load, nearest first, within the entity
+				budget of the frame. Cells reload from the scene file, so
+				changes to their entities are lost when they unload.
+			\param[in] scene
+				Scene the cells are streamed into
+			\param[in] position
+				Position to stream around
+		*************************************************************************/
+		void Update(Scene& scene, const glm::vec3& position);
+
+		uint32_t GetCellCount() const { return static_cast<uint32_t>(mCells.size()); }
+		uint32_t GetLoadedCellCount() const { return mLoadedCells; }
+
+	private:
+		struct Cell
+		{
+			glm::vec2 mCentre;
+			std::vector<YAML::Node> mEntities;	// Nodes of the entities in the scene file
+			std::vector<UUID> mLoaded;			// Entities created so far, in the order of mEntities
+		};
+
+		static uint64_t GetCellKey(int32_t x, int32_t z);
+
+		Settings mSettings;
+		std::unordered_map<uint64_t, Cell> mCells;
+		std::vector<std::pair<float, Cell*>> mPending; // Cells in range still loading, reused every frame
+		uint32_t mLoadedCells = 0;
+	};
+}
+
+#endif
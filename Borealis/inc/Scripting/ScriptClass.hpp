@@ -17,6 +17,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #ifndef SCRIPT_CLASS_HPP
 #define SCRIPT_CLASS_HPP
 #include <string>
+#include <Core/FlatHashMap.hpp>
 #include <Scripting/ScriptField.hpp>
 
 extern "C" {
@@ -72,7 +73,7 @@ namespace Borealis
 			\return
 				The method
 		*************************************************************************/
-		MonoMethod* GetMethod(std::string methodName, int paramCount);
+		MonoMethod* GetMethod(const char* methodName, int paramCount);
 
 		/*!***********************************************************************
 			\brief
@@ -104,7 +105,7 @@ namespace Borealis
 		*************************************************************************/
 		std::string GetKlassName() const;
 
-		std::unordered_map<std::string, ScriptField> mFields; // Fields of the class
+		FlatHashMap<std::string, ScriptField, StringHash, std::equal_to<>> mFields; // Fields of the class
 	private:
 		std::string mClassName; // Name of the class
 		std::string mNamespaceName; // Namespace of the class
@@ -90,29 +90,6 @@ namespace Borealis
 			}
 		}
 
-		/*!***********************************************************************
-			\brief
-				Getter of a field value for strings
-			\param[in] name
-				Name of the field
-			\return
-				Value of the field
-		*************************************************************************/
-		template <>
-		std::string GetFieldValue(const std::string& name)
-		{
-			std::string output;
-			if (GetFieldValueString(name, output))
-			{
-				return output;
-			}
-			else
-			{
-				BOREALIS_CORE_WARN("Failed to get field {0} in class {1}", name, mScriptClass->GetKlassName());
-			}
-			return std::string();
-		}
-
 		/*!***********************************************************************
 			\brief
 				Setter of a field Value
@@ -231,6 +208,29 @@ namespace Borealis
 		MonoObject* mInstance;						// MonoObject Instance
 		inline static char s_fieldValueBuffer[24];	// Field Value Buffer
 	};
+
+	/*!***********************************************************************
+		\brief
+			Getter of a field value for strings
+		\param[in] name
+			Name of the field
+		\return
+			Value of the field
+	*************************************************************************/
+	template <>
+	inline std::string ScriptInstance::GetFieldValue<std::string>(const std::string& name)
+	{
+		std::string output;
+		if (GetFieldValueString(name, output))
+		{
+			return output;
+		}
+		else
+		{
+			BOREALIS_CORE_WARN("Failed to get field {0} in class {1}", name, mScriptClass->GetKlassName());
+		}
+		return std::string();
+	}
 }
 
 #endif
@@ -16,6 +16,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #ifndef SCRIPTING_EXPOSED_INTERNAL_HPP
 #define SCRIPTING_EXPOSED_INTERNAL_HPP
 #include <glm/glm.hpp>
+#include <Core/FlatHashMap.hpp>
 #include <mono/metadata/object.h>
 #include <mono/metadata/reflection.h>
 #include <Scene/Entity.hpp>
@@ -29,9 +30,9 @@ namespace Borealis
 
 	typedef struct GenericComponentFunctionMaps
 	{
-		static std::unordered_map<MonoType*, HasComponentFn> mHasComponentFunctions;
-		static std::unordered_map<MonoType*, AddComponentFn> mAddComponentFunctions;
-		static std::unordered_map<MonoType*, RemoveComponentFn> mRemoveComponentFunctions;
+		static FlatHashMap<MonoType*, HasComponentFn> mHasComponentFunctions;
+		static FlatHashMap<MonoType*, AddComponentFn> mAddComponentFunctions;
+		static FlatHashMap<MonoType*, RemoveComponentFn> mRemoveComponentFunctions;
 	} GCFM;
 
 	/*!***********************************************************************
@@ -288,6 +289,25 @@ namespace Borealis
 	*************************************************************************/
 	bool ScriptComponent_HasComponent(uint64_t entityID, MonoReflectionType* reflectionType);
 
+	/*!***********************************************************************
+		\brief
+			Starts loading a scene through the scene loader. The active scene
+			keeps running until the new one is built.
+		\param[in] sceneName
+			Name of the scene in the scene library
+		\param[in] additive
+			True to add the entities to the active scene instead
+	*************************************************************************/
+	void SceneManager_LoadScene(MonoString* sceneName, bool additive);
+
+	/*!***********************************************************************
+		\brief
+			Checks if a scene load is in progress
+		\return
+			True if loading
+	*************************************************************************/
+	bool SceneManager_IsLoading();
+
 
 
 }
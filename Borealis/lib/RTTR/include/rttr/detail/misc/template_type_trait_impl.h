@@ -88,19 +88,19 @@ namespace detail
     template<template <typename, typename, value_type > class T, typename T1, typename T2, value_type N1>                                                       \
     struct template_type_trait<T<T1, T2, N1>> : std::true_type                                                                                                  \
     {                                                                                                                                                           \
-        static std::vector<::rttr::type> get_template_arguments() { return { ::rttr::type::get<T1>(), ::rttr::type::get<T2>(), ::rttr::type::get<N1>() }; }     \
+        static std::vector<::rttr::type> get_template_arguments() { return { ::rttr::type::get<T1>(), ::rttr::type::get<T2>(), ::rttr::type::get<value_type>() }; }     \
     };                                                                                                                                                          \
                                                                                                                                                                 \
     template<template <typename, value_type, typename > class T, typename T1, typename T2, value_type N1>                                                       \
     struct template_type_trait<T<T1, N1, T2>> : std::true_type                                                                                                  \
     {                                                                                                                                                           \
-        static std::vector<::rttr::type> get_template_arguments() { return { ::rttr::type::get<T1>(), ::rttr::type::get<N1>(), ::rttr::type::get<T2>() }; }     \
+        static std::vector<::rttr::type> get_template_arguments() { return { ::rttr::type::get<T1>(), ::rttr::type::get<value_type>(), ::rttr::type::get<T2>() }; }     \
     };                                                                                                                                                          \
                                                                                                                                                                 \
     template<template <value_type, typename, typename > class T, typename T1, typename T2, value_type N1>                                                       \
     struct template_type_trait<T<N1, T1, T2>> : std::true_type                                                                                                  \
     {                                                                                                                                                           \
-        static std::vector<::rttr::type> get_template_arguments() { return { ::rttr::type::get<N1>(), ::rttr::type::get<T1>(), ::rttr::type::get<T2>() }; }     \
+        static std::vector<::rttr::type> get_template_arguments() { return { ::rttr::type::get<value_type>(), ::rttr::type::get<T1>(), ::rttr::type::get<T2>() }; }     \
     };                                                                                                                                                          \
                                                                                                                                                                 \
                                                                                                                                                                 \
@@ -108,19 +108,19 @@ namespace detail
     template<template <value_type, value_type, typename > class T, typename T1, value_type N1, value_type N2>                                                   \
     struct template_type_trait<T<N1, N2, T1>> : std::true_type                                                                                                  \
     {                                                                                                                                                           \
-        static std::vector<::rttr::type> get_template_arguments() { return { ::rttr::type::get<N1>(), ::rttr::type::get<N2>(), ::rttr::type::get<T1>() }; }     \
+        static std::vector<::rttr::type> get_template_arguments() { return { ::rttr::type::get<value_type>(), ::rttr::type::get<value_type>(), ::rttr::type::get<T1>() }; }     \
     };                                                                                                                                                          \
                                                                                                                                                                 \
     template<template <value_type, typename, value_type > class T, typename T1, value_type N1, value_type N2>                                                   \
     struct template_type_trait<T<N1, T1, N2>> : std::true_type                                                                                                  \
     {                                                                                                                                                           \
-        static std::vector<::rttr::type> get_template_arguments() { return { ::rttr::type::get<N1>(), ::rttr::type::get<T1>(), ::rttr::type::get<N2>() }; }     \
+        static std::vector<::rttr::type> get_template_arguments() { return { ::rttr::type::get<value_type>(), ::rttr::type::get<T1>(), ::rttr::type::get<value_type>() }; }     \
     };                                                                                                                                                          \
                                                                                                                                                                 \
     template<template <typename, value_type, value_type > class T, typename T1, value_type N1, value_type N2>                                                   \
     struct template_type_trait<T<T1, N1, N2>> : std::true_type                                                                                                  \
     {                                                                                                                                                           \
-        static std::vector<::rttr::type> get_template_arguments() { return { ::rttr::type::get<T1>(), ::rttr::type::get<N1>(), ::rttr::type::get<N2>() }; }     \
+        static std::vector<::rttr::type> get_template_arguments() { return { ::rttr::type::get<T1>(), ::rttr::type::get<value_type>(), ::rttr::type::get<value_type>() }; }     \
     };                                                                                                                                                          \
                                                                                                                                                                 \
 }                                                                                                                                                               \
@@ -33,6 +33,7 @@ namespace Borealis
 		if (extension == ".mat")	return AssetType::Material;
 		if (extension == ".mp3")	return AssetType::Audio;
 		if (extension == ".wav")	return AssetType::Audio;
+		if (extension == ".ogg")	return AssetType::Audio;
 
 		return AssetType::None;
 	}
@@ -22,6 +22,9 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <Graphics/Material.hpp>
 #include <Graphics/Texture.hpp>
 #include <Graphics/Model.hpp>
+#include <Graphics/RenderThread.hpp>
+#include <Core/MemoryTracker.hpp>
+#include <gli.hpp>
 
 
 namespace Borealis
@@ -61,6 +64,15 @@ namespace Borealis
 		metaData.CachePath = str;
 		metaData.importDate = node["LastModifiedDate"].as<uint64_t>();
 
+		if (YAML::Node audioSettings = node["AudioSettings"])
+		{
+			metaData.AudioSettings.Format = AudioImportSettings::StringToFormat(audioSettings["Format"].as<std::string>());
+			metaData.AudioSettings.LoadMode = AudioImportSettings::StringToLoadMode(audioSettings["LoadMode"].as<std::string>());
+			metaData.AudioSettings.StreamThreshold = audioSettings["StreamThreshold"].as<float>();
+			metaData.AudioSettings.ForceMono = audioSettings["ForceMono"].as<bool>();
+			metaData.AudioSettings.Streaming = audioSettings["Streaming"].as<bool>();
+		}
+
 		return metaData;
 	}
 
@@ -104,13 +116,32 @@ namespace Borealis
 		}
 
 		Ref<Asset> asset = nullptr;
-		if (mLoadedAssets.contains(assetHandle))
+		auto loaded = mLoadedAssets.find(assetHandle);
+		if (loaded != mLoadedAssets.end())
 		{
-			asset = mLoadedAssets.at(assetHandle);
+			asset = loaded->second;
 		}
 		else
 		{
-			asset = LoadAsset(assetHandle);
+			// A prefetched asset only waits on the rest of its read
+			Scope<PendingAsset> pending;
+			auto read = mPendingAssets.find(assetHandle);
+			if (read != mPendingAssets.end())
+			{
+				pending = std::move(read->second);
+				mPendingAssets.erase(assetHandle);
+				JobSystem::Wait(pending->mCounter);
+			}
+
+			// Loading creates GL objects, so borrow the context if the render thread owns it
+			RenderThread::ScopedContext context;
+			if (pending)
+			{
+				asset = pending->mFinish();
+				asset->mAssetHandle = assetHandle;
+			}
+			else
+				asset = LoadAsset(assetHandle);
 			mLoadedAssets.insert({ assetHandle, asset });
 		}
 		BOREALIS_CORE_INFO("Get asset : {}", assetHandle);
@@ -119,13 +150,59 @@ namespace Borealis
 
 	AssetMetaData const& EditorAssetManager::GetMetaData(AssetHandle assetHandle)
 	{
-		if (mAssetRegistry.contains(assetHandle))
+		auto metaData = mAssetRegistry.find(assetHandle);
+		if (metaData != mAssetRegistry.end())
 		{
-			return mAssetRegistry.at(assetHandle);
+			return metaData->second;
 		}
 		return{};
 	}
 
+	void EditorAssetManager::PrefetchAsset(AssetHandle assetHandle)
+	{
+		auto metaData = mAssetRegistry.find(assetHandle);
+		if (metaData == mAssetRegistry.end() || mLoadedAssets.contains(assetHandle) || mPendingAssets.contains(assetHandle))
+			return;
+
+		// The jobs own what they read, so a request dropped halfway leaves nothing dangling
+		std::string path = metaData->second.CachePath.string();
+		Scope<PendingAsset> pending = MakeScope<PendingAsset>();
+		switch (metaData->second.Type)
+		{
+		case AssetType::Texture2D:
+		{
+			Ref<gli::texture> image = MakeRef<gli::texture>();
+			JobSystem::Submit([image, path]()
+				{
+					MemoryTagScope memoryTag(MemoryTag::Textures);
+					*image = gli::load(path);
+				}, &pending->mCounter);
+			pending->mFinish = [image, path]() -> Ref<Asset> { return Texture2D::Create(path, *image); };
+			break;
+		}
+		case AssetType::Mesh:
+		{
+			Ref<Model> model = MakeRef<Model>();
+			JobSystem::Submit([model, path]() { model->ReadModel(path); }, &pending->mCounter);
+			pending->mFinish = [model]() -> Ref<Asset>
+				{
+					model->SetupMeshes();
+					return model;
+				};
+			break;
+		}
+		default:
+			return;
+		}
+		mPendingAssets[assetHandle] = std::move(pending);
+	}
+
+	bool EditorAssetManager::IsAssetReady(AssetHandle assetHandle)
+	{
+		auto pending = mPendingAssets.find(assetHandle);
+		return pending == mPendingAssets.end() || pending->second->mCounter.IsDone();
+	}
+
 	AssetRegistry& EditorAssetManager::GetAssetRegistry()
 	{
 		return mAssetRegistry;
@@ -170,8 +247,24 @@ namespace Borealis
 	//	SerializeRegistry();
 	//}
 
+	void EditorAssetManager::AddMemoryAsset(Ref<Asset> asset, std::string const& name)
+	{
+		AssetMetaData metaData;
+		metaData.name = name;
+		metaData.Handle = asset->mAssetHandle;
+		metaData.Type = asset->mAssetType;
+
+		mAssetRegistry[metaData.Handle] = metaData;
+		mLoadedAssets[metaData.Handle] = asset;
+	}
+
 	void EditorAssetManager::Clear()
 	{
+		// The workers decrement the counters when they finish
+		for (auto& [handle, pending] : mPendingAssets)
+			JobSystem::Wait(pending->mCounter);
+		mPendingAssets.clear();
+
 		mAssetRegistry.clear();
 		mAssetRegistryPath.clear();
 	}
@@ -185,7 +278,11 @@ namespace Borealis
 		switch (metaData.Type)
 		{
 		case AssetType::Audio:
-			asset = MakeRef<Audio>(AudioEngine::LoadAudio(metaData.SourcePath.string()));
+			// Audio imported before the compiler handled it has no cache yet
+			if (std::filesystem::is_regular_file(metaData.CachePath))
+				asset = MakeRef<Audio>(AudioEngine::LoadAudio(metaData.CachePath.string(), metaData.AudioSettings));
+			else
+				asset = MakeRef<Audio>(AudioEngine::LoadAudio(metaData.SourcePath.string()));
 			break;
 		case AssetType::Texture2D:
 			asset = Texture2D::Create(metaData.CachePath.string());
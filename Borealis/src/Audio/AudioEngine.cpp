@@ -17,27 +17,92 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <Audio/Audio.hpp>
 #include "Audio/AudioEngine.hpp"
 #include <Scene/Components.hpp>
+#include <Assets/AssetMetaData.hpp>
+#include <Core/MemoryTracker.hpp>
 
 namespace Borealis
 {
+    static void* F_CALL FmodAllocate(unsigned int size, FMOD_MEMORY_TYPE, const char*)
+    {
+        return MemoryTracker::Allocate(size, 16, MemoryTag::Audio);
+    }
+
+    static void* F_CALL FmodReallocate(void* ptr, unsigned int size, FMOD_MEMORY_TYPE, const char*)
+    {
+        return MemoryTracker::Reallocate(ptr, size, MemoryTag::Audio);
+    }
+
+    static void F_CALL FmodFree(void* ptr, FMOD_MEMORY_TYPE, const char*)
+    {
+        MemoryTracker::Free(ptr);
+    }
+
+    // Voices FMOD mixes for real, the rest are virtual and only tracked
+    static constexpr int sRealVoices = 64;
+    // Channels FMOD may hold at once, real and virtual
+    static constexpr int sMaxChannels = 512;
+    // 3D voices further than this multiple of their max distance give up their channel
+    static constexpr float sCullDistanceScale = 1.1f;
+
+    /*!***********************************************************************
+    \brief
+        One playing sound. Voices sit in a dense slot array and are named by
+        a handle holding the slot index and the slot's generation, so the
+        handle of a finished voice never refers to a newer one. A culled
+        voice has no FMOD channel and only its playback position advances.
+    *************************************************************************/
+    struct Voice
+    {
+        FMOD::Channel* mpChannel = nullptr;     // Null while culled
+        FMOD::Sound* mpSound = nullptr;
+        FMOD_VECTOR mPosition{};
+        float mfVolume = 1.0f;                  // Linear volume
+        float mfMinDistance = 1.0f;
+        float mfMaxDistance = 50.0f;
+        unsigned int mnLengthMs = 0;
+        unsigned int mnPositionMs = 0;          // Playback position while culled
+        float mfPositionRemainder = 0.0f;       // Fraction of a millisecond carried between updates
+        int mnPriority = 128;
+        uint32_t mnActiveIndex = 0;             // Index into mActiveSlots
+        uint16_t mnGeneration = 1;
+        bool mbActive = false;
+        bool mbLoop = false;
+        bool mbMute = false;
+        bool mb3D = false;
+        bool mbPositionDirty = false;
+        bool mbEnded = false;                   // Set by the channel end callback
+        bool mbPrepared = false;                // Length and mode read, the sound has finished loading
+    };
 
     struct Implementation {
-        Implementation();
+        Implementation(bool bNoSound);
         ~Implementation();
 
-        void Update();
+        void Update(float dt);
 
-        FMOD::System* mpSystem;
+        int GetHandle(uint16_t nSlot) const;
+        Voice* GetVoice(int nHandle);
+        int AllocateVoice();
+        void ReleaseVoice(uint16_t nSlot);
+        bool Prepare(Voice& voice);
+        bool IsAudible(const Voice& voice) const;
+        void Realise(Voice& voice, int nHandle);
+        void Cull(Voice& voice);
 
-        int mnNextChannelId;
+        FMOD::System* mpSystem;
 
-        //typedef std::map<std::string, FMOD::Sound*> SoundMap;
-        typedef std::map<int, FMOD::Channel*> ChannelMap;
+        std::vector<Voice> mVoices;
+        std::vector<uint16_t> mFreeSlots;
+        std::vector<uint16_t> mActiveSlots;     // Dense list of the slots in use
 
-        //SoundMap mSounds;
-        ChannelMap mChannels;
+        FMOD_VECTOR mListenerPosition{};
+        FMOD_VECTOR mListenerForward{ 0.0f, 0.0f, -1.0f };
+        FMOD_VECTOR mListenerUp{ 0.0f, 1.0f, 0.0f };
+        bool mbListenerDirty = true;
     };
 
+    Implementation* sgpImplementation = nullptr;
+
     static FMOD_VECTOR VectorToFmod(const Vector3& vPosition)
     {
         FMOD_VECTOR fVec;
@@ -59,14 +124,57 @@ namespace Borealis
         return 0;
     }
 
-    Implementation::Implementation()
+    /*!***********************************************************************
+    \brief
+        Marks a voice as finished when FMOD ends its channel, so the update
+        never polls isPlaying
+    *************************************************************************/
+    static FMOD_RESULT F_CALL ChannelCallback(FMOD_CHANNELCONTROL* pControl, FMOD_CHANNELCONTROL_TYPE eType, FMOD_CHANNELCONTROL_CALLBACK_TYPE eCallback, void*, void*)
+    {
+        if (eType != FMOD_CHANNELCONTROL_CHANNEL || eCallback != FMOD_CHANNELCONTROL_CALLBACK_END || !sgpImplementation)
+            return FMOD_OK;
+
+        FMOD::Channel* pChannel = reinterpret_cast<FMOD::Channel*>(pControl);
+        void* pUserData = nullptr;
+        pChannel->getUserData(&pUserData);
+
+        // Culled and stopped voices clear their channel first, so only natural ends land here
+        Voice* pVoice = sgpImplementation->GetVoice(static_cast<int>(reinterpret_cast<intptr_t>(pUserData)));
+        if (pVoice && pVoice->mpChannel == pChannel)
+            pVoice->mbEnded = true;
+        return FMOD_OK;
+    }
+
+    Implementation::Implementation(bool bNoSound)
     {
         mpSystem = NULL;
-        mnNextChannelId = 1;
+        // Route FMOD's allocations through the memory tracker, this has to happen before any FMOD object exists
+        static bool memoryHooked = false;
+        if (!memoryHooked)
+        {
+            ErrorCheck(FMOD::Memory_Initialize(nullptr, 0, FmodAllocate, FmodReallocate, FmodFree));
+            memoryHooked = true;
+        }
         // Create FMOD Core system
         ErrorCheck(FMOD::System_Create(&mpSystem));
+        // Channels are still mixed and tracked, but nothing is sent to a device
+        if (bNoSound)
+            ErrorCheck(mpSystem->setOutput(FMOD_OUTPUTTYPE_NOSOUND));
+
+        // FMOD mixes the loudest, highest priority channels and keeps the rest virtual.
+        // Near silent channels go virtual too instead of taking a real voice.
+        ErrorCheck(mpSystem->setSoftwareChannels(sRealVoices));
+        FMOD_ADVANCEDSETTINGS settings{};
+        settings.cbSize = sizeof(settings);
+        settings.vol0virtualvol = 0.001f;
+        ErrorCheck(mpSystem->setAdvancedSettings(&settings));
+
         // Initialize FMOD Core system
-        ErrorCheck(mpSystem->init(32, FMOD_INIT_PROFILE_ENABLE, NULL));
+        ErrorCheck(mpSystem->init(sMaxChannels, FMOD_INIT_PROFILE_ENABLE | FMOD_INIT_VOL0_BECOMES_VIRTUAL | FMOD_INIT_3D_RIGHTHANDED, NULL));
+
+        mVoices.reserve(sMaxChannels);
+        mActiveSlots.reserve(sMaxChannels);
+        mFreeSlots.reserve(sMaxChannels);
     }
 
     Implementation::~Implementation()
@@ -75,56 +183,244 @@ namespace Borealis
         ErrorCheck(mpSystem->release());
     }
 
-    void Implementation::Update()
+    int Implementation::GetHandle(uint16_t nSlot) const
     {
-        /*AudioEngine::PlayAudio(".\assets\audio\meow.mp3");*/
-        std::vector<ChannelMap::iterator> pStoppedChannels;
-        for (auto it = mChannels.begin(), itEnd = mChannels.end(); it != itEnd; ++it)
+        return static_cast<int>(mVoices[nSlot].mnGeneration) << 16 | nSlot;
+    }
+
+    Voice* Implementation::GetVoice(int nHandle)
+    {
+        uint32_t nSlot = static_cast<uint32_t>(nHandle) & 0xFFFF;
+        uint32_t nGeneration = static_cast<uint32_t>(nHandle) >> 16;
+        if (nHandle <= 0 || nSlot >= mVoices.size())
+            return nullptr;
+
+        Voice& voice = mVoices[nSlot];
+        return voice.mbActive && voice.mnGeneration == nGeneration ? &voice : nullptr;
+    }
+
+    int Implementation::AllocateVoice()
+    {
+        uint16_t nSlot;
+        if (!mFreeSlots.empty())
         {
-            bool bIsPlaying = false;
-            it->second->isPlaying(&bIsPlaying);
-            if (!bIsPlaying)
-            {
-                pStoppedChannels.push_back(it);
-            }
+            nSlot = mFreeSlots.back();
+            mFreeSlots.pop_back();
+        }
+        else if (mVoices.size() < 0xFFFF)
+        {
+            nSlot = static_cast<uint16_t>(mVoices.size());
+            mVoices.emplace_back();
+        }
+        else
+        {
+            return -1;
         }
 
-        for (auto& it : pStoppedChannels)
+        Voice& voice = mVoices[nSlot];
+        uint16_t nGeneration = voice.mnGeneration;
+        voice = Voice{};
+        voice.mnGeneration = nGeneration;
+        voice.mbActive = true;
+        voice.mnActiveIndex = static_cast<uint32_t>(mActiveSlots.size());
+        mActiveSlots.push_back(nSlot);
+        return GetHandle(nSlot);
+    }
+
+    void Implementation::ReleaseVoice(uint16_t nSlot)
+    {
+        Voice& voice = mVoices[nSlot];
+        if (voice.mpChannel)
         {
-            mChannels.erase(it);
+            // Clear the channel first so the end callback ignores it
+            FMOD::Channel* pChannel = voice.mpChannel;
+            voice.mpChannel = nullptr;
+            pChannel->stop();
         }
-        ErrorCheck(mpSystem->update());
+
+        // Swap remove from the active list
+        uint16_t nLast = mActiveSlots.back();
+        mActiveSlots[voice.mnActiveIndex] = nLast;
+        mVoices[nLast].mnActiveIndex = voice.mnActiveIndex;
+        mActiveSlots.pop_back();
+
+        voice.mbActive = false;
+        // Generations stay in 1..0x7FFF so handles are always positive
+        voice.mnGeneration = voice.mnGeneration == 0x7FFF ? 1 : voice.mnGeneration + 1;
+        mFreeSlots.push_back(nSlot);
     }
 
-    Implementation* sgpImplementation = nullptr;
+    bool Implementation::Prepare(Voice& voice)
+    {
+        if (voice.mbPrepared)
+            return true;
+
+        // Sounds are opened non blocking and can't be queried until they finish loading
+        FMOD_OPENSTATE eState = FMOD_OPENSTATE_READY;
+        voice.mpSound->getOpenState(&eState, nullptr, nullptr, nullptr);
+        if (eState == FMOD_OPENSTATE_LOADING)
+            return false;
+        if (eState == FMOD_OPENSTATE_ERROR)
+        {
+            voice.mbEnded = true;
+            return false;
+        }
+
+        FMOD_MODE currMode;
+        voice.mpSound->getMode(&currMode);
+        voice.mb3D = (currMode & FMOD_3D) != 0;
+        voice.mpSound->getLength(&voice.mnLengthMs, FMOD_TIMEUNIT_MS);
+        voice.mbPrepared = true;
+        return true;
+    }
 
-    void AudioEngine::Init()
+    bool Implementation::IsAudible(const Voice& voice) const
     {
-        sgpImplementation = new Implementation;
+        if (!voice.mb3D)
+            return true;
+
+        float dx = voice.mPosition.x - mListenerPosition.x;
+        float dy = voice.mPosition.y - mListenerPosition.y;
+        float dz = voice.mPosition.z - mListenerPosition.z;
+        float fCullDistance = voice.mfMaxDistance * sCullDistanceScale;
+        return dx * dx + dy * dy + dz * dz <= fCullDistance * fCullDistance;
     }
 
-    void AudioEngine::Update()
+    void Implementation::Realise(Voice& voice, int nHandle)
     {
-        sgpImplementation->Update();
+        FMOD::Channel* pChannel = nullptr;
+        if (ErrorCheck(mpSystem->playSound(voice.mpSound, nullptr, true, &pChannel)) || !pChannel)
+            return;
+
+        ErrorCheck(pChannel->setUserData(reinterpret_cast<void*>(static_cast<intptr_t>(nHandle))));
+        ErrorCheck(pChannel->setCallback(ChannelCallback));
+        ErrorCheck(pChannel->setPriority(voice.mnPriority));
+        if (voice.mb3D)
+        {
+            ErrorCheck(pChannel->set3DMinMaxDistance(voice.mfMinDistance, voice.mfMaxDistance));
+            ErrorCheck(pChannel->set3DAttributes(&voice.mPosition, nullptr));
+        }
+
+        // Set the volume, mute, and loop properties
+        ErrorCheck(pChannel->setVolume(voice.mfVolume));
+        ErrorCheck(pChannel->setMute(voice.mbMute));
+        ErrorCheck(pChannel->setMode(voice.mbLoop ? FMOD_LOOP_NORMAL : FMOD_LOOP_OFF));
+        if (voice.mnPositionMs > 0)
+            ErrorCheck(pChannel->setPosition(voice.mnPositionMs, FMOD_TIMEUNIT_MS));
+        ErrorCheck(pChannel->setPaused(false));
+
+        voice.mpChannel = pChannel;
+        voice.mbEnded = false;
+        voice.mbPositionDirty = false;
     }
 
+    void Implementation::Cull(Voice& voice)
+    {
+        // Keep the playback position so the voice resumes in the right place
+        unsigned int nPositionMs = 0;
+        voice.mpChannel->getPosition(&nPositionMs, FMOD_TIMEUNIT_MS);
+        voice.mnPositionMs = nPositionMs;
+        voice.mfPositionRemainder = 0.0f;
+
+        FMOD::Channel* pChannel = voice.mpChannel;
+        voice.mpChannel = nullptr;
+        pChannel->stop();
+    }
 
-    Audio AudioEngine::LoadAudio(const std::string& strAudioName, bool b3d, bool bLooping, bool bStream)
+    void Implementation::Update(float dt)
     {
-        //auto tFoundIt = sgpImplementation->mSounds.find(strAudioName);
-        //if (tFoundIt != sgpImplementation->mSounds.end())
-        //    return Audio();
+        PROFILE_FUNCTION();
 
-        FMOD_MODE eMode = FMOD_DEFAULT;
-        eMode |= b3d ? FMOD_3D : FMOD_2D;
-        eMode |= bLooping ? FMOD_LOOP_NORMAL : FMOD_LOOP_OFF;
-        eMode |= bStream ? FMOD_CREATESTREAM : FMOD_CREATECOMPRESSEDSAMPLE;
+        if (mbListenerDirty)
+        {
+            ErrorCheck(mpSystem->set3DListenerAttributes(0, &mListenerPosition, nullptr, &mListenerForward, &mListenerUp));
+            mbListenerDirty = false;
+        }
+
+        // One pass over the voices in use, pushing the positions set this frame
+        for (size_t i = 0; i < mActiveSlots.size();)
+        {
+            uint16_t nSlot = mActiveSlots[i];
+            Voice& voice = mVoices[nSlot];
+            if (voice.mbEnded)
+            {
+                ReleaseVoice(nSlot);
+                continue;
+            }
 
+            if (voice.mpChannel)
+            {
+                if (!IsAudible(voice))
+                    Cull(voice);
+                else if (voice.mbPositionDirty)
+                    ErrorCheck(voice.mpChannel->set3DAttributes(&voice.mPosition, nullptr));
+            }
+            else
+            {
+                // Voices whose sound is still loading wait at the start of the clip
+                bool bWasPrepared = voice.mbPrepared;
+                if (!Prepare(voice))
+                {
+                    ++i;
+                    continue;
+                }
+
+                if (bWasPrepared)
+                {
+                    float fElapsedMs = dt * 1000.0f + voice.mfPositionRemainder;
+                    unsigned int nElapsedMs = static_cast<unsigned int>(fElapsedMs);
+                    voice.mfPositionRemainder = fElapsedMs - nElapsedMs;
+                    voice.mnPositionMs += nElapsedMs;
+
+                    if (voice.mnLengthMs > 0 && voice.mnPositionMs >= voice.mnLengthMs)
+                    {
+                        if (!voice.mbLoop)
+                        {
+                            ReleaseVoice(nSlot);
+                            continue;
+                        }
+                        voice.mnPositionMs %= voice.mnLengthMs;
+                    }
+                }
+
+                if (IsAudible(voice))
+                    Realise(voice, GetHandle(nSlot));
+            }
+
+            voice.mbPositionDirty = false;
+            ++i;
+        }
+
+        ErrorCheck(mpSystem->update());
+
+        int nRealChannels = 0;
+        mpSystem->getChannelsPlaying(nullptr, &nRealChannels);
+        PROFILE_COUNTER("Audio Voices", mActiveSlots.size());
+        PROFILE_COUNTER("Audio Real Voices", nRealChannels);
+    }
+
+    void AudioEngine::Init(bool bNoSound)
+    {
+        sgpImplementation = new Implementation(bNoSound);
+    }
+
+    void AudioEngine::Update(float dt)
+    {
+        sgpImplementation->Update(dt);
+    }
+
+
+    /*!***********************************************************************
+    \brief
+        Opens a sound without blocking. FMOD decodes it on its own thread and
+        voices playing it wait until it is ready.
+    *************************************************************************/
+    static Audio CreateAudio(const std::string& strAudioName, FMOD_MODE eMode)
+    {
         FMOD::Sound* pSound = nullptr;
-        ErrorCheck(sgpImplementation->mpSystem->createSound(strAudioName.c_str(), eMode, nullptr, &pSound));
+        ErrorCheck(sgpImplementation->mpSystem->createSound(strAudioName.c_str(), eMode | FMOD_NONBLOCKING, nullptr, &pSound));
         if (pSound)
         {
-            //sgpImplementation->mSounds[strAudioName] = pSound;
             Audio audio;
             audio.AudioPath = strAudioName;
             audio.audioPtr = pSound;
@@ -135,6 +431,32 @@ namespace Borealis
         return Audio();
     }
 
+    Audio AudioEngine::LoadAudio(const std::string& strAudioName, bool b3d, bool bLooping, bool bStream)
+    {
+        FMOD_MODE eMode = FMOD_DEFAULT;
+        eMode |= b3d ? FMOD_3D : FMOD_2D;
+        eMode |= bLooping ? FMOD_LOOP_NORMAL : FMOD_LOOP_OFF;
+        eMode |= bStream ? FMOD_CREATESTREAM : FMOD_CREATECOMPRESSEDSAMPLE;
+
+        return CreateAudio(strAudioName, eMode);
+    }
+
+    Audio AudioEngine::LoadAudio(const std::string& strAudioName, const AudioImportSettings& settings, bool b3d)
+    {
+        FMOD_MODE eMode = FMOD_DEFAULT;
+        eMode |= b3d ? FMOD_3D : FMOD_2D;
+
+        // Long clips keep only a streaming buffer in memory, short ones are decoded up front so playing them costs nothing
+        if (settings.Streaming)
+            eMode |= FMOD_CREATESTREAM;
+        else if (settings.LoadMode == AudioLoadMode::CompressedInMemory)
+            eMode |= FMOD_CREATECOMPRESSEDSAMPLE;
+        else
+            eMode |= FMOD_CREATESAMPLE;
+
+        return CreateAudio(strAudioName, eMode);
+    }
+
     void AudioEngine::UnLoadAudio(const std::string& strSoundName)
     {
         //auto tFoundIt = sgpImplementation->mSounds.find(strSoundName);
@@ -147,108 +469,94 @@ namespace Borealis
 
     int AudioEngine::PlayAudio(const AudioSourceComponent& audio, const Vector3& vPosition, float fVolumedB, bool bMute, bool bLoop)
     {
-        int nChannelId = sgpImplementation->mnNextChannelId++;
-
-        // Load the sound if it hasn't been loaded yet
-        
-        //auto tFoundIt = sgpImplementation->mSounds.find(strSoundName);
-        //if (tFoundIt == sgpImplementation->mSounds.end())
-        //{
-        //    AudioEngine::LoadAudio(strSoundName, true, bLoop);  // Load with loop if needed
-        //    tFoundIt = sgpImplementation->mSounds.find(strSoundName);
-        //    if (tFoundIt == sgpImplementation->mSounds.end())
-        //    {
-        //        return -1;  // Error: Sound not found or failed to load
-        //    }
-        //}
-        FMOD::Sound* fmodSound = audio.audio->audioPtr;
+        FMOD::Sound* fmodSound = audio.audio ? audio.audio->audioPtr : nullptr;
         if (!fmodSound)
         {
             return -1;
         }
 
-        FMOD::Channel* pChannel = nullptr;
-        ErrorCheck(sgpImplementation->mpSystem->playSound(fmodSound, nullptr, true, &pChannel));
-
-        if (pChannel)
+        int nHandle = sgpImplementation->AllocateVoice();
+        if (nHandle < 0)
         {
-            FMOD_MODE currMode;
-            fmodSound->getMode(&currMode);
-            if (currMode & FMOD_3D)
-            {
-                FMOD_VECTOR position = VectorToFmod(vPosition);
-                ErrorCheck(pChannel->set3DAttributes(&position, nullptr));
-            }
-
-            // Set the volume, mute, and loop properties
-            ErrorCheck(pChannel->setVolume(dbToVolume(fVolumedB)));
-            ErrorCheck(pChannel->setPaused(false));
-            ErrorCheck(pChannel->setMute(bMute));  // Mute the sound if necessary
-            ErrorCheck(pChannel->setMode(bLoop ? FMOD_LOOP_NORMAL : FMOD_LOOP_OFF));  // Set loop mode
-
-            // Store the channel in the channel map
-            sgpImplementation->mChannels[nChannelId] = pChannel;
+            return -1;
         }
 
-        return nChannelId;  // Return the channel ID for tracking
+        Voice& voice = *sgpImplementation->GetVoice(nHandle);
+        voice.mpSound = fmodSound;
+        voice.mPosition = VectorToFmod(vPosition);
+        voice.mfVolume = dbToVolume(fVolumedB);
+        voice.mfMinDistance = audio.MinDistance;
+        voice.mfMaxDistance = std::max(audio.MaxDistance, audio.MinDistance);
+        voice.mnPriority = audio.Priority;
+        voice.mbLoop = bLoop;
+        voice.mbMute = bMute;
+
+        // Sounds out of range start culled and only take a channel once the listener gets close,
+        // sounds still loading start once Update sees them ready
+        if (sgpImplementation->Prepare(voice) && sgpImplementation->IsAudible(voice))
+            sgpImplementation->Realise(voice, nHandle);
+
+        return nHandle;  // Return the voice handle for tracking
     }
 
+
     bool AudioEngine::isSoundPlaying(int nChannelId)
     {
-        // Find the channel using the channel ID
-        auto tFoundChannel = sgpImplementation->mChannels.find(nChannelId);
-        if (tFoundChannel == sgpImplementation->mChannels.end())
-            return false; // Channel not found
-
-        bool bIsPlaying = false;
-        // Check if the channel is currently playing
-        ErrorCheck(tFoundChannel->second->isPlaying(&bIsPlaying));
-
-        return bIsPlaying;
+        // Culled voices are still playing, just not audibly
+        Voice* pVoice = sgpImplementation->GetVoice(nChannelId);
+        return pVoice && !pVoice->mbEnded;
     }
 
     void AudioEngine::StopChannel(int nChannelId)
     {
-        auto tFoundIt = sgpImplementation->mChannels.find(nChannelId); // Attempt to find the channel by ID
-
-        // Check if the channel is found
-        if (tFoundIt != sgpImplementation->mChannels.end())
+        if (sgpImplementation->GetVoice(nChannelId))
         {
-            FMOD::Channel* pChannel = tFoundIt->second;
-            bool bIsPlaying = false;
-
-            // Check if the channel is currently playing
-            pChannel->isPlaying(&bIsPlaying);
+            sgpImplementation->ReleaseVoice(static_cast<uint16_t>(nChannelId & 0xFFFF));
+        }
+    }
 
-            // If the channel is playing, stop it
-            if (bIsPlaying)
-            {
-                ErrorCheck(pChannel->stop()); // Stop the channel
-                sgpImplementation->mChannels.erase(nChannelId); // Remove channel from map
-            }
+    void AudioEngine::StopAllChannels()
+    {
+        while (!sgpImplementation->mActiveSlots.empty())
+        {
+            sgpImplementation->ReleaseVoice(sgpImplementation->mActiveSlots.back());
         }
     }
 
-    void AudioEngine::SetChannel3DPosition(int nChannelId, const Vector3& vPosition)
+    void AudioEngine::Set3DListenerAndOrientation(const Vector3& vPos, const Vector3& vForward, const Vector3& vUp)
     {
-        auto tFoundIt = sgpImplementation->mChannels.find(nChannelId);
-        if (tFoundIt == sgpImplementation->mChannels.end())
-            return;
+        sgpImplementation->mListenerPosition = VectorToFmod(vPos);
+        sgpImplementation->mListenerForward = VectorToFmod(vForward);
+        sgpImplementation->mListenerUp = VectorToFmod(vUp);
+        sgpImplementation->mbListenerDirty = true;
+    }
 
-        FMOD_VECTOR position = VectorToFmod(vPosition);
-        ErrorCheck(tFoundIt->second->set3DAttributes(&position, NULL));
+    void AudioEngine::SetChannel3DPosition(int nChannelId, const Vector3& vPosition)
+    {
+        // Only recorded here, Update pushes every moved voice to FMOD in one pass
+        if (Voice* pVoice = sgpImplementation->GetVoice(nChannelId))
+        {
+            pVoice->mPosition = VectorToFmod(vPosition);
+            pVoice->mbPositionDirty = true;
+        }
     }
 
     void AudioEngine::SetChannelVolume(int nChannelId, float fVolumedB)
     {
-        auto tFoundIt = sgpImplementation->mChannels.find(nChannelId);
-        if (tFoundIt == sgpImplementation->mChannels.end())
+        Voice* pVoice = sgpImplementation->GetVoice(nChannelId);
+        if (!pVoice)
             return;
 
-        ErrorCheck(tFoundIt->second->setVolume(dbToVolume(fVolumedB)));
+        pVoice->mfVolume = dbToVolume(fVolumedB);
+        if (pVoice->mpChannel)
+            ErrorCheck(pVoice->mpChannel->setVolume(pVoice->mfVolume));
+    }
+
+    uint32_t AudioEngine::GetVoiceCount()
+    {
+        return static_cast<uint32_t>(sgpImplementation->mActiveSlots.size());
     }
 
-  
     float AudioEngine::dbToVolume(float dB)
     {
         return powf(10.0f, 0.05f * dB);
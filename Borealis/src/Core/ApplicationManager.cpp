@@ -13,17 +13,23 @@ prior written consent of DigiPen Institute of Technology is prohibited.
  /******************************************************************************/
 
 #include <BorealisPCH.hpp>
-#define NOMINMAX
-#include <windows.h>
+#include <thread>
 #include <GLFW/glfw3.h>
 #include <Audio/AudioEngine.hpp>
 #include <Core/LoggerSystem.hpp>
 #include <Core/ApplicationManager.hpp>
 #include <Core/InputSystem.hpp>
+#include <Core/InputRecorder.hpp>
+#include <Core/FrameAllocator.hpp>
+#include <Core/MemoryTracker.hpp>
+#include <Core/JobSystem.hpp>
 #include <Graphics/Renderer.hpp>
+#include <Graphics/Null/GraphicsContextNullImpl.hpp>
+#include <Graphics/Null/RendererAPINullImpl.hpp>
 #include <Scripting/ScriptingSystem.hpp>
 #include <AI/BehaviourTree/RegisterNodes.hpp>
 #include <Physics/PhysicsSystem.hpp>
+#include <Scene/SceneLoader.hpp>
 
 namespace Borealis
 {
@@ -33,26 +39,61 @@ namespace Borealis
 		\brief
 			Constructor of the class. Initializes the application
 	*************************************************************************/
-	ApplicationManager::ApplicationManager(const std::string& name)
+	ApplicationManager::ApplicationManager(const std::string& name, RenderThread::Policy renderPolicy)
+		: ApplicationManager(ApplicationProperties{ name, renderPolicy })
+	{
+	}
+
+	/*!***********************************************************************
+		\brief
+			Constructor of the class. Initializes the application. Headless
+			applications create no window and render through the Null API.
+	*************************************************************************/
+	ApplicationManager::ApplicationManager(const ApplicationProperties& properties) : mProperties(properties)
 	{
 		PROFILE_FUNCTION();
 		mIsRunning = true;
 		mIsMinimized = false;
 		sInstance = this;
-		mWindowManager = new WindowManager(WindowProperties(name));
-		mWindowManager->SetEventCallback(BIND_EVENT(ApplicationManager::EventFn));
+		FrameProfiler::Init();
+		FrameAllocator::Init();
+
+		if (mProperties.mIsHeadless)
+		{
+			BOREALIS_CORE_INFO("Running headless");
+			RendererAPI::SetAPI(RendererAPI::API::Null);
+			mHeadlessContext = MakeScope<NullGraphicsContext>();
+			RenderThread::Init(mProperties.mRenderPolicy, mHeadlessContext.get());
+		}
+		else
+		{
+			mWindowManager = new WindowManager(WindowProperties(mProperties.mName));
+			mWindowManager->SetEventCallback(BIND_EVENT(ApplicationManager::EventFn));
 
-		mImGuiLayer = new ImGuiLayer();
-		PushOverlay(mImGuiLayer);
+			RenderThread::Init(mProperties.mRenderPolicy, mWindowManager->GetContext());
+
+			mImGuiLayer = new ImGuiLayer();
+			PushOverlay(mImGuiLayer);
+		}
+
+		JobSystem::Init();
 
 		Renderer::Init();
 
 		ScriptingSystem::Init();
 
-		AudioEngine::Init();
+		AudioEngine::Init(mProperties.mIsHeadless);
 		NodeFactory::Init();
 		InputSystem::Init();
 		PhysicsSystem::Init();
+
+		if (!mProperties.mReplayInputPath.empty())
+		{
+			if (InputRecorder::StartReplay(mProperties.mReplayInputPath) && mImGuiLayer)
+				mImGuiLayer->DetachLiveInput();
+		}
+		else if (!mProperties.mRecordInputPath.empty())
+			InputRecorder::StartRecording(mProperties.mRecordInputPath, std::random_device{}());
 	}
 
 	/*!***********************************************************************
@@ -63,14 +104,27 @@ namespace Borealis
 	{
 		PROFILE_FUNCTION();
 
+		InputRecorder::Stop();
+		if (!mProperties.mTracePath.empty())
+			FrameProfiler::ExportChromeTrace(mProperties.mTracePath);
+
+		// A half built scene holds physics bodies and scripts
+		SceneLoader::Free();
+		RenderThread::Free();
 		Renderer::Free();
 		AudioEngine::Shutdown();
 		mLayerSystem.Clear();
 		ScriptingSystem::Free();
 
 		PhysicsSystem::Free();
-		delete mWindowManager;
-		glfwTerminate(); // Terminate after system shuts down
+		JobSystem::Free();
+		if (mWindowManager)
+		{
+			delete mWindowManager;
+			glfwTerminate(); // Terminate after system shuts down
+		}
+		FrameAllocator::Free();
+		FrameProfiler::Free();
 
 	}
 
@@ -80,41 +134,110 @@ namespace Borealis
 	*************************************************************************/
 	void ApplicationManager::Run()
 	{
-		ULONGLONG prevTickCount = GetTickCount64(); // Get initial tick count
+		using Clock = std::chrono::steady_clock;
+		Clock::time_point startTime = Clock::now();
+		Clock::time_point prevTime = startTime;
+		Clock::time_point nextTick = startTime;
 		PROFILE_FUNCTION();
 		while (mIsRunning)
 		{
+			FrameProfiler::NewFrame();
+			MemoryTracker::NewFrame();
+			FrameAllocator::NewFrame();
 			PROFILE_SCOPE("ApplicationManager Run Loop");
 
-			ULONGLONG currentTickCount = GetTickCount64();
-			ULONGLONG deltaTime = currentTickCount - prevTickCount;
-			prevTickCount = currentTickCount;
+			Clock::time_point currentTime = Clock::now();
+			float g_dt = std::chrono::duration<float>(currentTime - prevTime).count();
+			prevTime = currentTime;
 
-			float g_dt = static_cast<float>(deltaTime) / 1000.0f;
+			if (mProperties.mFixedTimestep > 0.f)
+			{
+				g_dt = mProperties.mFixedTimestep;
+			}
 
 			if (!mIsMinimized)
 			{
-				InputSystem::PollInput();
+				// A replayed session drives both the input and the dt, so every update matches the recording
+				if (InputRecorder::IsReplaying())
+				{
+					if (!InputRecorder::ReplayFrame(g_dt))
+					{
+						mIsRunning = false;
+						break;
+					}
+
+					// Dispatched where the live events of the previous frame's poll were, before any layer updates
+					for (const InputEvent& event : InputRecorder::GetReplayedEvents())
+					{
+						if (mImGuiLayer)
+							mImGuiLayer->ReplayInput(event);
+						WindowManager::DispatchInput(event, BIND_EVENT(ApplicationManager::EventFn));
+					}
+				}
+				else if (mWindowManager)
+				{
+					InputSystem::PollInput();
+				}
+				InputRecorder::RecordFrame(g_dt);
+
+				// Scenes finished loading are swapped in before any layer sees the frame
+				SceneLoader::Update();
 				{
 					PROFILE_SCOPE("LayerStack Updates");
 					for (Layer* layer : mLayerSystem)
 						layer->UpdateFn(g_dt);
 				}
 
-
-				mImGuiLayer->BeginFrame();
+				if (mImGuiLayer)
 				{
-					PROFILE_SCOPE("LayerStack ImGuiRender");
-					for (Layer* layer : mLayerSystem)
-						layer->ImGuiRender(g_dt);
+					mImGuiLayer->BeginFrame();
+					{
+						PROFILE_SCOPE("LayerStack ImGuiRender");
+						for (Layer* layer : mLayerSystem)
+							layer->ImGuiRender(g_dt);
+					}
+					mImGuiLayer->EndFrame();
 				}
-				mImGuiLayer->EndFrame();
 			}
 
+			// Keeps running while minimised so sounds finish and FMOD keeps mixing
+			AudioEngine::Update(g_dt);
 			InputSystem::ResetScroll();
-			mWindowManager->OnUpdate();
+			if (mWindowManager)
+				mWindowManager->OnUpdate();
+			Renderer::EndFrame();
+			RenderThread::EndFrame();
+			PROFILE_COUNTER("Render Commands", RenderThread::GetLastFrameCommandCount());
+
+			RenderStatistics renderStats = RendererAPI::GetLastFrameStatistics();
+			PROFILE_COUNTER("Draw Calls", renderStats.DrawCalls);
+			PROFILE_COUNTER("Triangles", renderStats.Triangles);
+			PROFILE_COUNTER("State Changes", renderStats.StateChanges);
+			PROFILE_COUNTER("Texture Binds", renderStats.TextureBinds);
+			PROFILE_COUNTER("State Calls Issued", renderStats.StateCallsIssued);
+			PROFILE_COUNTER("State Calls Skipped", renderStats.StateCallsSkipped);
+			PROFILE_COUNTER("Upload Bytes", renderStats.UploadBytes);
+
+			++mFrameCount;
+			if (mProperties.mMaxFrames > 0 && mFrameCount >= mProperties.mMaxFrames)
+				mIsRunning = false;
+
+			// Without vsync to pace a headless run, sleep until the next fixed tick is due
+			if (mProperties.mFixedTimestep > 0.f && !mProperties.mIsUnlocked && mProperties.mIsHeadless)
+			{
+				nextTick += std::chrono::duration_cast<Clock::duration>(std::chrono::duration<float>(mProperties.mFixedTimestep));
+				std::this_thread::sleep_until(nextTick);
+			}
+		}
+
+		if (mProperties.mIsHeadless)
+		{
+			RenderThread::WaitForRenderThread();
+			float elapsed = std::chrono::duration<float>(Clock::now() - startTime).count();
+			NullRendererAPI::Statistics stats = NullRendererAPI::GetStatistics();
+			BOREALIS_CORE_INFO("Headless run: {} frames in {:.3f}s ({:.1f} fps)", mFrameCount, elapsed, elapsed > 0.f ? mFrameCount / elapsed : 0.f);
+			BOREALIS_CORE_INFO("Headless draws: {} draw calls, {} indices, {} vertices, {} instances", stats.DrawCalls, stats.Indices, stats.Vertices, stats.Instances);
 		}
-		
 	}
 	void ApplicationManager::Close()
 	{
@@ -194,7 +317,8 @@ namespace Borealis
 
 		mIsMinimized = false;
 		Renderer::OnWindowResize(e.GetWidth(), e.GetHeight());
-		mImGuiLayer->OnWindowResize(static_cast<float>(e.GetWidth()), static_cast<float>(e.GetHeight()));
+		if (mImGuiLayer)
+			mImGuiLayer->OnWindowResize(static_cast<float>(e.GetWidth()), static_cast<float>(e.GetHeight()));
 		return false;
 	}
 }
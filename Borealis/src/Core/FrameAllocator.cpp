@@ -0,0 +1,167 @@
+/******************************************************************************/
+/*!
+\file		FrameAllocator.cpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Defines the linear, frame and scratch allocators
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#include <BorealisPCH.hpp>
+#include <cstring>
+#include <Core/Core.hpp>
+#include <Core/LoggerSystem.hpp>
+#include <Core/FrameAllocator.hpp>
+#include <Core/MemoryTracker.hpp>
+
+namespace Borealis
+{
+	namespace
+	{
+		constexpr size_t sBlockAlignment = 64;
+		constexpr size_t sScratchCapacity = 256 * 1024;
+
+		uintptr_t AlignUp(uintptr_t value, size_t alignment)
+		{
+			return (value + alignment - 1) & ~static_cast<uintptr_t>(alignment - 1);
+		}
+
+		struct FrameAllocatorData
+		{
+			FrameAllocatorData(size_t capacity) : mBuffers{ LinearAllocator(capacity), LinearAllocator(capacity) } {}
+
+			LinearAllocator mBuffers[2];
+			std::atomic<uint32_t> mIndex = 0;
+		};
+
+		FrameAllocatorData* sData = nullptr;
+	}
+
+	LinearAllocator::LinearAllocator(size_t capacity) : mCapacity(capacity)
+	{
+		if (mCapacity > 0)
+			mBuffer = static_cast<uint8_t*>(MemoryTracker::Allocate(mCapacity, sBlockAlignment, MemoryTag::Arenas));
+	}
+
+	LinearAllocator::~LinearAllocator()
+	{
+		Reset();
+		MemoryTracker::Free(mBuffer);
+	}
+
+	void* LinearAllocator::Allocate(size_t size, size_t alignment)
+	{
+		BOREALIS_CORE_ASSERT((alignment & (alignment - 1)) == 0, "Alignment must be a power of two");
+
+		uintptr_t base = reinterpret_cast<uintptr_t>(mBuffer);
+		size_t offset = mOffset.load(std::memory_order_relaxed);
+		size_t begin, end;
+		do
+		{
+			begin = static_cast<size_t>(AlignUp(base + offset, alignment) - base);
+			end = begin + size;
+			if (end > mCapacity)
+				return AllocateOverflow(size, alignment);
+		} while (!mOffset.compare_exchange_weak(offset, end, std::memory_order_relaxed));
+
+		return mBuffer + begin;
+	}
+
+	void* LinearAllocator::AllocateOverflow(size_t size, size_t alignment)
+	{
+		void* block = MemoryTracker::Allocate(size, alignment, MemoryTag::Arenas);
+
+		std::lock_guard<std::mutex> lock(mOverflowMutex);
+		MemoryTagScope memoryTag(MemoryTag::Arenas);
+		mOverflow.push_back(block);
+		mOverflowBytes.fetch_add(size, std::memory_order_relaxed);
+		return block;
+	}
+
+	LinearAllocator::Marker LinearAllocator::GetMarker() const
+	{
+		return { mOffset.load(std::memory_order_relaxed), mOverflow.size() };
+	}
+
+	void LinearAllocator::Rewind(Marker marker)
+	{
+		mPeak = std::max(mPeak, GetUsedBytes());
+
+		for (size_t i = marker.mOverflowCount; i < mOverflow.size(); ++i)
+			MemoryTracker::Free(mOverflow[i]);
+		mOverflow.resize(std::min(marker.mOverflowCount, mOverflow.size()));
+		mOffset.store(marker.mOffset, std::memory_order_relaxed);
+
+		if (marker.mOffset != 0 || marker.mOverflowCount != 0)
+			return;
+		mOverflowBytes.store(0, std::memory_order_relaxed);
+
+		// Everything is free, grow so the same workload fits in the block next time
+		if (mPeak > mCapacity)
+		{
+			MemoryTracker::Free(mBuffer);
+			mCapacity = static_cast<size_t>(AlignUp(std::max(mPeak + mPeak / 4, mCapacity * 2), sBlockAlignment));
+			mBuffer = static_cast<uint8_t*>(MemoryTracker::Allocate(mCapacity, sBlockAlignment, MemoryTag::Arenas));
+		}
+		mPeak = 0;
+	}
+
+	size_t LinearAllocator::GetUsedBytes() const
+	{
+		return mOffset.load(std::memory_order_relaxed) + mOverflowBytes.load(std::memory_order_relaxed);
+	}
+
+	void FrameAllocator::Init(size_t capacity)
+	{
+		sData = new FrameAllocatorData(capacity);
+	}
+
+	void FrameAllocator::Free()
+	{
+		delete sData;
+		sData = nullptr;
+	}
+
+	void FrameAllocator::NewFrame()
+	{
+		if (!sData)
+			return;
+
+		// Rewind before publishing, the render thread may still be allocating from the current buffer
+		uint32_t next = sData->mIndex.load(std::memory_order_relaxed) ^ 1;
+		sData->mBuffers[next].Reset();
+		sData->mIndex.store(next, std::memory_order_release);
+
+		PROFILE_COUNTER("Frame Allocator Bytes", static_cast<double>(sData->mBuffers[next ^ 1].GetUsedBytes()));
+	}
+
+	void* FrameAllocator::Allocate(size_t size, size_t alignment)
+	{
+		BOREALIS_CORE_ASSERT(sData, "Frame allocator used before Init");
+		return sData->mBuffers[sData->mIndex.load(std::memory_order_acquire)].Allocate(size, alignment);
+	}
+
+	std::string_view FrameAllocator::CopyString(std::string_view string)
+	{
+		char* copy = static_cast<char*>(Allocate(string.size() + 1, alignof(char)));
+		std::memcpy(copy, string.data(), string.size());
+		copy[string.size()] = '\0';
+		return { copy, string.size() };
+	}
+
+	size_t FrameAllocator::GetUsedBytes()
+	{
+		return sData ? sData->mBuffers[sData->mIndex.load(std::memory_order_acquire)].GetUsedBytes() : 0;
+	}
+
+	LinearAllocator& ScratchAllocator::Get()
+	{
+		thread_local LinearAllocator tArena(sScratchCapacity);
+		return tArena;
+	}
+}
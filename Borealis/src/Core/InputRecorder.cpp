@@ -0,0 +1,253 @@
+/******************************************************************************/
+/*!
+\file		InputRecorder.cpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Defines the input recorder
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#include <BorealisPCH.hpp>
+#include <Core/FrameAllocator.hpp>
+#include <Core/InputRecorder.hpp>
+#include <Core/LoggerSystem.hpp>
+#include <Core/UUID.hpp>
+
+namespace Borealis
+{
+	namespace
+	{
+		constexpr char sMagic[4] = { 'B', 'R', 'I', 'R' };
+		constexpr uint32_t sVersion = 2;
+		constexpr std::streamoff sFrameCountOffset = sizeof(sMagic) + sizeof(uint32_t) + sizeof(uint64_t);
+
+		constexpr uint8_t sFlagDt = 1 << 0;		//!< Frame dt differs from the previous frame
+		constexpr uint8_t sFlagMouse = 1 << 1;		//!< Cursor moved
+		constexpr uint8_t sFlagScroll = 1 << 2;	//!< Scroll wheel moved
+		constexpr uint16_t sPressedBit = 1 << 15;	//!< Set on a key change if the key went down
+
+		template <typename T>
+		void Write(std::fstream& file, const T& value)
+		{
+			file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+		}
+
+		template <typename T>
+		bool Read(std::fstream& file, T& value)
+		{
+			return static_cast<bool>(file.read(reinterpret_cast<char*>(&value), sizeof(T)));
+		}
+	}
+
+	InputRecorder::Mode InputRecorder::sMode = InputRecorder::Mode::None;
+	std::fstream InputRecorder::sFile;
+	uint32_t InputRecorder::sFrameCount = 0;
+	float InputRecorder::sPrevDt = 0.f;
+	float InputRecorder::sPrevMouseX = 0.f;
+	float InputRecorder::sPrevMouseY = 0.f;
+	uint16_t InputRecorder::sPrevKeys[InputSystem::KeyStateCount];
+	std::vector<InputEvent> InputRecorder::sEvents;
+
+	bool InputRecorder::StartRecording(const std::string& path, uint64_t seed)
+	{
+		Stop();
+		sFile.open(path, std::ios::out | std::ios::binary | std::ios::trunc);
+		if (!sFile)
+		{
+			BOREALIS_CORE_ERROR("Failed to open input recording {}", path);
+			return false;
+		}
+
+		Write(sFile, sMagic);
+		Write(sFile, sVersion);
+		Write(sFile, seed);
+		Write(sFile, uint32_t(0)); // Frame count, written on Stop
+
+		UUID::SetSeed(seed);
+		sMode = Mode::Recording;
+		sFrameCount = 0;
+		sPrevDt = 0.f;
+		sPrevMouseX = sPrevMouseY = 0.f;
+		std::memset(sPrevKeys, 0, sizeof(sPrevKeys));
+		sEvents.clear();
+
+		BOREALIS_CORE_INFO("Recording input to {} with seed {}", path, seed);
+		return true;
+	}
+
+	bool InputRecorder::StartReplay(const std::string& path)
+	{
+		Stop();
+		sFile.open(path, std::ios::in | std::ios::binary);
+		if (!sFile)
+		{
+			BOREALIS_CORE_ERROR("Failed to open input recording {}", path);
+			return false;
+		}
+
+		char magic[4];
+		uint32_t version = 0;
+		uint64_t seed = 0;
+		uint32_t frameCount = 0;
+		if (!Read(sFile, magic) || std::memcmp(magic, sMagic, sizeof(sMagic)) != 0 || !Read(sFile, version) || version != sVersion
+			|| !Read(sFile, seed) || !Read(sFile, frameCount))
+		{
+			BOREALIS_CORE_ERROR("{} is not a valid input recording", path);
+			sFile.close();
+			return false;
+		}
+
+		UUID::SetSeed(seed);
+		sMode = Mode::Replaying;
+		sFrameCount = 0;
+		sPrevDt = 0.f;
+		sEvents.clear();
+		InputSystem::Init();
+		InputSystem::MouseX = InputSystem::MouseY = 0.f;
+
+		// A recording cut short by a crash has no frame count, it is replayed until the end of the file
+		BOREALIS_CORE_INFO("Replaying input from {} with seed {} ({} frames)", path, seed, frameCount);
+		return true;
+	}
+
+	void InputRecorder::Stop()
+	{
+		if (sMode == Mode::Recording)
+		{
+			sFile.seekp(sFrameCountOffset);
+			Write(sFile, sFrameCount);
+			BOREALIS_CORE_INFO("Recorded {} frames of input", sFrameCount);
+		}
+		else if (sMode == Mode::Replaying)
+		{
+			BOREALIS_CORE_INFO("Replayed {} frames of input", sFrameCount);
+		}
+
+		if (sFile.is_open())
+			sFile.close();
+		sMode = Mode::None;
+		sEvents.clear();
+	}
+
+	void InputRecorder::RecordFrame(float dt)
+	{
+		if (sMode != Mode::Recording)
+			return;
+
+		float scroll = InputSystem::GetScroll();
+		uint8_t flags = 0;
+		if (dt != sPrevDt)
+			flags |= sFlagDt;
+		if (InputSystem::MouseX != sPrevMouseX || InputSystem::MouseY != sPrevMouseY)
+			flags |= sFlagMouse;
+		if (scroll != 0.f)
+			flags |= sFlagScroll;
+
+		ScratchScope scratch;
+		ScratchVector<uint16_t> changes;
+		for (uint16_t key = 0; key < InputSystem::KeyStateCount; ++key)
+		{
+			if (InputSystem::KeyCurrentState[key] != sPrevKeys[key])
+			{
+				changes.push_back(key | (InputSystem::KeyCurrentState[key] ? sPressedBit : 0));
+				sPrevKeys[key] = InputSystem::KeyCurrentState[key];
+			}
+		}
+
+		Write(sFile, flags);
+		if (flags & sFlagDt)
+			Write(sFile, dt);
+		if (flags & sFlagMouse)
+		{
+			Write(sFile, InputSystem::MouseX);
+			Write(sFile, InputSystem::MouseY);
+		}
+		if (flags & sFlagScroll)
+			Write(sFile, scroll);
+		Write(sFile, static_cast<uint16_t>(changes.size()));
+		if (!changes.empty())
+			sFile.write(reinterpret_cast<const char*>(changes.data()), changes.size() * sizeof(uint16_t));
+
+		// Field by field, so the log does not depend on the padding of InputEvent
+		Write(sFile, static_cast<uint16_t>(sEvents.size()));
+		for (const InputEvent& event : sEvents)
+		{
+			Write(sFile, event.mType);
+			Write(sFile, event.mCode);
+			Write(sFile, event.mScancode);
+			Write(sFile, event.mAction);
+			Write(sFile, event.mMods);
+			Write(sFile, event.mX);
+			Write(sFile, event.mY);
+		}
+		sEvents.clear();
+
+		sPrevDt = dt;
+		sPrevMouseX = InputSystem::MouseX;
+		sPrevMouseY = InputSystem::MouseY;
+		++sFrameCount;
+	}
+
+	bool InputRecorder::ReplayFrame(float& dt)
+	{
+		if (sMode != Mode::Replaying)
+			return false;
+
+		uint8_t flags = 0;
+		if (!Read(sFile, flags))
+			return false;
+
+		float scroll = 0.f;
+		uint16_t changeCount = 0;
+		bool valid = true;
+		if (flags & sFlagDt)
+			valid &= Read(sFile, sPrevDt);
+		if (flags & sFlagMouse)
+			valid &= Read(sFile, InputSystem::MouseX) && Read(sFile, InputSystem::MouseY);
+		if (flags & sFlagScroll)
+			valid &= Read(sFile, scroll);
+		valid &= Read(sFile, changeCount);
+
+		std::memcpy(InputSystem::KeyPrevState, InputSystem::KeyCurrentState, sizeof(InputSystem::KeyCurrentState));
+		for (uint16_t i = 0; valid && i < changeCount; ++i)
+		{
+			uint16_t change = 0;
+			valid = Read(sFile, change);
+			uint16_t key = change & ~sPressedBit;
+			if (valid && key < InputSystem::KeyStateCount)
+				InputSystem::KeyCurrentState[key] = (change & sPressedBit) ? 1 : 0;
+		}
+
+		uint16_t eventCount = 0;
+		valid = valid && Read(sFile, eventCount);
+		sEvents.resize(valid ? eventCount : 0);
+		for (InputEvent& event : sEvents)
+		{
+			valid = valid && Read(sFile, event.mType) && Read(sFile, event.mCode) && Read(sFile, event.mScancode) && Read(sFile, event.mAction)
+				&& Read(sFile, event.mMods) && Read(sFile, event.mX) && Read(sFile, event.mY);
+		}
+
+		if (!valid)
+		{
+			sEvents.clear();
+			BOREALIS_CORE_WARN("Input recording is truncated after {} frames", sFrameCount);
+			return false;
+		}
+
+		InputSystem::ScrollY = scroll;
+		dt = sPrevDt;
+		++sFrameCount;
+		return true;
+	}
+
+	void InputRecorder::RecordEvent(const InputEvent& event)
+	{
+		if (sMode == Mode::Recording)
+			sEvents.push_back(event);
+	}
+}
@@ -13,6 +13,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
  /******************************************************************************/
 
 #include <BorealisPCH.hpp>
+#include <cstring>
 #include <GLFW/glfw3.h>
 #include <Core/InputSystem.hpp>
 #include <Core/ApplicationManager.hpp>
@@ -21,9 +22,11 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <Events/EventInput.hpp>
 namespace Borealis
 {
-	uint16_t InputSystem::KeyCurrentState[349];
-	uint16_t InputSystem::KeyPrevState[349];
+	uint16_t InputSystem::KeyCurrentState[KeyStateCount];
+	uint16_t InputSystem::KeyPrevState[KeyStateCount];
 	double InputSystem::ScrollY = 0;
+	float InputSystem::MouseX = 0;
+	float InputSystem::MouseY = 0;
 
 	static std::vector<uint16_t> KeysToPoll
 	{
@@ -207,9 +210,8 @@ namespace Borealis
 
 	std::pair<float, float> InputSystem::GetMousePos()
 	{
-		double x, y;
-		glfwGetCursorPos(static_cast<GLFWwindow*>(ApplicationManager::Get().GetWindow()->GetNativeWindow()), &x, &y);
-		return { static_cast<float>(x), static_cast<float>(y) };
+		// Cached by PollInput, or set by the input recorder when replaying. Headless applications have no cursor
+		return { MouseX, MouseY };
 	}
 
 	float InputSystem::GetMouseX()
@@ -224,10 +226,12 @@ namespace Borealis
 	}
 	void InputSystem::PollInput()
 	{
+		GLFWwindow* window = static_cast<GLFWwindow*>(ApplicationManager::Get().GetWindow()->GetNativeWindow());
+
 		std::memcpy(KeyPrevState, KeyCurrentState, sizeof(KeyCurrentState));
 		for (auto key : KeysToPoll)
 		{
-			auto state = glfwGetKey(static_cast<GLFWwindow*>(ApplicationManager::Get().GetWindow()->GetNativeWindow()), key);
+			auto state = glfwGetKey(window, key);
 			if (state == GLFW_PRESS || state == GLFW_REPEAT)
 			{
 				KeyCurrentState[key] = true;
@@ -240,7 +244,7 @@ namespace Borealis
 
 		for (auto mouse : MouseToPoll)
 		{
-			auto state = glfwGetMouseButton(static_cast<GLFWwindow*>(ApplicationManager::Get().GetWindow()->GetNativeWindow()), mouse);
+			auto state = glfwGetMouseButton(window, mouse);
 			if (state == GLFW_PRESS)
 			{
 				KeyCurrentState[mouse] = true;
@@ -250,5 +254,10 @@ namespace Borealis
 				KeyCurrentState[mouse] = false;
 			}
 		}
+
+		double x, y;
+		glfwGetCursorPos(window, &x, &y);
+		MouseX = static_cast<float>(x);
+		MouseY = static_cast<float>(y);
 	}
 } // End of namespace Borealis
@@ -0,0 +1,269 @@
+/******************************************************************************/
+/*!
+\file		JobSystem.cpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Defines the engine wide work stealing job system
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#include <BorealisPCH.hpp>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <Core/JobSystem.hpp>
+#include <Core/LoggerSystem.hpp>
+
+namespace Borealis
+{
+	namespace
+	{
+		struct Job
+		{
+			JobSystem::JobFn mFn;
+			JobCounter* mCounter = nullptr;
+		};
+
+		/*
+			Per thread deque. The owning thread pushes and pops at the back
+			(LIFO, cache friendly), other threads steal from the front. Jobs
+			sit in a ring buffer that only grows, so pushes stop allocating
+			once it is large enough.
+		*/
+		class WorkQueue
+		{
+		public:
+			void Push(Job&& job)
+			{
+				std::lock_guard<std::mutex> lock(mMutex);
+				if (mCount == mJobs.size())
+					Grow();
+				mJobs[(mHead + mCount) & (mJobs.size() - 1)] = std::move(job);
+				++mCount;
+			}
+
+			bool Pop(Job& out)
+			{
+				std::lock_guard<std::mutex> lock(mMutex);
+				if (mCount == 0)
+					return false;
+				--mCount;
+				out = std::move(mJobs[(mHead + mCount) & (mJobs.size() - 1)]);
+				return true;
+			}
+
+			bool Steal(Job& out)
+			{
+				std::unique_lock<std::mutex> lock(mMutex, std::try_to_lock);
+				if (!lock.owns_lock() || mCount == 0)
+					return false;
+				out = std::move(mJobs[mHead]);
+				mHead = (mHead + 1) & (mJobs.size() - 1);
+				--mCount;
+				return true;
+			}
+
+		private:
+			void Grow()
+			{
+				// Capacity stays a power of two so indices wrap with a mask
+				std::vector<Job> jobs(std::max<size_t>(mJobs.size() * 2, 64));
+				for (size_t i = 0; i < mCount; ++i)
+					jobs[i] = std::move(mJobs[(mHead + i) & (mJobs.size() - 1)]);
+				mJobs.swap(jobs);
+				mHead = 0;
+			}
+
+			std::mutex mMutex;
+			std::vector<Job> mJobs;
+			size_t mHead = 0;
+			size_t mCount = 0;
+		};
+
+		struct JobSystemData
+		{
+			std::vector<std::thread> mWorkers;
+			std::unique_ptr<WorkQueue[]> mQueues; // Index 0 is the main thread
+			uint32_t mQueueCount = 0;
+
+			std::atomic<uint32_t> mQueuedJobs = 0;
+			std::atomic<bool> mRunning = false;
+			std::mutex mSleepMutex;
+			std::condition_variable mWake;
+		};
+
+		JobSystemData* sData = nullptr;
+		thread_local uint32_t tThreadIndex = 0;
+
+		void Execute(Job& job)
+		{
+			job.mFn();
+			if (job.mCounter)
+				job.mCounter->mPending.fetch_sub(1, std::memory_order_acq_rel);
+		}
+
+		bool TryGetJob(uint32_t index, Job& out)
+		{
+			if (sData->mQueues[index].Pop(out))
+				return true;
+
+			for (uint32_t i = 1; i < sData->mQueueCount; ++i)
+			{
+				uint32_t victim = (index + i) % sData->mQueueCount;
+				if (sData->mQueues[victim].Steal(out))
+					return true;
+			}
+			return false;
+		}
+
+		void WorkerLoop(uint32_t index)
+		{
+			tThreadIndex = index;
+			while (sData->mRunning.load(std::memory_order_acquire))
+			{
+				if (JobSystem::RunPendingJob())
+					continue;
+
+				std::unique_lock<std::mutex> lock(sData->mSleepMutex);
+				sData->mWake.wait(lock, []
+					{
+						return sData->mQueuedJobs.load(std::memory_order_acquire) > 0 || !sData->mRunning.load(std::memory_order_acquire);
+					});
+			}
+		}
+	}
+
+	void JobSystem::Init(uint32_t workerCount)
+	{
+		PROFILE_FUNCTION();
+
+		if (workerCount == 0)
+		{
+			uint32_t hardware = std::thread::hardware_concurrency();
+			workerCount = hardware > 1 ? hardware - 1 : 0;
+		}
+
+		sData = new JobSystemData();
+		sData->mQueueCount = workerCount + 1;
+		sData->mQueues = std::make_unique<WorkQueue[]>(sData->mQueueCount);
+		sData->mRunning = true;
+		tThreadIndex = 0;
+
+		sData->mWorkers.reserve(workerCount);
+		for (uint32_t i = 1; i <= workerCount; ++i)
+		{
+			sData->mWorkers.emplace_back(WorkerLoop, i);
+		}
+
+		BOREALIS_CORE_INFO("Job system started with {} worker threads", workerCount);
+	}
+
+	void JobSystem::Free()
+	{
+		if (!sData)
+			return;
+
+		while (RunPendingJob());
+
+		{
+			std::lock_guard<std::mutex> lock(sData->mSleepMutex);
+			sData->mRunning = false;
+		}
+		sData->mWake.notify_all();
+
+		for (auto& worker : sData->mWorkers)
+			worker.join();
+
+		delete sData;
+		sData = nullptr;
+	}
+
+	void JobSystem::Submit(JobFn job, JobCounter* counter)
+	{
+		if (counter)
+			counter->mPending.fetch_add(1, std::memory_order_relaxed);
+
+		// Without workers (or before Init) the job runs inline
+		if (!sData || sData->mQueueCount == 1)
+		{
+			Job inlineJob{ std::move(job), counter };
+			Execute(inlineJob);
+			return;
+		}
+
+		// Threads that are not owned by the job system share the main thread's queue
+		sData->mQueues[tThreadIndex].Push({ std::move(job), counter });
+		sData->mQueuedJobs.fetch_add(1, std::memory_order_release);
+
+		{
+			std::lock_guard<std::mutex> lock(sData->mSleepMutex);
+		}
+		sData->mWake.notify_one();
+	}
+
+	void JobSystem::Wait(JobCounter& counter)
+	{
+		while (!counter.IsDone())
+		{
+			if (!RunPendingJob())
+				std::this_thread::yield();
+		}
+	}
+
+	void JobSystem::ParallelFor(uint32_t count, uint32_t grainSize, const RangeFn& fn)
+	{
+		if (count == 0)
+			return;
+
+		grainSize = std::max(grainSize, 1u);
+		if (!sData || sData->mQueueCount == 1 || count <= grainSize)
+		{
+			fn(0, count);
+			return;
+		}
+
+		JobCounter counter;
+		for (uint32_t begin = grainSize; begin < count; begin += grainSize)
+		{
+			uint32_t end = std::min(begin + grainSize, count);
+			Submit([&fn, begin, end]() { fn(begin, end); }, &counter);
+		}
+
+		fn(0, grainSize);
+		Wait(counter);
+	}
+
+	bool JobSystem::RunPendingJob()
+	{
+		if (!sData)
+			return false;
+
+		Job job;
+		if (!TryGetJob(tThreadIndex, job))
+			return false;
+
+		sData->mQueuedJobs.fetch_sub(1, std::memory_order_acq_rel);
+		Execute(job);
+		return true;
+	}
+
+	uint32_t JobSystem::GetWorkerCount()
+	{
+		return sData ? sData->mQueueCount - 1 : 0;
+	}
+
+	uint32_t JobSystem::GetThreadIndex()
+	{
+		return tThreadIndex;
+	}
+
+	bool JobSystem::IsRunning()
+	{
+		return sData && sData->mRunning.load(std::memory_order_acquire);
+	}
+}
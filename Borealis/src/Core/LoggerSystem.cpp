@@ -13,7 +13,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
  /******************************************************************************/
 
 #include <BorealisPCH.hpp>
-#include <spdlog\sinks\stdout_color_sinks.h>
+#include <spdlog/sinks/stdout_color_sinks.h>
 #include <Core/LoggerSystem.hpp>
 
 namespace Borealis 
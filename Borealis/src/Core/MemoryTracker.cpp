@@ -0,0 +1,399 @@
+/******************************************************************************/
+/*!
+\file		MemoryTracker.cpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Defines the memory tracker and replaces the global operator new
+			and delete, so every C++ allocation of the process is counted
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#include <BorealisPCH.hpp>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <Core/LoggerSystem.hpp>
+#include <Core/MemoryTracker.hpp>
+
+namespace Borealis
+{
+	namespace
+	{
+		/*!***********************************************************************
+			\brief
+				Stored in front of every tracked block so a free knows the size
+				and tag without a lookup
+		*************************************************************************/
+		struct BlockHeader
+		{
+			uint64_t mSize;
+			uint32_t mMagic;	//!< Cleared on free, so debug builds catch blocks freed twice
+			uint16_t mOffset;	//!< Bytes from the start of the raw block to the user block
+			uint8_t mTag;
+			uint8_t mAligned;	//!< Raw block came from the aligned allocator
+		};
+		static_assert(sizeof(BlockHeader) == 16, "Block header must keep 16 byte alignment");
+
+		constexpr uint32_t sMagic = 0xB0EA11CE;
+		constexpr size_t sDefaultAlignment = 16;
+		constexpr size_t sTagCount = static_cast<size_t>(MemoryTag::Count);
+
+		struct TagCounters
+		{
+			std::atomic<uint64_t> mLive = 0;
+			std::atomic<uint64_t> mPeak = 0;
+			std::atomic<uint64_t> mAllocations = 0;
+			std::atomic<uint64_t> mBytes = 0;
+			std::atomic<uint64_t> mBudget = 0;
+		};
+
+		// Only touched by NewFrame and the readers on the main thread
+		struct FrameCounters
+		{
+			uint64_t mAllocations = 0;		//!< Total at the start of the frame
+			uint64_t mBytes = 0;
+			uint64_t mFrameAllocations = 0;	//!< Made during the last frame
+			uint64_t mFrameBytes = 0;
+			bool mOverBudget = false;
+		};
+
+		TagCounters sCounters[sTagCount];
+		FrameCounters sFrames[sTagCount];
+		thread_local MemoryTag tTag = MemoryTag::General;
+
+		const char* const sTagNames[sTagCount] =
+		{
+			"General", "ECS", "Physics", "Scripting", "Audio", "Meshes", "Textures", "Arenas", "GPUBuffers", "GPUTextures"
+		};
+
+		void CountAllocation(MemoryTag tag, uint64_t bytes)
+		{
+			TagCounters& counters = sCounters[static_cast<size_t>(tag)];
+			counters.mAllocations.fetch_add(1, std::memory_order_relaxed);
+			counters.mBytes.fetch_add(bytes, std::memory_order_relaxed);
+
+			uint64_t live = counters.mLive.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+			uint64_t peak = counters.mPeak.load(std::memory_order_relaxed);
+			while (live > peak && !counters.mPeak.compare_exchange_weak(peak, live, std::memory_order_relaxed));
+		}
+
+		void CountFree(MemoryTag tag, uint64_t bytes)
+		{
+			sCounters[static_cast<size_t>(tag)].mLive.fetch_sub(bytes, std::memory_order_relaxed);
+		}
+
+		BlockHeader* GetHeader(void* ptr)
+		{
+			return reinterpret_cast<BlockHeader*>(static_cast<unsigned char*>(ptr) - sizeof(BlockHeader));
+		}
+
+		void* AlignedMalloc(size_t size, size_t alignment)
+		{
+#ifdef _MSC_VER
+			return _aligned_malloc(size, alignment);
+#else
+			return std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+#endif
+		}
+
+		void AlignedFree(void* ptr)
+		{
+#ifdef _MSC_VER
+			_aligned_free(ptr);
+#else
+			std::free(ptr);
+#endif
+		}
+	}
+
+	void* MemoryTracker::Allocate(size_t size, size_t alignment, MemoryTag tag)
+	{
+		// The header sits right in front of the user block, so aligned blocks reserve a whole alignment for it
+		bool aligned = alignment > sDefaultAlignment;
+		size_t offset = aligned ? alignment : sDefaultAlignment;
+
+		void* raw = aligned ? AlignedMalloc(size + offset, alignment) : std::malloc(size + offset);
+		if (!raw)
+			return nullptr;
+
+		void* ptr = static_cast<unsigned char*>(raw) + offset;
+		BlockHeader* header = GetHeader(ptr);
+		header->mSize = size;
+		header->mOffset = static_cast<uint16_t>(offset);
+		header->mMagic = sMagic;
+		header->mTag = static_cast<uint8_t>(tag);
+		header->mAligned = aligned;
+
+		CountAllocation(tag, size);
+		return ptr;
+	}
+
+	void* MemoryTracker::Reallocate(void* ptr, size_t size, MemoryTag tag)
+	{
+		if (!ptr)
+			return Allocate(size, sDefaultAlignment, tag);
+
+		BlockHeader* header = GetHeader(ptr);
+		BOREALIS_CORE_ASSERT(header->mMagic == sMagic, "Reallocating a block the memory tracker did not allocate");
+
+		if (!header->mAligned)
+		{
+			BlockHeader previous = *header;
+			void* raw = std::realloc(static_cast<unsigned char*>(ptr) - previous.mOffset, size + previous.mOffset);
+			if (!raw)
+				return nullptr;
+
+			ptr = static_cast<unsigned char*>(raw) + previous.mOffset;
+			GetHeader(ptr)->mSize = size;
+
+			MemoryTag blockTag = static_cast<MemoryTag>(previous.mTag);
+			CountFree(blockTag, previous.mSize);
+			CountAllocation(blockTag, size);
+			return ptr;
+		}
+
+		void* resized = Allocate(size, header->mOffset, static_cast<MemoryTag>(header->mTag));
+		if (!resized)
+			return nullptr;
+		std::memcpy(resized, ptr, std::min<size_t>(size, header->mSize));
+		Free(ptr);
+		return resized;
+	}
+
+	void MemoryTracker::Free(void* ptr)
+	{
+		if (!ptr)
+			return;
+
+		// Every block freed here came from Allocate: operator new is replaced at link time, and each library
+		// hook is installed before the first call into its library, so nothing is probed for a header it lacks
+		BlockHeader* header = GetHeader(ptr);
+		BOREALIS_CORE_ASSERT(header->mMagic == sMagic, "Freeing a block the memory tracker did not allocate");
+
+		CountFree(static_cast<MemoryTag>(header->mTag), header->mSize);
+		header->mMagic = 0;
+
+		void* raw = static_cast<unsigned char*>(ptr) - header->mOffset;
+		if (header->mAligned)
+			AlignedFree(raw);
+		else
+			std::free(raw);
+	}
+
+	void MemoryTracker::TrackGpuAllocation(MemoryTag tag, uint64_t bytes)
+	{
+		CountAllocation(tag, bytes);
+	}
+
+	void MemoryTracker::TrackGpuFree(MemoryTag tag, uint64_t bytes)
+	{
+		CountFree(tag, bytes);
+	}
+
+	MemoryTag MemoryTracker::GetCurrentTag()
+	{
+		return tTag;
+	}
+
+	MemoryTag MemoryTracker::SetCurrentTag(MemoryTag tag)
+	{
+		MemoryTag previous = tTag;
+		tTag = tag;
+		return previous;
+	}
+
+	void MemoryTracker::NewFrame()
+	{
+		for (size_t i = 0; i < sTagCount; ++i)
+		{
+			TagCounters& counters = sCounters[i];
+			FrameCounters& frame = sFrames[i];
+
+			uint64_t allocations = counters.mAllocations.load(std::memory_order_relaxed);
+			uint64_t bytes = counters.mBytes.load(std::memory_order_relaxed);
+			frame.mFrameAllocations = allocations - frame.mAllocations;
+			frame.mFrameBytes = bytes - frame.mBytes;
+			frame.mAllocations = allocations;
+			frame.mBytes = bytes;
+
+			// Warn once each time the budget is crossed rather than every frame
+			uint64_t budget = counters.mBudget.load(std::memory_order_relaxed);
+			uint64_t live = counters.mLive.load(std::memory_order_relaxed);
+			bool overBudget = budget && live > budget;
+			if (overBudget && !frame.mOverBudget)
+				BOREALIS_CORE_WARN("{} memory is over budget: {:.2f} MB of {:.2f} MB", sTagNames[i], live / (1024.0 * 1024.0), budget / (1024.0 * 1024.0));
+			frame.mOverBudget = overBudget;
+		}
+
+		PROFILE_COUNTER("Heap Bytes", GetHeapStats().LiveBytes);
+		PROFILE_COUNTER("GPU Bytes", GetStats(MemoryTag::GPUBuffers).LiveBytes + GetStats(MemoryTag::GPUTextures).LiveBytes);
+	}
+
+	MemoryTagStats MemoryTracker::GetStats(MemoryTag tag)
+	{
+		const TagCounters& counters = sCounters[static_cast<size_t>(tag)];
+		const FrameCounters& frame = sFrames[static_cast<size_t>(tag)];
+
+		MemoryTagStats stats;
+		stats.LiveBytes = counters.mLive.load(std::memory_order_relaxed);
+		stats.PeakBytes = counters.mPeak.load(std::memory_order_relaxed);
+		stats.TotalAllocations = counters.mAllocations.load(std::memory_order_relaxed);
+		stats.TotalBytes = counters.mBytes.load(std::memory_order_relaxed);
+		stats.FrameAllocations = frame.mFrameAllocations;
+		stats.FrameBytes = frame.mFrameBytes;
+		stats.Budget = counters.mBudget.load(std::memory_order_relaxed);
+		return stats;
+	}
+
+	MemoryTagStats MemoryTracker::GetHeapStats()
+	{
+		// The peak is the sum of each tag's peak, an upper bound on the real one
+		MemoryTagStats total;
+		for (size_t i = 0; i < sTagCount; ++i)
+		{
+			MemoryTag tag = static_cast<MemoryTag>(i);
+			if (IsGpuTag(tag))
+				continue;
+
+			MemoryTagStats stats = GetStats(tag);
+			total.LiveBytes += stats.LiveBytes;
+			total.PeakBytes += stats.PeakBytes;
+			total.TotalAllocations += stats.TotalAllocations;
+			total.TotalBytes += stats.TotalBytes;
+			total.FrameAllocations += stats.FrameAllocations;
+			total.FrameBytes += stats.FrameBytes;
+			total.Budget += stats.Budget;
+		}
+		return total;
+	}
+
+	void MemoryTracker::SetBudget(MemoryTag tag, uint64_t bytes)
+	{
+		sCounters[static_cast<size_t>(tag)].mBudget.store(bytes, std::memory_order_relaxed);
+	}
+
+	bool MemoryTracker::ParseBudget(const std::string& budget)
+	{
+		size_t separator = budget.find('=');
+		if (separator == std::string::npos)
+			return false;
+
+		std::string name = budget.substr(0, separator);
+		char* end = nullptr;
+		double megabytes = std::strtod(budget.c_str() + separator + 1, &end);
+		if (end == budget.c_str() + separator + 1 || megabytes < 0.0)
+			return false;
+
+		for (size_t i = 0; i < sTagCount; ++i)
+		{
+			if (name == sTagNames[i])
+			{
+				SetBudget(static_cast<MemoryTag>(i), static_cast<uint64_t>(megabytes * 1024.0 * 1024.0));
+				return true;
+			}
+		}
+		return false;
+	}
+
+	const char* MemoryTracker::GetTagName(MemoryTag tag)
+	{
+		return tag < MemoryTag::Count ? sTagNames[static_cast<size_t>(tag)] : "Unknown";
+	}
+}
+
+namespace
+{
+	void* TrackedNew(std::size_t size, std::size_t alignment)
+	{
+		void* ptr = Borealis::MemoryTracker::Allocate(size ? size : 1, alignment, Borealis::MemoryTracker::GetCurrentTag());
+		if (!ptr)
+			throw std::bad_alloc();
+		return ptr;
+	}
+}
+
+void* operator new(std::size_t size)
+{
+	return TrackedNew(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void* operator new[](std::size_t size)
+{
+	return TrackedNew(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+	return TrackedNew(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+	return TrackedNew(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+	return Borealis::MemoryTracker::Allocate(size ? size : 1, __STDCPP_DEFAULT_NEW_ALIGNMENT__, Borealis::MemoryTracker::GetCurrentTag());
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+	return Borealis::MemoryTracker::Allocate(size ? size : 1, __STDCPP_DEFAULT_NEW_ALIGNMENT__, Borealis::MemoryTracker::GetCurrentTag());
+}
+
+void operator delete(void* ptr) noexcept
+{
+	Borealis::MemoryTracker::Free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+	Borealis::MemoryTracker::Free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+	Borealis::MemoryTracker::Free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+	Borealis::MemoryTracker::Free(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept
+{
+	Borealis::MemoryTracker::Free(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t) noexcept
+{
+	Borealis::MemoryTracker::Free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept
+{
+	Borealis::MemoryTracker::Free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept
+{
+	Borealis::MemoryTracker::Free(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+	Borealis::MemoryTracker::Free(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+	Borealis::MemoryTracker::Free(ptr);
+}
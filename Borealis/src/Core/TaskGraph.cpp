@@ -0,0 +1,161 @@
+/******************************************************************************/
+/*!
+\file		TaskGraph.cpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Defines the per frame task graph
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#include <BorealisPCH.hpp>
+#include <thread>
+#include <Core/TaskGraph.hpp>
+#include <Core/JobSystem.hpp>
+
+namespace Borealis
+{
+	TaskGraph::TaskBuilder TaskGraph::AddTask(const char* name, TaskFn fn)
+	{
+		// Slots are reused across frames so their access vectors keep their storage
+		if (mTaskCount == mTasks.size())
+			mTasks.emplace_back();
+
+		Task& task = mTasks[mTaskCount];
+		task.mName = name;
+		task.mFn = std::move(fn);
+		task.mReads.clear();
+		task.mWrites.clear();
+		task.mMilliseconds = 0.f;
+		task.mExclusive = false;
+		task.mMainThread = false;
+		return TaskBuilder(*this, mTaskCount++);
+	}
+
+	void TaskGraph::Clear()
+	{
+		// Release the captures but keep the slots
+		for (uint32_t i = 0; i < mTaskCount; ++i)
+			mTasks[i].mFn = nullptr;
+		mTaskCount = 0;
+	}
+
+	bool TaskGraph::Conflicts(const Task& first, const Task& second)
+	{
+		if (first.mExclusive || second.mExclusive)
+			return true;
+
+		auto intersects = [](const std::vector<entt::id_type>& lhs, const std::vector<entt::id_type>& rhs)
+			{
+				for (auto id : lhs)
+					if (std::find(rhs.begin(), rhs.end(), id) != rhs.end())
+						return true;
+				return false;
+			};
+
+		return intersects(first.mWrites, second.mWrites)
+			|| intersects(first.mWrites, second.mReads)
+			|| intersects(first.mReads, second.mWrites);
+	}
+
+	void TaskGraph::Execute()
+	{
+		PROFILE_FUNCTION();
+
+		uint32_t count = mTaskCount;
+		mTimings.clear();
+		if (count == 0)
+			return;
+
+		// Order every conflicting pair by insertion order
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			mTasks[i].mSuccessors.clear();
+			mTasks[i].mDependencyCount = 0;
+		}
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			for (uint32_t j = i + 1; j < count; ++j)
+			{
+				if (Conflicts(mTasks[i], mTasks[j]))
+				{
+					mTasks[i].mSuccessors.push_back(j);
+					++mTasks[j].mDependencyCount;
+				}
+			}
+		}
+
+		if (count > mRemainingCapacity)
+		{
+			mRemaining = std::make_unique<std::atomic<uint32_t>[]>(count);
+			mRemainingCapacity = count;
+		}
+		for (uint32_t i = 0; i < count; ++i)
+			mRemaining[i].store(mTasks[i].mDependencyCount, std::memory_order_relaxed);
+
+		mCompleted.store(0, std::memory_order_relaxed);
+		mMainThreadReady.clear();
+
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			if (mTasks[i].mDependencyCount == 0)
+				Schedule(i);
+		}
+
+		// Run main thread tasks as they become ready, help the workers otherwise
+		while (mCompleted.load(std::memory_order_acquire) < count)
+		{
+			bool hasTask = false;
+			uint32_t index = 0;
+			{
+				std::lock_guard<std::mutex> lock(mMainThreadMutex);
+				if (!mMainThreadReady.empty())
+				{
+					index = mMainThreadReady.front();
+					mMainThreadReady.erase(mMainThreadReady.begin());
+					hasTask = true;
+				}
+			}
+
+			if (hasTask)
+				RunTask(index);
+			else if (!JobSystem::RunPendingJob())
+				std::this_thread::yield();
+		}
+
+		for (uint32_t i = 0; i < count; ++i)
+			mTimings.push_back({ mTasks[i].mName, mTasks[i].mMilliseconds });
+	}
+
+	void TaskGraph::Schedule(uint32_t index)
+	{
+		if (mTasks[index].mMainThread)
+		{
+			std::lock_guard<std::mutex> lock(mMainThreadMutex);
+			mMainThreadReady.push_back(index);
+			return;
+		}
+
+		JobSystem::Submit([this, index]() { RunTask(index); });
+	}
+
+	void TaskGraph::RunTask(uint32_t index)
+	{
+		Task& task = mTasks[index];
+		auto start = std::chrono::steady_clock::now();
+		task.mFn();
+		task.mMilliseconds = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+		for (uint32_t successor : task.mSuccessors)
+		{
+			if (mRemaining[successor].fetch_sub(1, std::memory_order_acq_rel) == 1)
+				Schedule(successor);
+		}
+
+		mCompleted.fetch_add(1, std::memory_order_acq_rel);
+	}
+}
@@ -27,5 +27,11 @@ namespace Borealis
 
 	}
 
+	void UUID::SetSeed(uint64_t seed)
+	{
+		sGenerator.seed(seed);
+		sDistribution.reset();
+	}
+
 }
 
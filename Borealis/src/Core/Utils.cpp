@@ -12,17 +12,21 @@ prior written consent of DigiPen Institute of Technology is prohibited.
  *
  /******************************************************************************/
 #include <BorealisPCH.hpp>
-#include <commdlg.h>
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
+#ifdef _WIN32
+#include <commdlg.h>
 #define GLFW_EXPOSE_NATIVE_WIN32
 #include <GLFW/glfw3native.h>
+#endif
 #include <Core/ApplicationManager.hpp>
 #include <Core/Utils.hpp>
+#include <Graphics/OpenGL/StateCacheOpenGLImpl.hpp>
 
 
 namespace Borealis
 {
+#ifdef _WIN32
 	std::string FileDialogs::OpenFile(const char* filter)
 	{
 		OPENFILENAMEA ofn;
@@ -65,6 +69,17 @@ namespace Borealis
 		}
 		return std::string();
 	}
+#else
+	// Only the editor opens dialogs, and it is built for Windows only
+	std::string FileDialogs::OpenFile(const char* filter)
+	{
+		return std::string();
+	}
+	std::string FileDialogs::SaveFile(const char* filter)
+	{
+		return std::string();
+	}
+#endif
 
 	bool GraphicsUtils::IsDepthFormat(FramebufferTextureFormat format)
 	{
@@ -88,7 +103,7 @@ namespace Borealis
 
 	void GraphicsUtils::BindTexture(bool multiSampled, uint32_t id)
 	{
-		glBindTexture(TextureTarget(multiSampled), id);
+		OpenGLStateCache::BindTexture(TextureTarget(multiSampled), id);
 	}
 
 	void GraphicsUtils::AttachColorTexture(uint32_t id, int samples, unsigned internalformat, unsigned format, uint32_t width, uint32_t height, int index)
@@ -22,6 +22,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <Events/EventWindow.hpp>
 #include <Events/EventInput.hpp>
 #include <Graphics/OpenGL/GraphicsContextOpenGLImpl.hpp>
+#include <Graphics/RenderThread.hpp>
 
 namespace Borealis
 {
@@ -65,7 +66,7 @@ namespace Borealis
 		PROFILE_FUNCTION();
 
 		glfwPollEvents();
-		mContext->SwapBuffers();
+		RenderThread::Submit([context = mContext]() { context->SwapBuffers(); });
 	}
 
 	/*!***********************************************************************
@@ -78,10 +79,8 @@ namespace Borealis
 	{
 		PROFILE_FUNCTION();
 
-		if (enabled)
-			glfwSwapInterval(1);
-		else
-			glfwSwapInterval(0);
+		// The swap interval belongs to the context, so it is set on the thread that owns it
+		RenderThread::Submit([enabled]() { glfwSwapInterval(enabled ? 1 : 0); });
 
 		mData.mIsVSync = enabled;
 	}
@@ -128,12 +127,19 @@ namespace Borealis
 		{
 			PROFILE_SCOPE("glfwCreateWindow");
 
-			//lock the version of opengl to 4.1
+			// Ask for 4.3 so the sprite texture arrays and multi-draw indirect can run,
+			// drivers that stop at 4.1 (macOS) get the 4.1 fallback paths
 			glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
-			glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 1);
+			glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
 			glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
 
 			mWindow = (void*)(glfwCreateWindow((int)mData.mWidth, (int)mData.mHeight, mData.mTitle, nullptr, nullptr));
+			if (!mWindow)
+			{
+				BOREALIS_CORE_WARN("OpenGL 4.3 is not available, falling back to 4.1");
+				glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 1);
+				mWindow = (void*)(glfwCreateWindow((int)mData.mWidth, (int)mData.mHeight, mData.mTitle, nullptr, nullptr));
+			}
 			mContext = new OpenGLContext((GLFWwindow*)mWindow);
 			mContext->Init();
 		}
@@ -162,76 +168,61 @@ namespace Borealis
 			data.mEventCallback(event);
 		});
 
+		// Live input is dropped while a recording is replayed, the recorded events are dispatched instead
 		glfwSetKeyCallback((GLFWwindow*)mWindow, [](GLFWwindow* window, int key, int scancode, int action, int mods)
 		{
-			WindowData& data = *(WindowData*)glfwGetWindowUserPointer(window);
+			if (InputRecorder::IsReplaying())
+				return;
 
-			switch (action)
-			{
-				case GLFW_PRESS:
-				{
-					EventKeyTriggered event(key);
-					data.mEventCallback(event);
-					EventKeyPressed event2(key);
-					data.mEventCallback(event2);
-					break;
-				}
-				case GLFW_RELEASE:
-				{
-					EventKeyReleased event(key);
-					data.mEventCallback(event);
-					break;
-				}
-				case GLFW_REPEAT:
-				{
-					EventKeyPressed event(key);
-					data.mEventCallback(event);
-					break;
-				}
-			}
+			WindowData& data = *(WindowData*)glfwGetWindowUserPointer(window);
+			InputEvent event{ InputEvent::Type::Key, key, scancode, action, mods };
+			InputRecorder::RecordEvent(event);
+			DispatchInput(event, data.mEventCallback);
 		});
 
 		glfwSetCharCallback((GLFWwindow*)mWindow, [](GLFWwindow* window, unsigned  character)
 		{
+			if (InputRecorder::IsReplaying())
+				return;
+
 			WindowData& data = *(WindowData*)glfwGetWindowUserPointer(window);
-			EventKeyTyped event(character);
-			data.mEventCallback(event);
+			InputEvent event{ InputEvent::Type::Char, static_cast<int32_t>(character) };
+			InputRecorder::RecordEvent(event);
+			DispatchInput(event, data.mEventCallback);
 		});
 
 		glfwSetMouseButtonCallback((GLFWwindow*)mWindow, [](GLFWwindow* window, int button, int action, int mods)
 		{
-			WindowData& data = *(WindowData*)glfwGetWindowUserPointer(window);
+			if (InputRecorder::IsReplaying())
+				return;
 
-			switch (action)
-			{
-				case GLFW_PRESS:
-				{
-					EventMouseButtonTriggered event2(button);
-					data.mEventCallback(event2);
-					break;
-				}
-				case GLFW_RELEASE:
-				{
-					EventMouseButtonReleased event(button);
-					data.mEventCallback(event);
-					break;
-				}
-			}
+			WindowData& data = *(WindowData*)glfwGetWindowUserPointer(window);
+			InputEvent event{ InputEvent::Type::MouseButton, button, 0, action, mods };
+			InputRecorder::RecordEvent(event);
+			DispatchInput(event, data.mEventCallback);
 		});
 
 		glfwSetScrollCallback((GLFWwindow*)mWindow, [](GLFWwindow* window, double xOffset, double yOffset)
 		{
+			if (InputRecorder::IsReplaying())
+				return;
+
 			WindowData& data = *(WindowData*)glfwGetWindowUserPointer(window);
-			EventMouseScrolled event(xOffset, yOffset);
+			InputEvent event{ InputEvent::Type::Scroll, 0, 0, 0, 0, xOffset, yOffset };
 			InputSystem::AccumulateScroll(yOffset);
-			data.mEventCallback(event);
+			InputRecorder::RecordEvent(event);
+			DispatchInput(event, data.mEventCallback);
 		});
 
 		glfwSetCursorPosCallback((GLFWwindow*)mWindow, [](GLFWwindow* window, double xPos, double yPos)
 		{
+			if (InputRecorder::IsReplaying())
+				return;
+
 			WindowData& data = *(WindowData*)glfwGetWindowUserPointer(window);
-			EventMouseMoved event(xPos, yPos);
-			data.mEventCallback(event);
+			InputEvent event{ InputEvent::Type::CursorPos, 0, 0, 0, 0, xPos, yPos };
+			InputRecorder::RecordEvent(event);
+			DispatchInput(event, data.mEventCallback);
 		});
 
 
@@ -247,4 +238,72 @@ namespace Borealis
 		glfwDestroyWindow((GLFWwindow*)mWindow);
 		delete mContext;
 	}
+
+	/*!***********************************************************************
+		\brief
+			Turns window input into engine events
+		\param[in] event
+			Input received from the window
+		\param[in] callback
+			Function the engine events are passed to
+	*************************************************************************/
+	void WindowManager::DispatchInput(const InputEvent& event, const EventCallbackFn& callback)
+	{
+		switch (event.mType)
+		{
+			case InputEvent::Type::Key:
+			{
+				if (event.mAction == GLFW_PRESS)
+				{
+					EventKeyTriggered triggered(event.mCode);
+					callback(triggered);
+					EventKeyPressed pressed(event.mCode);
+					callback(pressed);
+				}
+				else if (event.mAction == GLFW_RELEASE)
+				{
+					EventKeyReleased released(event.mCode);
+					callback(released);
+				}
+				else if (event.mAction == GLFW_REPEAT)
+				{
+					EventKeyPressed pressed(event.mCode);
+					callback(pressed);
+				}
+				break;
+			}
+			case InputEvent::Type::Char:
+			{
+				EventKeyTyped typed(event.mCode);
+				callback(typed);
+				break;
+			}
+			case InputEvent::Type::MouseButton:
+			{
+				if (event.mAction == GLFW_PRESS)
+				{
+					EventMouseButtonTriggered triggered(event.mCode);
+					callback(triggered);
+				}
+				else if (event.mAction == GLFW_RELEASE)
+				{
+					EventMouseButtonReleased released(event.mCode);
+					callback(released);
+				}
+				break;
+			}
+			case InputEvent::Type::Scroll:
+			{
+				EventMouseScrolled scrolled(event.mX, event.mY);
+				callback(scrolled);
+				break;
+			}
+			case InputEvent::Type::CursorPos:
+			{
+				EventMouseMoved moved(event.mX, event.mY);
+				callback(moved);
+				break;
+			}
+		}
+	}
 } // End of namespace Borealis
@@ -0,0 +1,324 @@
+/******************************************************************************/
+/*!
+\file		FrameProfiler.cpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Defines the built in frame profiler
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#include <BorealisPCH.hpp>
+#include <atomic>
+#include <cstring>
+#include <iomanip>
+#include <mutex>
+#include <Core/Core.hpp>
+#include <Core/LoggerSystem.hpp>
+#include <Debugging/FrameProfiler.hpp>
+
+namespace Borealis
+{
+	namespace
+	{
+		/*!***********************************************************************
+			\brief
+				Zones closed by one thread since the last NewFrame. Each thread
+				appends to its own buffer so zones only contend with NewFrame.
+		*************************************************************************/
+		struct ThreadBuffer
+		{
+			std::mutex mMutex;
+			std::vector<ProfileZoneRecord> mZones;
+			uint32_t mIndex = 0;
+		};
+
+		struct State
+		{
+			std::mutex mMutex;
+			std::vector<ProfiledFrame> mFrames;		//!< Ring buffer of closed frames
+			uint32_t mHead = 0;						//!< Next slot to write
+			uint32_t mCount = 0;					//!< Number of valid slots
+			ProfiledFrame mCurrent;					//!< Frame being recorded
+			bool mHasCurrent = false;
+			std::vector<std::unique_ptr<ThreadBuffer>> mThreads; //!< Kept for the life of the process, threads hold raw pointers to them
+		};
+
+		State sState;
+		std::atomic<bool> sEnabled = false;
+		std::atomic<bool> sPaused = false;
+		std::atomic<uint64_t> sFrameIndex = 0;
+		const std::chrono::steady_clock::time_point sEpoch = std::chrono::steady_clock::now();
+
+		thread_local ThreadBuffer* tThreadBuffer = nullptr;
+		thread_local uint32_t tDepth = 0;
+
+		ThreadBuffer& GetThreadBuffer()
+		{
+			if (!tThreadBuffer)
+			{
+				std::lock_guard<std::mutex> lock(sState.mMutex);
+				sState.mThreads.push_back(MakeScope<ThreadBuffer>());
+				tThreadBuffer = sState.mThreads.back().get();
+				tThreadBuffer->mIndex = static_cast<uint32_t>(sState.mThreads.size() - 1);
+			}
+			return *tThreadBuffer;
+		}
+
+		void WriteEscaped(std::ofstream& out, const char* text)
+		{
+			for (; *text; ++text)
+			{
+				if (*text == '"' || *text == '\\')
+					out << '\\';
+				out << *text;
+			}
+		}
+	}
+
+	void FrameProfiler::Init(uint32_t frameCount)
+	{
+		// The calling thread owns the frame loop and is always thread 0
+		GetThreadBuffer();
+
+		std::lock_guard<std::mutex> lock(sState.mMutex);
+		sState.mFrames.assign(std::max(frameCount, 1u), ProfiledFrame{});
+		sState.mHead = 0;
+		sState.mCount = 0;
+		sState.mHasCurrent = false;
+		sEnabled = true;
+	}
+
+	void FrameProfiler::Free()
+	{
+		sEnabled = false;
+
+		std::lock_guard<std::mutex> lock(sState.mMutex);
+		sState.mFrames.clear();
+		sState.mFrames.shrink_to_fit();
+		sState.mCurrent = {};
+		sState.mHasCurrent = false;
+	}
+
+	void FrameProfiler::NewFrame()
+	{
+		int64_t now = Now();
+		bool record = sEnabled && !sPaused;
+
+		std::lock_guard<std::mutex> lock(sState.mMutex);
+		ProfiledFrame& current = sState.mCurrent;
+		for (auto& thread : sState.mThreads)
+		{
+			std::lock_guard<std::mutex> threadLock(thread->mMutex);
+			if (record)
+				current.mZones.insert(current.mZones.end(), thread->mZones.begin(), thread->mZones.end());
+			thread->mZones.clear();
+		}
+
+		if (record && sState.mHasCurrent && !sState.mFrames.empty())
+		{
+			current.mEnd = now;
+			std::swap(sState.mFrames[sState.mHead], current);
+			sState.mHead = (sState.mHead + 1) % sState.mFrames.size();
+			sState.mCount = std::min<uint32_t>(sState.mCount + 1, static_cast<uint32_t>(sState.mFrames.size()));
+		}
+
+		// Reuse the storage of the slot that was just overwritten
+		current.mIndex = sFrameIndex++;
+		current.mStart = now;
+		current.mEnd = now;
+		current.mZones.clear();
+		current.mGpuZones.clear();
+		current.mCounters.clear();
+		sState.mHasCurrent = true;
+	}
+
+	uint64_t FrameProfiler::GetFrameIndex()
+	{
+		uint64_t next = sFrameIndex.load();
+		return next > 0 ? next - 1 : 0;
+	}
+
+	void FrameProfiler::SetEnabled(bool enabled)
+	{
+		sEnabled = enabled && !sState.mFrames.empty();
+	}
+
+	bool FrameProfiler::IsEnabled()
+	{
+		return sEnabled;
+	}
+
+	void FrameProfiler::SetPaused(bool paused)
+	{
+		sPaused = paused;
+	}
+
+	bool FrameProfiler::IsPaused()
+	{
+		return sPaused;
+	}
+
+	int64_t FrameProfiler::Now()
+	{
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - sEpoch).count();
+	}
+
+	bool FrameProfiler::BeginZone(int64_t& start, uint32_t& depth)
+	{
+		if (!sEnabled.load(std::memory_order_relaxed) || sPaused.load(std::memory_order_relaxed))
+			return false;
+
+		depth = tDepth++;
+		start = Now();
+		return true;
+	}
+
+	void FrameProfiler::EndZone(const char* name, int64_t start, uint32_t depth)
+	{
+		int64_t end = Now();
+		tDepth = depth;
+
+		ThreadBuffer& buffer = GetThreadBuffer();
+		std::lock_guard<std::mutex> lock(buffer.mMutex);
+		buffer.mZones.push_back({ name, start, end, buffer.mIndex, depth });
+	}
+
+	void FrameProfiler::SetCounter(const char* name, double value)
+	{
+		TracyProfiler::recordPlot(name, static_cast<float>(value));
+		if (!sEnabled || sPaused)
+			return;
+
+		std::lock_guard<std::mutex> lock(sState.mMutex);
+		for (ProfileCounterRecord& counter : sState.mCurrent.mCounters)
+		{
+			if (counter.mName == name || std::strcmp(counter.mName, name) == 0)
+			{
+				counter.mValue = value;
+				return;
+			}
+		}
+		sState.mCurrent.mCounters.push_back({ name, value });
+	}
+
+	void FrameProfiler::RecordGpuZone(uint64_t frameIndex, const ProfileZoneRecord& zone)
+	{
+		if (!sEnabled)
+			return;
+
+		std::lock_guard<std::mutex> lock(sState.mMutex);
+		if (sState.mHasCurrent && sState.mCurrent.mIndex == frameIndex)
+		{
+			sState.mCurrent.mGpuZones.push_back(zone);
+			return;
+		}
+
+		// Queries resolve a few frames late, search from the newest frame back
+		uint32_t size = static_cast<uint32_t>(sState.mFrames.size());
+		for (uint32_t i = 1; i <= sState.mCount; ++i)
+		{
+			ProfiledFrame& frame = sState.mFrames[(sState.mHead + size - i) % size];
+			if (frame.mIndex == frameIndex)
+			{
+				frame.mGpuZones.push_back(zone);
+				return;
+			}
+			if (frame.mIndex < frameIndex)
+				return;
+		}
+	}
+
+	void FrameProfiler::GetFrames(std::vector<ProfiledFrame>& frames)
+	{
+		std::lock_guard<std::mutex> lock(sState.mMutex);
+		uint32_t size = static_cast<uint32_t>(sState.mFrames.size());
+		frames.resize(sState.mCount);
+		for (uint32_t i = 0; i < sState.mCount; ++i)
+			frames[i] = sState.mFrames[(sState.mHead + size - sState.mCount + i) % size];
+	}
+
+	bool FrameProfiler::GetLatestGpuFrame(ProfiledFrame& frame)
+	{
+		std::lock_guard<std::mutex> lock(sState.mMutex);
+		uint32_t size = static_cast<uint32_t>(sState.mFrames.size());
+		for (uint32_t i = 1; i <= sState.mCount; ++i)
+		{
+			const ProfiledFrame& candidate = sState.mFrames[(sState.mHead + size - i) % size];
+			if (!candidate.mGpuZones.empty())
+			{
+				frame = candidate;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	bool FrameProfiler::ExportChromeTrace(const std::string& path)
+	{
+		std::vector<ProfiledFrame> frames;
+		GetFrames(frames);
+
+		std::ofstream out(path);
+		if (!out)
+		{
+			BOREALIS_CORE_ERROR("Failed to write trace {}", path);
+			return false;
+		}
+
+		constexpr uint32_t gpuThread = 1000;
+		uint32_t threadCount = 0;
+		{
+			std::lock_guard<std::mutex> lock(sState.mMutex);
+			threadCount = static_cast<uint32_t>(sState.mThreads.size());
+		}
+
+		// Chrome traces are in microseconds
+		out << std::fixed << std::setprecision(3);
+		out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+		out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << gpuThread << ",\"args\":{\"name\":\"GPU\"}}";
+		for (uint32_t thread = 0; thread < threadCount; ++thread)
+		{
+			out << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << thread << ",\"args\":{\"name\":\""
+				<< (thread == 0 ? "Main" : "Thread " + std::to_string(thread)) << "\"}}";
+		}
+
+		for (const ProfiledFrame& frame : frames)
+		{
+			out << ",\n{\"name\":\"Frame " << frame.mIndex << "\",\"cat\":\"frame\",\"ph\":\"X\",\"pid\":0,\"tid\":0,\"ts\":"
+				<< frame.mStart * 1e-3 << ",\"dur\":" << (frame.mEnd - frame.mStart) * 1e-3 << "}";
+
+			for (const ProfileZoneRecord& zone : frame.mZones)
+			{
+				out << ",\n{\"name\":\"";
+				WriteEscaped(out, zone.mName);
+				out << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << zone.mThread << ",\"ts\":" << zone.mStart * 1e-3
+					<< ",\"dur\":" << (zone.mEnd - zone.mStart) * 1e-3 << "}";
+			}
+
+			// GPU clocks are not synchronised with the CPU, line them up with the start of the frame
+			for (const ProfileZoneRecord& zone : frame.mGpuZones)
+			{
+				out << ",\n{\"name\":\"";
+				WriteEscaped(out, zone.mName);
+				out << "\",\"cat\":\"gpu\",\"ph\":\"X\",\"pid\":0,\"tid\":" << gpuThread << ",\"ts\":" << (frame.mStart + zone.mStart) * 1e-3
+					<< ",\"dur\":" << (zone.mEnd - zone.mStart) * 1e-3 << "}";
+			}
+
+			for (const ProfileCounterRecord& counter : frame.mCounters)
+			{
+				out << ",\n{\"name\":\"";
+				WriteEscaped(out, counter.mName);
+				out << "\",\"ph\":\"C\",\"pid\":0,\"ts\":" << frame.mEnd * 1e-3 << ",\"args\":{\"value\":" << counter.mValue << "}}";
+			}
+		}
+		out << "\n]}\n";
+
+		BOREALIS_CORE_INFO("Wrote {} frames of profiling data to {}", frames.size(), path);
+		return true;
+	}
+}
@@ -85,9 +85,20 @@ namespace Borealis
         FrameMarkEnd(frameName);
     }
     
-    // Start a custom profiling zone, provides detailed insight into those frame
-    void TracyProfiler::startZone(const mySourceLocationData* loc) {
-        tracy::ScopedZone ___tracy_scoped_zone(reinterpret_cast<const tracy::SourceLocationData*>(loc), true);
+    static_assert(sizeof(tracy::ScopedZone) <= 16 && alignof(tracy::ScopedZone) <= 8, "ProfileZone storage is too small for tracy::ScopedZone");
+
+    // Begins a zone that lives until the ProfileZone goes out of scope
+    ProfileZone::ProfileZone(const mySourceLocationData* loc) : mLocation(loc), mStart(0), mDepth(0) {
+        new (mTracyZone) tracy::ScopedZone(reinterpret_cast<const tracy::SourceLocationData*>(loc), true);
+        mRecording = FrameProfiler::BeginZone(mStart, mDepth);
+    }
+
+    // Ends the zone in Tracy and records it into the frame profiler
+    ProfileZone::~ProfileZone() {
+        if (mRecording) {
+            FrameProfiler::EndZone(mLocation->name ? mLocation->name : mLocation->function, mStart, mDepth);
+        }
+        reinterpret_cast<tracy::ScopedZone*>(mTracyZone)->~ScopedZone();
     }
     
     // Destructor that ends the profiling zone
@@ -17,6 +17,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <glad/glad.h>
 #include <Graphics/Renderer.hpp>
 #include <Graphics/OpenGL/BufferOpenGLImpl.hpp>
+#include <Graphics/Null/BufferNullImpl.hpp>
 #include <Graphics/Buffer.hpp>
 #include <Core/LoggerSystem.hpp>
 
@@ -42,6 +43,7 @@ namespace Borealis
 		{
 			case RendererAPI::API::None: BOREALIS_CORE_ASSERT(false, "RendererAPI::None is not supported"); return nullptr;
 			case RendererAPI::API::OpenGL: return MakeRef<OpenGLVertexBuffer>(size);
+			case RendererAPI::API::Null: return MakeRef<NullVertexBuffer>();
 		}
 		BOREALIS_CORE_ASSERT(false, "Unknown RendererAPI");
 		return nullptr;
@@ -53,6 +55,7 @@ namespace Borealis
 		{
 			case RendererAPI::API::None: BOREALIS_CORE_ASSERT(false, "RendererAPI::None is not supported"); return nullptr;
 			case RendererAPI::API::OpenGL: return MakeRef<OpenGLVertexBuffer>(vertices, size);
+			case RendererAPI::API::Null: return MakeRef<NullVertexBuffer>();
 		}
 		BOREALIS_CORE_ASSERT(false, "Unknown RendererAPI");
 		return nullptr;
@@ -64,6 +67,7 @@ namespace Borealis
 		{
 			case RendererAPI::API::None: BOREALIS_CORE_ASSERT(false, "RendererAPI::None is not supported"); return nullptr;
 			case RendererAPI::API::OpenGL: return MakeRef<OpenGLElementBuffer>(indices, count);
+			case RendererAPI::API::Null: return MakeRef<NullElementBuffer>(count);
 		}
 		BOREALIS_CORE_ASSERT(false, "Unknown RendererAPI");
 		return nullptr;
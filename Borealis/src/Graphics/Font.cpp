@@ -30,6 +30,7 @@ namespace Borealis
 	Font::Font(FontInfo const& fontInfo)
 	{
 		mFontInfo = fontInfo;
+		BuildGlyphTable();
 	}
 
 	Font::Font(std::filesystem::path const& filePath)
@@ -73,6 +74,7 @@ namespace Borealis
 		in.close();
 
 		mFontInfo = fontInfo;
+		BuildGlyphTable();
 	}
 
 	Font::~Font()
@@ -85,6 +87,37 @@ namespace Borealis
 		return mFontInfo;
 	}
 
+	FontGlyph const* Font::GetGlyph(uint32_t codepoint) const
+	{
+		if (codepoint < GlyphTableSize)
+			return mHasGlyph[codepoint] ? &mGlyphTable[codepoint] : nullptr;
+
+		// Glyphs are keyed by char, so nothing past the table can be in the font
+		return nullptr;
+	}
+
+	double Font::GetAdvance(uint32_t codepoint, uint32_t nextCodepoint) const
+	{
+		auto kerning = mFontInfo.kernings.find({ codepoint, nextCodepoint });
+		if (kerning != mFontInfo.kernings.end())
+			return kerning->second;
+
+		FontGlyph const* glyph = GetGlyph(codepoint);
+		return glyph ? glyph->advance : 0.0;
+	}
+
+	void Font::BuildGlyphTable()
+	{
+		mHasGlyph.fill(false);
+		for (auto const& [character, glyph] : mFontInfo.glyphs)
+		{
+			// The importer truncates codepoints to char, Latin-1 ones come back unsigned
+			uint8_t codepoint = static_cast<uint8_t>(character);
+			mGlyphTable[codepoint] = glyph;
+			mHasGlyph[codepoint] = true;
+		}
+	}
+
 	Ref<Texture2D> Font::GetAtlasTexture() const
 	{
 		return mFontInfo.fontAtlas;
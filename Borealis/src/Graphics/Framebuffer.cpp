@@ -15,7 +15,8 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <Core/Core.hpp>
 #include <Graphics/Framebuffer.hpp>
 #include <Graphics/Renderer.hpp>
-#include <Graphics/OpenGL/FrameBufferOpenGLImpl.hpp>
+#include <Graphics/OpenGL/FramebufferOpenGLImpl.hpp>
+#include <Graphics/Null/FramebufferNullImpl.hpp>
 namespace Borealis
 {
 	Ref<FrameBuffer> FrameBuffer::Create(const FrameBufferProperties& properties)
@@ -24,6 +25,7 @@ namespace Borealis
 		{
 			case RendererAPI::API::None:    BOREALIS_CORE_ASSERT(false, "RendererAPI::None is currently not supported"); return nullptr;
 			case RendererAPI::API::OpenGL:  return MakeRef<OpenGLFrameBuffer>(properties);
+			case RendererAPI::API::Null:    return MakeRef<NullFrameBuffer>(properties);
 		}
 
 		BOREALIS_CORE_ASSERT(false,  "Unknown RendererAPI");
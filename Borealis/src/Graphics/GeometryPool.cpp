@@ -0,0 +1,348 @@
+/******************************************************************************/
+/*!
+\file		GeometryPool.cpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Defines the geometry pool
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#include <BorealisPCH.hpp>
+#include <map>
+#include <mutex>
+#include <glad/glad.h>
+#include <Core/LoggerSystem.hpp>
+#include <Core/MemoryTracker.hpp>
+#include <Graphics/GeometryPool.hpp>
+#include <Graphics/Mesh.hpp>
+#include <Graphics/OpenGL/StateCacheOpenGLImpl.hpp>
+#include <Graphics/RendererAPI.hpp>
+#include <Graphics/Null/RendererAPINullImpl.hpp>
+
+namespace Borealis
+{
+	namespace
+	{
+		constexpr uint32_t sInitialVertices = 1u << 20;
+		constexpr uint32_t sInitialIndices = 4u << 20;
+		constexpr uint32_t sInvalidOffset = UINT32_MAX;
+
+		// First fit free list over a range of elements, neighbouring free ranges are merged
+		class RangeAllocator
+		{
+		public:
+			void Reset(uint32_t capacity)
+			{
+				mFree.clear();
+				mFree[0] = capacity;
+				mCapacity = capacity;
+			}
+
+			uint32_t Allocate(uint32_t count)
+			{
+				for (auto it = mFree.begin(); it != mFree.end(); ++it)
+				{
+					if (it->second < count)
+						continue;
+
+					uint32_t offset = it->first, remaining = it->second - count;
+					mFree.erase(it);
+					if (remaining > 0)
+						mFree[offset + count] = remaining;
+					return offset;
+				}
+				return sInvalidOffset;
+			}
+
+			void Release(uint32_t offset, uint32_t count)
+			{
+				auto next = mFree.lower_bound(offset);
+				if (next != mFree.end() && offset + count == next->first)
+				{
+					count += next->second;
+					next = mFree.erase(next);
+				}
+				if (next != mFree.begin())
+				{
+					auto previous = std::prev(next);
+					if (previous->first + previous->second == offset)
+					{
+						previous->second += count;
+						return;
+					}
+				}
+				mFree[offset] = count;
+			}
+
+			void Grow(uint32_t capacity)
+			{
+				uint32_t oldCapacity = mCapacity;
+				mCapacity = capacity;
+				Release(oldCapacity, capacity - oldCapacity);
+			}
+
+			uint32_t GetCapacity() const { return mCapacity; }
+
+		private:
+			std::map<uint32_t, uint32_t> mFree;	//!< Offset to size of each free range
+			uint32_t mCapacity = 0;
+		};
+
+		struct FormatPool
+		{
+			GLuint mVertexArray = 0;
+			GLuint mVertexBuffer = 0;
+			GLuint mIndexBuffer = 0;
+			uint32_t mStride = 0;
+			RangeAllocator mVertices;
+			RangeAllocator mIndices;
+		};
+
+		struct GeometryPoolData
+		{
+			std::array<FormatPool, static_cast<size_t>(GeometryPool::VertexFormat::Count)> mPools;
+			GLuint mInstanceBuffer = 0;
+			GLuint mIndirectBuffer = 0;
+			std::mutex mMutex;	//!< Guards the allocators, allocations may be released from any thread
+		};
+
+		GeometryPoolData* sData = nullptr;
+
+		void SetupVertexAttributes(GeometryPool::VertexFormat format, FormatPool& pool)
+		{
+			OpenGLStateCache::BindVertexArray(pool.mVertexArray);
+			OpenGLStateCache::BindBuffer(GL_ARRAY_BUFFER, pool.mVertexBuffer);
+			OpenGLStateCache::BindBuffer(GL_ELEMENT_ARRAY_BUFFER, pool.mIndexBuffer);
+
+			switch (format)
+			{
+			case GeometryPool::VertexFormat::Static:
+				// vertex positions
+				glEnableVertexAttribArray(0);
+				glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)0);
+				// vertex normals
+				glEnableVertexAttribArray(1);
+				glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, Normal));
+				// vertex texture coords
+				glEnableVertexAttribArray(2);
+				glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, TexCoords));
+				// Tangents
+				glEnableVertexAttribArray(3);
+				glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(VertexData, Tangent));
+				// Bitangents
+				glEnableVertexAttribArray(4);
+				glVertexAttribPointer(4, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(VertexData, Bitangent));
+				break;
+			default:
+				break;
+			}
+		}
+
+		void SetupInstanceAttributes(size_t firstInstance)
+		{
+			using InstanceData = GeometryPool::InstanceData;
+			size_t base = firstInstance * sizeof(InstanceData);
+
+			OpenGLStateCache::BindBuffer(GL_ARRAY_BUFFER, sData->mInstanceBuffer);
+			for (GLuint column = 0; column < 4; ++column)
+			{
+				glEnableVertexAttribArray(5 + column);
+				glVertexAttribPointer(5 + column, 4, GL_FLOAT, GL_FALSE, sizeof(InstanceData), (void*)(base + offsetof(InstanceData, mTransform) + column * sizeof(glm::vec4)));
+				glVertexAttribDivisor(5 + column, 1);
+			}
+			glEnableVertexAttribArray(9);
+			glVertexAttribIPointer(9, 1, GL_INT, sizeof(InstanceData), (void*)(base + offsetof(InstanceData, mEntityID)));
+			glVertexAttribDivisor(9, 1);
+			glEnableVertexAttribArray(10);
+			glVertexAttribPointer(10, 1, GL_FLOAT, GL_FALSE, sizeof(InstanceData), (void*)(base + offsetof(InstanceData, mLodFade)));
+			glVertexAttribDivisor(10, 1);
+		}
+
+		// Moves the contents of a buffer into a larger one
+		GLuint GrowBuffer(GLuint buffer, uint64_t oldBytes, uint64_t newBytes)
+		{
+			GLuint grown;
+			glGenBuffers(1, &grown);
+			OpenGLStateCache::BindBuffer(GL_COPY_WRITE_BUFFER, grown);
+			glBufferData(GL_COPY_WRITE_BUFFER, newBytes, nullptr, GL_STATIC_DRAW);
+			OpenGLStateCache::BindBuffer(GL_COPY_READ_BUFFER, buffer);
+			glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 0, oldBytes);
+			OpenGLStateCache::DeleteBuffers(1, &buffer);
+
+			MemoryTracker::TrackGpuFree(MemoryTag::GPUBuffers, oldBytes);
+			MemoryTracker::TrackGpuAllocation(MemoryTag::GPUBuffers, newBytes);
+			return grown;
+		}
+
+		uint32_t AllocateRange(RangeAllocator& allocator, GLuint& buffer, uint32_t stride, uint32_t count, bool& grown)
+		{
+			uint32_t offset = allocator.Allocate(count);
+			if (offset != sInvalidOffset)
+				return offset;
+
+			uint32_t oldCapacity = allocator.GetCapacity();
+			uint32_t newCapacity = std::max(oldCapacity * 2, oldCapacity + count);
+			buffer = GrowBuffer(buffer, static_cast<uint64_t>(oldCapacity) * stride, static_cast<uint64_t>(newCapacity) * stride);
+			allocator.Grow(newCapacity);
+			grown = true;
+			return allocator.Allocate(count);
+		}
+	}
+
+	GeometryPool::Allocation::~Allocation()
+	{
+		if (!sData)
+			return;
+
+		// The range is only reused by later uploads, draws in flight hold the mesh and so this allocation
+		std::lock_guard<std::mutex> lock(sData->mMutex);
+		FormatPool& pool = sData->mPools[static_cast<size_t>(mFormat)];
+		pool.mVertices.Release(mBaseVertex, mVertexCount);
+		if (mIndexCount > 0)
+			pool.mIndices.Release(mFirstIndex, mIndexCount);
+	}
+
+	void GeometryPool::Init()
+	{
+		if (RendererAPI::GetAPI() == RendererAPI::API::Null)
+			return;
+
+		sData = new GeometryPoolData();
+		sData->mPools[static_cast<size_t>(VertexFormat::Static)].mStride = sizeof(Vertex);
+
+		glGenBuffers(1, &sData->mInstanceBuffer);
+		glGenBuffers(1, &sData->mIndirectBuffer);
+
+		// Multi draw indirect is core in 4.3, the window falls back to a 4.1 context where it is not available
+		BOREALIS_CORE_INFO("Geometry pool draws: {}", GLAD_GL_VERSION_4_3 ? "Multi draw indirect" : "One call per mesh (multi draw indirect needs OpenGL 4.3)");
+
+		for (size_t format = 0; format < sData->mPools.size(); ++format)
+		{
+			FormatPool& pool = sData->mPools[format];
+			glGenVertexArrays(1, &pool.mVertexArray);
+			glGenBuffers(1, &pool.mVertexBuffer);
+			glGenBuffers(1, &pool.mIndexBuffer);
+
+			OpenGLStateCache::BindVertexArray(pool.mVertexArray);
+			OpenGLStateCache::BindBuffer(GL_ARRAY_BUFFER, pool.mVertexBuffer);
+			glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(sInitialVertices) * pool.mStride, nullptr, GL_STATIC_DRAW);
+			OpenGLStateCache::BindBuffer(GL_ELEMENT_ARRAY_BUFFER, pool.mIndexBuffer);
+			glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(sInitialIndices) * sizeof(uint32_t), nullptr, GL_STATIC_DRAW);
+			MemoryTracker::TrackGpuAllocation(MemoryTag::GPUBuffers, static_cast<uint64_t>(sInitialVertices) * pool.mStride + sInitialIndices * sizeof(uint32_t));
+
+			pool.mVertices.Reset(sInitialVertices);
+			pool.mIndices.Reset(sInitialIndices);
+			SetupVertexAttributes(static_cast<VertexFormat>(format), pool);
+			SetupInstanceAttributes(0);
+		}
+		OpenGLStateCache::BindVertexArray(0);
+	}
+
+	void GeometryPool::Free()
+	{
+		if (!sData)
+			return;
+
+		for (FormatPool& pool : sData->mPools)
+		{
+			MemoryTracker::TrackGpuFree(MemoryTag::GPUBuffers, static_cast<uint64_t>(pool.mVertices.GetCapacity()) * pool.mStride + pool.mIndices.GetCapacity() * sizeof(uint32_t));
+			OpenGLStateCache::DeleteVertexArrays(1, &pool.mVertexArray);
+			OpenGLStateCache::DeleteBuffers(1, &pool.mVertexBuffer);
+			OpenGLStateCache::DeleteBuffers(1, &pool.mIndexBuffer);
+		}
+		OpenGLStateCache::DeleteBuffers(1, &sData->mInstanceBuffer);
+		OpenGLStateCache::DeleteBuffers(1, &sData->mIndirectBuffer);
+
+		delete sData;
+		sData = nullptr;
+	}
+
+	Ref<GeometryPool::Allocation> GeometryPool::Allocate(VertexFormat format, const void* vertices, uint32_t vertexCount, const uint32_t* indices, uint32_t indexCount)
+	{
+		if (!sData || vertexCount == 0)
+			return nullptr;
+
+		std::lock_guard<std::mutex> lock(sData->mMutex);
+		FormatPool& pool = sData->mPools[static_cast<size_t>(format)];
+
+		bool grown = false;
+		uint32_t baseVertex = AllocateRange(pool.mVertices, pool.mVertexBuffer, pool.mStride, vertexCount, grown);
+		uint32_t firstIndex = indexCount > 0 ? AllocateRange(pool.mIndices, pool.mIndexBuffer, sizeof(uint32_t), indexCount, grown) : 0;
+		if (grown)
+		{
+			BOREALIS_CORE_INFO("Geometry pool grown to {0} vertices and {1} indices", pool.mVertices.GetCapacity(), pool.mIndices.GetCapacity());
+			SetupVertexAttributes(format, pool);
+		}
+
+		OpenGLStateCache::BindBuffer(GL_ARRAY_BUFFER, pool.mVertexBuffer);
+		glBufferSubData(GL_ARRAY_BUFFER, static_cast<GLintptr>(baseVertex) * pool.mStride, static_cast<GLsizeiptr>(vertexCount) * pool.mStride, vertices);
+		if (indexCount > 0)
+		{
+			// Bound outside a vertex array so the element binding of the pool is left alone
+			OpenGLStateCache::BindBuffer(GL_COPY_WRITE_BUFFER, pool.mIndexBuffer);
+			glBufferSubData(GL_COPY_WRITE_BUFFER, static_cast<GLintptr>(firstIndex) * sizeof(uint32_t), static_cast<GLsizeiptr>(indexCount) * sizeof(uint32_t), indices);
+		}
+
+		return MakeRef<Allocation>(format, baseVertex, vertexCount, firstIndex, indexCount);
+	}
+
+	void GeometryPool::MultiDraw(VertexFormat format, const std::vector<DrawCommand>& commands, const std::vector<InstanceData>& instances)
+	{
+		if (commands.empty())
+			return;
+
+		// Headless runs have no pool, but still count what would have been drawn
+		if (!sData)
+		{
+			if (RendererAPI::GetAPI() != RendererAPI::API::Null)
+				return;
+
+			uint64_t indices = 0;
+			RenderStatistics& stats = RendererAPI::GetStatistics();
+			for (const DrawCommand& command : commands)
+			{
+				indices += command.mCount;
+				stats.Triangles += command.mCount / 3;
+			}
+			stats.DrawCalls++;
+			NullRendererAPI::DrawMultiIndirect(indices, instances.size());
+			return;
+		}
+
+		FormatPool& pool = sData->mPools[static_cast<size_t>(format)];
+		OpenGLStateCache::BindVertexArray(pool.mVertexArray);
+
+		// Orphaned every batch so the driver does not wait on the last one
+		OpenGLStateCache::BindBuffer(GL_ARRAY_BUFFER, sData->mInstanceBuffer);
+		glBufferData(GL_ARRAY_BUFFER, instances.size() * sizeof(InstanceData), instances.data(), GL_STREAM_DRAW);
+
+		RenderStatistics& stats = RendererAPI::GetStatistics();
+		if (GLAD_GL_VERSION_4_3)
+		{
+			// The instanced attributes stay at the start of the buffer set up in Init, base instance offsets them
+			OpenGLStateCache::BindBuffer(GL_DRAW_INDIRECT_BUFFER, sData->mIndirectBuffer);
+			glBufferData(GL_DRAW_INDIRECT_BUFFER, commands.size() * sizeof(DrawCommand), commands.data(), GL_STREAM_DRAW);
+			glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, nullptr, static_cast<GLsizei>(commands.size()), 0);
+			stats.DrawCalls++;
+		}
+		else
+		{
+			// Without base instance, point the instanced attributes at each draw's data instead
+			for (const DrawCommand& command : commands)
+			{
+				SetupInstanceAttributes(command.mBaseInstance);
+				glDrawElementsBaseVertex(GL_TRIANGLES, static_cast<GLsizei>(command.mCount), GL_UNSIGNED_INT,
+					reinterpret_cast<void*>(static_cast<uintptr_t>(command.mFirstIndex) * sizeof(uint32_t)), command.mBaseVertex);
+			}
+			stats.DrawCalls += static_cast<uint32_t>(commands.size());
+		}
+
+		for (const DrawCommand& command : commands)
+			stats.Triangles += command.mCount / 3;
+	}
+}
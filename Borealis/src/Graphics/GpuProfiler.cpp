@@ -0,0 +1,48 @@
+/******************************************************************************/
+/*!
+\file		GpuProfiler.cpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Defines the GPU profiler factory
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#include <BorealisPCH.hpp>
+#include <Graphics/GpuProfiler.hpp>
+#include <Graphics/Renderer.hpp>
+#include <Graphics/RenderThread.hpp>
+#include <Graphics/OpenGL/GpuProfilerOpenGLImpl.hpp>
+#include <Core/LoggerSystem.hpp>
+
+namespace Borealis
+{
+	Scope<GpuProfiler> GpuProfiler::sInstance = nullptr;
+
+	Scope<GpuProfiler> GpuProfiler::Create(uint32_t framesInFlight)
+	{
+		switch (Renderer::GetAPI())
+		{
+			case RendererAPI::API::None:    BOREALIS_CORE_ASSERT(false, "RendererAPI::None is not supported"); return nullptr;
+			case RendererAPI::API::OpenGL:  return MakeScope<OpenGLGpuProfiler>(framesInFlight);
+			case RendererAPI::API::Null:    return nullptr; // No GPU work to time
+		}
+
+		BOREALIS_CORE_ASSERT(false, "Unknown RendererAPI");
+		return nullptr;
+	}
+
+	void GpuProfiler::Init()
+	{
+		RenderThread::Submit([]() { sInstance = Create(); });
+	}
+
+	void GpuProfiler::Free()
+	{
+		RenderThread::Submit([]() { sInstance = nullptr; });
+	}
+}
@@ -14,6 +14,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 
 #include "BorealisPCH.hpp"
 #include "Graphics/Light.hpp"
+#include <cstdio>
 
 namespace Borealis
 {
@@ -39,37 +40,30 @@ namespace Borealis
 		shader->Set("u_Light.linear", mLight.linear);
 		shader->Set("u_Light.quadratic", mLight.quadratic);
 		shader->Set("u_Light.type", static_cast<int>(mLight.type));
-
-		shader->Unbind();
 	}
 
 	void Light::SetUniforms(LightComponent const& lightComponent, int index, Ref<Shader> shader)
 	{
 		shader->Bind();
 
-		std::string lightPrefix = "u_Lights[" + std::to_string(index) + "]";
+		// Names are formatted into a stack buffer, this runs for every light every frame
+		char name[64];
+		auto uniform = [&](const char* member)
+			{
+				std::snprintf(name, sizeof(name), "u_Lights[%d].%s", index, member);
+				return name;
+			};
 
 		glm::vec2 innerOuterSpot = glm::vec2{ cos(glm::radians(lightComponent.InnerOuterSpot.x)), cos(glm::radians(lightComponent.InnerOuterSpot.y)) };
 
-		std::string str = lightPrefix + ".position";
-		shader->Set(str.c_str(), lightComponent.offset);
-		str = lightPrefix + ".ambient";
-		shader->Set(str.c_str(), lightComponent.ambient);
-		str = lightPrefix + ".diffuse";
-		shader->Set(str.c_str(), lightComponent.diffuse);
-		str = lightPrefix + ".specular";
-		shader->Set(str.c_str(), lightComponent.specular);
-		str = lightPrefix + ".direction";
-		shader->Set(str.c_str(), lightComponent.direction);
-		str = lightPrefix + ".innerOuterAngle";
-		shader->Set(str.c_str(), innerOuterSpot);
-		str = lightPrefix + ".linear";
-		shader->Set(str.c_str(), lightComponent.linear);
-		str = lightPrefix + ".quadratic";
-		shader->Set(str.c_str(), lightComponent.quadratic);
-		str = lightPrefix + ".type";
-		shader->Set(str.c_str(), static_cast<int>(lightComponent.type));
-
-		shader->Unbind();
+		shader->Set(uniform("position"), lightComponent.offset);
+		shader->Set(uniform("ambient"), lightComponent.ambient);
+		shader->Set(uniform("diffuse"), lightComponent.diffuse);
+		shader->Set(uniform("specular"), lightComponent.specular);
+		shader->Set(uniform("direction"), lightComponent.direction);
+		shader->Set(uniform("innerOuterAngle"), innerOuterSpot);
+		shader->Set(uniform("linear"), lightComponent.linear);
+		shader->Set(uniform("quadratic"), lightComponent.quadratic);
+		shader->Set(uniform("type"), static_cast<int>(lightComponent.type));
 	}
 }
\ No newline at end of file
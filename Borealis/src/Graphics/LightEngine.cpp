@@ -31,10 +31,9 @@ namespace Borealis
 
 	void LightEngine::SetLights(Ref<Shader> shader)
 	{
+		// Stays bound for the lights and the draws after, uniforms go to the bound program
 		shader->Bind();
 		shader->Set("u_LightsCount", static_cast<int>(mLights.size()));
-		shader->Unbind();
-
 
 		for (int i{}; i < mLights.size(); ++i)
 		{
@@ -16,6 +16,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include "Assets/AssetManager.hpp"
 #include "Core/LoggerSystem.hpp"
 #include "Graphics/Material.hpp"
+#include "Graphics/RenderThread.hpp"
 #include <yaml-cpp/yaml.h>
 
 namespace YAML
@@ -92,6 +93,18 @@ namespace YAML
 
 namespace Borealis
 {
+    static constexpr const char* sMaterialShaderPath = "engineResources/Shaders/Renderer3D_Material.glsl";
+
+    // Define of the shader variant that samples each texture map
+    static const std::pair<Material::TextureMaps, const char*> sShaderFeatureDefines[] =
+    {
+        { Material::Albedo,    "HAS_ALBEDO_MAP" },
+        { Material::Specular,  "HAS_SPECULAR_MAP" },
+        { Material::Metallic,  "HAS_METALLIC_MAP" },
+        { Material::Emission,  "HAS_EMISSION_MAP" },
+        { Material::NormalMap, "HAS_NORMAL_MAP" },
+    };
+
     void Material::Init()
     {
         glm::vec4 defaultColor(0.0f, 0.0f, 0.0f, 1.0f);
@@ -152,7 +165,7 @@ namespace Borealis
 
     Ref<Material> Material::CreateNewMaterial(std::filesystem::path const& path)
     {
-        Material material(Shader::Create("engineResources/Shaders/Renderer3D_Material.glsl"));
+        Material material(ShaderLibrary::Load(sMaterialShaderPath));
         material.SerializeMaterial(path);
         return MakeRef<Material>(material);
     }
@@ -205,107 +218,102 @@ namespace Borealis
         fout << out.c_str();
     }
 
-    void Material::SetUniforms(Ref<Shader> shader)
-	{
-		shader->Bind();
-        int textureUnit = 0;
+    // Value of a parameter, or its default when the material never set it
+    template <typename Key, typename T>
+    static T FindParameter(const std::unordered_map<Key, T>& parameters, Key key, const T& defaultValue)
+    {
+        auto it = parameters.find(key);
+        return it != parameters.end() ? it->second : defaultValue;
+    }
 
-        // Albedo Map
-        if (mTextureMaps[Albedo])
-        {
-            shader->Set("u_Material.hasAlbedoMap", true);
-            shader->Set("u_Material.albedoMap", textureUnit);
-            shader->Set("u_Material.albedoColor", mTextureMapColor[Albedo]);
-            mTextureMaps[Albedo]->Bind(textureUnit);
-            textureUnit++;
-		}
-        else
-		{
-            shader->Set("u_Material.hasAlbedoMap", false);
-            shader->Set("u_Material.albedoColor", mTextureMapColor[Albedo]);
-        }
+    Ref<Material::DrawState> Material::GetDrawState()
+    {
+        if (!mDirty && mDrawState)
+            return mDrawState;
 
-        // Specular Map
-        if (mTextureMaps[Specular])
-        {
-            shader->Set("u_Material.specularMap", textureUnit);
-            mTextureMaps[Specular]->Bind(textureUnit);
-            shader->Set("u_Material.hasSpecularMap", true);
-            textureUnit++;
-        }
-        else
-        {
-            shader->Set("u_Material.hasSpecularMap", false);
-			shader->Set("u_Material.specularColor", mTextureMapColor[Specular]);
-        }
+        // A new state rather than an update, the render thread may still be drawing with the last one
+        Ref<DrawState> state = MakeRef<DrawState>();
+        for (uint32_t map = 0; map < state->mTextureBindings.size(); ++map)
+            state->mTextureBindings[map] = FindParameter(mTextureMaps, static_cast<TextureMaps>(map), Ref<Texture2D>());
 
-        // Metallic
-        if (mTextureMaps[Metallic])
+        uint32_t features = 0;
+        for (uint32_t i = 0; i < std::size(sShaderFeatureDefines); ++i)
         {
-            shader->Set("u_Material.metallic", textureUnit);
-            mTextureMaps[DetailMask]->Bind(textureUnit);
-            shader->Set("u_Material.hasMetallicMap", true);
-            textureUnit++;
-        }
-        else
-        {
-            shader->Set("u_Material.metallic", mTextureMapFloat[Metallic]);
-            shader->Set("u_Material.hasMetallicMap", false);
+            if (state->mTextureBindings[sShaderFeatureDefines[i].first])
+                features |= 1u << i;
         }
 
-        // Emission Map
-        if (mTextureMaps[Emission])
-        {
-            shader->Set("u_Material.emissionMap", textureUnit);
-            mTextureMaps[Emission]->Bind(textureUnit);
-            shader->Set("u_Material.hasEmissionMap", true);
-            textureUnit++;
-        }
-        else
+        // The library de-duplicates variants, so this only compiles for the first material with these maps
+        if (features != mShaderFeatures || !mShader)
         {
-            shader->Set("u_Material.hasEmissionMap", false);
-            shader->Set("u_Material.emissionColor", mTextureMapColor[Emission]);
-        }
+            std::vector<std::string> defines;
+            for (uint32_t i = 0; i < std::size(sShaderFeatureDefines); ++i)
+            {
+                if (features & (1u << i))
+                    defines.push_back(sShaderFeatureDefines[i].second);
+            }
+            // Compiling a new variant needs the graphics context the render thread holds
+            RenderThread::ScopedContext context;
+            mShader = ShaderLibrary::Load(sMaterialShaderPath, defines);
+            mShaderFeatures = features;
+        }
+
+        state->mShader = mShader;
+
+        MaterialBuffer::Parameters& parameters = state->mParameters;
+        parameters.mAlbedoColor = FindParameter(mTextureMapColor, Albedo, glm::vec4(0.f));
+        parameters.mSpecularColor = FindParameter(mTextureMapColor, Specular, glm::vec4(0.f));
+        parameters.mEmissionColor = FindParameter(mTextureMapColor, Emission, glm::vec4(0.f));
+        parameters.mTiling = FindParameter(mPropertiesVec2, Tiling, glm::vec2(1.f));
+        parameters.mOffset = FindParameter(mPropertiesVec2, Offset, glm::vec2(0.f));
+        parameters.mSmoothness = FindParameter(mPropertiesFloat, Smoothness, 0.f);
+        parameters.mShininess = FindParameter(mPropertiesFloat, Shininess, 0.f);
+        parameters.mMetallic = FindParameter(mTextureMapFloat, Metallic, 0.f);
+
+        mDrawState = state;
+        mDirty = false;
+        return mDrawState;
+    }
 
-        // Normal Map
-        if (mTextureMaps[NormalMap])
-        {
-            shader->Set("u_Material.normalMap", textureUnit);
-            mTextureMaps[NormalMap]->Bind(textureUnit);
-            shader->Set("u_Material.hasNormalMap", true);
-            textureUnit++;
-        }
+    void Material::DrawState::Bind() const
+    {
+        if (!mParameterSlot.IsValid())
+            mParameterSlot.Upload(mParameters);
+        mParameterSlot.Bind();
 
-        // Height Map
-        if (mTextureMaps[HeightMap])
+        // Every map stays on the unit of its enum, so materials sharing a texture skip the rebind.
+        // Only the maps a variant can sample are bound.
+        for (auto const& [map, define] : sShaderFeatureDefines)
         {
-            shader->Set("u_Material.heightMap", textureUnit);
-            mTextureMaps[HeightMap]->Bind(textureUnit);
-            textureUnit++;
+            if (mTextureBindings[map])
+                mTextureBindings[map]->Bind(map);
         }
+    }
 
-        // Occlusion
-        if (mTextureMaps[Occlusion])
-        {
-            shader->Set("u_Material.occlusionMap", textureUnit);
-            mTextureMaps[Occlusion]->Bind(textureUnit);
-            textureUnit++;
-        }
+    void Material::SetTextureUnits(Ref<Shader> shader)
+    {
+        shader->Set("u_MaterialMaps.albedoMap", static_cast<int>(Albedo));
+        shader->Set("u_MaterialMaps.specularMap", static_cast<int>(Specular));
+        shader->Set("u_MaterialMaps.metallicMap", static_cast<int>(Metallic));
+        shader->Set("u_MaterialMaps.normalMap", static_cast<int>(NormalMap));
+        shader->Set("u_MaterialMaps.emissionMap", static_cast<int>(Emission));
+        shader->SetBlockBinding("MaterialBlock", MaterialBuffer::BindingPoint);
+    }
 
-        // Detail Mask
-        if (mTextureMaps[DetailMask])
+    void Material::DrawState::RequestTextureMips(float uvPerPixel) const
+    {
+        float tiling = std::max(std::abs(mParameters.mTiling.x), std::abs(mParameters.mTiling.y));
+        for (auto const& texture : mTextureBindings)
         {
-            shader->Set("u_Material.detailMaskMap", textureUnit);
-            mTextureMaps[DetailMask]->Bind(textureUnit);
-            textureUnit++;
-        }
+            if (!texture || texture->GetStreamingHandle() == TextureStreamer::InvalidHandle)
+                continue;
 
-        // Set other properties
-        shader->Set("u_Material.tiling", mPropertiesVec2[Tiling]);
-        shader->Set("u_Material.offset", mPropertiesVec2[Offset]);
-        shader->Set("u_Material.smoothness", mPropertiesFloat[Smoothness]);
-        shader->Set("u_Material.shininess", mPropertiesFloat[Shininess]);
-	}
+            // One mip level per doubling of texels under a pixel
+            float texelsPerPixel = uvPerPixel * tiling * static_cast<float>(std::max(texture->GetWidth(), texture->GetHeight()));
+            uint32_t mip = texelsPerPixel > 1.f ? static_cast<uint32_t>(std::log2(texelsPerPixel)) : 0;
+            TextureStreamer::RequestMip(texture->GetStreamingHandle(), mip);
+        }
+    }
 
     std::string Material::TextureMapToString(TextureMaps map)
     {
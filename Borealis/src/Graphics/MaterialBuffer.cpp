@@ -0,0 +1,139 @@
+/******************************************************************************/
+/*!
+\file		MaterialBuffer.cpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Defines the material buffer
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#include <BorealisPCH.hpp>
+#include <mutex>
+#include <vector>
+#include <glad/glad.h>
+#include <Core/MemoryTracker.hpp>
+#include <Graphics/MaterialBuffer.hpp>
+#include <Graphics/OpenGL/StateCacheOpenGLImpl.hpp>
+#include <Graphics/RendererAPI.hpp>
+
+namespace Borealis
+{
+	namespace
+	{
+		constexpr uint32_t sInitialSlots = 256;
+
+		struct MaterialBufferData
+		{
+			GLuint mBuffer = 0;
+			uint32_t mStride = 0;		//!< Size of a slot, rounded up to the offset alignment of uniform buffers
+			uint32_t mCapacity = 0;
+			uint32_t mUsed = 0;			//!< Slots handed out at least once
+			std::vector<uint32_t> mFreeSlots;
+			std::mutex mMutex;			//!< Guards the free slots, materials may be destroyed on any thread
+		};
+
+		MaterialBufferData* sData = nullptr;
+
+		// Moves the slots into a buffer twice the size
+		void Grow()
+		{
+			uint32_t capacity = sData->mCapacity * 2;
+			uint64_t oldBytes = static_cast<uint64_t>(sData->mCapacity) * sData->mStride;
+			uint64_t newBytes = static_cast<uint64_t>(capacity) * sData->mStride;
+
+			GLuint grown;
+			glGenBuffers(1, &grown);
+			OpenGLStateCache::BindBuffer(GL_COPY_WRITE_BUFFER, grown);
+			glBufferData(GL_COPY_WRITE_BUFFER, newBytes, nullptr, GL_DYNAMIC_DRAW);
+			OpenGLStateCache::BindBuffer(GL_COPY_READ_BUFFER, sData->mBuffer);
+			glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 0, oldBytes);
+			OpenGLStateCache::DeleteBuffers(1, &sData->mBuffer);
+
+			MemoryTracker::TrackGpuFree(MemoryTag::GPUBuffers, oldBytes);
+			MemoryTracker::TrackGpuAllocation(MemoryTag::GPUBuffers, newBytes);
+			sData->mBuffer = grown;
+			sData->mCapacity = capacity;
+		}
+	}
+
+	MaterialBuffer::Slot::~Slot()
+	{
+		if (!sData || mIndex == InvalidSlot)
+			return;
+
+		std::lock_guard<std::mutex> lock(sData->mMutex);
+		sData->mFreeSlots.push_back(mIndex);
+	}
+
+	void MaterialBuffer::Slot::Upload(const Parameters& parameters)
+	{
+		if (!sData)
+			return;
+
+		if (mIndex == InvalidSlot)
+		{
+			std::lock_guard<std::mutex> lock(sData->mMutex);
+			if (!sData->mFreeSlots.empty())
+			{
+				mIndex = sData->mFreeSlots.back();
+				sData->mFreeSlots.pop_back();
+			}
+			else
+			{
+				if (sData->mUsed == sData->mCapacity)
+					Grow();
+				mIndex = sData->mUsed++;
+			}
+		}
+
+		// Draws already issued with the old contents are ordered before the update by the driver
+		OpenGLStateCache::BindBuffer(GL_UNIFORM_BUFFER, sData->mBuffer);
+		glBufferSubData(GL_UNIFORM_BUFFER, static_cast<GLintptr>(mIndex) * sData->mStride, sizeof(Parameters), &parameters);
+		RendererAPI::GetStatistics().UploadBytes += sizeof(Parameters);
+	}
+
+	void MaterialBuffer::Slot::Bind() const
+	{
+		if (!sData || mIndex == InvalidSlot)
+			return;
+
+		OpenGLStateCache::BindBufferRange(GL_UNIFORM_BUFFER, BindingPoint, sData->mBuffer,
+			static_cast<int64_t>(mIndex) * sData->mStride, sizeof(Parameters));
+	}
+
+	void MaterialBuffer::Init()
+	{
+		if (RendererAPI::GetAPI() == RendererAPI::API::Null)
+			return;
+
+		sData = new MaterialBufferData();
+
+		GLint alignment = 256;
+		glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+		sData->mStride = (static_cast<uint32_t>(sizeof(Parameters)) + alignment - 1) / alignment * alignment;
+		sData->mCapacity = sInitialSlots;
+
+		uint64_t bytes = static_cast<uint64_t>(sData->mCapacity) * sData->mStride;
+		glGenBuffers(1, &sData->mBuffer);
+		OpenGLStateCache::BindBuffer(GL_UNIFORM_BUFFER, sData->mBuffer);
+		glBufferData(GL_UNIFORM_BUFFER, bytes, nullptr, GL_DYNAMIC_DRAW);
+		MemoryTracker::TrackGpuAllocation(MemoryTag::GPUBuffers, bytes);
+	}
+
+	void MaterialBuffer::Free()
+	{
+		if (!sData)
+			return;
+
+		MemoryTracker::TrackGpuFree(MemoryTag::GPUBuffers, static_cast<uint64_t>(sData->mCapacity) * sData->mStride);
+		OpenGLStateCache::DeleteBuffers(1, &sData->mBuffer);
+
+		delete sData;
+		sData = nullptr;
+	}
+}
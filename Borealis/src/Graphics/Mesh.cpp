@@ -14,6 +14,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 
 #include <BorealisPCH.hpp>
 #include <Graphics/Mesh.hpp>
+#include <Graphics/RendererAPI.hpp>
 #include <Core/LoggerSystem.hpp>
 
 #include <Graphics/OpenGL/TextureOpenGLImpl.hpp>
@@ -108,49 +109,73 @@ namespace Borealis
 
 	void Mesh::SetupMesh()
 	{
-		glGenVertexArrays(1, &VAO);
-		glGenBuffers(1, &VBO);
-		glGenBuffers(1, &EBO);
-
-		glBindVertexArray(VAO);
-		glBindBuffer(GL_ARRAY_BUFFER, VBO);
-
-		glBufferData(GL_ARRAY_BUFFER, mVertices.size() * sizeof(Vertex), &mVertices[0], GL_STATIC_DRAW);
-
-		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
-		glBufferData(GL_ELEMENT_ARRAY_BUFFER, mIndices.size() * sizeof(unsigned int),
-			&mIndices[0], GL_STATIC_DRAW);
-
-		// vertex positions
-		glEnableVertexAttribArray(0);
-		glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)0);
-		// vertex normals
-		glEnableVertexAttribArray(1);
-		glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, Normal));
-		// vertex texture coords
-		glEnableVertexAttribArray(2);
-		glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, TexCoords));
-		// Tangents
-		glEnableVertexAttribArray(3);
-		glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(VertexData, Tangent));
-		// Bitangents
-		glEnableVertexAttribArray(4);
-		glVertexAttribPointer(4, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(VertexData, Bitangent));
-
-		// Unbind VAO
-		glBindVertexArray(0);
+		// Every LOD lives in the index range of the mesh, after the full mesh
+		mLodRanges.clear();
+		mLodRanges.push_back({ 0, static_cast<uint32_t>(mIndices.size()) });
+		for (std::vector<unsigned int> const& lod : mLodIndices)
+			mLodRanges.push_back({ mLodRanges.back().mFirstIndex + mLodRanges.back().mIndexCount, static_cast<uint32_t>(lod.size()) });
+
+		ComputeBounds();
+
+		// Headless runs keep the CPU side data only
+		if (RendererAPI::GetAPI() == RendererAPI::API::Null)
+			return;
+
+		std::vector<uint32_t> indices;
+		indices.reserve(mLodRanges.back().mFirstIndex + mLodRanges.back().mIndexCount);
+		indices.insert(indices.end(), mIndices.begin(), mIndices.end());
+		for (std::vector<unsigned int> const& lod : mLodIndices)
+			indices.insert(indices.end(), lod.begin(), lod.end());
+
+		mGeometry = GeometryPool::Allocate(GeometryPool::VertexFormat::Static, mVertices.data(), static_cast<uint32_t>(mVertices.size()),
+			indices.data(), static_cast<uint32_t>(indices.size()));
+
+		if (mGeometry && !mCpuAccess)
+		{
+			std::vector<Vertex>().swap(mVertices);
+			std::vector<unsigned int>().swap(mIndices);
+			std::vector<std::vector<unsigned int>>().swap(mLodIndices);
+		}
 	}
 
-	void Mesh::Draw(const glm::mat4& transform, Ref<Shader> shader, int entityID)
+	GeometryPool::DrawCommand Mesh::GetDrawCommand(uint32_t lod, uint32_t baseInstance) const
 	{
-		shader->Bind();
+		if (mLodRanges.empty())
+			return { 0, 0, 0, 0, baseInstance };
+
+		LodRange const& range = mLodRanges[std::min<size_t>(lod, mLodRanges.size() - 1)];
+
+		// Headless runs have no geometry, the count alone is kept for the statistics
+		if (!mGeometry)
+		{
+			if (RendererAPI::GetAPI() == RendererAPI::API::Null)
+				return { range.mIndexCount, 1, range.mFirstIndex, 0, baseInstance };
+			return { 0, 0, 0, 0, baseInstance };
+		}
 
-		shader->Set("u_ModelTransform", transform);
-		shader->Set("u_EntityID", entityID);
+		return { range.mIndexCount, 1, mGeometry->GetFirstIndex() + range.mFirstIndex, static_cast<int32_t>(mGeometry->GetBaseVertex()), baseInstance };
+	}
 
-		glBindVertexArray(VAO);
-		glDrawElements(GL_TRIANGLES, (int)mIndices.size(), GL_UNSIGNED_INT, 0);
-		glBindVertexArray(0);
+	void Mesh::ComputeBounds()
+	{
+		mBoundsMin = glm::vec3(std::numeric_limits<float>::max());
+		mBoundsMax = glm::vec3(std::numeric_limits<float>::lowest());
+		mSurfaceArea = mUVArea = 0.f;
+		for (const Vertex& vertex : mVertices)
+		{
+			mBoundsMin = glm::min(mBoundsMin, vertex.Position);
+			mBoundsMax = glm::max(mBoundsMax, vertex.Position);
+		}
+
+		for (size_t i = 0; i + 2 < mIndices.size(); i += 3)
+		{
+			const Vertex& a = mVertices[mIndices[i]];
+			const Vertex& b = mVertices[mIndices[i + 1]];
+			const Vertex& c = mVertices[mIndices[i + 2]];
+			mSurfaceArea += 0.5f * glm::length(glm::cross(b.Position - a.Position, c.Position - a.Position));
+			glm::vec2 u = b.TexCoords - a.TexCoords, v = c.TexCoords - a.TexCoords;
+			mUVArea += 0.5f * std::abs(u.x * v.y - u.y * v.x);
+		}
 	}
 
 	std::vector<unsigned int> const& Mesh::GetIndices() const
@@ -14,23 +14,49 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 
 #include <BorealisPCH.hpp>
 #include <Graphics/Model.hpp>
+#include <Core/MemoryTracker.hpp>
 
 namespace Borealis
 {
-	void Model::Draw(const glm::mat4& transform, Ref<Shader> shader, int entityID)
+	static constexpr uint32_t sMeshFileMagic = 0x48534D42; // "BMSH"
+	static constexpr float sLodPixelError = 1.f; // Screen space error a level may have, in pixels
+	static constexpr float sLodReferenceHeight = 1080.f; // Screen height the pixel error is measured at
+	static constexpr float sLodHysteresis = 0.1f;
+
+	void Model::AppendDrawCommands(uint32_t lod, uint32_t baseInstance, std::vector<GeometryPool::DrawCommand>& commands) const
 	{
-		for (auto mesh : mMeshes)
+		for (const Mesh& mesh : mMeshes)
 		{
-			mesh.Draw(transform, shader, entityID);
+			GeometryPool::DrawCommand command = mesh.GetDrawCommand(lod, baseInstance);
+			if (command.mCount > 0)
+				commands.push_back(command);
 		}
 	}
 
 	void Model::LoadModel(std::filesystem::path const& path)
 	{
+		ReadModel(path);
+		SetupMeshes();
+	}
+
+	void Model::ReadModel(std::filesystem::path const& path)
+	{
+		MemoryTagScope memoryTag(MemoryTag::Meshes);
 		std::ifstream inFile(path, std::ios::binary);
 
-		uint32_t meshCount;
+		// Meshes imported before levels of detail start with the mesh count
+		uint32_t meshCount, lodCount = 1;
 		inFile.read(reinterpret_cast<char*>(&meshCount), sizeof(meshCount));
+		mLodErrors = { 0.f };
+		if (meshCount == sMeshFileMagic)
+		{
+			uint32_t version;
+			inFile.read(reinterpret_cast<char*>(&version), sizeof(version));
+			inFile.read(reinterpret_cast<char*>(&meshCount), sizeof(meshCount));
+			inFile.read(reinterpret_cast<char*>(&lodCount), sizeof(lodCount));
+			mLodErrors.resize(std::max(lodCount, 1u));
+			inFile.read(reinterpret_cast<char*>(mLodErrors.data()), lodCount * sizeof(float));
+		}
 
 		mMeshes.resize(meshCount);
 
@@ -50,12 +76,84 @@ namespace Borealis
 
 			inFile.read(reinterpret_cast<char*>(mesh.GetIndices().data()), indicesCount * sizeof(uint32_t));
 
-			mesh.SetupMesh();
+			mesh.GetLodIndices().resize(lodCount > 1 ? lodCount - 1 : 0);
+			for (std::vector<unsigned int>& lod : mesh.GetLodIndices())
+			{
+				uint32_t lodIndicesCount;
+				inFile.read(reinterpret_cast<char*>(&lodIndicesCount), sizeof(lodIndicesCount));
+				lod.resize(lodIndicesCount);
+				inFile.read(reinterpret_cast<char*>(lod.data()), lodIndicesCount * sizeof(uint32_t));
+			}
 		}
 
 		inFile.close();
 	}
 
+	void Model::SetupMeshes()
+	{
+		MemoryTagScope memoryTag(MemoryTag::Meshes);
+		for (Mesh& mesh : mMeshes)
+			mesh.SetupMesh();
+
+		ComputeBounds();
+	}
+
+	uint32_t Model::SelectLod(float screenSize, uint32_t currentLod) const
+	{
+		uint32_t lod = std::min(currentLod, GetLodCount() - 1);
+		while (lod > 0 && screenSize >= mLodScreenSizes[lod])
+			--lod;
+		while (lod + 1 < GetLodCount() && screenSize < mLodScreenSizes[lod + 1] * (1.f - sLodHysteresis))
+			++lod;
+		return lod;
+	}
+
+	void Model::ComputeLodScreenSizes()
+	{
+		// A level deviating by e model units is under a pixel once the sphere of
+		// radius r covers less than 2r * pixel / (e * height) of the screen
+		mLodScreenSizes.assign(std::max<size_t>(mLodErrors.size(), 1), std::numeric_limits<float>::max());
+		for (size_t lod = 1; lod < mLodErrors.size(); ++lod)
+		{
+			if (mLodErrors[lod] > 0.f)
+				mLodScreenSizes[lod] = 2.f * mBoundsRadius * sLodPixelError / (mLodErrors[lod] * sLodReferenceHeight);
+			// Coarser levels must switch in at smaller sizes
+			mLodScreenSizes[lod] = std::min(mLodScreenSizes[lod], mLodScreenSizes[lod - 1]);
+		}
+	}
+
+	void Model::ComputeBounds()
+	{
+		// The meshes measured themselves in SetupMesh, their vertices may be gone by now
+		glm::vec3 min(std::numeric_limits<float>::max());
+		glm::vec3 max(std::numeric_limits<float>::lowest());
+		float worldArea = 0.f, uvArea = 0.f;
+		for (const Mesh& mesh : mMeshes)
+		{
+			min = glm::min(min, mesh.GetBoundsMin());
+			max = glm::max(max, mesh.GetBoundsMax());
+			worldArea += mesh.GetSurfaceArea();
+			uvArea += mesh.GetUVArea();
+		}
+
+		if (min.x > max.x)
+		{
+			ComputeLodScreenSizes();
+			return;
+		}
+
+		mBoundsCenter = (min + max) * 0.5f;
+		mBoundsRadius = glm::length(max - mBoundsCenter);
+
+		// Without UVs assume the texture is stretched across the model once
+		if (worldArea > 0.f && uvArea > 0.f)
+			mUVDensity = std::sqrt(uvArea / worldArea);
+		else if (mBoundsRadius > 0.f)
+			mUVDensity = 0.5f / mBoundsRadius;
+
+		ComputeLodScreenSizes();
+	}
+
 	void Model::SaveModel()
 	{
 		std::ofstream outFile("model.mesh", std::ios::binary);
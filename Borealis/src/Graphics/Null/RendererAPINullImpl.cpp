@@ -0,0 +1,80 @@
+/******************************************************************************/
+/*!
+\file		RendererAPINullImpl.cpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Defines the Null Renderer API
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#include <BorealisPCH.hpp>
+#include <Graphics/Null/RendererAPINullImpl.hpp>
+
+namespace Borealis
+{
+	std::atomic<uint64_t> NullRendererAPI::sDrawCalls = 0;
+	std::atomic<uint64_t> NullRendererAPI::sIndices = 0;
+	std::atomic<uint64_t> NullRendererAPI::sVertices = 0;
+	std::atomic<uint64_t> NullRendererAPI::sInstances = 0;
+	std::atomic<uint64_t> NullRendererAPI::sClears = 0;
+
+	void NullRendererAPI::Clear()
+	{
+		sClears.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	void NullRendererAPI::DrawElements(const Ref<VertexArray>& VAO, uint32_t indexCount, uint32_t baseVertex)
+	{
+		uint32_t count = indexCount;
+		if (count == 0 && VAO->GetElementBuffer())
+			count = VAO->GetElementBuffer()->GetCount();
+
+		sDrawCalls.fetch_add(1, std::memory_order_relaxed);
+		sIndices.fetch_add(count, std::memory_order_relaxed);
+	}
+
+	void NullRendererAPI::DrawLines(const Ref<VertexArray>& VAO, uint32_t vertexCount, uint32_t firstVertex)
+	{
+		sDrawCalls.fetch_add(1, std::memory_order_relaxed);
+		sVertices.fetch_add(vertexCount, std::memory_order_relaxed);
+	}
+
+	void NullRendererAPI::DrawInstanced(const Ref<VertexArray>& VAO, uint32_t vertexCount, uint32_t instanceCount, uint32_t baseInstance)
+	{
+		sDrawCalls.fetch_add(1, std::memory_order_relaxed);
+		sVertices.fetch_add(static_cast<uint64_t>(vertexCount) * instanceCount, std::memory_order_relaxed);
+		sInstances.fetch_add(instanceCount, std::memory_order_relaxed);
+	}
+
+	void NullRendererAPI::DrawMultiIndirect(uint64_t indexCount, uint64_t instanceCount)
+	{
+		sDrawCalls.fetch_add(1, std::memory_order_relaxed);
+		sIndices.fetch_add(indexCount, std::memory_order_relaxed);
+		sInstances.fetch_add(instanceCount, std::memory_order_relaxed);
+	}
+
+	NullRendererAPI::Statistics NullRendererAPI::GetStatistics()
+	{
+		Statistics stats;
+		stats.DrawCalls = sDrawCalls.load(std::memory_order_relaxed);
+		stats.Indices = sIndices.load(std::memory_order_relaxed);
+		stats.Vertices = sVertices.load(std::memory_order_relaxed);
+		stats.Instances = sInstances.load(std::memory_order_relaxed);
+		stats.Clears = sClears.load(std::memory_order_relaxed);
+		return stats;
+	}
+
+	void NullRendererAPI::ResetStatistics()
+	{
+		sDrawCalls = 0;
+		sIndices = 0;
+		sVertices = 0;
+		sInstances = 0;
+		sClears = 0;
+	}
+}
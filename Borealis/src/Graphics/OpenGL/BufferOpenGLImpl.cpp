@@ -16,49 +16,57 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <BorealisPCH.hpp>
 #include <glad/glad.h>
 #include <Graphics/OpenGL/BufferOpenGLImpl.hpp>
+#include <Graphics/OpenGL/StateCacheOpenGLImpl.hpp>
+#include <Graphics/RendererAPI.hpp>
+#include <Core/MemoryTracker.hpp>
+#include <Graphics/RenderThread.hpp>
 
 namespace Borealis
 {
-	OpenGLVertexBuffer::OpenGLVertexBuffer(uint32_t size)
+	OpenGLVertexBuffer::OpenGLVertexBuffer(uint32_t size) : mSize(size)
 	{
 		PROFILE_FUNCTION();
 
 		glGenBuffers(1, &mRendererID);
-		glBindBuffer(GL_ARRAY_BUFFER, mRendererID);
+		OpenGLStateCache::BindBuffer(GL_ARRAY_BUFFER, mRendererID);
 		glBufferData(GL_ARRAY_BUFFER, size, nullptr, GL_DYNAMIC_DRAW);
+		MemoryTracker::TrackGpuAllocation(MemoryTag::GPUBuffers, mSize);
 	}
 
-	OpenGLVertexBuffer::OpenGLVertexBuffer(float* vertices, uint32_t size)
+	OpenGLVertexBuffer::OpenGLVertexBuffer(float* vertices, uint32_t size) : mSize(size)
 	{
 		PROFILE_FUNCTION();
 
 		glGenBuffers(1, &mRendererID);
-		glBindBuffer(GL_ARRAY_BUFFER, mRendererID);
+		OpenGLStateCache::BindBuffer(GL_ARRAY_BUFFER, mRendererID);
 		glBufferData(GL_ARRAY_BUFFER, size, vertices, GL_STATIC_DRAW);
+		MemoryTracker::TrackGpuAllocation(MemoryTag::GPUBuffers, mSize);
 	}
 
 	OpenGLVertexBuffer::~OpenGLVertexBuffer()
 	{
 		PROFILE_FUNCTION();
 
-		glDeleteBuffers(1, &mRendererID);
+		MemoryTracker::TrackGpuFree(MemoryTag::GPUBuffers, mSize);
+		RenderThread::Submit([id = mRendererID]() { OpenGLStateCache::DeleteBuffers(1, &id); });
 	}
 	void OpenGLVertexBuffer::SetData(const void* data, uint32_t size)
 	{
-		glBindBuffer(GL_ARRAY_BUFFER, mRendererID);
+		OpenGLStateCache::BindBuffer(GL_ARRAY_BUFFER, mRendererID);
 		glBufferSubData(GL_ARRAY_BUFFER, 0, size, data);
+		RendererAPI::GetStatistics().UploadBytes += size;
 	}
 	void OpenGLVertexBuffer::Bind() const
 	{
 		PROFILE_FUNCTION();
 
-		glBindBuffer(GL_ARRAY_BUFFER, mRendererID);
+		OpenGLStateCache::BindBuffer(GL_ARRAY_BUFFER, mRendererID);
 	}
 	void OpenGLVertexBuffer::Unbind() const
 	{
 		PROFILE_FUNCTION();
 
-		glBindBuffer(GL_ARRAY_BUFFER, 0);
+		OpenGLStateCache::BindBuffer(GL_ARRAY_BUFFER, 0);
 	}
 
 
@@ -71,25 +79,28 @@ namespace Borealis
 		PROFILE_FUNCTION();
 
 		glGenBuffers(1, &mRendererID);
-		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mRendererID);
-		glBufferData(GL_ELEMENT_ARRAY_BUFFER, count * sizeof(uint32_t), indices, GL_STATIC_DRAW);
+		// Filled outside a vertex array so the element binding of whichever one is bound is left alone
+		OpenGLStateCache::BindBuffer(GL_COPY_WRITE_BUFFER, mRendererID);
+		glBufferData(GL_COPY_WRITE_BUFFER, count * sizeof(uint32_t), indices, GL_STATIC_DRAW);
+		MemoryTracker::TrackGpuAllocation(MemoryTag::GPUBuffers, count * sizeof(uint32_t));
 	}
 	OpenGLElementBuffer::~OpenGLElementBuffer()
 	{
 		PROFILE_FUNCTION();
 
-		glDeleteBuffers(1, &mRendererID);
+		MemoryTracker::TrackGpuFree(MemoryTag::GPUBuffers, mCount * sizeof(uint32_t));
+		RenderThread::Submit([id = mRendererID]() { OpenGLStateCache::DeleteBuffers(1, &id); });
 	}
 	void OpenGLElementBuffer::Bind() const
 	{
 		PROFILE_FUNCTION();
 
-		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mRendererID);
+		OpenGLStateCache::BindBuffer(GL_ELEMENT_ARRAY_BUFFER, mRendererID);
 	}
 	void OpenGLElementBuffer::Unbind() const
 	{
 		PROFILE_FUNCTION();
 
-		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+		OpenGLStateCache::BindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 	}
 }
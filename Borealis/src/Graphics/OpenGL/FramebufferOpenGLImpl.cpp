@@ -14,9 +14,12 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <BorealisPCH.hpp>
 #include <glad/glad.h>
 #include <Graphics/OpenGL/FramebufferOpenGLImpl.hpp>
+#include <Graphics/OpenGL/StateCacheOpenGLImpl.hpp>
 #include <Core/Core.hpp>
 #include <Core/LoggerSystem.hpp>
 #include <Core/Utils.hpp>
+#include <Graphics/RendererAPI.hpp>
+#include <Graphics/RenderThread.hpp>
 namespace Borealis
 {
 
@@ -39,18 +42,21 @@ namespace Borealis
 	}
 	OpenGLFrameBuffer::~OpenGLFrameBuffer()
 	{
-		glDeleteFramebuffers(1, &mRendererID);
-		glDeleteTextures(1, &mDepthAttachment);
-		glDeleteTextures((GLsizei)mColorAttachments.size(), mColorAttachments.data());
+		RenderThread::Submit([id = mRendererID, depth = mDepthAttachment, colors = mColorAttachments]()
+			{
+				OpenGLStateCache::DeleteFramebuffers(1, &id);
+				OpenGLStateCache::DeleteTextures(1, &depth);
+				OpenGLStateCache::DeleteTextures((int32_t)colors.size(), colors.data());
+			});
 	}
 	void OpenGLFrameBuffer::Bind()
 	{
-		glBindFramebuffer(GL_FRAMEBUFFER, mRendererID);
+		OpenGLStateCache::BindFramebuffer(GL_FRAMEBUFFER, mRendererID);
 		glViewport(0, 0, mProps.Width, mProps.Height);
 	}
 	void OpenGLFrameBuffer::Unbind()
 	{
-		glBindFramebuffer(GL_FRAMEBUFFER, 0);
+		OpenGLStateCache::BindFramebuffer(GL_FRAMEBUFFER, 0);
 	}
 	void OpenGLFrameBuffer::Resize(uint32_t width, uint32_t height)
 	{
@@ -65,7 +71,7 @@ namespace Borealis
 	}
 	int OpenGLFrameBuffer::ReadPixel(uint32_t attachmentIndex, int x, int y)
 	{
-		glBindFramebuffer(GL_FRAMEBUFFER, mRendererID);
+		OpenGLStateCache::BindFramebuffer(GL_FRAMEBUFFER, mRendererID);
 		glReadBuffer(GL_COLOR_ATTACHMENT0 + attachmentIndex);
 		int pixelData;
 		glReadPixels(x, y, 1, 1, GL_RED_INTEGER, GL_INT, &pixelData);
@@ -74,22 +80,22 @@ namespace Borealis
 
 	void OpenGLFrameBuffer::ClearAttachment(uint32_t attachmentIndex, int value)
 	{
-		glBindFramebuffer(GL_FRAMEBUFFER, mRendererID);
+		OpenGLStateCache::BindFramebuffer(GL_FRAMEBUFFER, mRendererID);
 		glClearBufferiv(GL_COLOR, attachmentIndex, &value);
 	}
 	void OpenGLFrameBuffer::Recreate()
 	{
 		if (mRendererID)
 		{
-			glDeleteFramebuffers(1, &mRendererID);
-			glDeleteTextures(1, &mDepthAttachment);
-			glDeleteTextures((GLsizei)mColorAttachments.size(), mColorAttachments.data());
+			OpenGLStateCache::DeleteFramebuffers(1, &mRendererID);
+			OpenGLStateCache::DeleteTextures(1, &mDepthAttachment);
+			OpenGLStateCache::DeleteTextures((int32_t)mColorAttachments.size(), mColorAttachments.data());
 			mColorAttachments.clear();
 			mDepthAttachment = 0;
 		}
 
 		glGenFramebuffers(1, &mRendererID);
-		glBindFramebuffer(GL_FRAMEBUFFER, mRendererID);
+		OpenGLStateCache::BindFramebuffer(GL_FRAMEBUFFER, mRendererID);
 		
 		bool multisample = mProps.Samples > 1;
 
@@ -140,7 +146,7 @@ namespace Borealis
 		}
 
 		BOREALIS_CORE_ASSERT(glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE, "Framebuffer is incomplete!");
-		glBindFramebuffer(GL_FRAMEBUFFER, 0);
+		OpenGLStateCache::BindFramebuffer(GL_FRAMEBUFFER, 0);
 
 	}
 }
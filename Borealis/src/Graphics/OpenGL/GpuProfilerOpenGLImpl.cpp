@@ -0,0 +1,133 @@
+/******************************************************************************/
+/*!
+\file		GpuProfilerOpenGLImpl.cpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Defines the OpenGL GPU profiler
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#include <BorealisPCH.hpp>
+#include <Core/FrameAllocator.hpp>
+#include <Graphics/OpenGL/GpuProfilerOpenGLImpl.hpp>
+#include <Debugging/FrameProfiler.hpp>
+
+namespace Borealis
+{
+	static constexpr uint32_t sDroppedZone = UINT32_MAX;
+
+	OpenGLGpuProfiler::OpenGLGpuProfiler(uint32_t framesInFlight) : mFrames(std::max(framesInFlight, 2u))
+	{
+	}
+
+	OpenGLGpuProfiler::~OpenGLGpuProfiler()
+	{
+		for (Frame& frame : mFrames)
+		{
+			if (!frame.mQueries.empty())
+				glDeleteQueries(static_cast<GLsizei>(frame.mQueries.size()), frame.mQueries.data());
+		}
+	}
+
+	void OpenGLGpuProfiler::Begin(const char* name)
+	{
+		Frame& frame = mFrames[mCurrent];
+		if (frame.mDropped)
+		{
+			mOpenZones.push_back(sDroppedZone);
+			return;
+		}
+
+		uint32_t query = WriteTimestamp(frame);
+		frame.mZones.push_back({ name, query, query, static_cast<uint32_t>(mOpenZones.size()) });
+		mOpenZones.push_back(static_cast<uint32_t>(frame.mZones.size() - 1));
+	}
+
+	void OpenGLGpuProfiler::End()
+	{
+		if (mOpenZones.empty())
+			return;
+
+		uint32_t zone = mOpenZones.back();
+		mOpenZones.pop_back();
+		if (zone == sDroppedZone)
+			return;
+
+		Frame& frame = mFrames[mCurrent];
+		frame.mZones[zone].mEndQuery = WriteTimestamp(frame);
+	}
+
+	void OpenGLGpuProfiler::EndFrame()
+	{
+		// Close anything left open so the zones never span frames
+		while (!mOpenZones.empty())
+			End();
+
+		Frame& frame = mFrames[mCurrent];
+		if (!frame.mDropped)
+			frame.mPending = !frame.mZones.empty();
+
+		// Oldest first, so results reach the frame profiler in order
+		for (uint32_t i = 1; i <= mFrames.size(); ++i)
+			Resolve(mFrames[(mCurrent + i) % mFrames.size()]);
+
+		++mFrameIndex;
+		mCurrent = (mCurrent + 1) % mFrames.size();
+		Frame& next = mFrames[mCurrent];
+		next.mDropped = !Resolve(next);	// Still in flight, skip timing this frame rather than stall on the readback
+		if (!next.mDropped)
+		{
+			next.mIndex = mFrameIndex;
+			next.mUsed = 0;
+			next.mZones.clear();
+		}
+	}
+
+	uint32_t OpenGLGpuProfiler::WriteTimestamp(Frame& frame)
+	{
+		if (frame.mUsed == frame.mQueries.size())
+		{
+			GLuint query;
+			glGenQueries(1, &query);
+			frame.mQueries.push_back(query);
+		}
+
+		glQueryCounter(frame.mQueries[frame.mUsed], GL_TIMESTAMP);
+		return frame.mUsed++;
+	}
+
+	bool OpenGLGpuProfiler::Resolve(Frame& frame)
+	{
+		if (!frame.mPending)
+			return true;
+
+		// Queries complete in order, so the last one being ready means they all are
+		GLint available = 0;
+		glGetQueryObjectiv(frame.mQueries[frame.mUsed - 1], GL_QUERY_RESULT_AVAILABLE, &available);
+		if (!available)
+			return false;
+
+		ScratchScope scratch;
+		ScratchVector<GLuint64> timestamps(frame.mUsed);
+		for (uint32_t i = 0; i < frame.mUsed; ++i)
+			glGetQueryObjectui64v(frame.mQueries[i], GL_QUERY_RESULT, &timestamps[i]);
+
+		GLuint64 origin = timestamps[frame.mZones.front().mBeginQuery];
+		for (const Zone& zone : frame.mZones)
+		{
+			ProfileZoneRecord record{ zone.mName,
+				static_cast<int64_t>(timestamps[zone.mBeginQuery] - origin),
+				static_cast<int64_t>(timestamps[zone.mEndQuery] - origin),
+				0, zone.mDepth };
+			FrameProfiler::RecordGpuZone(frame.mIndex, record);
+		}
+
+		frame.mPending = false;
+		return true;
+	}
+}
@@ -51,4 +51,14 @@ namespace Borealis
 		PROFILE_FUNCTION();
 		glfwSwapBuffers(mWindowHandle);
 	}
+
+	void OpenGLContext::MakeCurrent()
+	{
+		glfwMakeContextCurrent(mWindowHandle);
+	}
+
+	void OpenGLContext::DetachCurrent()
+	{
+		glfwMakeContextCurrent(nullptr);
+	}
 }
\ No newline at end of file
@@ -0,0 +1,194 @@
+/******************************************************************************/
+/*!
+\file		PickingServiceOpenGLImpl.cpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Defines the OpenGL picking service
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#include <BorealisPCH.hpp>
+#include <Graphics/OpenGL/PickingServiceOpenGLImpl.hpp>
+#include <Graphics/OpenGL/StateCacheOpenGLImpl.hpp>
+#include <Graphics/RenderThread.hpp>
+
+namespace Borealis
+{
+	OpenGLPickingService::OpenGLPickingService(uint32_t ringSize) : mState(MakeRef<State>())
+	{
+		RenderThread::Submit([state = mState, ringSize]()
+			{
+				state->mSlots.resize(ringSize);
+				for (Slot& slot : state->mSlots)
+				{
+					glGenBuffers(1, &slot.mBuffer);
+				}
+			});
+	}
+
+	OpenGLPickingService::~OpenGLPickingService()
+	{
+		RenderThread::Submit([state = mState]()
+			{
+				for (Slot& slot : state->mSlots)
+				{
+					if (slot.mFence)
+						glDeleteSync(slot.mFence);
+					OpenGLStateCache::DeleteBuffers(1, &slot.mBuffer);
+				}
+				state->mSlots.clear();
+			});
+	}
+
+	void OpenGLPickingService::QueryPixel(const Ref<FrameBuffer>& frameBuffer, uint32_t attachmentIndex, int x, int y)
+	{
+		RenderThread::Submit([state = mState, frameBuffer, attachmentIndex, x, y]()
+			{
+				Issue(*state, frameBuffer, attachmentIndex, QueryType::Pixel, x, y, 1, 1);
+			});
+	}
+
+	void OpenGLPickingService::QueryRect(const Ref<FrameBuffer>& frameBuffer, uint32_t attachmentIndex, int x0, int y0, int x1, int y1)
+	{
+		int x = std::min(x0, x1);
+		int y = std::min(y0, y1);
+		int width = std::abs(x1 - x0) + 1;
+		int height = std::abs(y1 - y0) + 1;
+		RenderThread::Submit([state = mState, frameBuffer, attachmentIndex, x, y, width, height]()
+			{
+				Issue(*state, frameBuffer, attachmentIndex, QueryType::Rect, x, y, width, height);
+			});
+	}
+
+	void OpenGLPickingService::Update()
+	{
+		RenderThread::Submit([state = mState]()
+			{
+				for (Slot& slot : state->mSlots)
+				{
+					Collect(*state, slot);
+				}
+			});
+	}
+
+	bool OpenGLPickingService::PollPixel(int& value)
+	{
+		std::lock_guard<std::mutex> lock(mState->mMutex);
+		if (!mState->mPixelReady)
+			return false;
+
+		value = mState->mPixel;
+		mState->mPixelReady = false;
+		return true;
+	}
+
+	bool OpenGLPickingService::PollRect(std::vector<int>& values)
+	{
+		std::lock_guard<std::mutex> lock(mState->mMutex);
+		if (!mState->mRectReady)
+			return false;
+
+		values.swap(mState->mRect);
+		mState->mRectReady = false;
+		return true;
+	}
+
+	void OpenGLPickingService::Issue(State& state, const Ref<FrameBuffer>& frameBuffer, uint32_t attachmentIndex, QueryType type, int x, int y, int width, int height)
+	{
+		PROFILE_FUNCTION();
+
+		if (state.mSlots.empty())
+			return;
+
+		// Clamp to the Frame Buffer, a hover outside the viewport reads nothing
+		const FrameBufferProperties& props = frameBuffer->GetProperties();
+		int x1 = std::min(x + width, static_cast<int>(props.Width));
+		int y1 = std::min(y + height, static_cast<int>(props.Height));
+		x = std::max(x, 0);
+		y = std::max(y, 0);
+		if (x >= x1 || y >= y1)
+			return;
+		width = x1 - x;
+		height = y1 - y;
+
+		// Still in flight, drop the read rather than wait. The next query will catch up.
+		Slot& slot = state.mSlots[state.mNext];
+		if (!Collect(state, slot))
+			return;
+		state.mNext = (state.mNext + 1) % state.mSlots.size();
+
+		uint32_t size = static_cast<uint32_t>(width * height) * sizeof(int);
+		OpenGLStateCache::BindBuffer(GL_PIXEL_PACK_BUFFER, slot.mBuffer);
+		if (size > slot.mCapacity)
+		{
+			glBufferData(GL_PIXEL_PACK_BUFFER, size, nullptr, GL_STREAM_READ);
+			slot.mCapacity = size;
+		}
+
+		GLuint previousFrameBuffer = OpenGLStateCache::GetFramebuffer(GL_READ_FRAMEBUFFER);
+		OpenGLStateCache::BindFramebuffer(GL_READ_FRAMEBUFFER, frameBuffer->GetRendererID());
+		glReadBuffer(GL_COLOR_ATTACHMENT0 + attachmentIndex);
+		glReadPixels(x, y, width, height, GL_RED_INTEGER, GL_INT, nullptr);
+		OpenGLStateCache::BindFramebuffer(GL_READ_FRAMEBUFFER, previousFrameBuffer);
+		OpenGLStateCache::BindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+		slot.mFence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		slot.mType = type;
+		slot.mCount = static_cast<uint32_t>(width * height);
+		slot.mSequence = ++state.mSequence;
+	}
+
+	bool OpenGLPickingService::Collect(State& state, Slot& slot)
+	{
+		if (!slot.mFence)
+			return true;
+
+		GLenum status = glClientWaitSync(slot.mFence, 0, 0);
+		if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED)
+			return false;
+
+		PROFILE_FUNCTION();
+
+		glDeleteSync(slot.mFence);
+		slot.mFence = nullptr;
+
+		OpenGLStateCache::BindBuffer(GL_PIXEL_PACK_BUFFER, slot.mBuffer);
+		const int* pixels = static_cast<const int*>(glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, slot.mCount * sizeof(int), GL_MAP_READ_BIT));
+		if (pixels)
+		{
+			if (slot.mType == QueryType::Pixel)
+			{
+				std::lock_guard<std::mutex> lock(state.mMutex);
+				if (slot.mSequence > state.mPixelSequence)
+				{
+					state.mPixel = pixels[0];
+					state.mPixelSequence = slot.mSequence;
+					state.mPixelReady = true;
+				}
+			}
+			else
+			{
+				std::vector<int> values(pixels, pixels + slot.mCount);
+				std::sort(values.begin(), values.end());
+				values.erase(std::unique(values.begin(), values.end()), values.end());
+				values.erase(std::remove(values.begin(), values.end(), -1), values.end());
+
+				std::lock_guard<std::mutex> lock(state.mMutex);
+				if (slot.mSequence > state.mRectSequence)
+				{
+					state.mRect = std::move(values);
+					state.mRectSequence = slot.mSequence;
+					state.mRectReady = true;
+				}
+			}
+			glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+		}
+		OpenGLStateCache::BindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+		return true;
+	}
+}
@@ -15,16 +15,20 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <BorealisPCH.hpp>
 #include <glad/glad.h>
 #include "Graphics/OpenGL/RendererAPIOpenGLImpl.hpp"
+#include "Graphics/OpenGL/VertexArrayOpenGLImpl.hpp"
+#include "Graphics/OpenGL/StateCacheOpenGLImpl.hpp"
 namespace Borealis
 {
 	void OpenGLRendererAPI::Init()
 	{
 		PROFILE_FUNCTION();
 
-		glEnable(GL_BLEND);
-		glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-		glEnable(GL_DEPTH_TEST);
-		glEnable(GL_LINE_SMOOTH);
+		// Whatever ran on the context before has left its state unknown
+		OpenGLStateCache::Reset();
+		OpenGLStateCache::SetCapability(GL_BLEND, true);
+		OpenGLStateCache::BlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+		OpenGLStateCache::SetCapability(GL_DEPTH_TEST, true);
+		OpenGLStateCache::SetCapability(GL_LINE_SMOOTH, true);
 	}
 	void OpenGLRendererAPI::Clear()
 	{
@@ -38,22 +42,55 @@ namespace Borealis
 	{
 		glClearColor(color.r, color.g, color.b, color.a);
 	}
-	void OpenGLRendererAPI::DrawElements(const Ref<VertexArray>& VAO, uint32_t count)
+	void OpenGLRendererAPI::DrawElements(const Ref<VertexArray>& VAO, uint32_t count, uint32_t baseVertex)
 	{
 		VAO->Bind();
 		uint32_t indexCount = count ? count : VAO->GetElementBuffer()->GetCount();
-		glDrawElements(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, nullptr);
+		if (baseVertex)
+			glDrawElementsBaseVertex(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, nullptr, baseVertex);
+		else
+			glDrawElements(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, nullptr);
+
+		RenderStatistics& stats = GetStatistics();
+		stats.DrawCalls++;
+		stats.Triangles += indexCount / 3;
+	}
+
+	void OpenGLRendererAPI::DrawLines(const Ref<VertexArray>& VAO, uint32_t vertexCount, uint32_t firstVertex)
+	{
+		VAO->Bind();
+		glDrawArrays(GL_LINES, firstVertex, vertexCount);
+		GetStatistics().DrawCalls++;
 	}
 
-	void OpenGLRendererAPI::DrawLines(const Ref<VertexArray>& VAO, uint32_t vertexCount)
+	void OpenGLRendererAPI::DrawInstanced(const Ref<VertexArray>& VAO, uint32_t vertexCount, uint32_t instanceCount, uint32_t baseInstance)
 	{
 		VAO->Bind();
-		glDrawArrays(GL_LINES, 0, vertexCount);
+		if (GLAD_GL_VERSION_4_2)
+		{
+			glDrawArraysInstancedBaseInstance(GL_TRIANGLES, 0, vertexCount, instanceCount, baseInstance);
+		}
+		else
+		{
+			// Base instance draws are GL 4.2, so offset the per instance attributes instead
+			static_cast<OpenGLVertexArray&>(*VAO).SetBaseInstance(baseInstance);
+			glDrawArraysInstanced(GL_TRIANGLES, 0, vertexCount, instanceCount);
+		}
+
+		RenderStatistics& stats = GetStatistics();
+		stats.DrawCalls++;
+		stats.Triangles += vertexCount / 3 * instanceCount;
 	}
 	void OpenGLRendererAPI::SetViewport (const uint32_t& x, const uint32_t& y, const uint32_t& width, const uint32_t& height)
 	{
 		glViewport(x, y, width, height);
 	}
+	uint32_t OpenGLRendererAPI::GetViewportHeight() const
+	{
+		GLint viewport[4];
+		glGetIntegerv(GL_VIEWPORT, viewport);
+		return static_cast<uint32_t>(viewport[3]);
+	}
 	void OpenGLRendererAPI::SetLineThickness(const float& thickness)
 	{
 		glLineWidth(thickness);
@@ -0,0 +1,192 @@
+/******************************************************************************/
+/*!
+\file		RingBufferOpenGLImpl.cpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Defines the OpenGL streaming ring buffer
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#include <BorealisPCH.hpp>
+#include <glad/glad.h>
+#include <Graphics/OpenGL/RingBufferOpenGLImpl.hpp>
+#include <Graphics/OpenGL/StateCacheOpenGLImpl.hpp>
+#include <Graphics/RendererAPI.hpp>
+#include <Core/MemoryTracker.hpp>
+#include <Graphics/RenderThread.hpp>
+#include <Core/LoggerSystem.hpp>
+
+namespace Borealis
+{
+	OpenGLRingBuffer::OpenGLRingBuffer(uint32_t regionSize, uint32_t regionCount) : mRegionSize(regionSize), mFences(regionCount, nullptr)
+	{
+		PROFILE_FUNCTION();
+
+		CreateStorage();
+	}
+
+	void OpenGLRingBuffer::CreateStorage()
+	{
+		GLsizeiptr totalSize = static_cast<GLsizeiptr>(mRegionSize) * mFences.size();
+
+		glGenBuffers(1, &mRendererID);
+		OpenGLStateCache::BindBuffer(GL_ARRAY_BUFFER, mRendererID);
+
+		// glBufferStorage is core in 4.4, the context is only guaranteed to be 4.1
+		if (GLAD_GL_VERSION_4_4)
+		{
+			GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+			glBufferStorage(GL_ARRAY_BUFFER, totalSize, nullptr, flags);
+			mMapped = static_cast<uint8_t*>(glMapBufferRange(GL_ARRAY_BUFFER, 0, totalSize, flags));
+		}
+		else
+		{
+			glBufferData(GL_ARRAY_BUFFER, totalSize, nullptr, GL_STREAM_DRAW);
+		}
+		MemoryTracker::TrackGpuAllocation(MemoryTag::GPUBuffers, totalSize);
+	}
+
+	OpenGLRingBuffer::~OpenGLRingBuffer()
+	{
+		PROFILE_FUNCTION();
+
+		MemoryTracker::TrackGpuFree(MemoryTag::GPUBuffers, static_cast<uint64_t>(mRegionSize) * mFences.size());
+
+		// Deleting the buffer also unmaps it
+		RenderThread::Submit([id = mRendererID, fences = mFences]()
+			{
+				for (void* fence : fences)
+				{
+					if (fence)
+						glDeleteSync(static_cast<GLsync>(fence));
+				}
+				OpenGLStateCache::DeleteBuffers(1, &id);
+			});
+	}
+
+	RingBuffer::Allocation OpenGLRingBuffer::Allocate(uint32_t size, uint32_t alignment)
+	{
+		// Align the offset in the whole buffer, so it can be turned into a base vertex
+		uint32_t regionBase = mRegion * mRegionSize;
+		uint32_t offset = (regionBase + mHead + alignment - 1) / alignment * alignment - regionBase;
+		if (offset + size > mRegionSize)
+		{
+			// The frame outgrew its region. Wrapping would wait on the GPU mid frame, so grow to fit the worst frame instead.
+			Grow(size + alignment);
+			regionBase = 0;
+			offset = 0;
+		}
+		BOREALIS_CORE_ASSERT(offset + size <= mRegionSize, "Ring buffer allocation does not fit in a region");
+		mHead = offset + size;
+
+		uint32_t bufferOffset = regionBase + offset;
+
+		Allocation allocation;
+		allocation.mOffset = bufferOffset;
+		allocation.mSize = size;
+		if (mMapped)
+		{
+			allocation.mData = mMapped + bufferOffset;
+		}
+		else
+		{
+			// The fences guarantee the range is not in use, so the driver does not need to synchronise
+			OpenGLStateCache::BindBuffer(GL_ARRAY_BUFFER, mRendererID);
+			allocation.mData = glMapBufferRange(GL_ARRAY_BUFFER, bufferOffset, size,
+				GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_FLUSH_EXPLICIT_BIT);
+		}
+		return allocation;
+	}
+
+	void OpenGLRingBuffer::Commit(const Allocation& allocation, uint32_t usedSize)
+	{
+		// Give the unused tail back so the next allocation packs behind this one
+		uint32_t end = allocation.mOffset - mRegion * mRegionSize + usedSize;
+		if (end <= mHead)
+			mHead = end;
+		RendererAPI::GetStatistics().UploadBytes += usedSize;
+
+		if (!mMapped)
+		{
+			OpenGLStateCache::BindBuffer(GL_ARRAY_BUFFER, mRendererID);
+			if (usedSize)
+				glFlushMappedBufferRange(GL_ARRAY_BUFFER, 0, usedSize);
+			glUnmapBuffer(GL_ARRAY_BUFFER);
+		}
+	}
+
+	void OpenGLRingBuffer::EndFrame()
+	{
+		PROFILE_FUNCTION();
+
+		if (mFences[mRegion])
+			glDeleteSync(static_cast<GLsync>(mFences[mRegion]));
+		mFences[mRegion] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+		mRegion = (mRegion + 1) % static_cast<uint32_t>(mFences.size());
+		mHead = 0;
+		WaitForRegion(mRegion);
+	}
+
+	void OpenGLRingBuffer::SetData(const void* data, uint32_t size)
+	{
+		Allocation allocation = Allocate(size, 4);
+		memcpy(allocation.mData, data, size);
+		Commit(allocation, size);
+	}
+
+	void OpenGLRingBuffer::Bind() const
+	{
+		OpenGLStateCache::BindBuffer(GL_ARRAY_BUFFER, mRendererID);
+	}
+
+	void OpenGLRingBuffer::Unbind() const
+	{
+		OpenGLStateCache::BindBuffer(GL_ARRAY_BUFFER, 0);
+	}
+
+	void OpenGLRingBuffer::Grow(uint32_t minRegionSize)
+	{
+		PROFILE_FUNCTION();
+
+		// Whatever was allocated before has been drawn, so nothing has to move across
+		for (void*& fence : mFences)
+		{
+			if (fence)
+				glDeleteSync(static_cast<GLsync>(fence));
+			fence = nullptr;
+		}
+		MemoryTracker::TrackGpuFree(MemoryTag::GPUBuffers, static_cast<uint64_t>(mRegionSize) * mFences.size());
+		OpenGLStateCache::DeleteBuffers(1, &mRendererID);
+		mMapped = nullptr;
+
+		mRegionSize = std::max(mRegionSize * 2, minRegionSize);
+		mRegion = 0;
+		mHead = 0;
+		CreateStorage();
+		BOREALIS_CORE_INFO("Ring buffer grown to {} bytes per frame", mRegionSize);
+	}
+
+	void OpenGLRingBuffer::WaitForRegion(uint32_t region)
+	{
+		GLsync fence = static_cast<GLsync>(mFences[region]);
+		if (!fence)
+			return;
+
+		GLenum result = glClientWaitSync(fence, 0, 0);
+		if (result == GL_TIMEOUT_EXPIRED)
+		{
+			PROFILE_SCOPE("OpenGLRingBuffer::Stall");
+			while (result == GL_TIMEOUT_EXPIRED)
+				result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+		}
+
+		glDeleteSync(fence);
+		mFences[region] = nullptr;
+	}
+}
@@ -16,7 +16,10 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <glad/glad.h>
 #include <glm/gtc/type_ptr.hpp>
 #include <Graphics/OpenGL/ShaderOpenGLImpl.hpp>
+#include <Graphics/OpenGL/StateCacheOpenGLImpl.hpp>
 #include <Core/LoggerSystem.hpp>
+#include <Graphics/RendererAPI.hpp>
+#include <Graphics/RenderThread.hpp>
 
 namespace Borealis
 {
@@ -34,6 +37,20 @@ namespace Borealis
 		lastDot = lastDot == std::string::npos ? filepath.size() - lastSlash : lastDot - lastSlash;
 		mName = filepath.substr(lastSlash, lastDot);
 	}
+	OpenGLShader::OpenGLShader(const std::string& filepath, const std::vector<std::string>& defines)
+	{
+		PROFILE_FUNCTION();
+
+		std::string shaderSrc = ReadFile(filepath);
+		auto shaderSources = PreProcess(shaderSrc);
+		InjectDefines(shaderSources, defines);
+		Compile(shaderSources);
+
+		// Variants are named after the file and their defines, so they can be told apart in captures
+		mName = std::filesystem::path(filepath).stem().string();
+		for (const std::string& define : defines)
+			mName += "_" + define;
+	}
 	OpenGLShader::OpenGLShader(const std::string& name, const std::string& vertexSource, const std::string& fragmentSource) : mName(name)
 	{
 		PROFILE_FUNCTION();
@@ -46,17 +63,17 @@ namespace Borealis
 	OpenGLShader::~OpenGLShader()
 	{
 		PROFILE_FUNCTION();
-		glDeleteProgram(mRendererID);
+		RenderThread::Submit([id = mRendererID]() { OpenGLStateCache::DeleteProgram(id); });
 	}
 	void OpenGLShader::Bind() const
 	{
 		PROFILE_FUNCTION();
-		glUseProgram(mRendererID);
+		OpenGLStateCache::UseProgram(mRendererID);
 	}
 	void OpenGLShader::Unbind() const
 	{
 		PROFILE_FUNCTION();
-		glUseProgram(0);
+		OpenGLStateCache::UseProgram(0);
 	}
 	void OpenGLShader::Set(const char* name, const int& value)
 	{
@@ -106,6 +123,14 @@ namespace Borealis
 
 		PushUniform(name, value);
 	}
+	void OpenGLShader::SetBlockBinding(const char* name, uint32_t binding)
+	{
+		PROFILE_FUNCTION();
+
+		GLuint index = glGetUniformBlockIndex(mRendererID, name);
+		if (index != GL_INVALID_INDEX)
+			glUniformBlockBinding(mRendererID, index, binding);
+	}
 	void OpenGLShader::PushUniform(const char* name, const int& value)
 	{
 		auto location = glGetUniformLocation(mRendererID, name);
@@ -245,11 +270,145 @@ namespace Borealis
 
 		return result;
 	}
+	void OpenGLShader::InjectDefines(std::unordered_map<GLenum, std::string>& shaderSources, const std::vector<std::string>& defines)
+	{
+		std::string defineBlock;
+		for (const std::string& define : defines)
+			defineBlock += "#define " + define + "\n";
+
+		for (auto& [type, source] : shaderSources)
+		{
+			// #version has to stay the first statement
+			size_t insertAt = 0;
+			size_t version = source.find("#version");
+			if (version != std::string::npos)
+			{
+				insertAt = source.find('\n', version);
+				insertAt = insertAt == std::string::npos ? source.size() : insertAt + 1;
+			}
+			source.insert(insertAt, defineBlock);
+		}
+	}
+
+	/*!***********************************************************************
+		\brief
+			Hashes the sources of a program with the driver that compiles them,
+			a driver update gets new binaries
+		\param shaderSources
+			The unordered map of the shader source
+		\return
+			64 bit FNV-1a hash
+	*************************************************************************/
+	static uint64_t HashProgram(const std::unordered_map<GLenum, std::string>& shaderSources)
+	{
+		uint64_t hash = 14695981039346656037ull;
+		auto mix = [&hash](const void* data, size_t size)
+			{
+				const unsigned char* bytes = static_cast<const unsigned char*>(data);
+				for (size_t i = 0; i < size; ++i)
+				{
+					hash ^= bytes[i];
+					hash *= 1099511628211ull;
+				}
+			};
+
+		for (GLenum name : { GL_VENDOR, GL_RENDERER, GL_VERSION })
+		{
+			const char* string = reinterpret_cast<const char*>(glGetString(name));
+			if (string)
+				mix(string, strlen(string));
+		}
+
+		// Stage order of an unordered map is not stable, hash in a fixed order
+		for (GLenum type : { GL_VERTEX_SHADER, GL_FRAGMENT_SHADER })
+		{
+			auto it = shaderSources.find(type);
+			if (it == shaderSources.end())
+				continue;
+			mix(&type, sizeof(type));
+			mix(it->second.data(), it->second.size());
+		}
+		return hash;
+	}
+
+	static constexpr const char* sProgramCacheFolder = "ShaderCache";
+	static constexpr uint32_t sProgramCacheMagic = 0x42505247; // "GRPB"
+
+	static std::filesystem::path GetProgramCachePath(uint64_t key)
+	{
+		char name[32];
+		snprintf(name, sizeof(name), "%016llx.bin", static_cast<unsigned long long>(key));
+		return std::filesystem::path(sProgramCacheFolder) / name;
+	}
+
+	GLuint OpenGLShader::LoadProgramBinary(uint64_t key)
+	{
+		std::ifstream file(GetProgramCachePath(key), std::ios::binary | std::ios::ate);
+		if (!file)
+			return 0;
+
+		size_t size = static_cast<size_t>(file.tellg());
+		uint32_t header[2];
+		if (size <= sizeof(header))
+			return 0;
+
+		std::vector<char> binary(size - sizeof(header));
+		file.seekg(0);
+		file.read(reinterpret_cast<char*>(header), sizeof(header));
+		file.read(binary.data(), binary.size());
+		if (!file || header[0] != sProgramCacheMagic)
+			return 0;
+
+		GLuint program = glCreateProgram();
+		glProgramBinary(program, header[1], binary.data(), static_cast<GLsizei>(binary.size()));
+
+		// Drivers may refuse binaries of their own, the program is then compiled again
+		GLint isLinked = 0;
+		glGetProgramiv(program, GL_LINK_STATUS, &isLinked);
+		if (isLinked == GL_FALSE)
+		{
+			glDeleteProgram(program);
+			return 0;
+		}
+		return program;
+	}
+
+	void OpenGLShader::SaveProgramBinary(GLuint program, uint64_t key)
+	{
+		GLint length = 0;
+		glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+		if (length <= 0)
+			return;
+
+		std::vector<char> binary(length);
+		GLenum format = 0;
+		glGetProgramBinary(program, length, &length, &format, binary.data());
+
+		std::error_code error;
+		std::filesystem::create_directories(sProgramCacheFolder, error);
+		std::ofstream file(GetProgramCachePath(key), std::ios::binary);
+		if (!file)
+		{
+			BOREALIS_CORE_WARN("Could not write the program binary of shader {}", mName);
+			return;
+		}
+
+		uint32_t header[2] = { sProgramCacheMagic, format };
+		file.write(reinterpret_cast<const char*>(header), sizeof(header));
+		file.write(binary.data(), length);
+	}
+
 	void OpenGLShader::Compile(const std::unordered_map<GLenum, std::string>& shaderSources)
 	{
 		PROFILE_FUNCTION();
 
+		uint64_t key = HashProgram(shaderSources);
+		mRendererID = LoadProgramBinary(key);
+		if (mRendererID != 0)
+			return;
+
 		GLuint program = glCreateProgram();
+		glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
 		BOREALIS_CORE_ASSERT(shaderSources.size() <= 2, "More than 2 shaders detected in 1 glsl");
 		std::array<GLenum,2> shaderIDs;
 		int index = 0;
@@ -322,5 +481,6 @@ namespace Borealis
 			glDetachShader(program,id);
 		}
 		mRendererID = program;
+		SaveProgramBinary(program, key);
 	}
 }
\ No newline at end of file
@@ -0,0 +1,189 @@
+/******************************************************************************/
+/*!
+\file		SpriteTextureCacheOpenGLImpl.cpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Defines the OpenGL sprite texture cache
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#include <BorealisPCH.hpp>
+#include <Graphics/OpenGL/SpriteTextureCacheOpenGLImpl.hpp>
+#include <Graphics/OpenGL/TextureOpenGLImpl.hpp>
+#include <Graphics/OpenGL/StateCacheOpenGLImpl.hpp>
+#include <Graphics/RendererAPI.hpp>
+#include <Graphics/RenderThread.hpp>
+#include <Core/LoggerSystem.hpp>
+
+namespace Borealis
+{
+	static constexpr uint32_t InitialPageLayers = 4;
+
+	OpenGLSpriteTextureCache::OpenGLSpriteTextureCache()
+	{
+		GLint maxLayers = 0;
+		glGetIntegerv(GL_MAX_ARRAY_TEXTURE_LAYERS, &maxLayers);
+		mMaxLayers = std::min(static_cast<uint32_t>(maxLayers), 256u);
+	}
+
+	OpenGLSpriteTextureCache::~OpenGLSpriteTextureCache()
+	{
+		std::vector<uint32_t> ids;
+		for (const Page& page : mPages)
+			ids.push_back(page.mRendererID);
+
+		RenderThread::Submit([ids = std::move(ids)]() { OpenGLStateCache::DeleteTextures(static_cast<int32_t>(ids.size()), ids.data()); });
+	}
+
+	bool OpenGLSpriteTextureCache::IsSupported()
+	{
+		return GLAD_GL_VERSION_4_3;
+	}
+
+	bool OpenGLSpriteTextureCache::Acquire(Texture2D* texture, Location& location)
+	{
+		auto it = mEntries.find(texture);
+		if (it != mEntries.end() && !it->second.mTexture.expired())
+		{
+			location = it->second.mLocation;
+			return true;
+		}
+
+		const OpenGLTexture2D& source = static_cast<const OpenGLTexture2D&>(*texture);
+		if (!source.IsValid())
+			return false;
+
+		PROFILE_FUNCTION();
+
+		// A destroyed texture's address may be reused, release its layer first
+		if (it != mEntries.end())
+		{
+			mPages[it->second.mLocation.mPage].mFreeLayers.push_back(it->second.mLocation.mLayer);
+			mEntries.erase(it);
+		}
+
+		PageFormat format{ source.GetWidth(), source.GetHeight(), source.GetMipLevels(), source.GetInternalFormat(), {} };
+		GLint residentLevel = 0;
+		OpenGLStateCache::BindTexture(GL_TEXTURE_2D, source.GetRendererID());
+		glGetTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, format.mSwizzle.data());
+		glGetTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, &residentLevel);
+
+		location = AllocateLayer(format);
+		const Page& page = mPages[location.mPage];
+		for (uint32_t level = 0; level < format.mLevels; ++level)
+		{
+			GLsizei width = std::max(1u, format.mWidth >> level);
+			GLsizei height = std::max(1u, format.mHeight >> level);
+
+			// Levels the texture streamer has not uploaded come straight from the file
+			if (level < static_cast<uint32_t>(residentLevel))
+			{
+				std::vector<uint8_t> data;
+				if (source.ReadMip(level, data))
+				{
+					OpenGLStateCache::BindTexture(GL_TEXTURE_2D_ARRAY, page.mRendererID);
+					glCompressedTexSubImage3D(GL_TEXTURE_2D_ARRAY, level, 0, 0, location.mLayer, width, height, 1,
+						format.mInternalFormat, static_cast<GLsizei>(data.size()), data.data());
+					RendererAPI::GetStatistics().UploadBytes += data.size();
+				}
+				continue;
+			}
+
+			glCopyImageSubData(source.GetRendererID(), GL_TEXTURE_2D, level, 0, 0, 0,
+				page.mRendererID, GL_TEXTURE_2D_ARRAY, level, 0, 0, location.mLayer,
+				width, height, 1);
+		}
+
+		mEntries[texture] = Entry{ texture->weak_from_this(), location };
+		return true;
+	}
+
+	void OpenGLSpriteTextureCache::BindPage(uint32_t page, uint32_t unit) const
+	{
+		OpenGLStateCache::BindTextureUnit(unit, GL_TEXTURE_2D_ARRAY, mPages[page].mRendererID);
+	}
+
+	void OpenGLSpriteTextureCache::CollectGarbage()
+	{
+		for (auto it = mEntries.begin(); it != mEntries.end();)
+		{
+			if (it->second.mTexture.expired())
+			{
+				mPages[it->second.mLocation.mPage].mFreeLayers.push_back(it->second.mLocation.mLayer);
+				it = mEntries.erase(it);
+			}
+			else
+			{
+				++it;
+			}
+		}
+	}
+
+	SpriteTextureCache::Location OpenGLSpriteTextureCache::AllocateLayer(const PageFormat& format)
+	{
+		for (uint32_t i = 0; i < mPages.size(); ++i)
+		{
+			Page& page = mPages[i];
+			if (!(page.mFormat == format))
+				continue;
+
+			if (!page.mFreeLayers.empty())
+			{
+				uint32_t layer = page.mFreeLayers.back();
+				page.mFreeLayers.pop_back();
+				return { i, layer };
+			}
+
+			if (page.mUsed == page.mCapacity && page.mCapacity < mMaxLayers)
+				Grow(page, std::min(page.mCapacity * 2, mMaxLayers));
+
+			if (page.mUsed < page.mCapacity)
+				return { i, page.mUsed++ };
+		}
+
+		Page page;
+		page.mFormat = format;
+		Grow(page, std::min(InitialPageLayers, mMaxLayers));
+		page.mUsed = 1;
+		mPages.push_back(std::move(page));
+		return { static_cast<uint32_t>(mPages.size() - 1), 0 };
+	}
+
+	void OpenGLSpriteTextureCache::Grow(Page& page, uint32_t capacity)
+	{
+		PROFILE_FUNCTION();
+
+		const PageFormat& format = page.mFormat;
+
+		uint32_t id;
+		glGenTextures(1, &id);
+		OpenGLStateCache::BindTexture(GL_TEXTURE_2D_ARRAY, id);
+		glTexStorage3D(GL_TEXTURE_2D_ARRAY, format.mLevels, format.mInternalFormat, format.mWidth, format.mHeight, capacity);
+		glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, format.mLevels > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+		glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+		glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_REPEAT);
+		glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_REPEAT);
+		glTexParameteriv(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_SWIZZLE_RGBA, format.mSwizzle.data());
+
+		if (page.mRendererID)
+		{
+			for (uint32_t level = 0; level < format.mLevels; ++level)
+			{
+				GLsizei width = std::max(1u, format.mWidth >> level);
+				GLsizei height = std::max(1u, format.mHeight >> level);
+				glCopyImageSubData(page.mRendererID, GL_TEXTURE_2D_ARRAY, level, 0, 0, 0,
+					id, GL_TEXTURE_2D_ARRAY, level, 0, 0, 0,
+					width, height, page.mUsed);
+			}
+			OpenGLStateCache::DeleteTextures(1, &page.mRendererID);
+		}
+
+		page.mRendererID = id;
+		page.mCapacity = capacity;
+	}
+}
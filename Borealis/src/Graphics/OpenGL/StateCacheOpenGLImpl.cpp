@@ -0,0 +1,380 @@
+/******************************************************************************/
+/*!
+\file		StateCacheOpenGLImpl.cpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Defines the OpenGL state cache
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#include <BorealisPCH.hpp>
+#include <array>
+#include <limits>
+#include <glad/glad.h>
+#include <Graphics/OpenGL/StateCacheOpenGLImpl.hpp>
+#include <Graphics/RendererAPI.hpp>
+
+namespace Borealis
+{
+	namespace
+	{
+		constexpr GLuint Unknown = std::numeric_limits<GLuint>::max();
+		constexpr uint32_t MaxTextureUnits = 32;
+		constexpr uint32_t MaxUniformBindings = 16;
+
+		enum BufferSlot { ArrayBufferSlot, ElementBufferSlot, DrawIndirectBufferSlot, PixelPackBufferSlot, PixelUnpackBufferSlot, UniformBufferSlot, CopyReadBufferSlot, CopyWriteBufferSlot, BufferSlotCount };
+		enum TextureSlot { Texture2DSlot, Texture2DArraySlot, Texture2DMultisampleSlot, TextureSlotCount };
+		struct BufferRange
+		{
+			GLuint mBuffer;
+			int64_t mOffset;
+			int64_t mSize;
+
+			bool operator==(const BufferRange& other) const { return mBuffer == other.mBuffer && mOffset == other.mOffset && mSize == other.mSize; }
+		};
+
+		enum CapabilitySlot { BlendSlot, DepthTestSlot, CullFaceSlot, LineSmoothSlot, ScissorTestSlot, StencilTestSlot, CapabilitySlotCount };
+
+		struct StateCacheData
+		{
+			StateCacheData() { Clear(); }
+
+			void Clear()
+			{
+				mProgram = Unknown;
+				mVertexArray = Unknown;
+				mBuffers.fill(Unknown);
+				mActiveUnit = Unknown;
+				for (auto& unit : mTextures)
+					unit.fill(Unknown);
+				mUniformRanges.fill({ Unknown, 0, 0 });
+				mDrawFramebuffer = Unknown;
+				mReadFramebuffer = Unknown;
+				mCapabilities.fill(Unknown);
+				mBlendSource = Unknown;
+				mBlendDestination = Unknown;
+				mDepthFunc = Unknown;
+				mDepthMask = Unknown;
+			}
+
+			GLuint mProgram;
+			GLuint mVertexArray;
+			std::array<GLuint, BufferSlotCount> mBuffers;
+			std::array<BufferRange, MaxUniformBindings> mUniformRanges;
+			GLuint mActiveUnit;
+			std::array<std::array<GLuint, TextureSlotCount>, MaxTextureUnits> mTextures;
+			GLuint mDrawFramebuffer;
+			GLuint mReadFramebuffer;
+			std::array<GLuint, CapabilitySlotCount> mCapabilities;	//!< 0 or 1 once known
+			GLenum mBlendSource;
+			GLenum mBlendDestination;
+			GLenum mDepthFunc;
+			GLuint mDepthMask;
+		};
+
+		StateCacheData sState;
+
+		int GetBufferSlot(GLenum target)
+		{
+			switch (target)
+			{
+			case GL_ARRAY_BUFFER: return ArrayBufferSlot;
+			case GL_ELEMENT_ARRAY_BUFFER: return ElementBufferSlot;
+			case GL_DRAW_INDIRECT_BUFFER: return DrawIndirectBufferSlot;
+			case GL_PIXEL_PACK_BUFFER: return PixelPackBufferSlot;
+			case GL_PIXEL_UNPACK_BUFFER: return PixelUnpackBufferSlot;
+			case GL_UNIFORM_BUFFER: return UniformBufferSlot;
+			case GL_COPY_READ_BUFFER: return CopyReadBufferSlot;
+			case GL_COPY_WRITE_BUFFER: return CopyWriteBufferSlot;
+			default: return -1;
+			}
+		}
+
+		int GetTextureSlot(GLenum target)
+		{
+			switch (target)
+			{
+			case GL_TEXTURE_2D: return Texture2DSlot;
+			case GL_TEXTURE_2D_ARRAY: return Texture2DArraySlot;
+			case GL_TEXTURE_2D_MULTISAMPLE: return Texture2DMultisampleSlot;
+			default: return -1;
+			}
+		}
+
+		int GetCapabilitySlot(GLenum capability)
+		{
+			switch (capability)
+			{
+			case GL_BLEND: return BlendSlot;
+			case GL_DEPTH_TEST: return DepthTestSlot;
+			case GL_CULL_FACE: return CullFaceSlot;
+			case GL_LINE_SMOOTH: return LineSmoothSlot;
+			case GL_SCISSOR_TEST: return ScissorTestSlot;
+			case GL_STENCIL_TEST: return StencilTestSlot;
+			default: return -1;
+			}
+		}
+
+		/*!***********************************************************************
+			\brief
+				Updates a shadowed value and counts the call
+			\return
+				True when the call has to reach the driver
+		*************************************************************************/
+		bool Update(GLuint& shadow, GLuint value)
+		{
+			RenderStatistics& stats = RendererAPI::GetStatistics();
+			if (shadow == value)
+			{
+				stats.StateCallsSkipped++;
+				return false;
+			}
+			shadow = value;
+			stats.StateCallsIssued++;
+			return true;
+		}
+
+		void CountIssued()
+		{
+			RendererAPI::GetStatistics().StateCallsIssued++;
+		}
+	}
+
+	void OpenGLStateCache::Reset()
+	{
+		sState.Clear();
+	}
+
+	void OpenGLStateCache::UseProgram(GLuint program)
+	{
+		if (Update(sState.mProgram, program))
+		{
+			glUseProgram(program);
+			RendererAPI::GetStatistics().StateChanges++;
+		}
+	}
+
+	void OpenGLStateCache::BindVertexArray(GLuint vertexArray)
+	{
+		if (Update(sState.mVertexArray, vertexArray))
+		{
+			glBindVertexArray(vertexArray);
+			sState.mBuffers[ElementBufferSlot] = Unknown;
+			RendererAPI::GetStatistics().StateChanges++;
+		}
+	}
+
+	void OpenGLStateCache::BindBuffer(GLenum target, GLuint buffer)
+	{
+		int slot = GetBufferSlot(target);
+		if (slot < 0)
+		{
+			CountIssued();
+			glBindBuffer(target, buffer);
+			return;
+		}
+
+		if (Update(sState.mBuffers[slot], buffer))
+			glBindBuffer(target, buffer);
+	}
+
+	void OpenGLStateCache::BindBufferRange(GLenum target, uint32_t index, GLuint buffer, int64_t offset, int64_t size)
+	{
+		BufferRange range{ buffer, offset, size };
+		if (target == GL_UNIFORM_BUFFER && index < MaxUniformBindings)
+		{
+			if (sState.mUniformRanges[index] == range)
+			{
+				RendererAPI::GetStatistics().StateCallsSkipped++;
+				return;
+			}
+			sState.mUniformRanges[index] = range;
+		}
+
+		CountIssued();
+		glBindBufferRange(target, index, buffer, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size));
+		int slot = GetBufferSlot(target);
+		if (slot >= 0)
+			sState.mBuffers[slot] = buffer;
+	}
+
+	void OpenGLStateCache::ActiveTexture(uint32_t unit)
+	{
+		if (Update(sState.mActiveUnit, unit))
+			glActiveTexture(GL_TEXTURE0 + unit);
+	}
+
+	void OpenGLStateCache::BindTexture(GLenum target, GLuint texture)
+	{
+		int slot = GetTextureSlot(target);
+		if (slot < 0 || sState.mActiveUnit >= MaxTextureUnits)
+		{
+			CountIssued();
+			glBindTexture(target, texture);
+			return;
+		}
+
+		if (Update(sState.mTextures[sState.mActiveUnit][slot], texture))
+			glBindTexture(target, texture);
+	}
+
+	void OpenGLStateCache::BindTextureUnit(uint32_t unit, GLenum target, GLuint texture)
+	{
+		int slot = GetTextureSlot(target);
+		if (slot >= 0 && unit < MaxTextureUnits && sState.mTextures[unit][slot] == texture)
+		{
+			RendererAPI::GetStatistics().StateCallsSkipped++;
+			return;
+		}
+
+		ActiveTexture(unit);
+		BindTexture(target, texture);
+		RendererAPI::GetStatistics().TextureBinds++;
+	}
+
+	void OpenGLStateCache::BindFramebuffer(GLenum target, GLuint framebuffer)
+	{
+		bool changed = false;
+		switch (target)
+		{
+		case GL_FRAMEBUFFER:
+			changed = sState.mDrawFramebuffer != framebuffer || sState.mReadFramebuffer != framebuffer;
+			sState.mDrawFramebuffer = framebuffer;
+			sState.mReadFramebuffer = framebuffer;
+			if (changed)
+				CountIssued();
+			else
+				RendererAPI::GetStatistics().StateCallsSkipped++;
+			break;
+		case GL_DRAW_FRAMEBUFFER:
+			changed = Update(sState.mDrawFramebuffer, framebuffer);
+			break;
+		case GL_READ_FRAMEBUFFER:
+			changed = Update(sState.mReadFramebuffer, framebuffer);
+			break;
+		default:
+			CountIssued();
+			changed = true;
+			break;
+		}
+
+		if (changed)
+		{
+			glBindFramebuffer(target, framebuffer);
+			RendererAPI::GetStatistics().StateChanges++;
+		}
+	}
+
+	OpenGLStateCache::GLuint OpenGLStateCache::GetFramebuffer(GLenum target)
+	{
+		GLuint& shadow = target == GL_READ_FRAMEBUFFER ? sState.mReadFramebuffer : sState.mDrawFramebuffer;
+		if (shadow == Unknown)
+		{
+			GLint bound = 0;
+			glGetIntegerv(target == GL_READ_FRAMEBUFFER ? GL_READ_FRAMEBUFFER_BINDING : GL_DRAW_FRAMEBUFFER_BINDING, &bound);
+			shadow = static_cast<GLuint>(bound);
+		}
+		return shadow;
+	}
+
+	void OpenGLStateCache::SetCapability(GLenum capability, bool enabled)
+	{
+		int slot = GetCapabilitySlot(capability);
+		if (slot < 0)
+			CountIssued();
+		else if (!Update(sState.mCapabilities[slot], enabled ? 1 : 0))
+			return;
+
+		if (enabled)
+			glEnable(capability);
+		else
+			glDisable(capability);
+	}
+
+	void OpenGLStateCache::BlendFunc(GLenum source, GLenum destination)
+	{
+		if (sState.mBlendSource == source && sState.mBlendDestination == destination)
+		{
+			RendererAPI::GetStatistics().StateCallsSkipped++;
+			return;
+		}
+		sState.mBlendSource = source;
+		sState.mBlendDestination = destination;
+		CountIssued();
+		glBlendFunc(source, destination);
+	}
+
+	void OpenGLStateCache::DepthFunc(GLenum function)
+	{
+		if (Update(sState.mDepthFunc, function))
+			glDepthFunc(function);
+	}
+
+	void OpenGLStateCache::DepthMask(bool write)
+	{
+		if (Update(sState.mDepthMask, write ? 1 : 0))
+			glDepthMask(write ? GL_TRUE : GL_FALSE);
+	}
+
+	void OpenGLStateCache::DeleteProgram(GLuint program)
+	{
+		glDeleteProgram(program);
+		// A program in use is only flagged for deletion, the next UseProgram has to go through
+		if (sState.mProgram == program)
+			sState.mProgram = Unknown;
+	}
+
+	void OpenGLStateCache::DeleteVertexArrays(int32_t count, const GLuint* vertexArrays)
+	{
+		glDeleteVertexArrays(count, vertexArrays);
+		for (int32_t i = 0; i < count; ++i)
+		{
+			if (sState.mVertexArray == vertexArrays[i])
+			{
+				sState.mVertexArray = 0;
+				sState.mBuffers[ElementBufferSlot] = Unknown;
+			}
+		}
+	}
+
+	void OpenGLStateCache::DeleteBuffers(int32_t count, const GLuint* buffers)
+	{
+		glDeleteBuffers(count, buffers);
+		for (int32_t i = 0; i < count; ++i)
+		{
+			for (GLuint& bound : sState.mBuffers)
+				if (bound == buffers[i])
+					bound = 0;
+			for (BufferRange& range : sState.mUniformRanges)
+				if (range.mBuffer == buffers[i])
+					range = { 0, 0, 0 };
+		}
+	}
+
+	void OpenGLStateCache::DeleteTextures(int32_t count, const GLuint* textures)
+	{
+		glDeleteTextures(count, textures);
+		for (int32_t i = 0; i < count; ++i)
+			for (auto& unit : sState.mTextures)
+				for (GLuint& bound : unit)
+					if (bound == textures[i])
+						bound = 0;
+	}
+
+	void OpenGLStateCache::DeleteFramebuffers(int32_t count, const GLuint* framebuffers)
+	{
+		glDeleteFramebuffers(count, framebuffers);
+		for (int32_t i = 0; i < count; ++i)
+		{
+			if (sState.mDrawFramebuffer == framebuffers[i])
+				sState.mDrawFramebuffer = 0;
+			if (sState.mReadFramebuffer == framebuffers[i])
+				sState.mReadFramebuffer = 0;
+		}
+	}
+}
@@ -12,18 +12,61 @@ prior written consent of DigiPen Institute of Technology is prohibited.
  */
  /******************************************************************************/
 #include <BorealisPCH.hpp>
+#include <cstring>
 #include <Graphics/OpenGL/TextureOpenGLImpl.hpp>
+#include <Graphics/OpenGL/StateCacheOpenGLImpl.hpp>
 #include <Core/LoggerSystem.hpp>
+#include <Graphics/RendererAPI.hpp>
+#include <Core/MemoryTracker.hpp>
+#include <Graphics/RenderThread.hpp>
 
 #include <stb_image.h>
 #include <gli.hpp>
 namespace Borealis
 {
-	OpenGLTexture2D::OpenGLTexture2D(const std::string& path) : mPath(path)
+	/*!***********************************************************************
+		\brief
+			Finds where each level of a DDS file is, so the streamer can read
+			levels on their own
+		\param[in] path
+			Path to the file
+		\param[in] texture
+			Texture loaded from the file
+		\return
+			The layout, null if the file is not a DDS file
+	*************************************************************************/
+	static std::shared_ptr<TextureStreamer::MipLayout> GetDDSMipLayout(const std::string& path, gli::texture const& texture)
+	{
+		if (std::filesystem::path(path).extension() != ".dds")
+			return nullptr;
+
+		std::ifstream file(path, std::ios::binary);
+		char header[128];
+		if (!file.read(header, sizeof(header)) || std::memcmp(header, "DDS ", 4) != 0)
+			return nullptr;
+
+		// The DX10 header follows when the four cc of the pixel format says so
+		uint64_t dataOffset = sizeof(header) + (std::memcmp(header + 84, "DX10", 4) == 0 ? 20 : 0);
+
+		std::shared_ptr<TextureStreamer::MipLayout> layout = std::make_shared<TextureStreamer::MipLayout>();
+		layout->mPath = path;
+		const uint8_t* base = static_cast<const uint8_t*>(texture.data());
+		for (std::size_t level = 0; level < texture.levels(); ++level)
+		{
+			layout->mOffsets.push_back(dataOffset + static_cast<uint64_t>(static_cast<const uint8_t*>(texture.data(0, 0, level)) - base));
+			layout->mSizes.push_back(texture.size(level));
+		}
+		return layout;
+	}
+
+	OpenGLTexture2D::OpenGLTexture2D(const std::string& path) : OpenGLTexture2D(path, gli::load(path))
+	{
+	}
+
+	OpenGLTexture2D::OpenGLTexture2D(const std::string& path, const gli::texture& Texture) : mPath(path)
 	{
 		PROFILE_FUNCTION();
 
-		gli::texture Texture = gli::load(path);
 		if (Texture.empty())
 		{
 			BOREALIS_CORE_ASSERT(false,"Invalid texture file {}");
@@ -54,19 +97,31 @@ namespace Borealis
 
 		mWidth = Extent.x;
 		mHeight = Extent.y;
+		mMipLevels = static_cast<uint32_t>(Texture.levels());
+
+		// Large textures only upload their small levels, the streamer reads the rest once they are drawn
+		uint32_t tailMip = TextureStreamer::GetTailMip(mWidth, mHeight, mMipLevels);
+		if (tailMip > 0)
+		{
+			mStreamLayout = GetDDSMipLayout(path, Texture);
+			if (mStreamLayout)
+				mStreamingHandle = TextureStreamer::Register(this, mStreamLayout, tailMip);
+		}
+		mResidentMip = mStreamingHandle != TextureStreamer::InvalidHandle ? tailMip : 0;
 
 		glGenTextures(1, &mRendererID);
-		glBindTexture(Target, mRendererID);
-		glTexParameteri(Target, GL_TEXTURE_BASE_LEVEL, 0);
+		OpenGLStateCache::BindTexture(Target, mRendererID);
+		glTexParameteri(Target, GL_TEXTURE_BASE_LEVEL, static_cast<GLint>(mResidentMip));
 		glTexParameteri(Target, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(Texture.levels() - 1));
 		glTexParameteriv(Target, GL_TEXTURE_SWIZZLE_RGBA, &Format.Swizzles[0]);
 
-		glTexParameteri(Target, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+		// Imported textures carry their full mip chain, sample across it when there is one
+		glTexParameteri(Target, GL_TEXTURE_MIN_FILTER, mMipLevels > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
 		glTexParameteri(Target, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 		glTexParameteri(Target, GL_TEXTURE_WRAP_S, GL_REPEAT);
 		glTexParameteri(Target, GL_TEXTURE_WRAP_T, GL_REPEAT);
 
-		for (std::size_t Level = 0; Level < Texture.levels(); ++Level)
+		for (std::size_t Level = mResidentMip; Level < Texture.levels(); ++Level)
 		{
 			glm::tvec3<GLsizei> Extent = Texture.extent(Level);
 
@@ -78,9 +133,9 @@ namespace Borealis
 				0,
 				static_cast<GLsizei>(Texture.size(Level)),
 				Texture.data(0, 0, Level));
+			mGpuBytes += Texture.size(Level);
 		}
-
-		glBindTexture(Target, 0);
+		MemoryTracker::TrackGpuAllocation(MemoryTag::GPUTextures, mGpuBytes);
 
 		mValid = true;
 
@@ -164,16 +219,16 @@ namespace Borealis
 		mDataFormat = ImageFormatToGLDataFormat(textureInfo.imageFormat);
 
 		glGenTextures(1, &mRendererID);
-		glBindTexture(GL_TEXTURE_2D, mRendererID);
+		OpenGLStateCache::BindTexture(GL_TEXTURE_2D, mRendererID);
 		glTexImage2D(GL_TEXTURE_2D, 0, mInternalFormat, mWidth, mHeight, 0, mDataFormat, GL_UNSIGNED_BYTE, nullptr);
+		mGpuBytes = static_cast<uint64_t>(mWidth) * mHeight * (mDataFormat == GL_RGBA ? 4 : 3);
+		MemoryTracker::TrackGpuAllocation(MemoryTag::GPUTextures, mGpuBytes);
 
 		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
 		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
 		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
 		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
 
-		glBindTexture(GL_TEXTURE_2D, 0);
-
 		mValid = true;
 	}
 
@@ -181,7 +236,9 @@ namespace Borealis
 	{
 		PROFILE_FUNCTION();
 
-		glDeleteTextures(1, &mRendererID);
+		TextureStreamer::Unregister(mStreamingHandle);
+		MemoryTracker::TrackGpuFree(MemoryTag::GPUTextures, mGpuBytes);
+		RenderThread::Submit([id = mRendererID]() { OpenGLStateCache::DeleteTextures(1, &id); });
 	}
 
 	void OpenGLTexture2D::SetData(void* data, uint32_t size)
@@ -192,17 +249,71 @@ namespace Borealis
 
 		BOREALIS_CORE_ASSERT(size == mWidth * mHeight * bpp, "Data must be entire texture!");
 		
-		glBindTexture(GL_TEXTURE_2D, mRendererID);
+		OpenGLStateCache::BindTexture(GL_TEXTURE_2D, mRendererID);
 		glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, mWidth, mHeight, mDataFormat, GL_UNSIGNED_BYTE, data);
-		glBindTexture(GL_TEXTURE_2D, 0);
+		RendererAPI::GetStatistics().UploadBytes += size;
+	}
+
+	void OpenGLTexture2D::UploadMips(uint32_t firstLevel, std::vector<uint8_t> data)
+	{
+		PROFILE_FUNCTION();
+
+		uint64_t bytes = data.size();
+		RenderThread::Submit([id = mRendererID, format = mInternalFormat, width = mWidth, height = mHeight, layout = mStreamLayout,
+			firstLevel, lastLevel = mResidentMip, data = std::move(data)]()
+			{
+				OpenGLStateCache::BindTexture(GL_TEXTURE_2D, id);
+				const uint8_t* source = data.data();
+				for (uint32_t level = firstLevel; level < lastLevel; ++level)
+				{
+					GLsizei size = static_cast<GLsizei>(layout->mSizes[level]);
+					glCompressedTexImage2D(GL_TEXTURE_2D, static_cast<GLint>(level), format,
+						std::max(1u, width >> level), std::max(1u, height >> level), 0, size, source);
+					source += size;
+				}
+				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, static_cast<GLint>(firstLevel));
+				RendererAPI::GetStatistics().UploadBytes += data.size();
+			});
+
+		mResidentMip = firstLevel;
+		mGpuBytes += bytes;
+		MemoryTracker::TrackGpuAllocation(MemoryTag::GPUTextures, bytes);
+	}
+
+	void OpenGLTexture2D::EvictMips(uint32_t firstLevel)
+	{
+		PROFILE_FUNCTION();
+
+		RenderThread::Submit([id = mRendererID, format = mInternalFormat, residentLevel = mResidentMip, firstLevel]()
+			{
+				OpenGLStateCache::BindTexture(GL_TEXTURE_2D, id);
+				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, static_cast<GLint>(firstLevel));
+
+				// Respecifying a level as empty releases its storage
+				for (uint32_t level = residentLevel; level < firstLevel; ++level)
+					glCompressedTexImage2D(GL_TEXTURE_2D, static_cast<GLint>(level), format, 0, 0, 0, 0, nullptr);
+			});
+
+		uint64_t bytes = 0;
+		for (uint32_t level = mResidentMip; level < firstLevel; ++level)
+			bytes += mStreamLayout->mSizes[level];
+		mResidentMip = firstLevel;
+		mGpuBytes -= bytes;
+		MemoryTracker::TrackGpuFree(MemoryTag::GPUTextures, bytes);
+	}
+
+	bool OpenGLTexture2D::ReadMip(uint32_t level, std::vector<uint8_t>& data) const
+	{
+		if (!mStreamLayout || level >= mStreamLayout->mSizes.size())
+			return false;
+		return TextureStreamer::ReadMips(*mStreamLayout, level, level + 1, data);
 	}
 
 	void OpenGLTexture2D::OpenGLTexture2D::Bind(uint32_t unit) const
 	{
 		PROFILE_FUNCTION();
 
-		glActiveTexture(GL_TEXTURE0 + unit);
-		glBindTexture(GL_TEXTURE_2D, mRendererID);
+		OpenGLStateCache::BindTextureUnit(unit, GL_TEXTURE_2D, mRendererID);
 	}
 	bool OpenGLTexture2D::IsValid() const
 	{
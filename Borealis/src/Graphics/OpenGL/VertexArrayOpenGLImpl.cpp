@@ -15,6 +15,10 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <BorealisPCH.hpp>
 #include <glad/glad.h>
 #include <Graphics/OpenGL/VertexArrayOpenGLImpl.hpp>
+#include <Graphics/OpenGL/StateCacheOpenGLImpl.hpp>
+#include <Graphics/RendererAPI.hpp>
+#include <Graphics/RenderThread.hpp>
+#include <Graphics/RingBuffer.hpp>
 namespace Borealis {
 	static GLenum ShaderDataTypeToOpenGLBaseType(ShaderDataType type)
 	{
@@ -47,19 +51,32 @@ namespace Borealis {
 	{
 		PROFILE_FUNCTION();
 
-		glDeleteVertexArrays(1, &mRendererID);
+		RenderThread::Submit([id = mRendererID]() { OpenGLStateCache::DeleteVertexArrays(1, &id); });
 	}
 	void OpenGLVertexArray::Bind() const
 	{
 		PROFILE_FUNCTION();
 
-		glBindVertexArray(mRendererID);
+		OpenGLStateCache::BindVertexArray(mRendererID);
+
+		// A ring buffer that grew lives in a new buffer, point its attributes at it
+		for (RingBinding& binding : mRingBindings)
+		{
+			const Ref<VertexBuffer>& VBO = mVBOs[binding.mIndex];
+			uint32_t bufferID = static_cast<const RingBuffer&>(*VBO).GetRendererID();
+			if (bufferID != binding.mBufferID)
+			{
+				const BufferLayout& layout = VBO->GetLayout();
+				SetAttributes(VBO, mFirstAttributes[binding.mIndex], layout.IsPerInstance() ? mBaseInstance * layout.GetStride() : 0);
+				binding.mBufferID = bufferID;
+			}
+		}
 	}
 	void OpenGLVertexArray::Unbind() const
 	{
 		PROFILE_FUNCTION();
 
-		glBindVertexArray(0);
+		OpenGLStateCache::BindVertexArray(0);
 	}
 	void OpenGLVertexArray::AddVertexBuffer(const Ref<VertexBuffer>& VBO)
 	{
@@ -67,35 +84,64 @@ namespace Borealis {
 
 		BOREALIS_CORE_ASSERT(!VBO->GetLayout().GetElements().empty(), "Vertex Buffer Layout is empty!");
 
-		glBindVertexArray(mRendererID);
+		OpenGLStateCache::BindVertexArray(mRendererID);
+
+		// Attribute indices continue across buffers, so a per vertex and a per instance buffer can share the VAO
+		uint32_t firstIndex = mAttributeCount;
+		SetAttributes(VBO, firstIndex, 0);
+		for (uint32_t index = firstIndex; index < firstIndex + VBO->GetLayout().GetElements().size(); index++)
+		{
+			glEnableVertexAttribArray(index);
+			glVertexAttribDivisor(index, VBO->GetLayout().IsPerInstance() ? 1 : 0);
+		}
+		mAttributeCount += static_cast<uint32_t>(VBO->GetLayout().GetElements().size());
+
+		if (auto ring = std::dynamic_pointer_cast<RingBuffer>(VBO))
+			mRingBindings.push_back({ static_cast<uint32_t>(mVBOs.size()), ring->GetRendererID() });
+
+		mVBOs.push_back(VBO);
+		mFirstAttributes.push_back(firstIndex);
+	}
+
+	void OpenGLVertexArray::SetAttributes(const Ref<VertexBuffer>& VBO, uint32_t firstIndex, uint32_t offset) const
+	{
 		VBO->Bind();
 
-		uint32_t index = 0;
+		uint32_t index = firstIndex;
 		for (const auto& element : VBO->GetLayout())
 		{
 			if (element.mType >= ShaderDataType::Int)
 			{
-				glEnableVertexAttribArray(index);
 				glVertexAttribIPointer(index, element.GetComponentCount(), ShaderDataTypeToOpenGLBaseType(element.mType),
-					VBO->GetLayout().GetStride(), (const void*)element.mOffset);
+					VBO->GetLayout().GetStride(), (const void*)(uintptr_t)(element.mOffset + offset));
 			}
 			else
-
 			{
-				glEnableVertexAttribArray(index);
 				glVertexAttribPointer(index, element.GetComponentCount(), ShaderDataTypeToOpenGLBaseType(element.mType),
-					element.mNormalized ? GL_TRUE : GL_FALSE, VBO->GetLayout().GetStride(), (const void*)element.mOffset);
+					element.mNormalized ? GL_TRUE : GL_FALSE, VBO->GetLayout().GetStride(), (const void*)(uintptr_t)(element.mOffset + offset));
 			}
 			index++;
 		}
+	}
 
-		mVBOs.push_back(VBO);
+	void OpenGLVertexArray::SetBaseInstance(uint32_t baseInstance)
+	{
+		if (baseInstance == mBaseInstance)
+			return;
+
+		for (size_t i = 0; i < mVBOs.size(); i++)
+		{
+			const BufferLayout& layout = mVBOs[i]->GetLayout();
+			if (layout.IsPerInstance())
+				SetAttributes(mVBOs[i], mFirstAttributes[i], baseInstance * layout.GetStride());
+		}
+		mBaseInstance = baseInstance;
 	}
 	void OpenGLVertexArray::SetElementBuffer(const Ref<ElementBuffer>& EBO)
 	{
 		PROFILE_FUNCTION();
 
-		glBindVertexArray(mRendererID);
+		OpenGLStateCache::BindVertexArray(mRendererID);
 		EBO->Bind();
 		mEBO = EBO;
 	}
@@ -0,0 +1,184 @@
+/******************************************************************************/
+/*!
+\file		ParticleSystem.cpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Defines the particle system
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#include <BorealisPCH.hpp>
+#include <xmmintrin.h>
+#include <glm/gtc/constants.hpp>
+#include <Graphics/ParticleSystem.hpp>
+#include <Graphics/Renderer2D.hpp>
+#include <Graphics/RenderThread.hpp>
+#include <Core/JobSystem.hpp>
+
+namespace Borealis
+{
+	static constexpr uint32_t ParticleGrainSize = 16384; // Multiple of 4 so only the last chunk has a scalar tail
+
+	struct ParticleSystem::InstanceArray
+	{
+		std::vector<Renderer2D::SpriteInstance> mInstances;
+	};
+
+	ParticleSystem::ParticleSystem(uint32_t maxParticles) : mCapacity(maxParticles), mRandom(std::random_device{}())
+	{
+		for (std::vector<float>* array : { &mPositionX, &mPositionY, &mPositionZ, &mVelocityX, &mVelocityY, &mVelocityZ,
+			&mLife, &mInvLifeTime, &mRotation, &mSizeBegin, &mSizeEnd })
+		{
+			array->resize(maxParticles);
+		}
+		mColourBegin.resize(maxParticles);
+		mColourEnd.resize(maxParticles);
+	}
+
+	void ParticleSystem::Emit(const ParticleProps& props, uint32_t count)
+	{
+		PROFILE_FUNCTION();
+
+		std::uniform_real_distribution<float> spread(-0.5f, 0.5f);
+		std::uniform_real_distribution<float> angle(0.0f, glm::two_pi<float>());
+
+		count = std::min(count, mCapacity - mCount);
+		for (uint32_t i = mCount; i < mCount + count; i++)
+		{
+			mPositionX[i] = props.Position.x;
+			mPositionY[i] = props.Position.y;
+			mPositionZ[i] = props.Position.z;
+			mVelocityX[i] = props.Velocity.x + props.VelocityVariation.x * spread(mRandom);
+			mVelocityY[i] = props.Velocity.y + props.VelocityVariation.y * spread(mRandom);
+			mVelocityZ[i] = props.Velocity.z + props.VelocityVariation.z * spread(mRandom);
+			mLife[i] = props.LifeTime;
+			mInvLifeTime[i] = props.LifeTime > 0.0f ? 1.0f / props.LifeTime : 0.0f;
+			mRotation[i] = angle(mRandom);
+			mSizeBegin[i] = props.SizeBegin + props.SizeVariation * spread(mRandom);
+			mSizeEnd[i] = props.SizeEnd;
+			mColourBegin[i] = props.ColourBegin;
+			mColourEnd[i] = props.ColourEnd;
+		}
+		mCount += count;
+	}
+
+	void ParticleSystem::Update(float dt)
+	{
+		PROFILE_FUNCTION();
+
+		JobSystem::ParallelFor(mCount, ParticleGrainSize, [this, dt](uint32_t begin, uint32_t end)
+			{
+				float* positionX = mPositionX.data();
+				float* positionY = mPositionY.data();
+				float* positionZ = mPositionZ.data();
+				const float* velocityX = mVelocityX.data();
+				const float* velocityY = mVelocityY.data();
+				const float* velocityZ = mVelocityZ.data();
+				float* life = mLife.data();
+
+				const __m128 delta = _mm_set1_ps(dt);
+				uint32_t i = begin;
+				for (; i + 4 <= end; i += 4)
+				{
+					_mm_storeu_ps(positionX + i, _mm_add_ps(_mm_loadu_ps(positionX + i), _mm_mul_ps(_mm_loadu_ps(velocityX + i), delta)));
+					_mm_storeu_ps(positionY + i, _mm_add_ps(_mm_loadu_ps(positionY + i), _mm_mul_ps(_mm_loadu_ps(velocityY + i), delta)));
+					_mm_storeu_ps(positionZ + i, _mm_add_ps(_mm_loadu_ps(positionZ + i), _mm_mul_ps(_mm_loadu_ps(velocityZ + i), delta)));
+					_mm_storeu_ps(life + i, _mm_sub_ps(_mm_loadu_ps(life + i), delta));
+				}
+				for (; i < end; i++)
+				{
+					positionX[i] += velocityX[i] * dt;
+					positionY[i] += velocityY[i] * dt;
+					positionZ[i] += velocityZ[i] * dt;
+					life[i] -= dt;
+				}
+			});
+
+		// Swap expired particles with the last live one, so the live range stays packed
+		for (uint32_t i = 0; i < mCount;)
+		{
+			if (mLife[i] <= 0.0f)
+			{
+				MoveParticle(--mCount, i);
+			}
+			else
+			{
+				i++;
+			}
+		}
+	}
+
+	void ParticleSystem::MoveParticle(uint32_t from, uint32_t to)
+	{
+		mPositionX[to] = mPositionX[from];
+		mPositionY[to] = mPositionY[from];
+		mPositionZ[to] = mPositionZ[from];
+		mVelocityX[to] = mVelocityX[from];
+		mVelocityY[to] = mVelocityY[from];
+		mVelocityZ[to] = mVelocityZ[from];
+		mLife[to] = mLife[from];
+		mInvLifeTime[to] = mInvLifeTime[from];
+		mRotation[to] = mRotation[from];
+		mSizeBegin[to] = mSizeBegin[from];
+		mSizeEnd[to] = mSizeEnd[from];
+		mColourBegin[to] = mColourBegin[from];
+		mColourEnd[to] = mColourEnd[from];
+	}
+
+	void ParticleSystem::Submit(Texture2D* texture, int entityID)
+	{
+		PROFILE_FUNCTION();
+
+		if (mCount == 0)
+			return;
+
+		// An array is free once no pending render command holds it
+		Ref<InstanceArray> instances;
+		for (auto& pooled : mInstancePool)
+		{
+			if (pooled.use_count() == 1)
+			{
+				instances = pooled;
+				break;
+			}
+		}
+		if (!instances)
+		{
+			instances = MakeRef<InstanceArray>();
+			mInstancePool.push_back(instances);
+		}
+		instances->mInstances.resize(mCount);
+
+		JobSystem::ParallelFor(mCount, ParticleGrainSize, [this, &instances, entityID](uint32_t begin, uint32_t end)
+			{
+				Renderer2D::SpriteInstance* destination = instances->mInstances.data();
+				for (uint32_t i = begin; i < end; i++)
+				{
+					float t = 1.0f - mLife[i] * mInvLifeTime[i];
+					float size = glm::mix(mSizeBegin[i], mSizeEnd[i], t);
+					float cos = std::cos(mRotation[i]) * size;
+					float sin = std::sin(mRotation[i]) * size;
+
+					Renderer2D::SpriteInstance& instance = destination[i];
+					instance.Position = { mPositionX[i], mPositionY[i], mPositionZ[i] };
+					instance.AxisX = { cos, sin, 0.0f };
+					instance.AxisY = { -sin, cos, 0.0f };
+					instance.UVRect = { 0.0f, 0.0f, 1.0f, 1.0f };
+					instance.Colour = glm::mix(mColourBegin[i], mColourEnd[i], t);
+					instance.TilingFactor = 1.0f;
+					instance.EntityID = entityID;
+				}
+			});
+
+		// The caller retains the texture for the frame
+		RenderThread::Submit([instances, texture]()
+			{
+				Renderer2D::DrawSprites(instances->mInstances.data(), static_cast<uint32_t>(instances->mInstances.size()), texture);
+			});
+	}
+}
@@ -0,0 +1,35 @@
+/******************************************************************************/
+/*!
+\file		PickingService.cpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Defines the factory for the picking service
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#include <BorealisPCH.hpp>
+#include <Graphics/PickingService.hpp>
+#include <Graphics/Renderer.hpp>
+#include <Graphics/OpenGL/PickingServiceOpenGLImpl.hpp>
+#include <Core/LoggerSystem.hpp>
+
+namespace Borealis
+{
+	Scope<PickingService> PickingService::Create(uint32_t ringSize)
+	{
+		switch (Renderer::GetAPI())
+		{
+			case RendererAPI::API::None:    BOREALIS_CORE_ASSERT(false, "RendererAPI::None is not supported"); return nullptr;
+			case RendererAPI::API::OpenGL:  return MakeScope<OpenGLPickingService>(ringSize);
+			case RendererAPI::API::Null:    return nullptr; // Nothing is rendered to pick from
+		}
+
+		BOREALIS_CORE_ASSERT(false, "Unknown RendererAPI");
+		return nullptr;
+	}
+}
@@ -0,0 +1,109 @@
+/******************************************************************************/
+/*!
+\file		RenderCommandQueue.cpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Defines the linear allocated render command queue
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#include <BorealisPCH.hpp>
+#include <Graphics/RenderCommandQueue.hpp>
+#include <Core/LoggerSystem.hpp>
+
+namespace Borealis
+{
+	static constexpr uint32_t AlignUp(uint32_t value, uint32_t alignment)
+	{
+		return (value + alignment - 1) & ~(alignment - 1);
+	}
+
+	RenderCommandQueue::RenderCommandQueue(uint32_t blockSize) : mBlockSize(blockSize)
+	{
+		mBlocks.push_back(static_cast<uint8_t*>(::operator new(mBlockSize, std::align_val_t(PacketAlignment))));
+	}
+
+	RenderCommandQueue::~RenderCommandQueue()
+	{
+		Reset();
+		for (uint8_t* block : mBlocks)
+			::operator delete(block, std::align_val_t(PacketAlignment));
+	}
+
+	void* RenderCommandQueue::Allocate(CommandFn execute, CommandFn destroy, uint32_t size)
+	{
+		uint32_t headerSize = AlignUp(sizeof(PacketHeader), PacketAlignment);
+		uint32_t packetSize = headerSize + AlignUp(size, PacketAlignment);
+		BOREALIS_CORE_ASSERT(packetSize <= mBlockSize, "Render command larger than a queue block");
+
+		// Chain a new block rather than growing, so recorded packets never move
+		if (mWrite.mOffset + packetSize > mBlockSize)
+		{
+			// Terminate the current block with an empty header
+			if (mWrite.mOffset + sizeof(PacketHeader) <= mBlockSize)
+				new (mBlocks[mWrite.mBlock] + mWrite.mOffset) PacketHeader{ nullptr, nullptr, 0 };
+
+			++mWrite.mBlock;
+			mWrite.mOffset = 0;
+			if (mWrite.mBlock == mBlocks.size())
+				mBlocks.push_back(static_cast<uint8_t*>(::operator new(mBlockSize, std::align_val_t(PacketAlignment))));
+		}
+
+		uint8_t* packet = mBlocks[mWrite.mBlock] + mWrite.mOffset;
+		new (packet) PacketHeader{ execute, destroy, packetSize };
+		mWrite.mOffset += packetSize;
+
+		++mCommandCount;
+		mUsedBytes += packetSize;
+		return packet + headerSize;
+	}
+
+	template <typename Visitor>
+	void RenderCommandQueue::ForEachPacket(Cursor begin, Cursor end, Visitor&& visitor)
+	{
+		uint32_t headerSize = AlignUp(sizeof(PacketHeader), PacketAlignment);
+		Cursor cursor = begin;
+		while (cursor.mBlock < end.mBlock || (cursor.mBlock == end.mBlock && cursor.mOffset < end.mOffset))
+		{
+			bool blockEnd = cursor.mOffset + sizeof(PacketHeader) > mBlockSize;
+			PacketHeader* header = blockEnd ? nullptr : reinterpret_cast<PacketHeader*>(mBlocks[cursor.mBlock] + cursor.mOffset);
+			if (!header || header->mSize == 0)
+			{
+				++cursor.mBlock;
+				cursor.mOffset = 0;
+				continue;
+			}
+
+			visitor(*header, mBlocks[cursor.mBlock] + cursor.mOffset + headerSize);
+			cursor.mOffset += header->mSize;
+		}
+	}
+
+	void RenderCommandQueue::Execute()
+	{
+		ForEachPacket(mExecuted, mWrite, [](PacketHeader& header, void* command)
+			{
+				header.mExecute(command);
+			});
+		mExecuted = mWrite;
+	}
+
+	void RenderCommandQueue::Reset()
+	{
+		ForEachPacket(Cursor{}, mWrite, [](PacketHeader& header, void* command)
+			{
+				if (header.mDestroy)
+					header.mDestroy(command);
+			});
+
+		mWrite = Cursor{};
+		mExecuted = Cursor{};
+		mCommandCount = 0;
+		mUsedBytes = 0;
+	}
+}
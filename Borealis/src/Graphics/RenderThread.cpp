@@ -0,0 +1,297 @@
+/******************************************************************************/
+/*!
+\file		RenderThread.cpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Defines the render thread
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#include <BorealisPCH.hpp>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <Graphics/RenderThread.hpp>
+#include <Graphics/GraphicsContext.hpp>
+#include <Core/LoggerSystem.hpp>
+#include <Core/FlatHashMap.hpp>
+
+namespace Borealis
+{
+	namespace
+	{
+		struct RenderThreadData
+		{
+			RenderThread::Policy mPolicy = RenderThread::Policy::SingleThreaded;
+			GraphicsContext* mContext = nullptr;
+
+			// Game thread records into mQueues[mSubmitIndex], render thread executes the other
+			RenderCommandQueue mQueues[2];
+			std::vector<Ref<void>> mRetained[2]; // Resources the queue's commands point to
+			FlatHashSet<const void*> mRetainedSet[2];
+			uint32_t mSubmitIndex = 0;
+			uint32_t mRenderIndex = 1;
+			uint32_t mLastFrameCommandCount = 0;
+
+			std::thread mThread;
+			bool mStarted = false;
+
+			std::mutex mMutex;
+			std::condition_variable mSignal;
+			uint64_t mKickedFrame = 0;
+			uint64_t mCompletedFrame = 0;
+			bool mReleaseRequested = false;
+			bool mRunning = false;
+		};
+
+		RenderThreadData* sData = nullptr;
+		thread_local bool tExecuting = false;
+		thread_local uint32_t tScopedDepth = 0;
+
+		void RenderLoop()
+		{
+			bool hasContext = false;
+			std::unique_lock<std::mutex> lock(sData->mMutex);
+			while (true)
+			{
+				sData->mSignal.wait(lock, []
+					{
+						return sData->mKickedFrame > sData->mCompletedFrame || sData->mReleaseRequested || !sData->mRunning;
+					});
+
+				if (sData->mKickedFrame > sData->mCompletedFrame)
+				{
+					RenderCommandQueue& queue = sData->mQueues[sData->mRenderIndex];
+					uint64_t frame = sData->mKickedFrame;
+					lock.unlock();
+
+					if (!hasContext)
+					{
+						sData->mContext->MakeCurrent();
+						hasContext = true;
+					}
+
+					{
+						PROFILE_SCOPE("RenderThread::Execute");
+						tExecuting = true;
+						queue.Execute();
+						tExecuting = false;
+					}
+
+					lock.lock();
+					sData->mCompletedFrame = frame;
+					sData->mSignal.notify_all();
+					continue;
+				}
+
+				if (sData->mReleaseRequested)
+				{
+					if (hasContext)
+					{
+						sData->mContext->DetachCurrent();
+						hasContext = false;
+					}
+					sData->mReleaseRequested = false;
+					sData->mSignal.notify_all();
+					continue;
+				}
+
+				if (!sData->mRunning)
+					break;
+			}
+
+			if (hasContext)
+				sData->mContext->DetachCurrent();
+		}
+
+		void WaitForIdle(std::unique_lock<std::mutex>& lock)
+		{
+			sData->mSignal.wait(lock, [] { return sData->mCompletedFrame == sData->mKickedFrame; });
+		}
+
+		void ReleaseRetained(uint32_t index)
+		{
+			// Capacity is kept, so a steady frame does not allocate
+			sData->mRetainedSet[index].clear();
+			sData->mRetained[index].clear();
+		}
+
+		void Kick()
+		{
+			{
+				std::lock_guard<std::mutex> lock(sData->mMutex);
+				sData->mRenderIndex = sData->mSubmitIndex;
+				++sData->mKickedFrame;
+			}
+			sData->mSignal.notify_all();
+		}
+	}
+
+	void RenderThread::Init(Policy policy, GraphicsContext* context)
+	{
+		sData = new RenderThreadData();
+		sData->mPolicy = policy;
+		sData->mContext = context;
+		BOREALIS_CORE_INFO("Render thread policy: {}", policy == Policy::MultiThreaded ? "Multithreaded" : "Singlethreaded");
+	}
+
+	void RenderThread::Free()
+	{
+		if (!sData)
+			return;
+
+		if (sData->mStarted)
+		{
+			// Flush whatever was recorded after the last EndFrame, e.g. by destructors
+			WaitForRenderThread();
+			if (sData->mQueues[sData->mSubmitIndex].GetCommandCount() > 0)
+			{
+				Kick();
+				WaitForRenderThread();
+			}
+
+			{
+				std::lock_guard<std::mutex> lock(sData->mMutex);
+				sData->mRunning = false;
+			}
+			sData->mSignal.notify_all();
+			sData->mThread.join();
+			sData->mContext->MakeCurrent();
+		}
+		else
+		{
+			ExecuteSubmitted();
+		}
+
+		// Clear sData first so that commands submitted by the captures' destructors run inline
+		std::unique_ptr<RenderThreadData> data(sData);
+		sData = nullptr;
+		data.reset();
+	}
+
+	void RenderThread::EndFrame()
+	{
+		PROFILE_FUNCTION();
+
+		if (!sData)
+			return;
+
+		RenderCommandQueue& submitted = sData->mQueues[sData->mSubmitIndex];
+		sData->mLastFrameCommandCount = submitted.GetCommandCount();
+
+		if (!sData->mStarted)
+		{
+			// Everything has executed inline. Swap first, since destroying the captures may submit more commands.
+			uint32_t retired = sData->mSubmitIndex;
+			sData->mSubmitIndex ^= 1;
+			sData->mQueues[retired].Reset();
+			ReleaseRetained(retired);
+
+			if (sData->mPolicy == Policy::MultiThreaded)
+			{
+				sData->mContext->DetachCurrent();
+				sData->mRunning = true;
+				sData->mThread = std::thread(RenderLoop);
+				sData->mStarted = true;
+			}
+			return;
+		}
+
+		// Wait for frame N-1, then retire it. Commands its destructors submit land in frame N.
+		{
+			std::unique_lock<std::mutex> lock(sData->mMutex);
+			WaitForIdle(lock);
+		}
+		sData->mQueues[sData->mSubmitIndex ^ 1].Reset();
+		ReleaseRetained(sData->mSubmitIndex ^ 1);
+
+		Kick();
+		sData->mSubmitIndex ^= 1;
+	}
+
+	void RenderThread::WaitForRenderThread()
+	{
+		if (!sData || !sData->mStarted)
+			return;
+
+		std::unique_lock<std::mutex> lock(sData->mMutex);
+		WaitForIdle(lock);
+	}
+
+	RenderThread::Policy RenderThread::GetPolicy()
+	{
+		return sData ? sData->mPolicy : Policy::SingleThreaded;
+	}
+
+	bool RenderThread::IsMultiThreaded()
+	{
+		return sData && sData->mStarted;
+	}
+
+	uint32_t RenderThread::GetLastFrameCommandCount()
+	{
+		return sData ? sData->mLastFrameCommandCount : 0;
+	}
+
+	bool RenderThread::IsRecording()
+	{
+		return sData && !tExecuting && tScopedDepth == 0;
+	}
+
+	RenderCommandQueue& RenderThread::GetSubmitQueue()
+	{
+		return sData->mQueues[sData->mSubmitIndex];
+	}
+
+	bool RenderThread::MarkRetained(const void* resource)
+	{
+		return sData->mRetainedSet[sData->mSubmitIndex].insert(resource).second;
+	}
+
+	void RenderThread::AddRetained(Ref<void> resource)
+	{
+		sData->mRetained[sData->mSubmitIndex].push_back(std::move(resource));
+	}
+
+	void RenderThread::ExecuteSubmitted()
+	{
+		tExecuting = true;
+		sData->mQueues[sData->mSubmitIndex].Execute();
+		tExecuting = false;
+	}
+
+	RenderThread::ScopedContext::ScopedContext()
+	{
+		if (tScopedDepth++ > 0 || !IsMultiThreaded())
+			return;
+
+		PROFILE_FUNCTION();
+
+		// Let the render thread finish the frame in flight, then have it give up the context
+		{
+			std::unique_lock<std::mutex> lock(sData->mMutex);
+			WaitForIdle(lock);
+			sData->mReleaseRequested = true;
+			sData->mSignal.notify_all();
+			sData->mSignal.wait(lock, [] { return !sData->mReleaseRequested; });
+		}
+
+		sData->mContext->MakeCurrent();
+		mBorrowed = true;
+	}
+
+	RenderThread::ScopedContext::~ScopedContext()
+	{
+		--tScopedDepth;
+		if (!mBorrowed)
+			return;
+
+		// The render thread takes the context back when it executes its next frame
+		sData->mContext->DetachCurrent();
+	}
+}
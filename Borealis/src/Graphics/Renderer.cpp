@@ -18,6 +18,10 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <Graphics/OpenGL/ShaderOpenGLImpl.hpp>
 #include <Graphics/Renderer2D.hpp>
 #include <Graphics/Renderer3D.hpp>
+#include <Graphics/GpuProfiler.hpp>
+#include <Graphics/TextureStreamer.hpp>
+#include <Graphics/GeometryPool.hpp>
+#include <Graphics/MaterialBuffer.hpp>
 
 namespace Borealis
 {
@@ -27,12 +31,21 @@ namespace Borealis
 		 PROFILE_FUNCTION();
 
 		 RenderCommand::Init();
+		 GeometryPool::Init();
+		 MaterialBuffer::Init();
 		 Renderer2D::Init();
 		 Renderer3D::Init();
+		 GpuProfiler::Init();
+		 TextureStreamer::Init();
 	 }
 	 void Renderer::Free()
 	 {
+		 TextureStreamer::Free();
+		 GpuProfiler::Free();
 		 Renderer2D::Free();
+		 MaterialBuffer::Free();
+		 GeometryPool::Free();
+		 ShaderLibrary::Clear();
 	 }
 	 void Renderer::Begin(OrthographicCamera& camera)
 	 {
@@ -41,6 +54,12 @@ namespace Borealis
 	 void Renderer::End()
 	 {
 	 }
+	 void Renderer::EndFrame()
+	 {
+		 // The draws of this frame have been submitted, so the streamer sees what they asked for
+		 TextureStreamer::Update();
+		 RenderThread::Submit([]() { Renderer2D::EndFrame(); GpuProfiler::EndGpuFrame(); RendererAPI::EndFrameStatistics(); });
+	 }
 	 void Renderer::Push(const Ref<VertexArray>& VAO, const Ref<Shader>& shader, const glm::mat4& transform)
 	 {
 		 shader->Bind();
@@ -13,26 +13,18 @@ prior written consent of DigiPen Institute of Technology is prohibited.
  /******************************************************************************/
 
 #include "BorealisPCH.hpp"
+#include <mutex>
 #include <glm/gtc/matrix_transform.hpp>
 #include "Graphics/Renderer2D.hpp"
 #include <Graphics/VertexArray.hpp>
 #include <Graphics/Shader.hpp>
 #include <Graphics/RenderCommand.hpp>
+#include <Graphics/RingBuffer.hpp>
+#include <Graphics/SpriteTextureCache.hpp>
+#include <Graphics/GpuProfiler.hpp>
 
 namespace Borealis
 {
-	struct QuadData
-	{
-		glm::vec3 Position;
-		glm::vec4 Colour;
-		glm::vec2 TexCoord;
-		uint32_t TexIndex;
-		float TilingFactor;
-
-		//Editor only
-		int EntityID;
-	};
-
 	struct CircleData
 	{
 		glm::vec3 WorldPosition;
@@ -51,74 +43,103 @@ namespace Borealis
 		glm::vec4 Colour;
 	};
 
-	struct FontData
-	{
-		glm::vec3 Position;
-		glm::vec4 Colour;
-		glm::vec2 TexCoord;
+	/*
+		Batch streamed straight into a ring buffer region. Vertices are written
+		through mPtr into GPU visible memory, then committed and drawn with the
+		allocation's base vertex.
+	*/
+	template <typename Vertex>
+	struct StreamBatch
+	{
+		Ref<RingBuffer> mBuffer;
+		RingBuffer::Allocation mAllocation;
+		Vertex* mBase = nullptr;
+		Vertex* mPtr = nullptr;
+		uint32_t mCapacity = 0; // In vertices
+
+		bool HasRoom(uint32_t vertexCount) const { return mBase && static_cast<uint32_t>(mPtr - mBase) + vertexCount <= mCapacity; }
+		uint32_t GetVertexCount() const { return mBase ? static_cast<uint32_t>(mPtr - mBase) : 0; }
+		uint32_t GetBaseVertex() const { return mAllocation.mOffset / sizeof(Vertex); }
+
+		void Open()
+		{
+			mAllocation = mBuffer->Allocate(mCapacity * sizeof(Vertex), sizeof(Vertex));
+			mBase = mPtr = static_cast<Vertex*>(mAllocation.mData);
+		}
 
-		//Editor only
-		int EntityID;
+		void Close()
+		{
+			if (mBase)
+				mBuffer->Commit(mAllocation, GetVertexCount() * sizeof(Vertex));
+			mBase = mPtr = nullptr;
+		}
 	};
 
 	struct Renderer2DData
 	{
 		static const uint32_t MaxQuads = 10000;
+		static const uint32_t MaxSpriteInstances = 65536;
 		static const uint32_t MaxCircles = 1000;
-		static const uint32_t MaxLines = 100;
+		static const uint32_t MaxLines = 1000;
 		static const uint32_t MaxFont = 10000;
 		static const uint32_t MaxCircleVertices = MaxCircles * 4;
 		static const uint32_t MaxLineVertices = MaxLines * 2;
-		static const uint32_t MaxFontVertices = MaxLines * 4;
-		static const uint32_t MaxVertices = MaxQuads * 4;
+		static const uint32_t MaxFontVertices = MaxFont * 4;
+		static_assert(MaxFont <= MaxQuads, "Text batches share the quad element buffer");
 		static const uint32_t MaxIndices = MaxQuads * 6;
 		static const uint32_t MaxTextureSlots = 16;
+		static const uint32_t BatchesPerFrame = 2; // Full batches a ring region starts with, it grows if a frame needs more
 
 
 		std::array<Ref<Texture2D>, MaxTextureSlots> TextureSlots;
-		QuadData* QuadBufferBase = nullptr;
-		QuadData* QuadBufferPtr = nullptr;
-
-		CircleData* CircleBufferBase = nullptr;
-		CircleData* CircleBufferPtr = nullptr;
-
-		LineData* LineBufferBase = nullptr;
-		LineData* LineBufferPtr = nullptr;
+		std::unordered_map<const Texture2D*, uint32_t> mTextureUnits; // Texture to slot, for the plain texture path
+
+		// Texture array path, used when the context can build them
+		Scope<SpriteTextureCache> mTextureCache;
+		SpriteTextureCache::Location mWhiteLocation;
+		std::vector<int32_t> mPageUnits; // Page to texture unit in the current batch, -1 if unbound
+		std::array<uint32_t, MaxTextureSlots> mBoundPages;
+		uint32_t mBoundPageCount = 0;
+		StreamBatch<Renderer2D::SpriteInstance> mQuads; // One instance per quad, expanded in the vertex shader
+		StreamBatch<CircleData> mCircles;
+		StreamBatch<LineData> mLines;
+		StreamBatch<TextVertex> mFonts;
 
 		Ref<Texture2D> FontTexture;
-		FontData* FontBufferBase = nullptr;
-		FontData* FontBufferPtr = nullptr;
 		
 		glm::vec4 VertexPos[4];
 
 		Ref<VertexArray> mQuadVAO;
-		Ref<VertexBuffer> mQuadVBO;
 		Ref<Shader> mQuadShader; 
 		Ref<Texture2D> mWhiteTexture;
 
 		Ref<VertexArray> mCircleVAO;
-		Ref<VertexBuffer> mCircleVBO;
 		Ref<Shader> mCircleShader;
 
 		Ref<VertexArray> mLineVAO;
-		Ref<VertexBuffer> mLineVBO;
 		Ref<Shader> mLineShader;
 		
 		Ref<VertexArray> mFontVAO;
-		Ref<VertexBuffer> mFontVBO;
 		Ref<Shader> mFontShader;
 		
-		Renderer2D::Statistics mStats;
-		uint32_t QuadIndexCount = 0;
-		uint32_t CircleIndexCount = 0;
-		uint32_t LineVertexCount = 0;
-		uint32_t FontIndexCount = 0;
+		Renderer2D::Statistics mStats; // Counted on the render side
+		Renderer2D::Statistics mPublishedStats;
+		std::mutex mPublishedMutex;
 		uint32_t TextureSlotIndex = 1; // 0: White texture
 	};
 	
 	
 	static Renderer2DData* sData;
 
+	template <typename Vertex>
+	static void CreateStream(StreamBatch<Vertex>& batch, uint32_t capacity, const BufferLayout& layout, const Ref<VertexArray>& VAO)
+	{
+		batch.mCapacity = capacity;
+		batch.mBuffer = RingBuffer::Create(capacity * sizeof(Vertex) * Renderer2DData::BatchesPerFrame);
+		batch.mBuffer->SetLayout(layout);
+		VAO->AddVertexBuffer(batch.mBuffer);
+	}
+
 	void Renderer2D::Init()
 	{
 		PROFILE_FUNCTION();
@@ -126,19 +147,17 @@ namespace Borealis
 		sData = new Renderer2DData();
 		sData->mQuadVAO = VertexArray::Create();
 
-		sData->mQuadVBO = VertexBuffer::Create(sData->MaxVertices * sizeof(QuadData));
-		sData->mQuadVBO->SetLayout({
+		CreateStream(sData->mQuads, sData->MaxSpriteInstances, BufferLayout({
 			{ ShaderDataType::Float3, "a_Position" },
+			{ ShaderDataType::Float3, "a_AxisX" },
+			{ ShaderDataType::Float3, "a_AxisY" },
+			{ ShaderDataType::Float4, "a_UVRect" },
 			{ ShaderDataType::Float4, "a_Colour" },
-			{ ShaderDataType::Float2, "a_TexCoord"},
-			{ ShaderDataType::Float, "a_TexIndex"},
+			{ ShaderDataType::Int, "a_TexIndex"},
+			{ ShaderDataType::Float, "a_TexLayer"},
 			{ ShaderDataType::Float, "a_TilingFactor"},
 			{ ShaderDataType::Int, "a_EntityID"}
-			});
-		sData->mQuadVAO->AddVertexBuffer(sData->mQuadVBO);
-
-		sData->QuadBufferBase = new QuadData[sData->MaxVertices];
-		sData->QuadBufferPtr = sData->QuadBufferBase;
+			}, true), sData->mQuadVAO);
 
 		uint32_t* indices = new uint32_t[sData->MaxIndices];
 
@@ -153,53 +172,40 @@ namespace Borealis
 		}
 
 		Ref<ElementBuffer> EBO = ElementBuffer::Create(indices, sData->MaxIndices);
-		sData->mQuadVAO->SetElementBuffer(EBO);
 		delete[] indices;
 
 		//circle
 		sData->mCircleVAO = VertexArray::Create();
 
-		sData->mCircleVBO = VertexBuffer::Create(sData->MaxCircleVertices * sizeof(CircleData));
-		sData->mCircleVBO->SetLayout({
+		CreateStream(sData->mCircles, sData->MaxCircleVertices, {
 			{ ShaderDataType::Float3, "a_WorldPosition" },
 			{ ShaderDataType::Float2, "a_LocalPosition" },
 			{ ShaderDataType::Float4, "a_Colour" },
 			{ ShaderDataType::Float, "a_Thickness"},
 			{ ShaderDataType::Float, "a_Float"},
 			{ ShaderDataType::Int, "a_EntityID"}
-			});
-		sData->mCircleVAO->AddVertexBuffer(sData->mCircleVBO);
+			}, sData->mCircleVAO);
 		sData->mCircleVAO->SetElementBuffer(EBO);
-		sData->CircleBufferBase = new CircleData[sData->MaxCircleVertices];
-		sData->CircleBufferPtr = sData->CircleBufferBase;
 
 		//line
 		sData->mLineVAO = VertexArray::Create();
 
-		sData->mLineVBO = VertexBuffer::Create(sData->MaxLines * sizeof(LineData));
-		sData->mLineVBO->SetLayout({
+		CreateStream(sData->mLines, sData->MaxLineVertices, {
 			{ ShaderDataType::Float3, "a_Position" },
 			{ ShaderDataType::Float4, "a_Colour" },
-			});
-		sData->mLineVAO->AddVertexBuffer(sData->mLineVBO);
-		sData->LineBufferBase = new LineData[sData->MaxLines];
-		sData->LineBufferPtr = sData->LineBufferBase;
+			}, sData->mLineVAO);
 
 		//Font
 		sData->mFontVAO = VertexArray::Create();
 
-		sData->mFontVBO = VertexBuffer::Create(sData->MaxFont * sizeof(FontData));
-		sData->mFontVBO->SetLayout({
+		CreateStream(sData->mFonts, sData->MaxFontVertices, {
 			{ ShaderDataType::Float3, "a_Position" },
 			{ ShaderDataType::Float4, "a_Colour" },
 			{ ShaderDataType::Float2, "a_TexCoord"},
 			{ ShaderDataType::Int, "a_EntityID"}
-			});
-		sData->mFontVAO->AddVertexBuffer(sData->mFontVBO);
+			}, sData->mFontVAO);
 
 		sData->mFontVAO->SetElementBuffer(EBO);
-		sData->FontBufferBase = new FontData[sData->MaxFont];
-		sData->FontBufferPtr = sData->FontBufferBase;
 
 
 
@@ -213,13 +219,27 @@ namespace Borealis
 			samplers[i] = i;
 		}
 
-		sData->mQuadShader = Shader::Create("engineResources/shaders/Renderer2D_Quad.glsl");
-		sData->mQuadShader->Bind();
-		sData->mQuadShader->Set("u_Texture", samplers, Renderer2DData::MaxTextureSlots);
+		// Sprites sample texture arrays when available, so a batch is no longer limited to 16 textures.
+		// The cache needs OpenGL 4.3, a 4.1 context uses the texture slots
+		sData->mTextureCache = SpriteTextureCache::Create();
+		if (sData->mTextureCache && sData->mTextureCache->Acquire(sData->mWhiteTexture.get(), sData->mWhiteLocation))
+		{
+			sData->mQuadShader = ShaderLibrary::Load("engineResources/shaders/Renderer2D_QuadArray.glsl");
+			sData->mQuadShader->Bind();
+			sData->mQuadShader->Set("u_TextureArrays", samplers, Renderer2DData::MaxTextureSlots);
+		}
+		else
+		{
+			sData->mTextureCache.reset();
+			sData->mQuadShader = ShaderLibrary::Load("engineResources/shaders/Renderer2D_Quad.glsl");
+			sData->mQuadShader->Bind();
+			sData->mQuadShader->Set("u_Texture", samplers, Renderer2DData::MaxTextureSlots);
+		}
+		BOREALIS_CORE_INFO("Renderer2D sprite textures: {}", sData->mTextureCache ? "Texture arrays" : "Texture slots (texture arrays need OpenGL 4.3)");
 
-		sData->mCircleShader = Shader::Create("engineResources/shaders/Renderer2D_Circle.glsl");
-		sData->mLineShader = Shader::Create("engineResources/shaders/Renderer2D_Line.glsl");
-		sData->mFontShader = Shader::Create("engineResources/shaders/Renderer2D_Font.glsl");
+		sData->mCircleShader = ShaderLibrary::Load("engineResources/shaders/Renderer2D_Circle.glsl");
+		sData->mLineShader = ShaderLibrary::Load("engineResources/shaders/Renderer2D_Line.glsl");
+		sData->mFontShader = ShaderLibrary::Load("engineResources/shaders/Renderer2D_Font.glsl");
 
 		sData->TextureSlots[0] = sData->mWhiteTexture;
 
@@ -231,166 +251,336 @@ namespace Borealis
 	void Renderer2D::Free()
 	{
 		PROFILE_FUNCTION();
-		delete[] sData->QuadBufferBase;	
-		delete[] sData->CircleBufferBase;
-		delete[] sData->LineBufferBase;
-		delete[] sData->FontBufferBase;
+		sData->mQuads.Close();
+		sData->mCircles.Close();
+		sData->mLines.Close();
+		sData->mFonts.Close();
 		delete sData;	
 	}
+
+	/*!***********************************************************************
+		\brief
+			Unbinds every texture of the quad batch
+	*************************************************************************/
+	static void ResetTextureUnits()
+	{
+		for (uint32_t i = 0; i < sData->mBoundPageCount; i++)
+		{
+			sData->mPageUnits[sData->mBoundPages[i]] = -1;
+		}
+		sData->mBoundPageCount = 0;
+
+		for (uint32_t i = 1; i < sData->TextureSlotIndex; i++)
+		{
+			sData->TextureSlots[i].reset();
+		}
+		sData->TextureSlotIndex = 1;
+		sData->mTextureUnits.clear();
+	}
+
+	static void ResetBatches()
+	{
+		// Anything drawn since the last flush is discarded, as before
+		sData->mQuads.Close();
+		sData->mCircles.Close();
+		sData->mLines.Close();
+		sData->mFonts.Close();
+		ResetTextureUnits();
+	}
+
 	void Renderer2D::Begin(const OrthographicCamera& camera)
 	{
 		PROFILE_FUNCTION();
+		GpuProfiler::BeginZone("Renderer2D");
 
 		sData->mQuadShader->Bind();
 		sData->mQuadShader->Set("u_ViewProjection", camera.GetViewProjectionMatrix());
 
-		sData->QuadIndexCount = 0;
-		sData->QuadBufferPtr = sData->QuadBufferBase;
-
 		sData->mCircleShader->Bind();
 		sData->mCircleShader->Set("u_ViewProjection", camera.GetViewProjectionMatrix());
 
-		sData->CircleIndexCount = 0;
-		sData->CircleBufferPtr = sData->CircleBufferBase;
-
 		sData->mLineShader->Bind();
 		sData->mLineShader->Set("u_ViewProjection", camera.GetViewProjectionMatrix());
 
-		sData->LineVertexCount = 0;
-		sData->LineBufferPtr = sData->LineBufferBase;
-
 		sData->mFontShader->Bind();
 		sData->mFontShader->Set("u_ViewProjection", camera.GetViewProjectionMatrix());
 
-		sData->FontIndexCount = 0;
-		sData->FontBufferPtr = sData->FontBufferBase;
-
-		sData->TextureSlotIndex = 1;
+		ResetBatches();
 	}
 
 	void Renderer2D::Begin(const EditorCamera& camera)
 	{
 		PROFILE_FUNCTION();
+		GpuProfiler::BeginZone("Renderer2D");
 
 		sData->mQuadShader->Bind();
 		sData->mQuadShader->Set("u_ViewProjection", camera.GetViewProjectionMatrix());
 
-		sData->QuadIndexCount = 0;
-		sData->QuadBufferPtr = sData->QuadBufferBase;
-
 		sData->mCircleShader->Bind();
 		sData->mCircleShader->Set("u_ViewProjection", camera.GetViewProjectionMatrix());
 
-		sData->CircleIndexCount = 0;
-		sData->CircleBufferPtr = sData->CircleBufferBase;
-
 		sData->mLineShader->Bind();
 		sData->mLineShader->Set("u_ViewProjection", camera.GetViewProjectionMatrix());
 
-		sData->LineVertexCount = 0;
-		sData->LineBufferPtr = sData->LineBufferBase;
-
 		sData->mFontShader->Bind();
 		sData->mFontShader->Set("u_ViewProjection", camera.GetViewProjectionMatrix());
 
-		sData->FontIndexCount = 0;
-		sData->FontBufferPtr = sData->FontBufferBase;
-		 
-		sData->TextureSlotIndex = 1;
+		ResetBatches();
 	}
 
 
 	void Renderer2D::Begin(const Camera& camera, const glm::mat4& transform)
 	{
 		PROFILE_FUNCTION();
+		GpuProfiler::BeginZone("Renderer2D");
 
 		glm::mat4 viewProj = camera.GetProjectionMatrix() *glm::inverse(transform);
 
 		sData->mQuadShader->Bind();
 		sData->mQuadShader->Set("u_ViewProjection", viewProj);
 
-		sData->QuadIndexCount = 0;
-		sData->QuadBufferPtr = sData->QuadBufferBase;
-
 		sData->mCircleShader->Bind();
 		sData->mCircleShader->Set("u_ViewProjection", viewProj);
 
-		sData->CircleIndexCount = 0;
-		sData->CircleBufferPtr = sData->CircleBufferBase;
-
 		sData->mLineShader->Bind();
 		sData->mLineShader->Set("u_ViewProjection", viewProj);
 
-		sData->LineVertexCount = 0;
-		sData->LineBufferPtr = sData->LineBufferBase;
-
 		sData->mFontShader->Bind();
 		sData->mFontShader->Set("u_ViewProjection", viewProj);
 
-		sData->FontIndexCount = 0;
-		sData->FontBufferPtr = sData->FontBufferBase;
-
-		sData->TextureSlotIndex = 1;
+		ResetBatches();
 	}
 
 	void Renderer2D::End()
 	{
 		PROFILE_FUNCTION();
 		Flush();
-
+		GpuProfiler::EndZone();
 	}
-	void Renderer2D::Flush()
+
+	static void FlushQuads()
 	{
-		PROFILE_FUNCTION();
-		if (sData->QuadIndexCount)
+		uint32_t instanceCount = sData->mQuads.GetVertexCount();
+		uint32_t baseInstance = sData->mQuads.GetBaseVertex();
+		sData->mQuads.Close();
+
+		if (instanceCount)
 		{
-			uint32_t size = (uint32_t)((uint8_t*)sData->QuadBufferPtr - (uint8_t*)sData->QuadBufferBase);
-			sData->mQuadVBO->SetData(sData->QuadBufferBase, size);
-			for (uint32_t i = 0; i < sData->TextureSlotIndex; i++)
+			PROFILE_GPU_SCOPE("Quads");
+			if (sData->mTextureCache)
 			{
-				sData->TextureSlots[i]->Bind(i);
+				for (uint32_t i = 0; i < sData->mBoundPageCount; i++)
+				{
+					sData->mTextureCache->BindPage(sData->mBoundPages[i], i);
+				}
+			}
+			else
+			{
+				for (uint32_t i = 0; i < sData->TextureSlotIndex; i++)
+				{
+					sData->TextureSlots[i]->Bind(i);
+				}
 			}
 			sData->mQuadShader->Bind();
-			RenderCommand::DrawElements(sData->mQuadVAO, sData->QuadIndexCount);
+			RenderCommand::DrawInstanced(sData->mQuadVAO, 6, instanceCount, baseInstance);
 			sData->mStats.DrawCalls++;
 		}
+		ResetTextureUnits();
+	}
+
+	static void FlushCircles()
+	{
+		uint32_t vertexCount = sData->mCircles.GetVertexCount();
+		uint32_t baseVertex = sData->mCircles.GetBaseVertex();
+		sData->mCircles.Close();
 
-		if (sData->CircleIndexCount)
+		if (vertexCount)
 		{
-			uint32_t size = (uint32_t)((uint8_t*)sData->CircleBufferPtr - (uint8_t*)sData->CircleBufferBase);
-			sData->mCircleVBO->SetData(sData->CircleBufferBase, size);
+			PROFILE_GPU_SCOPE("Circles");
 			sData->mCircleShader->Bind();
-			RenderCommand::DrawElements(sData->mCircleVAO, sData->CircleIndexCount);
+			RenderCommand::DrawElements(sData->mCircleVAO, vertexCount / 4 * 6, baseVertex);
 			sData->mStats.DrawCalls++;
 		}
+	}
+
+	static void FlushLines()
+	{
+		uint32_t vertexCount = sData->mLines.GetVertexCount();
+		uint32_t firstVertex = sData->mLines.GetBaseVertex();
+		sData->mLines.Close();
 
-		if (sData->LineVertexCount)
+		if (vertexCount)
 		{
-			uint32_t size = (uint32_t)((uint8_t*)sData->LineBufferPtr - (uint8_t*)sData->LineBufferBase);
-			sData->mLineVBO->SetData(sData->LineBufferBase, size);
+			PROFILE_GPU_SCOPE("Lines");
 			sData->mLineShader->Bind();
-			RenderCommand::DrawLines(sData->mLineVAO, sData->LineVertexCount);
+			RenderCommand::DrawLines(sData->mLineVAO, vertexCount, firstVertex);
 			sData->mStats.DrawCalls++;
 		}
+	}
 
-		if (sData->FontIndexCount)
+	static void FlushFonts()
+	{
+		uint32_t vertexCount = sData->mFonts.GetVertexCount();
+		uint32_t baseVertex = sData->mFonts.GetBaseVertex();
+		sData->mFonts.Close();
+
+		if (vertexCount)
 		{
-			uint32_t size = (uint32_t)((uint8_t*)sData->FontBufferPtr - (uint8_t*)sData->FontBufferBase);
-			sData->mFontVBO->SetData(sData->FontBufferBase, size);
+			PROFILE_GPU_SCOPE("Text");
 			sData->FontTexture->Bind(0);
 			sData->mFontShader->Bind();
-			RenderCommand::DrawElements(sData->mFontVAO, sData->FontIndexCount);
+			RenderCommand::DrawElements(sData->mFontVAO, vertexCount / 4 * 6, baseVertex);
 			sData->mStats.DrawCalls++;
 		}
 	}
 
-	static void FlushReset()
+	void Renderer2D::Flush()
 	{
-		Renderer2D::End();
-		sData->QuadBufferPtr = sData->QuadBufferBase;
-		sData->QuadIndexCount = 0;
-		sData->TextureSlotIndex = 1;
+		PROFILE_FUNCTION();
+		FlushQuads();
+		FlushCircles();
+		FlushLines();
+		FlushFonts();
 	}
+
+	void Renderer2D::EndFrame()
+	{
+		PROFILE_FUNCTION();
+		ResetBatches();
+		sData->mQuads.mBuffer->EndFrame();
+		sData->mCircles.mBuffer->EndFrame();
+		sData->mLines.mBuffer->EndFrame();
+		sData->mFonts.mBuffer->EndFrame();
+
+		if (sData->mTextureCache)
+			sData->mTextureCache->CollectGarbage();
+
+		{
+			std::lock_guard<std::mutex> lock(sData->mPublishedMutex);
+			sData->mPublishedStats = sData->mStats;
+		}
+		sData->mStats = {};
+	}
+
+	/*!***********************************************************************
+		\brief
+			Makes room for vertices in a batch, drawing what is in it if it is full
+	*************************************************************************/
+	template <typename Vertex, typename FlushFn>
+	static void Reserve(StreamBatch<Vertex>& batch, uint32_t vertexCount, FlushFn flush)
+	{
+		if (!batch.HasRoom(vertexCount))
+		{
+			flush();
+			batch.Open();
+		}
+	}
+
+	static void ReserveQuads() { Reserve(sData->mQuads, 1, FlushQuads); }
+
+	static void RestartQuads()
+	{
+		FlushQuads();
+		sData->mQuads.Open();
+	}
+
+	/*!***********************************************************************
+		\brief
+			Gets the texture unit a quad samples from, binding the texture to the
+			batch if needed. Restarts the batch when it runs out of units, so it
+			must be called after reserving the quad.
+		\param[in] texture
+			Texture to sample, null for the white texture
+		\param[out] layer
+			Layer of the texture array to sample, 0 for plain textures
+		\return
+			Texture unit
+	*************************************************************************/
+	static uint32_t GetTextureIndex(Texture2D* texture, float& layer)
+	{
+		if (sData->mTextureCache)
+		{
+			SpriteTextureCache::Location location;
+			if (!texture || !sData->mTextureCache->Acquire(texture, location))
+				location = sData->mWhiteLocation;
+			layer = static_cast<float>(location.mLayer);
+
+			if (location.mPage >= sData->mPageUnits.size())
+				sData->mPageUnits.resize(location.mPage + 1, -1);
+
+			if (sData->mPageUnits[location.mPage] < 0)
+			{
+				if (sData->mBoundPageCount == Renderer2DData::MaxTextureSlots)
+					RestartQuads();
+
+				sData->mBoundPages[sData->mBoundPageCount] = location.mPage;
+				sData->mPageUnits[location.mPage] = static_cast<int32_t>(sData->mBoundPageCount++);
+			}
+			return static_cast<uint32_t>(sData->mPageUnits[location.mPage]);
+		}
+
+		layer = 0.0f;
+		if (!texture)
+			return 0;
+
+		// Screen space draws have no UV density to go on, keep the whole chain streamed in
+		TextureStreamer::RequestMip(texture->GetStreamingHandle(), 0);
+
+		auto it = sData->mTextureUnits.find(texture);
+		if (it != sData->mTextureUnits.end())
+			return it->second;
+
+		if (sData->TextureSlotIndex == Renderer2DData::MaxTextureSlots)
+			RestartQuads();
+
+		// The slot keeps the texture alive until the batch is drawn
+		uint32_t textureUnit = sData->TextureSlotIndex++;
+		sData->TextureSlots[textureUnit] = std::static_pointer_cast<Texture2D>(texture->shared_from_this());
+		sData->mTextureUnits[texture] = textureUnit;
+		return textureUnit;
+	}
+
+	/*!***********************************************************************
+		\brief
+			Adds a quad instance to the batch. The quad's local x and y axes are
+			taken straight from the transform, which carry its rotation and scale.
+	*************************************************************************/
+	static void SubmitQuad(const glm::mat4& transform, Texture2D* texture, const glm::vec4& uvRect, float tilingFactor, const glm::vec4& colour, int entityID)
+	{
+		ReserveQuads();
+
+		float textureLayer;
+		uint32_t textureUnit = GetTextureIndex(texture, textureLayer);
+
+		Renderer2D::SpriteInstance& instance = *sData->mQuads.mPtr++;
+		instance.Position = transform[3];
+		instance.AxisX = transform[0];
+		instance.AxisY = transform[1];
+		instance.UVRect = uvRect;
+		instance.Colour = colour;
+		instance.TexIndex = static_cast<int>(textureUnit);
+		instance.TexLayer = textureLayer;
+		instance.TilingFactor = tilingFactor;
+		instance.EntityID = entityID;
+
+		sData->mStats.QuadCount++;
+	}
+
+	static constexpr glm::vec4 FullUVRect = { 0.0f, 0.0f, 1.0f, 1.0f };
+
+	static glm::vec4 GetUVRect(const Ref<SubTexture2D>& subtexture)
+	{
+		const glm::vec2* texCoords = subtexture->GetTexCoords();
+		return { texCoords[0], texCoords[2] };
+	}
+
+	static glm::mat4 GetRotatedTransform(const glm::vec3& position, float rotation, const glm::vec2& size)
+	{
+		return glm::translate(glm::mat4(1.0f), position) *
+			glm::rotate(glm::mat4(1.0f), glm::radians(rotation), glm::vec3(0, 0, 1)) *
+			glm::scale(glm::mat4(1.0f), { size.x,size.y,1.0f });
+	}
+
 	void Renderer2D::DrawSprite(const glm::mat4& transform, const SpriteRendererComponent& sprite, int entityID)
 	{
 		PROFILE_FUNCTION();
@@ -398,29 +588,89 @@ namespace Borealis
 		{
 			DrawQuad(transform, sprite.Texture, sprite.TilingFactor, sprite.Colour, entityID);
 		}
-		DrawQuad(transform, sprite.Colour, entityID);
+		else
+		{
+			DrawQuad(transform, sprite.Colour, entityID);
+		}
+	}
+
+	void Renderer2D::DrawSprites(const SpriteInstance* instances, uint32_t count, Texture2D* texture)
+	{
+		PROFILE_FUNCTION();
+
+		while (count > 0)
+		{
+			ReserveQuads();
+
+			float textureLayer;
+			int textureUnit = static_cast<int>(GetTextureIndex(texture, textureLayer));
+
+			uint32_t batchCount = std::min(count, sData->mQuads.mCapacity - sData->mQuads.GetVertexCount());
+			SpriteInstance* destination = sData->mQuads.mPtr;
+			for (uint32_t i = 0; i < batchCount; i++)
+			{
+				destination[i] = instances[i];
+				destination[i].TexIndex = textureUnit;
+				destination[i].TexLayer = textureLayer;
+			}
+
+			sData->mQuads.mPtr += batchCount;
+			sData->mStats.QuadCount += batchCount;
+			instances += batchCount;
+			count -= batchCount;
+		}
+	}
+
+	void Renderer2D::DrawSprites(const SpriteSubmission* sprites, uint32_t count)
+	{
+		PROFILE_FUNCTION();
+
+		for (uint32_t i = 0; i < count; i++)
+		{
+			const SpriteSubmission& sprite = sprites[i];
+			SubmitQuad(sprite.Transform, sprite.Texture, FullUVRect, sprite.Texture ? sprite.TilingFactor : 1.0f, sprite.Colour, sprite.EntityID);
+		}
+	}
+
+	void Renderer2D::DrawCircles(const CircleSubmission* circles, uint32_t count)
+	{
+		PROFILE_FUNCTION();
+
+		for (uint32_t i = 0; i < count; i++)
+		{
+			const CircleSubmission& circle = circles[i];
+			DrawCircle(circle.Transform, circle.Colour, circle.Thickness, circle.Fade, circle.EntityID);
+		}
+	}
+
+	void Renderer2D::DrawStrings(const TextSubmission* texts, uint32_t count)
+	{
+		PROFILE_FUNCTION();
+
+		for (uint32_t i = 0; i < count; i++)
+		{
+			const TextSubmission& text = texts[i];
+			DrawString(*text.Layout, text.Transform, text.Colour, text.EntityID);
+		}
 	}
 
 	void Renderer2D::DrawCircle(const glm::mat4& transform, const glm::vec4& colour, float thickness, float fade, int entityID)
 	{
 		PROFILE_FUNCTION();
 
-		//if (sData->QuadIndexCount + 6 >= Renderer2DData::MaxIndices)
-		//	FlushReset();
+		Reserve(sData->mCircles, 4, FlushCircles);
 
 		for (int i = 0; i < 4; i++)
 		{
-			sData->CircleBufferPtr->WorldPosition = transform * sData->VertexPos[i];
-			sData->CircleBufferPtr->LocalPosition = sData->VertexPos[i] * 2.0f;
-			sData->CircleBufferPtr->Colour = colour;
-			sData->CircleBufferPtr->Thickness = thickness;
-			sData->CircleBufferPtr->Fade = fade;
-			sData->CircleBufferPtr->EntityID = entityID;
-			sData->CircleBufferPtr++;
+			sData->mCircles.mPtr->WorldPosition = transform * sData->VertexPos[i];
+			sData->mCircles.mPtr->LocalPosition = sData->VertexPos[i] * 2.0f;
+			sData->mCircles.mPtr->Colour = colour;
+			sData->mCircles.mPtr->Thickness = thickness;
+			sData->mCircles.mPtr->Fade = fade;
+			sData->mCircles.mPtr->EntityID = entityID;
+			sData->mCircles.mPtr++;
 		}
 
-		sData->CircleIndexCount += 6;
-
 		sData->mStats.QuadCount++;
 	}
 
@@ -460,18 +710,15 @@ namespace Borealis
 	{
 		PROFILE_FUNCTION();
 
-		//if (sData->QuadIndexCount + 6 >= Renderer2DData::MaxIndices)
-		//	FlushReset();
+		Reserve(sData->mLines, 2, FlushLines);
 
-		sData->LineBufferPtr->Position = p0;
-		sData->LineBufferPtr->Colour = colour;
-		sData->LineBufferPtr++;
+		sData->mLines.mPtr->Position = p0;
+		sData->mLines.mPtr->Colour = colour;
+		sData->mLines.mPtr++;
 
-		sData->LineBufferPtr->Position = p1;
-		sData->LineBufferPtr->Colour = colour;
-		sData->LineBufferPtr++;
-
-		sData->LineVertexCount += 2;
+		sData->mLines.mPtr->Position = p1;
+		sData->mLines.mPtr->Colour = colour;
+		sData->mLines.mPtr++;
 	}
 
 	void Renderer2D::DrawRotatedQuad(const glm::vec2& position, const float& rotation, const glm::vec2& size, const glm::vec4& colour)
@@ -482,29 +729,7 @@ namespace Borealis
 	{
 		PROFILE_FUNCTION();
 
-		if (sData->QuadIndexCount+6 >= Renderer2DData::MaxIndices)
-			FlushReset();
-
-		glm::mat4 transform =
-			glm::translate(glm::mat4(1.0f), position) *
-			glm::rotate(glm::mat4(1.0f), glm::radians(rotation), glm::vec3(0, 0, 1)) *
-			glm::scale(glm::mat4(1.0f), { size.x,size.y,1.0f });
-
-		constexpr uint32_t texIndex = 0;
-		constexpr glm::vec2 texCoords[] = { {0.0f,0.0f},{1.0f,0.0f},{1.0f,1.0f},{0.0f,1.0f} };
-
-		for (int i = 0; i < 4; i++)
-		{
-			sData->QuadBufferPtr->Position = transform * sData->VertexPos[i];
-			sData->QuadBufferPtr->Colour = colour;
-			sData->QuadBufferPtr->TexCoord = texCoords[i];
-			sData->QuadBufferPtr->TexIndex = texIndex;
-			sData->QuadBufferPtr->TilingFactor = 1.0f;
-			sData->QuadBufferPtr++;
-		}
-		sData->QuadIndexCount += 6;
-
-		sData->mStats.QuadCount++;
+		SubmitQuad(GetRotatedTransform(position, rotation, size), nullptr, FullUVRect, 1.0f, colour, -1);
 	}
 	void Renderer2D::DrawRotatedQuad(const glm::vec2& position, const float& rotation, const glm::vec2& size, const Ref<Texture2D>& texture, const float& tilingFactor, const glm::vec4& tintColour)
 	{
@@ -514,52 +739,8 @@ namespace Borealis
 	{
 		PROFILE_FUNCTION();
 
-		if (sData->QuadIndexCount + 6 >= Renderer2DData::MaxIndices)
-			FlushReset();
-
-		uint32_t textureUnit = 0;
-
-		for (uint32_t i = 1; i < sData->TextureSlotIndex; i++)
-		{
-			if (*sData->TextureSlots[i].get() == *texture.get())
-			{
-				textureUnit = i;
-				break;
-			}
-		}
-
-		if (textureUnit == 0)
-		{
-			if (sData->TextureSlotIndex + 1 == sData->MaxTextureSlots)
-			{
-				FlushReset();
-			}
-			textureUnit = sData->TextureSlotIndex;
-			sData->TextureSlots[textureUnit] = texture;
-			sData->TextureSlotIndex++;
-		}
-
-		glm::mat4 transform = 
-			glm::translate(glm::mat4(1.0f), position) * 
-			glm::rotate(glm::mat4(1.0f), glm::radians(rotation), glm::vec3(0, 0, 1)) * 
-			glm::scale(glm::mat4(1.0f), { size.x,size.y,1.0f });
-
 		constexpr glm::vec4 colour = { 1.0f,1.0f,1.0f,1.0f };
-		constexpr glm::vec2 texCoords[] = { {0.0f,0.0f},{1.0f,0.0f},{1.0f,1.0f},{0.0f,1.0f} };
-
-		for (int i = 0; i < 4; i++)
-		{
-			sData->QuadBufferPtr->Position = transform * sData->VertexPos[i];
-			sData->QuadBufferPtr->Colour = colour;
-			sData->QuadBufferPtr->TexCoord = texCoords[i];
-			sData->QuadBufferPtr->TexIndex = textureUnit;
-			sData->QuadBufferPtr->TilingFactor = tilingFactor;
-			sData->QuadBufferPtr++;
-		}
-
-		sData->QuadIndexCount += 6;
-
-		sData->mStats.QuadCount++;
+		SubmitQuad(GetRotatedTransform(position, rotation, size), texture.get(), FullUVRect, tilingFactor, colour, -1);
 	}
 
 	void Renderer2D::DrawRotatedQuad(const glm::vec2& position, const float& rotation, const glm::vec2& size, const Ref<SubTexture2D>& subtexture, const float& tilingFactor, const glm::vec4& tintColour)
@@ -570,125 +751,46 @@ namespace Borealis
 	{
 		PROFILE_FUNCTION();
 
-		if (sData->QuadIndexCount + 6 >= Renderer2DData::MaxIndices)
-			FlushReset();
-
-		uint32_t textureUnit = 0;
-
-		for (uint32_t i = 1; i < sData->TextureSlotIndex; i++)
-		{
-			if (*sData->TextureSlots[i].get() == *subtexture->GetTexture().get())
-			{
-				textureUnit = i;
-				break;
-			}
-		}
-
-		if (textureUnit == 0)
-		{
-			if (sData->TextureSlotIndex + 1 == sData->MaxTextureSlots)
-			{
-				FlushReset();
-			}
-			textureUnit = sData->TextureSlotIndex;
-			sData->TextureSlots[textureUnit] = subtexture->GetTexture();
-			sData->TextureSlotIndex++;
-		}
-
-		glm::mat4 transform =
-			glm::translate(glm::mat4(1.0f), position) *
-			glm::rotate(glm::mat4(1.0f), glm::radians(rotation), glm::vec3(0, 0, 1)) *
-			glm::scale(glm::mat4(1.0f), { size.x,size.y,1.0f });
-
 		constexpr glm::vec4 colour = { 1.0f,1.0f,1.0f,1.0f };
+		SubmitQuad(GetRotatedTransform(position, rotation, size), subtexture->GetTexture().get(), GetUVRect(subtexture), tilingFactor, colour, -1);
+	}
 
-		for (int i = 0; i < 4; i++)
-		{
-			sData->QuadBufferPtr->Position = transform * sData->VertexPos[i];
-			sData->QuadBufferPtr->Colour = colour;
-			sData->QuadBufferPtr->TexCoord = subtexture->GetTexCoords()[i];
-			sData->QuadBufferPtr->TexIndex = textureUnit;
-			sData->QuadBufferPtr->TilingFactor = tilingFactor;
-			sData->QuadBufferPtr++;
-		}
-
-		sData->QuadIndexCount += 6;
-
-		sData->mStats.QuadCount++;
+	void Renderer2D::DrawString(std::string_view string, Ref<Font> font, const glm::mat4& transform, int entityID)
+	{
+		TextLayout layout(string, font, TextLayout::DefaultFontSize);
+		DrawString(layout, transform, glm::vec4(1.f), entityID);
 	}
 
-	void Renderer2D::DrawString(const std::string& string, Ref<Font> font, const glm::mat4& transform, int entityID)
+	void Renderer2D::DrawString(TextLayout& layout, const glm::mat4& transform, const glm::vec4& colour, int entityID)
 	{
-		Ref<Texture2D> fontAtlas = font->GetAtlasTexture();
+		PROFILE_FUNCTION();
 
-		sData->FontTexture = fontAtlas;
+		if (layout.GetQuads().empty())
+			return;
 
-		FontInfo const& fontInfo = font->GetFontInfo();
+		Ref<Texture2D> fontAtlas = layout.GetFont()->GetAtlasTexture();
 
-		double x = 0.0;
-		double fsScale = 1.0 / (fontInfo.ascenderY - fontInfo.descenderY);
-		double y = 0.0;
+		// The font batch binds a single atlas
+		if (sData->FontTexture != fontAtlas)
+			FlushFonts();
+		sData->FontTexture = fontAtlas;
+		TextureStreamer::RequestMip(fontAtlas->GetStreamingHandle(), 0);
 
-		for (int i{}; i < string.size(); i++)
+		// Text that has not moved copies the vertices of its last draw
+		const std::vector<TextVertex>& vertices = layout.GetVertices(transform, colour, entityID);
+		for (size_t written = 0; written < vertices.size();)
 		{
-			char character = string[i];
-
-			FontGlyph glyph = fontInfo.glyphs.at(character);
-
-			glm::vec2 texCoordMin((float)glyph.altasBound.left, (float)glyph.altasBound.bottom);
-			glm::vec2 texCoordMax((float)glyph.altasBound.right, (float)glyph.altasBound.top);
-
-			glm::vec2 quadMin((float)glyph.planeBound.left, (float)glyph.planeBound.bottom);
-			glm::vec2 quadMax((float)glyph.planeBound.right, (float)glyph.planeBound.top);
-
-			quadMin *= fsScale, quadMax *= fsScale;
-			quadMin += glm::vec2(x, y);
-			quadMax += glm::vec2(x, y);
-
-			float texelWidth = 1.0f / fontAtlas->GetWidth();
-			float texelHeight = 1.0f / fontAtlas->GetHeight();
-			texCoordMin *= glm::vec2(texelWidth, texelHeight);
-			texCoordMax *= glm::vec2(texelWidth, texelHeight);
-
-			glm::vec4 colour = { 1.f,1.f,0.f,1.f };
-
-			sData->FontBufferPtr->Position = transform * glm::vec4(quadMin, 0.0f, 1.0f);
-			sData->FontBufferPtr->Colour = colour;
-			sData->FontBufferPtr->TexCoord = texCoordMin;
-			sData->FontBufferPtr->EntityID = entityID;
-			sData->FontBufferPtr++;
-
-			sData->FontBufferPtr->Position = transform * glm::vec4(quadMin.x, quadMax.y, 0.0f, 1.0f);
-			sData->FontBufferPtr->Colour = colour;
-			sData->FontBufferPtr->TexCoord = { texCoordMin.x, texCoordMax.y };
-			sData->FontBufferPtr->EntityID = entityID;
-			sData->FontBufferPtr++;
-
-			sData->FontBufferPtr->Position = transform * glm::vec4(quadMax, 0.0f, 1.0f);
-			sData->FontBufferPtr->Colour = colour;
-			sData->FontBufferPtr->TexCoord = texCoordMax;
-			sData->FontBufferPtr->EntityID = entityID;
-			sData->FontBufferPtr++;
-
-			sData->FontBufferPtr->Position = transform * glm::vec4(quadMax.x, quadMin.y, 0.0f, 1.0f);
-			sData->FontBufferPtr->Colour = colour;
-			sData->FontBufferPtr->TexCoord = { texCoordMax.x, texCoordMin.y };
-			sData->FontBufferPtr->EntityID = entityID;
-			sData->FontBufferPtr++;
-
-			sData->FontIndexCount += 6;
-			sData->mStats.QuadCount++;
-
-			if (i < string.size() - 1)
-			{
-				double advance = glyph.advance;
-				char nextCharacter = string[i + 1];
-				//fontGeometry.getAdvance(advance, character, nextCharacter);
-				advance = fontInfo.kernings.at({character, nextCharacter});
-
-				x += fsScale * advance;// +textParams.Kerning;
-			}
+			Reserve(sData->mFonts, 4, FlushFonts);
+
+			// Whole quads only, a quad must not straddle two draws
+			uint32_t room = (sData->mFonts.mCapacity - sData->mFonts.GetVertexCount()) / 4 * 4;
+			uint32_t count = static_cast<uint32_t>(std::min<size_t>(room, vertices.size() - written));
+			std::memcpy(sData->mFonts.mPtr, vertices.data() + written, count * sizeof(TextVertex));
+			sData->mFonts.mPtr += count;
+			written += count;
 		}
+
+		sData->mStats.QuadCount += static_cast<uint32_t>(vertices.size() / 4);
 	}
 
 	void Renderer2D::DrawQuad(const glm::vec2& position, const glm::vec2& size, const glm::vec4& colour)
@@ -700,35 +802,13 @@ namespace Borealis
 	{
 		PROFILE_FUNCTION();
 
-		if (sData->QuadIndexCount + 6 >= Renderer2DData::MaxIndices)
-			FlushReset();
-
-		constexpr glm::vec2 texCoords[] = { {0.0f,0.0f},{1.0f,0.0f},{1.0f,1.0f},{0.0f,1.0f} };
-		constexpr uint32_t texIndex = 0;
-
-		for (int i = 0; i < 4; i++)
-		{
-			sData->QuadBufferPtr->Position = transform * sData->VertexPos[i];
-			sData->QuadBufferPtr->Colour = colour;
-			sData->QuadBufferPtr->TexCoord = texCoords[i];
-			sData->QuadBufferPtr->TexIndex = texIndex;
-			sData->QuadBufferPtr->TilingFactor = 1.0f;
-			sData->QuadBufferPtr->EntityID = entityID;
-			sData->QuadBufferPtr++;
-		}
-
-		sData->QuadIndexCount += 6;
-
-		sData->mStats.QuadCount++;
+		SubmitQuad(transform, nullptr, FullUVRect, 1.0f, colour, entityID);
 	}
 
 	void Renderer2D::DrawQuad(const glm::vec3& position, const glm::vec2& size, const glm::vec4& colour)
 	{
 		PROFILE_FUNCTION();
 
-		if (sData->QuadIndexCount + 6 >= Renderer2DData::MaxIndices)
-			FlushReset();
-
 		glm::mat4 transform =
 			glm::translate(glm::mat4(1.0f), position) *
 			glm::scale(glm::mat4(1.0f), { size.x,size.y,1.0f });
@@ -753,48 +833,7 @@ namespace Borealis
 	{
 		PROFILE_FUNCTION();
 
-		if (sData->QuadIndexCount + 6 >= Renderer2DData::MaxIndices)
-			FlushReset();
-
-		uint32_t textureUnit = 0;
-
-		for (uint32_t i = 1; i < sData->TextureSlotIndex; i++)
-		{
-			if (*sData->TextureSlots[i].get() == *texture.get())
-			{
-				textureUnit = i;
-				break;
-			}
-		}
-
-		if (textureUnit == 0)
-		{
-			if (sData->TextureSlotIndex + 1 == sData->MaxTextureSlots)
-			{
-				FlushReset();
-			}
-			textureUnit = sData->TextureSlotIndex;
-			sData->TextureSlots[textureUnit] = texture;
-			sData->TextureSlotIndex++;
-		}
-
-		
-		constexpr glm::vec2 texCoords[] = { {0.0f,0.0f},{1.0f,0.0f},{1.0f,1.0f},{0.0f,1.0f} };
-
-		for (int i = 0; i < 4; i++)
-		{
-			sData->QuadBufferPtr->Position = transform * sData->VertexPos[i];
-			sData->QuadBufferPtr->Colour = tint;
-			sData->QuadBufferPtr->TexCoord = texCoords[i];
-			sData->QuadBufferPtr->TexIndex = textureUnit;
-			sData->QuadBufferPtr->TilingFactor = tilingFactor;
-			sData->QuadBufferPtr->EntityID = entityID;
-			sData->QuadBufferPtr++;
-		}
-
-		sData->QuadIndexCount += 6;
-
-		sData->mStats.QuadCount++;
+		SubmitQuad(transform, texture.get(), FullUVRect, tilingFactor, tint, entityID);
 	}
 
 	void Renderer2D::DrawQuad(const glm::vec2& position, const glm::vec2& size, const Ref<SubTexture2D>& subtexture, const float& tilingFactor, const glm::vec4& tintColour)
@@ -805,61 +844,18 @@ namespace Borealis
 	{
 		PROFILE_FUNCTION();
 
-		if (sData->QuadIndexCount + 6 >= Renderer2DData::MaxIndices)
-			FlushReset();
-
-		uint32_t textureUnit = 0;
-
-		for (uint32_t i = 1; i < sData->TextureSlotIndex; i++)
-		{
-			if (*sData->TextureSlots[i].get() == *subtexture->GetTexture().get())
-			{
-				textureUnit = i;
-				break;
-			}
-		}
-
-		if (textureUnit == 0)
-		{
-			if (sData->TextureSlotIndex + 1 == sData->MaxTextureSlots)
-			{
-				FlushReset();
-			}
-			textureUnit = sData->TextureSlotIndex;
-			sData->TextureSlots[textureUnit] = subtexture->GetTexture();
-			sData->TextureSlotIndex++;
-		}
-
 		glm::mat4 transform =
 			glm::translate(glm::mat4(1.0f), position) *
 			glm::scale(glm::mat4(1.0f), { size.x,size.y,1.0f });
 
 		constexpr glm::vec4 colour = { 1.0f,1.0f,1.0f,1.0f };
-
-		for (int i = 0; i < 4; i++)
-		{
-			sData->QuadBufferPtr->Position = transform * sData->VertexPos[i];
-			sData->QuadBufferPtr->Colour = colour;
-			sData->QuadBufferPtr->TexCoord = subtexture->GetTexCoords()[i];
-			sData->QuadBufferPtr->TexIndex = textureUnit;
-			sData->QuadBufferPtr->TilingFactor = tilingFactor;
-			sData->QuadBufferPtr++;
-		}
-
-		sData->QuadIndexCount += 6;
-
-		sData->mStats.QuadCount++;
-	}
-
-	void Renderer2D::ResetStats()
-	{
-		sData->mStats.QuadCount = 0;
-		sData->mStats.DrawCalls = 0;
+		SubmitQuad(transform, subtexture->GetTexture().get(), GetUVRect(subtexture), tilingFactor, colour, -1);
 	}
 
-	Renderer2D::Statistics& Renderer2D::GetStats()
+	Renderer2D::Statistics Renderer2D::GetLastFrameStats()
 	{
-		return sData->mStats;
+		std::lock_guard<std::mutex> lock(sData->mPublishedMutex);
+		return sData->mPublishedStats;
 	}
 
 }
\ No newline at end of file
@@ -17,45 +17,215 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include "Graphics/Renderer3D.hpp"
 #include <Graphics/VertexArray.hpp>
 #include <Graphics/RenderCommand.hpp>
+#include <Graphics/GpuProfiler.hpp>
+#include <Core/FlatHashMap.hpp>
+#include <Graphics/GeometryPool.hpp>
 
 namespace Borealis
 {
+	// Passes a mesh can be drawn in, the most significant field of its sort key
+	enum class MeshPass : uint32_t
+	{
+		Opaque,
+		Count
+	};
+
+	// Fields of a draw's sort key, most significant first. Sorting the keys puts the draws of
+	// a shader variant next to each other, within them the draws of a material, then of a
+	// model, front to back. IDs past the width of a field share its largest value, which only
+	// costs extra state changes, as batches are split on the material itself.
+	constexpr uint32_t sPassBits = 2;
+	constexpr uint32_t sShaderBits = 8;
+	constexpr uint32_t sMaterialBits = 16;
+	constexpr uint32_t sModelBits = 16;
+	constexpr uint32_t sDepthBits = 22;
+	static_assert(sPassBits + sShaderBits + sMaterialBits + sModelBits + sDepthBits == 64, "Sort key fields must fill 64 bits");
+
+	struct MeshDraw
+	{
+		glm::mat4 mTransform;
+		Model* mModel;		// Kept alive by the caller until End
+		const Material::DrawState* mMaterial;
+		int mEntityID;
+		uint32_t mLod;
+		uint32_t mPreviousLod;
+		float mLodFade;
+	};
+
+	struct SortEntry
+	{
+		uint64_t mKey;
+		uint32_t mDraw;	// Index in the queued draws
+	};
+
 	struct Renderer3DData
 	{
-		Ref<Shader> mModelShader;
+		Ref<Material::DrawState> mDefaultMaterial;	// Drawn with when a mesh has no material
+		glm::mat4 mViewProjection{ 1.f };
+
+		// Meshes of the pass, drawn in sort key order in End
+		std::vector<MeshDraw> mMeshDraws;
+		std::vector<SortEntry> mSortEntries;
+		std::vector<SortEntry> mSortScratch;
+		std::vector<GeometryPool::DrawCommand> mCommands;
+		std::vector<GeometryPool::InstanceData> mInstances;
+
+		// Sort key IDs, handed out in the order objects are first drawn each pass
+		FlatHashMap<const Shader*, uint32_t> mShaderIDs;
+		FlatHashMap<const Material::DrawState*, uint32_t> mMaterialIDs;
+		FlatHashMap<const Model*, uint32_t> mModelIDs;
+
+		// Camera of the pass, to work out the mip level each draw needs
+		glm::vec3 mCameraPosition{};
+		float mProjectionScale = 1.f; // Clip space height of one unit at distance one
+		bool mOrthographic = false;
+		uint32_t mViewportHeight = 0;
 	};
 
+	// Closer than this the mip level stops changing, so the camera inside a bounding sphere still gets a finite level
+	constexpr float sMinStreamingDistance = 0.1f;
+
 	static std::unique_ptr<Renderer3DData> sData;
 	LightEngine Renderer3D::mLightEngine;
 
 	void Renderer3D::Init()
 	{
 		sData =  std::make_unique<Renderer3DData>();
-		sData->mModelShader = Shader::Create("engineResources/Shaders/Renderer3D_Material.glsl");
+		sData->mDefaultMaterial = MakeRef<Material>(ShaderLibrary::Load("engineResources/Shaders/Renderer3D_Material.glsl"))->GetDrawState();
 	}
 
 
 
+	static void SetStreamingCamera(const glm::vec3& position, const glm::mat4& projection)
+	{
+		sData->mCameraPosition = position;
+		sData->mProjectionScale = projection[1][1];
+		sData->mOrthographic = projection[3][3] == 1.f;
+		sData->mViewportHeight = RenderCommand::GetViewportHeight();
+	}
+
 	void Renderer3D::Begin(const EditorCamera& camera)
 	{
-		sData->mModelShader->Bind();
-		sData->mModelShader->Set("u_ViewProjection", camera.GetViewProjectionMatrix());
+		GpuProfiler::BeginZone("Renderer3D");
+		sData->mViewProjection = camera.GetViewProjectionMatrix();
+		SetStreamingCamera(camera.GetPosition(), camera.GetProjectionMatrix());
 
 		mLightEngine.Begin();
 	}
 
 	void Renderer3D::Begin(const Camera& camera, const glm::mat4& transform)
 	{
-		sData->mModelShader->Bind();
-		glm::mat4 viewProj = camera.GetProjectionMatrix() * glm::inverse(transform);
-		sData->mModelShader->Set("u_ViewProjection", viewProj);
+		GpuProfiler::BeginZone("Renderer3D");
+		sData->mViewProjection = camera.GetProjectionMatrix() * glm::inverse(transform);
+		SetStreamingCamera(glm::vec3(transform[3]), camera.GetProjectionMatrix());
 
 		mLightEngine.Begin();
 	}
 
+	/*!***********************************************************************
+		\brief
+			Sorts the entries by key, least significant byte first. Bytes every
+			key shares are skipped, so keys from few shaders and materials take
+			few passes.
+		\param[in,out] entries
+			Entries to sort
+		\param[in] scratch
+			Storage for the passes
+	*************************************************************************/
+	static void RadixSort(std::vector<SortEntry>& entries, std::vector<SortEntry>& scratch)
+	{
+		if (entries.size() < 2)
+			return;
+
+		scratch.resize(entries.size());
+		for (uint32_t shift = 0; shift < 64; shift += 8)
+		{
+			std::array<uint32_t, 256> offsets{};
+			for (const SortEntry& entry : entries)
+				offsets[(entry.mKey >> shift) & 0xFF]++;
+			if (offsets[(entries.front().mKey >> shift) & 0xFF] == entries.size())
+				continue;
+
+			uint32_t offset = 0;
+			for (uint32_t& count : offsets)
+			{
+				uint32_t bucket = count;
+				count = offset;
+				offset += bucket;
+			}
+			for (const SortEntry& entry : entries)
+				scratch[offsets[(entry.mKey >> shift) & 0xFF]++] = entry;
+			entries.swap(scratch);
+		}
+	}
+
+	/*!***********************************************************************
+		\brief
+			Draws the meshes queued since Begin in sort key order, one multi
+			draw per material, binding each shader variant once
+	*************************************************************************/
+	static void FlushMeshes()
+	{
+		if (sData->mMeshDraws.empty())
+			return;
+
+		std::vector<SortEntry>& entries = sData->mSortEntries;
+		RadixSort(entries, sData->mSortScratch);
+
+		Shader* boundShader = nullptr;
+		for (size_t first = 0; first < entries.size();)
+		{
+			const Material::DrawState* material = sData->mMeshDraws[entries[first].mDraw].mMaterial;
+			const Ref<Shader>& shader = material->mShader;
+			if (shader.get() != boundShader)
+			{
+				// Camera and lights are per pass, but every variant is its own program
+				shader->Bind();
+				shader->Set("u_ViewProjection", sData->mViewProjection);
+				Renderer3D::SetLights(shader);
+				Material::SetTextureUnits(shader);
+				boundShader = shader.get();
+			}
+			material->Bind();
+
+			sData->mCommands.clear();
+			sData->mInstances.clear();
+			size_t last = first;
+			for (; last < entries.size() && sData->mMeshDraws[entries[last].mDraw].mMaterial == material; ++last)
+			{
+				const MeshDraw& draw = sData->mMeshDraws[entries[last].mDraw];
+
+				// While a level fades in, the old one is drawn with the opposite dither pattern so every pixel is covered once
+				if (draw.mLodFade < 1.f && draw.mPreviousLod != draw.mLod)
+				{
+					draw.mModel->AppendDrawCommands(draw.mLod, static_cast<uint32_t>(sData->mInstances.size()), sData->mCommands);
+					sData->mInstances.push_back({ draw.mTransform, draw.mEntityID, draw.mLodFade });
+					draw.mModel->AppendDrawCommands(draw.mPreviousLod, static_cast<uint32_t>(sData->mInstances.size()), sData->mCommands);
+					sData->mInstances.push_back({ draw.mTransform, draw.mEntityID, -draw.mLodFade });
+				}
+				else
+				{
+					draw.mModel->AppendDrawCommands(draw.mLod, static_cast<uint32_t>(sData->mInstances.size()), sData->mCommands);
+					sData->mInstances.push_back({ draw.mTransform, draw.mEntityID, 0.f });
+				}
+			}
+
+			GeometryPool::MultiDraw(GeometryPool::VertexFormat::Static, sData->mCommands, sData->mInstances);
+			first = last;
+		}
+
+		sData->mMeshDraws.clear();
+		sData->mSortEntries.clear();
+		sData->mShaderIDs.clear();
+		sData->mMaterialIDs.clear();
+		sData->mModelIDs.clear();
+	}
+
 	void Renderer3D::End()
 	{
+		FlushMeshes();
 		mLightEngine.Begin();//clear vector
+		GpuProfiler::EndZone();
 	}
 
 	void Renderer3D::AddLight(LightComponent const& lightComponent)
@@ -68,16 +238,105 @@ namespace Borealis
 		mLightEngine.SetLights(shader);
 	}
 
+	/*!***********************************************************************
+		\brief
+			Works out how much texture space one screen pixel covers on a model,
+			from the UV density of the model and its size on screen
+		\param[in] transform
+			World transform of the model
+		\param[in] model
+			Model being drawn
+		\return
+			UV units per pixel, 0 when the viewport is unknown
+	*************************************************************************/
+	static float GetUVPerPixel(const glm::mat4& transform, const Model& model)
+	{
+		float scale = std::max({ glm::length(glm::vec3(transform[0])), glm::length(glm::vec3(transform[1])), glm::length(glm::vec3(transform[2])) });
+		if (sData->mViewportHeight == 0 || scale <= 0.f)
+			return 0.f;
+
+		float distance = 1.f;
+		if (!sData->mOrthographic)
+		{
+			glm::vec3 center = glm::vec3(transform * glm::vec4(model.GetBoundsCenter(), 1.f));
+			distance = std::max(glm::length(center - sData->mCameraPosition) - model.GetBoundsRadius() * scale, sMinStreamingDistance);
+		}
+
+		float pixelsPerUnit = 0.5f * static_cast<float>(sData->mViewportHeight) * sData->mProjectionScale / distance;
+		return model.GetUVDensity() / (scale * pixelsPerUnit);
+	}
+
+	/*!***********************************************************************
+		\brief
+			Gets the sort key ID of an object for this pass
+		\param[in] ids
+			IDs handed out so far
+		\param[in] object
+			Object to look up
+		\return
+			The ID, the number of objects seen before it for a new one
+	*************************************************************************/
+	template <typename T>
+	static uint32_t GetSortID(FlatHashMap<const T*, uint32_t>& ids, const T* object)
+	{
+		return ids.try_emplace(object, static_cast<uint32_t>(ids.size())).first->second;
+	}
+
+	/*!***********************************************************************
+		\brief
+			Appends a field to a sort key, clamping values too wide for it
+	*************************************************************************/
+	static uint64_t AppendSortField(uint64_t key, uint32_t value, uint32_t bits)
+	{
+		uint32_t maxValue = (1u << bits) - 1u;
+		return key << bits | std::min(value, maxValue);
+	}
+
+	/*!***********************************************************************
+		\brief
+			Adds a mesh to the pass with its sort key
+	*************************************************************************/
+	static void QueueMesh(const glm::mat4& transform, Model* model, const Material::DrawState* material, int entityID, uint32_t lod, uint32_t previousLod, float lodFade)
+	{
+		if (!material)
+			material = sData->mDefaultMaterial.get();
+		const Shader* shader = material->mShader.get();
+		material->RequestTextureMips(GetUVPerPixel(transform, *model));
+
+		// Distances are positive, so their float bits sort like the distances themselves
+		glm::vec3 center = glm::vec3(transform * glm::vec4(model->GetBoundsCenter(), 1.f));
+		float distance = glm::length(center - sData->mCameraPosition);
+		uint32_t distanceBits;
+		std::memcpy(&distanceBits, &distance, sizeof(distanceBits));
+
+		uint64_t key = static_cast<uint64_t>(MeshPass::Opaque);
+		key = AppendSortField(key, GetSortID(sData->mShaderIDs, shader), sShaderBits);
+		key = AppendSortField(key, GetSortID(sData->mMaterialIDs, material), sMaterialBits);
+		key = AppendSortField(key, GetSortID(sData->mModelIDs, static_cast<const Model*>(model)), sModelBits);
+		key = key << sDepthBits | distanceBits >> (32 - sDepthBits);
+
+		sData->mSortEntries.push_back({ key, static_cast<uint32_t>(sData->mMeshDraws.size()) });
+		sData->mMeshDraws.push_back({ transform, model, material, entityID, lod, previousLod, lodFade });
+	}
+
 	void Renderer3D::DrawMesh(const glm::mat4& transform, const MeshFilterComponent& meshFilter, const MeshRendererComponent& meshRenderer, int entityID)
 	{
-		SetLights(sData->mModelShader);
-		if (meshFilter.Model) {
-			if (meshRenderer.Material)
-			{
-				meshRenderer.Material->SetUniforms(sData->mModelShader);
-			}
-			
-			meshFilter.Model->Draw(transform, sData->mModelShader, entityID);
+		if (!meshFilter.Model)
+			return;
+
+		// Retained like the scene's meshes, so editing the material before End leaves this draw as it was
+		const Material::DrawState* material = meshRenderer.Material ? RenderThread::Retain(meshRenderer.Material->GetDrawState()) : nullptr;
+		QueueMesh(transform, meshFilter.Model.get(), material, entityID, meshFilter.Lod, meshFilter.PreviousLod, meshFilter.LodFade);
+	}
+
+	void Renderer3D::DrawMeshes(const MeshSubmission* meshes, uint32_t count)
+	{
+		PROFILE_FUNCTION();
+
+		for (uint32_t i = 0; i < count; i++)
+		{
+			const MeshSubmission& mesh = meshes[i];
+			QueueMesh(mesh.mTransform, mesh.mModel, mesh.mMaterial, mesh.mEntityID, mesh.mLod, mesh.mPreviousLod, mesh.mLodFade);
 		}
 	}
 
@@ -13,9 +13,49 @@ prior written consent of DigiPen Institute of Technology is prohibited.
  /******************************************************************************/
 
 #include <BorealisPCH.hpp>
+#include <mutex>
 #include <Graphics/RendererAPI.hpp>
+#include <Graphics/OpenGL/RendererAPIOpenGLImpl.hpp>
+#include <Graphics/Null/RendererAPINullImpl.hpp>
+#include <Core/LoggerSystem.hpp>
 
 namespace Borealis
 {
 	RendererAPI::API RendererAPI::sAPI = RendererAPI::API::OpenGL;
-}
\ No newline at end of file
+	RenderStatistics RendererAPI::sStatistics;
+
+	static std::mutex sPublishedMutex;
+	static RenderStatistics sPublishedStatistics;
+
+	void RendererAPI::SetAPI(API api)
+	{
+		sAPI = api;
+	}
+
+	Scope<RendererAPI> RendererAPI::Create()
+	{
+		switch (sAPI)
+		{
+			case API::None: BOREALIS_CORE_ASSERT(false, "RendererAPI::None is not supported"); return nullptr;
+			case API::OpenGL: return MakeScope<OpenGLRendererAPI>();
+			case API::Null: return MakeScope<NullRendererAPI>();
+		}
+		BOREALIS_CORE_ASSERT(false, "Unknown RendererAPI");
+		return nullptr;
+	}
+
+	void RendererAPI::EndFrameStatistics()
+	{
+		{
+			std::lock_guard<std::mutex> lock(sPublishedMutex);
+			sPublishedStatistics = sStatistics;
+		}
+		sStatistics = {};
+	}
+
+	RenderStatistics RendererAPI::GetLastFrameStatistics()
+	{
+		std::lock_guard<std::mutex> lock(sPublishedMutex);
+		return sPublishedStatistics;
+	}
+}
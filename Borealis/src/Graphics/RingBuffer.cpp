@@ -0,0 +1,35 @@
+/******************************************************************************/
+/*!
+\file		RingBuffer.cpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Defines the factory for the streaming ring buffer
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#include <BorealisPCH.hpp>
+#include <Graphics/RingBuffer.hpp>
+#include <Graphics/Renderer.hpp>
+#include <Graphics/OpenGL/RingBufferOpenGLImpl.hpp>
+#include <Graphics/Null/BufferNullImpl.hpp>
+#include <Core/LoggerSystem.hpp>
+
+namespace Borealis
+{
+	Ref<RingBuffer> RingBuffer::Create(uint32_t regionSize, uint32_t regionCount)
+	{
+		switch (Renderer::GetAPI())
+		{
+			case RendererAPI::API::None: BOREALIS_CORE_ASSERT(false, "RendererAPI::None is not supported"); return nullptr;
+			case RendererAPI::API::OpenGL: return MakeRef<OpenGLRingBuffer>(regionSize, regionCount);
+			case RendererAPI::API::Null: return MakeRef<NullRingBuffer>();
+		}
+		BOREALIS_CORE_ASSERT(false, "Unknown RendererAPI");
+		return nullptr;
+	}
+}
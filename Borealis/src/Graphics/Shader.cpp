@@ -17,6 +17,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <Graphics/Shader.hpp>
 #include <Graphics/Renderer.hpp>
 #include <Graphics/OpenGL/ShaderOpenGLImpl.hpp>
+#include <Graphics/Null/ShaderNullImpl.hpp>
 
 namespace Borealis
 {
@@ -26,6 +27,19 @@ namespace Borealis
 		{
 		case RendererAPI::API::None: BOREALIS_CORE_ASSERT(false, "RendererAPI::None is not supported"); return nullptr;
 		case RendererAPI::API::OpenGL: return MakeRef<OpenGLShader>(filepath);
+		case RendererAPI::API::Null: return MakeRef<NullShader>(filepath);
+		}
+		BOREALIS_CORE_ASSERT(false, "Unknown RendererAPI");
+		return nullptr;
+	}
+
+	Ref<Shader> Shader::Create(const std::string& filepath, const std::vector<std::string>& defines)
+	{
+		switch (Renderer::GetAPI())
+		{
+		case RendererAPI::API::None: BOREALIS_CORE_ASSERT(false, "RendererAPI::None is not supported"); return nullptr;
+		case RendererAPI::API::OpenGL: return MakeRef<OpenGLShader>(filepath, defines);
+		case RendererAPI::API::Null: return MakeRef<NullShader>(filepath);
 		}
 		BOREALIS_CORE_ASSERT(false, "Unknown RendererAPI");
 		return nullptr;
@@ -37,6 +51,7 @@ namespace Borealis
 		{
 		case RendererAPI::API::None: BOREALIS_CORE_ASSERT(false, "RendererAPI::None is not supported"); return nullptr;
 		case RendererAPI::API::OpenGL: return MakeRef<OpenGLShader>(name, vertexSrc, fragmentSrc);
+		case RendererAPI::API::Null: return MakeRef<NullShader>(name, vertexSrc, fragmentSrc);
 		}
 		BOREALIS_CORE_ASSERT(false, "Unknown RendererAPI");
 		return nullptr;
@@ -84,4 +99,36 @@ namespace Borealis
 	{
 		return mShaders.find(name) != mShaders.end();
 	}
-}
\ No newline at end of file
+
+	std::unordered_map<std::string, Ref<Shader>> ShaderLibrary::sShaders;
+	std::mutex ShaderLibrary::sMutex;
+
+	Ref<Shader> ShaderLibrary::Load(const std::string& filepath, const std::vector<std::string>& defines)
+	{
+		std::vector<std::string> sorted = defines;
+		std::sort(sorted.begin(), sorted.end());
+		sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+
+		std::string key = filepath;
+		for (const std::string& define : sorted)
+		{
+			key += '|';
+			key += define;
+		}
+
+		std::lock_guard<std::mutex> lock(sMutex);
+		auto it = sShaders.find(key);
+		if (it != sShaders.end())
+			return it->second;
+
+		Ref<Shader> shader = sorted.empty() ? Shader::Create(filepath) : Shader::Create(filepath, sorted);
+		sShaders.emplace(key, shader);
+		return shader;
+	}
+
+	void ShaderLibrary::Clear()
+	{
+		std::lock_guard<std::mutex> lock(sMutex);
+		sShaders.clear();
+	}
+}
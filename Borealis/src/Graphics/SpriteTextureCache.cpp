@@ -0,0 +1,37 @@
+/******************************************************************************/
+/*!
+\file		SpriteTextureCache.cpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Defines the factory for the sprite texture cache
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#include <BorealisPCH.hpp>
+#include <Graphics/SpriteTextureCache.hpp>
+#include <Graphics/Renderer.hpp>
+#include <Graphics/OpenGL/SpriteTextureCacheOpenGLImpl.hpp>
+#include <Core/LoggerSystem.hpp>
+
+namespace Borealis
+{
+	Scope<SpriteTextureCache> SpriteTextureCache::Create()
+	{
+		switch (Renderer::GetAPI())
+		{
+			case RendererAPI::API::None: BOREALIS_CORE_ASSERT(false, "RendererAPI::None is not supported"); return nullptr;
+			case RendererAPI::API::OpenGL:
+				if (!OpenGLSpriteTextureCache::IsSupported())
+					return nullptr;
+				return MakeScope<OpenGLSpriteTextureCache>();
+			case RendererAPI::API::Null: return nullptr; // Renderer2D falls back to texture slots
+		}
+		BOREALIS_CORE_ASSERT(false, "Unknown RendererAPI");
+		return nullptr;
+	}
+}
@@ -0,0 +1,153 @@
+/******************************************************************************/
+/*!
+\file		TextLayout.cpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Defines the text layout
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#include <BorealisPCH.hpp>
+#include <Graphics/TextLayout.hpp>
+#include <Graphics/Texture.hpp>
+#include <Graphics/Font.hpp>
+
+namespace Borealis
+{
+	static constexpr uint32_t sReplacementCodepoint = 0xFFFD;
+
+	/*!***********************************************************************
+		\brief
+			Decodes the UTF-8 sequence at the start of a string
+		\param[in] text
+			Text to decode from
+		\param[in,out] index
+			Byte to start at, moved past the sequence
+		\return
+			The codepoint, U+FFFD for a malformed sequence
+	*************************************************************************/
+	static uint32_t DecodeUTF8(std::string_view text, size_t& index)
+	{
+		uint8_t lead = static_cast<uint8_t>(text[index++]);
+		if (lead < 0x80)
+			return lead;
+
+		uint32_t length;
+		uint32_t codepoint;
+		if ((lead & 0xE0) == 0xC0)
+		{
+			length = 1;
+			codepoint = lead & 0x1F;
+		}
+		else if ((lead & 0xF0) == 0xE0)
+		{
+			length = 2;
+			codepoint = lead & 0x0F;
+		}
+		else if ((lead & 0xF8) == 0xF0)
+		{
+			length = 3;
+			codepoint = lead & 0x07;
+		}
+		else
+		{
+			return sReplacementCodepoint;
+		}
+
+		for (uint32_t i = 0; i < length; ++i)
+		{
+			if (index == text.size() || (static_cast<uint8_t>(text[index]) & 0xC0) != 0x80)
+				return sReplacementCodepoint;
+			codepoint = codepoint << 6 | (static_cast<uint8_t>(text[index++]) & 0x3F);
+		}
+		return codepoint;
+	}
+
+	TextLayout::TextLayout(std::string_view text, const Ref<Font>& font, uint32_t fontSize)
+		: mText(text), mFont(font), mFontSize(fontSize)
+	{
+		if (!font || !font->GetAtlasTexture())
+			return;
+
+		FontInfo const& fontInfo = font->GetFontInfo();
+		Ref<Texture2D> atlas = font->GetAtlasTexture();
+
+		// Font units to local units, one line high at the default size
+		double scale = static_cast<double>(fontSize) / DefaultFontSize / (fontInfo.ascenderY - fontInfo.descenderY);
+		glm::vec2 texelSize(1.f / atlas->GetWidth(), 1.f / atlas->GetHeight());
+		FontGlyph const* fallback = font->GetGlyph('?');
+
+		std::vector<uint32_t> codepoints;
+		codepoints.reserve(text.size());
+		for (size_t index = 0; index < text.size();)
+			codepoints.push_back(DecodeUTF8(text, index));
+
+		mQuads.reserve(codepoints.size());
+		double x = 0.0;
+		double y = 0.0;
+		for (size_t i = 0; i < codepoints.size(); ++i)
+		{
+			uint32_t codepoint = codepoints[i];
+			if (codepoint == '\n')
+			{
+				x = 0.0;
+				y -= static_cast<double>(fontSize) / DefaultFontSize;
+				continue;
+			}
+
+			FontGlyph const* glyph = font->GetGlyph(codepoint);
+			if (!glyph)
+			{
+				glyph = fallback;
+				codepoint = '?';
+				if (!glyph)
+					continue;
+			}
+
+			// Whitespace has no quad, only an advance
+			if (glyph->planeBound.left != glyph->planeBound.right)
+			{
+				Quad quad;
+				quad.mMin = glm::vec2(glyph->planeBound.left * scale + x, glyph->planeBound.bottom * scale + y);
+				quad.mMax = glm::vec2(glyph->planeBound.right * scale + x, glyph->planeBound.top * scale + y);
+				quad.mTexMin = glm::vec2(glyph->altasBound.left, glyph->altasBound.bottom) * texelSize;
+				quad.mTexMax = glm::vec2(glyph->altasBound.right, glyph->altasBound.top) * texelSize;
+				mQuads.push_back(quad);
+			}
+
+			uint32_t next = i + 1 < codepoints.size() ? codepoints[i + 1] : 0;
+			x += scale * (next ? font->GetAdvance(codepoint, next) : glyph->advance);
+		}
+	}
+
+	bool TextLayout::Matches(std::string_view text, const Ref<Font>& font, uint32_t fontSize) const
+	{
+		return mFont == font && mFontSize == fontSize && mText == text;
+	}
+
+	const std::vector<TextVertex>& TextLayout::GetVertices(const glm::mat4& transform, const glm::vec4& colour, int entityID)
+	{
+		if (mVertices.size() == mQuads.size() * 4 && mTransform == transform && mColour == colour && mEntityID == entityID)
+			return mVertices;
+
+		mTransform = transform;
+		mColour = colour;
+		mEntityID = entityID;
+		mVertices.resize(mQuads.size() * 4);
+
+		TextVertex* vertex = mVertices.data();
+		for (const Quad& quad : mQuads)
+		{
+			*vertex++ = { transform * glm::vec4(quad.mMin, 0.f, 1.f), colour, quad.mTexMin, entityID };
+			*vertex++ = { transform * glm::vec4(quad.mMin.x, quad.mMax.y, 0.f, 1.f), colour, { quad.mTexMin.x, quad.mTexMax.y }, entityID };
+			*vertex++ = { transform * glm::vec4(quad.mMax, 0.f, 1.f), colour, quad.mTexMax, entityID };
+			*vertex++ = { transform * glm::vec4(quad.mMax.x, quad.mMin.y, 0.f, 1.f), colour, { quad.mTexMax.x, quad.mTexMin.y }, entityID };
+		}
+		return mVertices;
+	}
+}
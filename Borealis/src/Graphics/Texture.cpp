@@ -15,11 +15,14 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <Graphics/Texture.hpp>
 #include <Graphics/Renderer.hpp>
 #include <Graphics/OpenGL/TextureOpenGLImpl.hpp>
+#include <Graphics/Null/TextureNullImpl.hpp>
+#include <Core/MemoryTracker.hpp>
 namespace Borealis
 {
 	Ref<Texture2D> Texture2D::mDefault = nullptr;
 	Ref<Texture2D> Texture2D::Create(const TextureInfo& textureInfo)
 	{
+		MemoryTagScope memoryTag(MemoryTag::Textures);
 		Ref<Texture2D> texture = nullptr;
 		switch (Renderer::GetAPI())
 		{
@@ -31,6 +34,9 @@ namespace Borealis
 					texture = nullptr;
 				}
 				break;
+			case RendererAPI::API::Null:
+				texture = MakeRef<NullTexture2D>(textureInfo);
+				break;
 		}
 		if (!texture)
 		{
@@ -43,6 +49,7 @@ namespace Borealis
 	}
 	Ref<Texture2D> Texture2D::Create(const std::string& path)
 	{
+		MemoryTagScope memoryTag(MemoryTag::Textures);
 		Ref<Texture2D> texture = nullptr;
 		switch (Renderer::GetAPI())
 		{
@@ -54,6 +61,9 @@ namespace Borealis
 				texture = nullptr;
 			}
 			break;
+		case RendererAPI::API::Null:
+			texture = MakeRef<NullTexture2D>(path);
+			break;
 		}
 		if(!texture)
 		{
@@ -64,6 +74,31 @@ namespace Borealis
 
 		return Ref<Texture2D>();
 	}
+	Ref<Texture2D> Texture2D::Create(const std::string& path, const gli::texture& image)
+	{
+		MemoryTagScope memoryTag(MemoryTag::Textures);
+		Ref<Texture2D> texture = nullptr;
+		switch (Renderer::GetAPI())
+		{
+		case RendererAPI::API::None: BOREALIS_CORE_ASSERT(false, "RendererAPI::None is not supported"); break;
+		case RendererAPI::API::OpenGL:
+			texture = MakeRef<OpenGLTexture2D>(path, image);
+			if (!texture->IsValid())
+			{
+				texture = nullptr;
+			}
+			break;
+		case RendererAPI::API::Null:
+			texture = MakeRef<NullTexture2D>(path);
+			break;
+		}
+		if (!texture)
+		{
+			BOREALIS_CORE_ASSERT(false, "Unknown RendererAPI");
+			texture = GetDefaultTexture();
+		}
+		return texture;
+	}
 	Ref<Texture2D> Texture2D::GetDefaultTexture()
 	{
 		if (!mDefault)
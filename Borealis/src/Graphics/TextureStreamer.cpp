@@ -0,0 +1,425 @@
+/******************************************************************************/
+/*!
+\file		TextureStreamer.cpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Defines the texture streamer
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#include <BorealisPCH.hpp>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <Core/Core.hpp>
+#include <Core/LoggerSystem.hpp>
+#include <Core/MemoryTracker.hpp>
+#include <Graphics/Texture.hpp>
+#include <Graphics/TextureStreamer.hpp>
+
+namespace Borealis
+{
+	namespace
+	{
+		constexpr uint32_t sChunkSize = 1024;
+		constexpr uint32_t sMaxChunks = 64;
+		constexpr uint32_t sNoRequest = UINT32_MAX;
+		constexpr uint32_t sTailSize = 128;						//!< Levels this size and smaller are always resident
+		constexpr uint64_t sUnusedFrames = 120;					//!< Frames without a draw before a texture only wants its tail
+		constexpr uint64_t sMaxBytesInFlight = 32ull << 20;		//!< Reads queued at once
+		constexpr uint64_t sDefaultBudget = 512ull << 20;		//!< GPU texture budget when the memory tracker has none
+
+		struct Slot
+		{
+			Texture2D* mTexture = nullptr;
+			std::shared_ptr<const TextureStreamer::MipLayout> mLayout;
+			TextureStreamer::Handle mHandle = TextureStreamer::InvalidHandle;
+			uint32_t mTailMip = 0;			//!< Coarsest streamed level, the levels from here on stay resident
+			uint32_t mResidentMip = 0;		//!< Finest level uploaded
+			uint32_t mLoadingMip = 0;		//!< Finest level uploaded or being read
+			uint32_t mWantedMip = 0;		//!< Finest level the renderers asked for
+			uint32_t mGeneration = 0;		//!< Bumped when the slot is reused, so stale reads are dropped
+			uint64_t mLastUsedFrame = 0;
+			std::atomic<uint32_t> mRequestedMip = sNoRequest;	//!< Finest level reported this frame
+		};
+
+		struct ReadRequest
+		{
+			TextureStreamer::Handle mHandle;
+			uint32_t mGeneration;
+			std::shared_ptr<const TextureStreamer::MipLayout> mLayout;
+			uint32_t mFirstLevel;
+			uint32_t mLastLevel;
+		};
+
+		struct ReadResult
+		{
+			TextureStreamer::Handle mHandle;
+			uint32_t mGeneration;
+			uint32_t mFirstLevel;
+			bool mSuccess;
+			std::vector<uint8_t> mData;
+		};
+
+		struct StreamerData
+		{
+			std::array<std::unique_ptr<Slot[]>, sMaxChunks> mChunks;
+			uint32_t mSlotCount = 0;
+			std::vector<TextureStreamer::Handle> mFreeSlots;
+
+			uint64_t mFrame = 0;
+			uint64_t mStreamedBytes = 0;	//!< Levels finer than the tails, resident or being read
+			uint64_t mBytesInFlight = 0;
+
+			// Guards the slots and the byte counts. Textures register from the loaders and
+			// unregister wherever their last reference goes away, including the render thread.
+			std::mutex mSlotMutex;
+
+			std::thread mThread;
+			std::mutex mMutex;
+			std::condition_variable mSignal;
+			std::deque<ReadRequest> mRequests;
+			std::vector<ReadResult> mResults;
+			bool mRunning = true;
+		};
+
+		StreamerData* sData = nullptr;
+
+		Slot& GetSlot(TextureStreamer::Handle handle)
+		{
+			return sData->mChunks[handle / sChunkSize][handle % sChunkSize];
+		}
+
+		uint64_t GetLevelBytes(const Slot& slot, uint32_t firstLevel, uint32_t lastLevel)
+		{
+			uint64_t bytes = 0;
+			for (uint32_t level = firstLevel; level < lastLevel; ++level)
+				bytes += slot.mLayout->mSizes[level];
+			return bytes;
+		}
+
+		void StreamLoop()
+		{
+			std::unique_lock<std::mutex> lock(sData->mMutex);
+			while (true)
+			{
+				sData->mSignal.wait(lock, [] { return !sData->mRunning || !sData->mRequests.empty(); });
+				if (!sData->mRunning)
+					return;
+
+				ReadRequest request = std::move(sData->mRequests.front());
+				sData->mRequests.pop_front();
+				lock.unlock();
+
+				ReadResult result{ request.mHandle, request.mGeneration, request.mFirstLevel, false, {} };
+				{
+					MemoryTagScope memoryTag(MemoryTag::Textures);
+					result.mSuccess = TextureStreamer::ReadMips(*request.mLayout, request.mFirstLevel, request.mLastLevel, result.mData);
+				}
+
+				lock.lock();
+				sData->mResults.push_back(std::move(result));
+			}
+		}
+
+		void Evict(Slot& slot, uint32_t mip)
+		{
+			sData->mStreamedBytes -= GetLevelBytes(slot, slot.mResidentMip, mip);
+			slot.mTexture->EvictMips(mip);
+			slot.mResidentMip = slot.mLoadingMip = mip;
+		}
+
+		/*!***********************************************************************
+			\brief
+				Evicts the finer levels of the least recently used textures until
+				some bytes fit in the budget. Textures drawn last frame only lose
+				the levels they no longer want.
+			\param[in] bytes
+				Bytes to make room for
+			\param[in] budget
+				Bytes the streamed levels may use
+			\return
+				True if the bytes fit
+		*************************************************************************/
+		bool MakeRoom(uint64_t bytes, uint64_t budget)
+		{
+			if (sData->mStreamedBytes + bytes <= budget)
+				return true;
+
+			auto evictionTarget = [](const Slot& slot)
+				{
+					return slot.mLastUsedFrame + 1 < sData->mFrame ? slot.mTailMip : slot.mWantedMip;
+				};
+
+			std::vector<Slot*> candidates;
+			for (uint32_t i = 0; i < sData->mSlotCount; ++i)
+			{
+				Slot& slot = GetSlot(i);
+				if (slot.mTexture && slot.mLoadingMip == slot.mResidentMip && slot.mResidentMip < evictionTarget(slot))
+					candidates.push_back(&slot);
+			}
+			std::sort(candidates.begin(), candidates.end(), [](const Slot* first, const Slot* second) { return first->mLastUsedFrame < second->mLastUsedFrame; });
+
+			for (Slot* slot : candidates)
+			{
+				// One level at a time, so the texture keeps as much detail as the budget allows
+				uint32_t target = evictionTarget(*slot);
+				while (slot->mResidentMip < target && sData->mStreamedBytes + bytes > budget)
+					Evict(*slot, slot->mResidentMip + 1);
+
+				if (sData->mStreamedBytes + bytes <= budget)
+					return true;
+			}
+			return false;
+		}
+	}
+
+	void TextureStreamer::Init()
+	{
+		MemoryTagScope memoryTag(MemoryTag::Textures);
+		sData = new StreamerData();
+		sData->mThread = std::thread(StreamLoop);
+	}
+
+	void TextureStreamer::Free()
+	{
+		if (!sData)
+			return;
+
+		{
+			std::lock_guard<std::mutex> lock(sData->mMutex);
+			sData->mRunning = false;
+		}
+		sData->mSignal.notify_all();
+		sData->mThread.join();
+
+		// Textures that outlive the streamer keep what they have resident
+		delete sData;
+		sData = nullptr;
+	}
+
+	uint32_t TextureStreamer::GetTailMip(uint32_t width, uint32_t height, uint32_t levels)
+	{
+		uint32_t mip = 0;
+		while (mip + 1 < levels && std::max(width >> mip, height >> mip) > sTailSize)
+			++mip;
+		return mip;
+	}
+
+	TextureStreamer::Handle TextureStreamer::Register(Texture2D* texture, std::shared_ptr<const MipLayout> layout, uint32_t tailMip)
+	{
+		if (!sData || tailMip == 0)
+			return InvalidHandle;
+
+		std::lock_guard<std::mutex> slotLock(sData->mSlotMutex);
+		Handle handle;
+		if (!sData->mFreeSlots.empty())
+		{
+			handle = sData->mFreeSlots.back();
+			sData->mFreeSlots.pop_back();
+		}
+		else
+		{
+			if (sData->mSlotCount == sChunkSize * sMaxChunks)
+			{
+				BOREALIS_CORE_WARN("Texture streamer is full, texture is fully resident");
+				return InvalidHandle;
+			}
+
+			handle = sData->mSlotCount++;
+			std::unique_ptr<Slot[]>& chunk = sData->mChunks[handle / sChunkSize];
+			if (!chunk)
+			{
+				MemoryTagScope memoryTag(MemoryTag::Textures);
+				chunk = std::make_unique<Slot[]>(sChunkSize);
+			}
+		}
+
+		Slot& slot = GetSlot(handle);
+		slot.mTexture = texture;
+		slot.mHandle = handle;
+		slot.mLayout = std::move(layout);
+		slot.mTailMip = slot.mResidentMip = slot.mLoadingMip = slot.mWantedMip = tailMip;
+		slot.mLastUsedFrame = sData->mFrame;
+		slot.mRequestedMip.store(sNoRequest, std::memory_order_relaxed);
+		return handle;
+	}
+
+	void TextureStreamer::Unregister(Handle handle)
+	{
+		if (!sData || handle == InvalidHandle)
+			return;
+
+		// Waits out an Update that may be uploading to the texture being destroyed
+		std::lock_guard<std::mutex> slotLock(sData->mSlotMutex);
+		Slot& slot = GetSlot(handle);
+		sData->mStreamedBytes -= GetLevelBytes(slot, slot.mLoadingMip, slot.mTailMip);
+		sData->mBytesInFlight -= GetLevelBytes(slot, slot.mLoadingMip, slot.mResidentMip);
+
+		slot.mTexture = nullptr;
+		slot.mLayout.reset();
+		slot.mGeneration++;
+		sData->mFreeSlots.push_back(handle);
+	}
+
+	void TextureStreamer::RequestMip(Handle handle, uint32_t mip)
+	{
+		if (!sData || handle == InvalidHandle)
+			return;
+
+		std::atomic<uint32_t>& requested = GetSlot(handle).mRequestedMip;
+		uint32_t current = requested.load(std::memory_order_relaxed);
+		while (mip < current && !requested.compare_exchange_weak(current, mip, std::memory_order_relaxed));
+	}
+
+	void TextureStreamer::Update()
+	{
+		if (!sData)
+			return;
+
+		PROFILE_FUNCTION();
+		sData->mFrame++;
+
+		std::vector<ReadResult> results;
+		{
+			std::lock_guard<std::mutex> lock(sData->mMutex);
+			results.swap(sData->mResults);
+		}
+
+		std::unique_lock<std::mutex> slotLock(sData->mSlotMutex);
+		for (ReadResult& result : results)
+		{
+			Slot& slot = GetSlot(result.mHandle);
+			if (!slot.mTexture || slot.mGeneration != result.mGeneration)
+				continue;
+
+			uint64_t bytes = GetLevelBytes(slot, result.mFirstLevel, slot.mResidentMip);
+			sData->mBytesInFlight -= bytes;
+			if (!result.mSuccess)
+			{
+				BOREALIS_CORE_WARN("Failed to stream mips of {}", slot.mLayout->mPath);
+				sData->mStreamedBytes -= bytes;
+				slot.mLoadingMip = slot.mResidentMip;
+				continue;
+			}
+
+			slot.mTexture->UploadMips(result.mFirstLevel, std::move(result.mData));
+			slot.mResidentMip = result.mFirstLevel;
+		}
+
+		// Whatever the GPU texture budget leaves after the textures that are not streamed
+		MemoryTagStats stats = MemoryTracker::GetStats(MemoryTag::GPUTextures);
+		uint64_t budget = stats.Budget ? stats.Budget : sDefaultBudget;
+		uint64_t streamedResident = sData->mStreamedBytes - sData->mBytesInFlight;
+		uint64_t fixedBytes = stats.LiveBytes > streamedResident ? stats.LiveBytes - streamedResident : 0;
+		uint64_t streamBudget = budget > fixedBytes ? budget - fixedBytes : 0;
+
+		std::vector<Slot*> wanted;
+		for (uint32_t i = 0; i < sData->mSlotCount; ++i)
+		{
+			Slot& slot = GetSlot(i);
+			if (!slot.mTexture)
+				continue;
+
+			uint32_t requested = slot.mRequestedMip.exchange(sNoRequest, std::memory_order_relaxed);
+			if (requested != sNoRequest)
+			{
+				slot.mLastUsedFrame = sData->mFrame;
+				slot.mWantedMip = std::min(requested, slot.mTailMip);
+			}
+			else if (sData->mFrame - slot.mLastUsedFrame > sUnusedFrames)
+			{
+				slot.mWantedMip = slot.mTailMip;
+			}
+
+			if (slot.mWantedMip < slot.mLoadingMip && slot.mLoadingMip == slot.mResidentMip)
+				wanted.push_back(&slot);
+		}
+
+		// Textures on screen now first, then the ones missing the most levels
+		std::sort(wanted.begin(), wanted.end(), [](const Slot* first, const Slot* second)
+			{
+				if (first->mLastUsedFrame != second->mLastUsedFrame)
+					return first->mLastUsedFrame > second->mLastUsedFrame;
+				return first->mResidentMip - first->mWantedMip > second->mResidentMip - second->mWantedMip;
+			});
+
+		std::vector<ReadRequest> requests;
+		for (Slot* slot : wanted)
+		{
+			if (sData->mBytesInFlight >= sMaxBytesInFlight)
+				break;
+
+			// Fall back to the next level when the whole chain does not fit
+			uint32_t firstLevel = slot->mWantedMip;
+			uint64_t bytes = GetLevelBytes(*slot, firstLevel, slot->mResidentMip);
+			if (!MakeRoom(bytes, streamBudget))
+			{
+				firstLevel = slot->mResidentMip - 1;
+				bytes = GetLevelBytes(*slot, firstLevel, slot->mResidentMip);
+				if (!MakeRoom(bytes, streamBudget))
+					break;
+			}
+
+			sData->mStreamedBytes += bytes;
+			sData->mBytesInFlight += bytes;
+			slot->mLoadingMip = firstLevel;
+			requests.push_back({ slot->mHandle, slot->mGeneration, slot->mLayout, firstLevel, slot->mResidentMip });
+		}
+
+		// Over budget without new reads, e.g. the budget was lowered
+		MakeRoom(0, streamBudget);
+		uint64_t streamedBytes = sData->mStreamedBytes;
+		slotLock.unlock();
+
+		if (!requests.empty())
+		{
+			{
+				std::lock_guard<std::mutex> lock(sData->mMutex);
+				for (ReadRequest& request : requests)
+					sData->mRequests.push_back(std::move(request));
+			}
+			sData->mSignal.notify_one();
+		}
+
+		PROFILE_COUNTER("Streamed Texture Bytes", static_cast<double>(streamedBytes));
+		PROFILE_COUNTER("Texture Stream Reads", static_cast<double>(requests.size()));
+	}
+
+	bool TextureStreamer::ReadMips(const MipLayout& layout, uint32_t firstLevel, uint32_t lastLevel, std::vector<uint8_t>& data)
+	{
+		std::ifstream file(layout.mPath, std::ios::binary);
+		if (!file)
+			return false;
+
+		uint64_t bytes = 0;
+		for (uint32_t level = firstLevel; level < lastLevel; ++level)
+			bytes += layout.mSizes[level];
+		data.resize(static_cast<size_t>(bytes));
+
+		uint8_t* destination = data.data();
+		for (uint32_t level = firstLevel; level < lastLevel; ++level)
+		{
+			file.seekg(static_cast<std::streamoff>(layout.mOffsets[level]));
+			file.read(reinterpret_cast<char*>(destination), static_cast<std::streamsize>(layout.mSizes[level]));
+			if (!file)
+				return false;
+			destination += layout.mSizes[level];
+		}
+		return true;
+	}
+
+	uint64_t TextureStreamer::GetStreamedBytes()
+	{
+		if (!sData)
+			return 0;
+
+		std::lock_guard<std::mutex> slotLock(sData->mSlotMutex);
+		return sData->mStreamedBytes;
+	}
+}
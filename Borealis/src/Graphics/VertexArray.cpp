@@ -15,6 +15,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <BorealisPCH.hpp>
 #include <Graphics/Renderer.hpp>
 #include <Graphics/OpenGL/VertexArrayOpenGLImpl.hpp>
+#include <Graphics/Null/VertexArrayNullImpl.hpp>
 #include <Core/LoggerSystem.hpp>
 
 
@@ -26,6 +27,7 @@ namespace Borealis
 		{
 			case RendererAPI::API::None: BOREALIS_CORE_ASSERT(false, "RendererAPI::None is not supported"); return nullptr;
 			case RendererAPI::API::OpenGL: return MakeRef<OpenGLVertexArray>();
+			case RendererAPI::API::Null: return MakeRef<NullVertexArray>();
 		}
 		BOREALIS_CORE_ASSERT(false, "Unknown RendererAPI");
 		return nullptr;
@@ -21,6 +21,8 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <ImGui/ImGuiLayer.hpp>
 #include <ImGui/ImGuiFontLib.hpp>
 #include <Scene/Serialiser.hpp>
+#include <Graphics/RenderThread.hpp>
+#include <Graphics/GpuProfiler.hpp>
 
 #include <GLFW/glfw3.h>
 #include <glad/glad.h>
@@ -64,7 +66,9 @@ namespace Borealis
 		io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;     // Enable Keyboard Controls
 		io.ConfigFlags |= ImGuiConfigFlags_NavEnableGamepad;      // Enable Gamepad Controls
 		io.ConfigFlags |= ImGuiConfigFlags_DockingEnable;         // Enable Docking
-		io.ConfigFlags |= ImGuiConfigFlags_ViewportsEnable;       // Enable Multi-Viewport / Platform Windows
+		// Platform windows render through their own contexts, so they need the renderer on this thread
+		if (RenderThread::GetPolicy() != RenderThread::Policy::MultiThreaded)
+			io.ConfigFlags |= ImGuiConfigFlags_ViewportsEnable;   // Enable Multi-Viewport / Platform Windows
 		//io.ConfigViewportsNoAutoMerge = true;
 		//io.ConfigViewportsNoTaskBarIcon = true;
 
@@ -146,6 +150,10 @@ namespace Borealis
 
 		ImGui_ImplOpenGL3_NewFrame();
 		ImGui_ImplGlfw_NewFrame();
+
+		// The backend falls back to the live cursor when the window is focused, the replayed one is queued after it
+		if (!mLiveInput)
+			ImGui::GetIO().AddMousePosEvent(mReplayMouseX, mReplayMouseY);
 		ImGui::NewFrame();
 		ImGuizmo::BeginFrame();
 	}
@@ -159,7 +167,26 @@ namespace Borealis
 		io.DisplaySize = ImVec2(static_cast<float>(app.GetWindow()->GetWidth()), static_cast<float>(app.GetWindow()->GetHeight()));
 
 		ImGui::Render();
-		ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+		if (RenderThread::IsMultiThreaded())
+		{
+			// The draw lists are rebuilt next frame while the render thread is still drawing this one, so it gets a copy
+			ImDrawData* source = ImGui::GetDrawData();
+			std::shared_ptr<ImDrawData> drawData(IM_NEW(ImDrawData)(*source), [](ImDrawData* data)
+				{
+					for (ImDrawList* list : data->CmdLists)
+						IM_DELETE(list);
+					IM_DELETE(data);
+				});
+			for (int i = 0; i < drawData->CmdLists.Size; ++i)
+				drawData->CmdLists[i] = source->CmdLists[i]->CloneOutput();
+
+			RenderThread::Submit([drawData]() { PROFILE_GPU_SCOPE("ImGui"); ImGui_ImplOpenGL3_RenderDrawData(drawData.get()); });
+		}
+		else
+		{
+			PROFILE_GPU_SCOPE("ImGui");
+			ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+		}
 
 		if (io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable)
 		{
@@ -170,6 +197,47 @@ namespace Borealis
 		}
 	}
 
+	void ImGuiLayer::DetachLiveInput()
+	{
+		if (!mLiveInput)
+			return;
+
+		ImGui_ImplGlfw_RestoreCallbacks((GLFWwindow*)ApplicationManager::Get().GetWindow()->GetNativeWindow());
+		mLiveInput = false;
+	}
+
+	void ImGuiLayer::ReplayInput(const InputEvent& event)
+	{
+		GLFWwindow* window = (GLFWwindow*)ApplicationManager::Get().GetWindow()->GetNativeWindow();
+		ImGuiIO& io = ImGui::GetIO();
+		switch (event.mType)
+		{
+			case InputEvent::Type::Key:
+				ImGui_ImplGlfw_KeyCallback(window, event.mCode, event.mScancode, event.mAction, event.mMods);
+				break;
+			case InputEvent::Type::Char:
+				ImGui_ImplGlfw_CharCallback(window, static_cast<unsigned>(event.mCode));
+				return;
+			case InputEvent::Type::MouseButton:
+				ImGui_ImplGlfw_MouseButtonCallback(window, event.mCode, event.mAction, event.mMods);
+				break;
+			case InputEvent::Type::Scroll:
+				ImGui_ImplGlfw_ScrollCallback(window, event.mX, event.mY);
+				return;
+			case InputEvent::Type::CursorPos:
+				mReplayMouseX = static_cast<float>(event.mX);
+				mReplayMouseY = static_cast<float>(event.mY);
+				io.AddMousePosEvent(mReplayMouseX, mReplayMouseY);
+				return;
+		}
+
+		// The backend reads the modifiers from the live keyboard, the recorded ones replace them
+		io.AddKeyEvent(ImGuiMod_Ctrl, (event.mMods & GLFW_MOD_CONTROL) != 0);
+		io.AddKeyEvent(ImGuiMod_Shift, (event.mMods & GLFW_MOD_SHIFT) != 0);
+		io.AddKeyEvent(ImGuiMod_Alt, (event.mMods & GLFW_MOD_ALT) != 0);
+		io.AddKeyEvent(ImGuiMod_Super, (event.mMods & GLFW_MOD_SUPER) != 0);
+	}
+
 	void ImGuiLayer::ImGuiRender(float dt)
 	{
 
@@ -22,13 +22,15 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 
 #include <Physics/PhysicsSystem.hpp>
 #include <Core/Utils.hpp>
+#include <Core/JobSystem.hpp>
+#include <Core/MemoryTracker.hpp>
 #include <Jolt/Jolt.h>
 
 // Jolt includes
 #include <Jolt/RegisterTypes.h>
 #include <Jolt/Core/Factory.h>
 #include <Jolt/Core/TempAllocator.h>
-#include <Jolt/Core/JobSystemThreadPool.h>
+#include <Jolt/Core/JobSystemWithBarrier.h>
 #include <Jolt/Physics/PhysicsSettings.h>
 #include <Jolt/Physics/PhysicsSystem.h>
 #include <Jolt/Physics/Collision/Shape/BoxShape.h>
@@ -215,11 +217,57 @@ public:
 	}
 };
 
+/// Routes Jolt's jobs onto the engine job system so physics shares the worker threads with the rest of the frame
+class JobSystemAdapter final : public JobSystemWithBarrier
+{
+public:
+	explicit JobSystemAdapter(uint inMaxBarriers) : JobSystemWithBarrier(inMaxBarriers) {}
+
+	virtual int				GetMaxConcurrency() const override
+	{
+		return static_cast<int>(Borealis::JobSystem::GetWorkerCount()) + 1;
+	}
+
+	virtual JobHandle		CreateJob(const char* inName, ColorArg inColor, const JobFunction& inJobFunction, uint32 inNumDependencies = 0) override
+	{
+		Job* job = new Job(inName, inColor, this, inJobFunction, inNumDependencies);
+
+		// Construct handle to keep a reference, the job is queued below and may immediately complete
+		JobHandle handle(job);
+		if (inNumDependencies == 0)
+			QueueJob(job);
+		return handle;
+	}
+
+protected:
+	virtual void			QueueJob(Job* inJob) override
+	{
+		// The queue holds a reference until the job has run
+		inJob->AddRef();
+		Borealis::JobSystem::Submit([inJob]()
+			{
+				inJob->Execute();
+				inJob->Release();
+			});
+	}
+
+	virtual void			QueueJobs(Job** inJobs, uint inNumJobs) override
+	{
+		for (Job** job = inJobs, **job_end = inJobs + inNumJobs; job < job_end; ++job)
+			QueueJob(*job);
+	}
+
+	virtual void			FreeJob(Job* inJob) override
+	{
+		delete inJob;
+	}
+};
+
 struct PhysicsSystemData
 {
 	JPH::PhysicsSystem* mSystem;
 	JPH::TempAllocatorImpl* temp_allocator;
-	JPH::JobSystemThreadPool* job_system;
+	JobSystemAdapter* job_system;
 	JPH::BodyInterface* body_interface;
 	BPLayerInterfaceImpl* broad_phase_layer_interface;
 	ObjectVsBroadPhaseLayerFilterImpl* object_vs_broadphase_layer_filter;
@@ -236,14 +284,19 @@ namespace Borealis
 {
 void PhysicsSystem::Init()
 {
+	// Register allocation hook, so everything Jolt allocates is counted under Physics.
+	// This needs to be done before any other Jolt function is called.
+	JPH::Allocate = [](size_t size) { return MemoryTracker::Allocate(size, 16, MemoryTag::Physics); };
+	JPH::Reallocate = [](void* block, size_t, size_t size) { return MemoryTracker::Reallocate(block, size, MemoryTag::Physics); };
+	JPH::Free = [](void* block) { MemoryTracker::Free(block); };
+	JPH::AlignedAllocate = [](size_t size, size_t alignment) { return MemoryTracker::Allocate(size, alignment, MemoryTag::Physics); };
+	JPH::AlignedFree = [](void* block) { MemoryTracker::Free(block); };
+
 	sData.broad_phase_layer_interface = new BPLayerInterfaceImpl();
 	sData.object_vs_broadphase_layer_filter = new ObjectVsBroadPhaseLayerFilterImpl();
 	sData.object_vs_object_layer_filter = new ObjectLayerPairFilterImpl();
 	sData.contact_listener = new MyContactListener();
 	sData.body_activation_listener = new MyBodyActivationListener();
-	// Register allocation hook. In this example we'll just let Jolt use malloc / free but you can override these if you want (see Memory.h).
-	// This needs to be done before any other Jolt function is called.
-	RegisterDefaultAllocator();
 
 	// Install trace and assert callbacks
 	Trace = TraceImpl;
@@ -264,7 +317,8 @@ void PhysicsSystem::Init()
 	// If you don't want to pre-allocate you can also use TempAllocatorMalloc to fall back to
 	// malloc / free.
 	sData.temp_allocator = new TempAllocatorImpl(10 * 1024 * 1024);
-	sData.job_system = new JobSystemThreadPool(2048, 8, thread::hardware_concurrency() - 1);
+	// Jolt runs its jobs on the engine job system instead of a private thread pool
+	sData.job_system = new JobSystemAdapter(cMaxPhysicsBarriers);
 
 	// This is the max amount of rigid bodies that you can add to the physics system. If you try to add more you'll get an error.
 	// Note: This value is low because this is a simple test. For a real project use something in the order of 65536.
@@ -403,7 +457,7 @@ void PhysicsSystem::Init()
 	}
 
 
-	void PhysicsSystem::addSphereBody(float radius, glm::vec3 position, RigidBodyComponent& rigidbody)
+	void PhysicsSystem::addSphereBody(float radius, glm::vec3 position, RigidBodyComponent& rigidbody, bool addToWorld)
 	{
 		// Create the settings for the collision volume (the shape).
 		SphereShapeSettings sphere_shape_settings(radius); // Use radius as half extents
@@ -422,12 +476,20 @@ void PhysicsSystem::Init()
 		Body* sphere = sData.body_interface->CreateBody(sphere_settings); // Make sure to handle potential nullptr errors
 
 		// Add it to the world
-		sData.body_interface->AddBody(sphere->GetID(), EActivation::Activate);
+		if (addToWorld)
+			sData.body_interface->AddBody(sphere->GetID(), EActivation::Activate);
 
 		// Store the BodyID in the RigidBodyComponent
 		rigidbody.bodyID = sphere->GetID().GetIndexAndSequenceNumber();
 	}
 
+	void PhysicsSystem::AddToWorld(RigidBodyComponent& rigidbody)
+	{
+		JPH::BodyID id(rigidbody.bodyID);
+		if (!sData.body_interface->IsAdded(id))
+			sData.body_interface->AddBody(id, EActivation::Activate);
+	}
+
 	void PhysicsSystem::UpdateSphereValues(RigidBodyComponent& rigidbody)
 	{
 		// Create the settings for the collision volume (the shape).
@@ -457,6 +519,9 @@ void PhysicsSystem::Init()
 	}
 	void PhysicsSystem::FreeRigidBody(RigidBodyComponent& rigidbody)
 	{
-		sData.body_interface->RemoveBody(JPH::BodyID(rigidbody.bodyID));
+		// Bodies of a scene whose load was dropped never joined the world
+		JPH::BodyID id(rigidbody.bodyID);
+		if (sData.body_interface->IsAdded(id))
+			sData.body_interface->RemoveBody(id);
 	}
 }
\ No newline at end of file
@@ -13,6 +13,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
  /******************************************************************************/
 
 #include <BorealisPCH.hpp>
+#include <numeric>
 #include <glm/glm.hpp>
 #include <Scene/Scene.hpp>
 #include <Scene/Entity.hpp>
@@ -26,6 +27,9 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <Scene/SceneCamera.hpp>
 #include "Graphics/Light.hpp"
 #include <Physics/PhysicsSystem.hpp>
+#include <Core/JobSystem.hpp>
+#include <Graphics/RenderThread.hpp>
+#include <Core/FrameAllocator.hpp>
 
 namespace Borealis
 {
@@ -42,262 +46,484 @@ namespace Borealis
 			PhysicsSystem::FreeRigidBody(view.get<RigidBodyComponent>(entity));
 		}
 	}
+	void Scene::AddDeferredPhysicsBodies()
+	{
+		if (!mDeferPhysicsBodies)
+			return;
+
+		auto view = mRegistry.view<RigidBodyComponent>();
+		for (auto entity : view)
+			PhysicsSystem::AddToWorld(view.get<RigidBodyComponent>(entity));
+		mDeferPhysicsBodies = false;
+	}
+
 	void Scene::UpdateRuntime(float dt)
 	{
+		PROFILE_FUNCTION();
+
+		// Cells stream in before the views below are made, as they create and destroy entities
+		if (mWorldPartition)
+		{
+			if (Entity camera = GetPrimaryCameraEntity())
+				mWorldPartition->Update(*this, camera.GetComponent<TransformComponent>().Translate);
+		}
+
+		// Views and groups are created on this thread, the registry is not
+		// safe to mutate from the workers.
+		auto nativeView = mRegistry.view<NativeScriptComponent>();
+		auto view = mRegistry.view<ScriptComponent>();
+		auto BTview = mRegistry.view<BehaviourTreeComponent>();
+		auto physicsGroup = mRegistry.group<>(entt::get<TransformComponent, RigidBodyComponent>);
+		auto listenerGroup = mRegistry.group<>(entt::get<TransformComponent, AudioListenerComponent>);
+		auto audioGroup = mRegistry.group<>(entt::get<TransformComponent, AudioSourceComponent>);
+
+		mFrameGraph.Clear();
+
 		if (hasRuntimeStarted)
 		{
-			{
-				mRegistry.view<NativeScriptComponent>().each([=](auto entity, auto& component)
-					{
-						if (!component.Instance)
+			// Scripts may add or remove components, so they run alone on the main thread
+			mFrameGraph.AddTask("NativeScripts", [&]()
+				{
+					nativeView.each([=](auto entity, auto& component)
 						{
-							component.Instance = component.Init();
-							component.Instance->mEntity = Entity{ entity, this };
-							component.Instance->Start();
-						}
-						component.Instance->Update(dt);
-					});
-			}
+							if (!component.Instance)
+							{
+								component.Instance = component.Init();
+								component.Instance->mEntity = Entity{ entity, this };
+								component.Instance->Start();
+							}
+							component.Instance->Update(dt);
+						});
+				}).WritesAll().OnMainThread();
 
 			// Update for scripts -> make it more effecient by doing event-based and
 			// overridden-based rather than running every script every loop.
-			auto view = mRegistry.view<ScriptComponent>();
-			for (auto entity : view)
-			{
-				auto& scriptComponent = view.get<ScriptComponent>(entity);
-				for (auto& [name, script] : scriptComponent.mScripts)
+			mFrameGraph.AddTask("Scripts Update", [&]()
 				{
-					script->Update();
-				}
-			}
+					for (auto entity : view)
+					{
+						auto& scriptComponent = view.get<ScriptComponent>(entity);
+						for (auto& [name, script] : scriptComponent.mScripts)
+						{
+							script->Update();
+						}
+					}
+				}).WritesAll().OnMainThread();
+
 			static float accumDt = 0;
 			accumDt += dt;
 			int timeStep = std::max(1, (int)(accumDt / 1.66667f));
 			accumDt -= timeStep * 1.66667f;
 
-			auto BTview = mRegistry.view<BehaviourTreeComponent>();
-			for (auto entity : BTview)
-			{
-				BTview.get<BehaviourTreeComponent>(entity).Update(dt);
-			}
-
-
-
 			//timeStep = dt / 1.66667f;
-			for (auto entity : view)
-			{
-				auto& scriptComponent = view.get<ScriptComponent>(entity);
-				for (auto& [name, script] : scriptComponent.mScripts)
+			mFrameGraph.AddTask("Scripts FixedUpdate", [&, timeStep]()
 				{
-					for (int i = 0; i < timeStep; i++)
-						script->FixedUpdate();
-				}
-			}
+					for (auto entity : view)
+					{
+						auto& scriptComponent = view.get<ScriptComponent>(entity);
+						for (auto& [name, script] : scriptComponent.mScripts)
+						{
+							for (int i = 0; i < timeStep; i++)
+								script->FixedUpdate();
+						}
+					}
+				}).WritesAll().OnMainThread();
+
+			mFrameGraph.AddTask("BehaviourTrees", [&]()
+				{
+					JobSystem::ParallelFor(static_cast<uint32_t>(BTview.size()), 64, [&](uint32_t begin, uint32_t end)
+						{
+							for (uint32_t i = begin; i < end; ++i)
+							{
+								BTview.get<BehaviourTreeComponent>(*(BTview.begin() + i)).Update(dt);
+							}
+						});
+				}).Writes<BehaviourTreeComponent>();
 
 			//------------------------
 			// Physics Simulation here
 			//------------------------
-			
-			// Set Jolt values to entity transform.
-			{
-				auto physicsGroup = mRegistry.group<>(entt::get<TransformComponent, RigidBodyComponent>);
-				for (auto entity : physicsGroup)
+			mFrameGraph.AddTask("Physics", [&]()
 				{
-					auto [transform, rigidbody] = physicsGroup.get<TransformComponent, RigidBodyComponent>(entity);
-					PhysicsSystem::PushTransform(rigidbody.bodyID, transform);
-				}
+					uint32_t bodyCount = static_cast<uint32_t>(physicsGroup.size());
 
-				PhysicsSystem::Update(dt);
+					// Set Jolt values to entity transform.
+					JobSystem::ParallelFor(bodyCount, 128, [&](uint32_t begin, uint32_t end)
+						{
+							for (uint32_t i = begin; i < end; ++i)
+							{
+								auto [transform, rigidbody] = physicsGroup.get<TransformComponent, RigidBodyComponent>(*(physicsGroup.begin() + i));
+								PhysicsSystem::PushTransform(rigidbody.bodyID, transform);
+							}
+						});
 
-				// Set entity values to Jolt transform.
-				for (auto entity : physicsGroup)
-				{
-					auto [transform, rigidbody] = physicsGroup.get<TransformComponent, RigidBodyComponent>(entity);
-					PhysicsSystem::PullTransform(rigidbody.bodyID, transform);
-				}
-				for (auto entity : view)
+					PhysicsSystem::Update(dt);
+
+					// Set entity values to Jolt transform.
+					JobSystem::ParallelFor(bodyCount, 128, [&](uint32_t begin, uint32_t end)
+						{
+							for (uint32_t i = begin; i < end; ++i)
+							{
+								auto [transform, rigidbody] = physicsGroup.get<TransformComponent, RigidBodyComponent>(*(physicsGroup.begin() + i));
+								PhysicsSystem::PullTransform(rigidbody.bodyID, transform);
+							}
+						});
+				}).Writes<TransformComponent, RigidBodyComponent>();
+
+			mFrameGraph.AddTask("Scripts LateUpdate", [&]()
 				{
-					auto& scriptComponent = view.get<ScriptComponent>(entity);
-					for (auto& [name, script] : scriptComponent.mScripts)
+					for (auto entity : view)
 					{
-						script->LateUpdate();
+						auto& scriptComponent = view.get<ScriptComponent>(entity);
+						for (auto& [name, script] : scriptComponent.mScripts)
+						{
+							script->LateUpdate();
+						}
 					}
-				}
-			}
+				}).WritesAll().OnMainThread();
 		}
 
 		Camera* mainCamera = nullptr;
 		glm::mat4 mainCameratransform(1.f);
-	
-		{
-			auto group = mRegistry.group<>(entt::get<TransformComponent, CameraComponent>);
-			for (auto entity : group)
-			{
-				auto [transform, camera] = group.get<TransformComponent, CameraComponent>(entity);
+		auto cameraGroup = mRegistry.group<>(entt::get<TransformComponent, CameraComponent>);
 
-				if (camera.Primary)
-				{
-					//camera.Camera.SetCameraType(SceneCamera::CameraType::Perspective);
-					mainCamera = &camera.Camera;
-					mainCameratransform = transform;
-					break;
-				}
-			}
-		}
-
-		// Pre-Render
-		if (mainCamera)
-		{
-			Renderer3D::Begin(*mainCamera, mainCameratransform);
+		mFrameGraph.AddTask("Camera", [&]()
 			{
+				for (auto entity : cameraGroup)
 				{
-					auto group = mRegistry.group<>(entt::get<TransformComponent, LightComponent>);
-					for (auto& entity : group)
+					auto [transform, camera] = cameraGroup.get<TransformComponent, CameraComponent>(entity);
+
+					if (camera.Primary)
 					{
-						auto [transform, lightComponent] = group.get<TransformComponent, LightComponent>(entity);
-						lightComponent.offset = transform.Translate;
-						Renderer3D::AddLight(lightComponent);
+						//camera.Camera.SetCameraType(SceneCamera::CameraType::Perspective);
+						mainCamera = &camera.Camera;
+						mainCameratransform = transform;
+						break;
 					}
 				}
+			}).Reads<TransformComponent, CameraComponent>();
 
-				auto group = mRegistry.group<>(entt::get<TransformComponent, MeshFilterComponent, MeshRendererComponent>);
-				for (auto& entity : group)
+		BuildRenderList();
+
+		auto particleGroup = mRegistry.group<>(entt::get<TransformComponent, ParticleSystemComponent>);
+		mFrameGraph.AddTask("Particles", [&]()
+			{
+				for (auto entity : particleGroup)
 				{
-					auto [transform, meshFilter, meshRenderer] = group.get<TransformComponent, MeshFilterComponent, MeshRendererComponent>(entity);
-					auto groupLight = mRegistry.group<>(entt::get<TransformComponent, LightComponent>);
+					auto [transform, particles] = particleGroup.get<TransformComponent, ParticleSystemComponent>(entity);
+					if (!particles.System || particles.System->GetCapacity() != particles.MaxParticles)
+						particles.System = MakeRef<ParticleSystem>(particles.MaxParticles);
 
-					Renderer3D::DrawMesh(transform, meshFilter, meshRenderer, (int)entity);
+					particles.System->Update(dt);
+
+					// Carry the fraction over, so low rates still emit at high frame rates
+					particles.EmitAccumulator += particles.EmitRate * dt;
+					uint32_t count = static_cast<uint32_t>(particles.EmitAccumulator);
+					particles.EmitAccumulator -= static_cast<float>(count);
+					if (count)
+					{
+						ParticleProps props = particles.Props;
+						props.Position += transform.Translate;
+						particles.System->Emit(props, count);
+					}
 				}
-			}
-			Renderer3D::End();
+			}).Reads<TransformComponent>().Writes<ParticleSystemComponent>();
 
-			Renderer2D::Begin(*mainCamera, mainCameratransform);
+		//Audio
+		mFrameGraph.AddTask("Audio", [&]()
 			{
-				auto group = mRegistry.group<>(entt::get<TransformComponent, SpriteRendererComponent>);
-				for (auto& entity : group)
+				int listener = 0;
+				for (auto& entity : listenerGroup)
 				{
-					auto [transform, sprite] = group.get<TransformComponent, SpriteRendererComponent>(entity);
-					Renderer2D::DrawSprite(transform, sprite, (int)entity);
+					auto [transform, audioListener] = listenerGroup.get<TransformComponent, AudioListenerComponent>(entity);
+					if (!audioListener.isAudioListener)
+						continue;
+
+					if (listener > 0)
+					{
+						BOREALIS_CORE_ASSERT(false, "More than 1 listener");
+					}
+					listener++;
+
+					glm::quat rotation = glm::quat(glm::radians(transform.Rotation));
+					glm::vec3 forward = rotation * glm::vec3(0.0f, 0.0f, -1.0f);
+					glm::vec3 up = rotation * glm::vec3(0.0f, 1.0f, 0.0f);
+					AudioEngine::Set3DListenerAndOrientation({ transform.Translate.x, transform.Translate.y, transform.Translate.z }, { forward.x, forward.y, forward.z }, { up.x, up.y, up.z });
 				}
-				//Renderer2D::End();
-			}
 
-			{
-				//Renderer2D::Begin(*mainCamera, mainCameratransform);
-				auto group = mRegistry.group<>(entt::get<TransformComponent, CircleRendererComponent>);
-				for (auto& entity : group)
+				if (listener > 0)
 				{
-					auto [transform, circle] = group.get<TransformComponent, CircleRendererComponent>(entity);
-					Renderer2D::DrawCircle(transform, circle.Colour, circle.thickness, circle.fade);
+					// Positions are only recorded here, the audio engine sends them to FMOD in one batch
+					for (auto& entity : audioGroup)
+					{
+						auto [transform, audio] = audioGroup.get<TransformComponent, AudioSourceComponent>(entity);
+						Vector3 position{ transform.Translate.x, transform.Translate.y, transform.Translate.z };
+						if (audio.isPlaying && (!Borealis::AudioEngine::isSoundPlaying(audio.channelID) || !audio.isLoop))
+						{
+							AudioEngine::StopChannel(audio.channelID);
+							audio.isPlaying = false;
+							audio.channelID = Borealis::AudioEngine::PlayAudio(audio, position, audio.Volume, audio.isMute, audio.isLoop);
+						}
+						else
+						{
+							AudioEngine::SetChannel3DPosition(audio.channelID, position);
+						}
+					}
 				}
-				//Renderer2D::End();
-			}
+			}).Reads<TransformComponent, AudioListenerComponent>().Writes<AudioSourceComponent>();
 
-			{
-				//Renderer2D::Begin(*mainCamera, mainCameratransform);
-				auto group = mRegistry.group<>(entt::get<TransformComponent, TextComponent>);
-				for (auto& entity : group)
-				{
+		mFrameGraph.Execute();
 
-					auto [transform, text] = group.get<TransformComponent, TextComponent>(entity);
-					// multiply text scale into transform
-					Renderer2D::DrawString(text.text, text.font, transform, (int)entity);
-				}
-			}
-				Renderer2D::End();
-			
+		// Pre-Render
+		if (mainCamera)
+		{
+			// The camera is copied into the packets since the render thread may run a frame behind
+			SelectLods(glm::vec3(mainCameratransform[3]), mainCamera->GetProjectionMatrix(), dt);
+			RenderThread::Submit([camera = *mainCamera, mainCameratransform]() { Renderer3D::Begin(camera, mainCameratransform); });
+			SubmitMeshes();
+			RenderThread::Submit([]() { Renderer3D::End(); });
+
+			RenderThread::Submit([camera = *mainCamera, mainCameratransform]() { Renderer2D::Begin(camera, mainCameratransform); });
+			SubmitSprites();
+			RenderThread::Submit([]() { Renderer2D::End(); });
 		}
 
-		//Audio
-		{
-			auto group = mRegistry.group<>(entt::get<TransformComponent, AudioListenerComponent>);
-			int listener = 0;
-			for (auto& entity : group)
+		PROFILE_COUNTER("Entities", mRegistry.view<IDComponent>().size());
+	}
+
+	void Scene::UpdateEditor(float dt, EditorCamera& camera)
+	{
+		PROFILE_FUNCTION();
+
+		mFrameGraph.Clear();
+		BuildRenderList();
+		mFrameGraph.Execute();
+
+		SelectLods(camera.GetPosition(), camera.GetProjectionMatrix(), dt);
+		RenderThread::Submit([camera]() { Renderer3D::Begin(camera); });
+		SubmitMeshes();
+
+		RenderThread::Submit([camera]() { Renderer3D::End(); Renderer2D::Begin(camera); });
+		SubmitSprites();
+		RenderThread::Submit([]() { Renderer2D::End(); });
+
+	}
+
+	void Scene::BuildRenderList()
+	{
+		auto lightGroup = mRegistry.group<>(entt::get<TransformComponent, LightComponent>);
+		auto meshGroup = mRegistry.group<>(entt::get<TransformComponent, MeshFilterComponent, MeshRendererComponent>);
+		auto spriteGroup = mRegistry.group<>(entt::get<TransformComponent, SpriteRendererComponent>);
+		auto circleGroup = mRegistry.group<>(entt::get<TransformComponent, CircleRendererComponent>);
+		auto textGroup = mRegistry.group<>(entt::get<TransformComponent, TextComponent>);
+
+		// Each group is a separate task so lights, meshes and sprites are built concurrently
+		mFrameGraph.AddTask("RenderList Lights", [=]()
 			{
-				auto [transform, audioListener] = group.get<TransformComponent, AudioListenerComponent>(entity);
-				if (listener == 0)
-				{
-					listener = 1;
-				}
-				if (listener > 1)
-				{
-					BOREALIS_CORE_ASSERT(false, "More than 1 listener");
-				}
-			}
+				JobSystem::ParallelFor(static_cast<uint32_t>(lightGroup.size()), 256, [&](uint32_t begin, uint32_t end)
+					{
+						for (uint32_t i = begin; i < end; ++i)
+						{
+							auto [transform, lightComponent] = lightGroup.get<TransformComponent, LightComponent>(*(lightGroup.begin() + i));
+							lightComponent.offset = transform.Translate;
+						}
+					});
+			}).Reads<TransformComponent>().Writes<LightComponent>();
 
-			if (listener == 1)
+		auto addMatrixTask = [this](const char* name, auto group, std::vector<glm::mat4>& matrices)
 			{
-				auto group = mRegistry.group<>(entt::get<TransformComponent, AudioSourceComponent>);
-				for (auto& entity : group)
+				return mFrameGraph.AddTask(name, [group, &matrices]()
+					{
+						matrices.resize(group.size());
+						JobSystem::ParallelFor(static_cast<uint32_t>(group.size()), 256, [&](uint32_t begin, uint32_t end)
+							{
+								for (uint32_t i = begin; i < end; ++i)
+								{
+									matrices[i] = group.template get<TransformComponent>(*(group.begin() + i)).GetTransform();
+								}
+							});
+					});
+			};
+
+		addMatrixTask("RenderList Meshes", meshGroup, mRenderList.mMeshes).Reads<TransformComponent, MeshFilterComponent, MeshRendererComponent>();
+		addMatrixTask("RenderList Sprites", spriteGroup, mRenderList.mSprites).Reads<TransformComponent, SpriteRendererComponent>();
+		addMatrixTask("RenderList Circles", circleGroup, mRenderList.mCircles).Reads<TransformComponent, CircleRendererComponent>();
+		addMatrixTask("RenderList Texts", textGroup, mRenderList.mTexts).Reads<TransformComponent, TextComponent>();
+	}
+
+	void Scene::SelectLods(const glm::vec3& cameraPosition, const glm::mat4& projection, float dt)
+	{
+		static constexpr float sLodFadeDuration = 0.25f;
+
+		// Orthographic projections keep the same size at any distance
+		bool orthographic = projection[3][3] == 1.f;
+		float fadeStep = dt / sLodFadeDuration;
+		auto group = mRegistry.group<>(entt::get<TransformComponent, MeshFilterComponent, MeshRendererComponent>);
+		JobSystem::ParallelFor(static_cast<uint32_t>(group.size()), 256, [&](uint32_t begin, uint32_t end)
+			{
+				for (uint32_t i = begin; i < end; ++i)
 				{
-					auto [transform, audio] = group.get<TransformComponent, AudioSourceComponent>(entity);
-					if (audio.isPlaying && (!Borealis::AudioEngine::isSoundPlaying(audio.channelID) || !audio.isLoop))
+					MeshFilterComponent& meshFilter = group.get<MeshFilterComponent>(*(group.begin() + i));
+					if (!meshFilter.Model || meshFilter.Model->GetLodCount() <= 1)
+					{
+						meshFilter.Lod = meshFilter.PreviousLod = 0;
+						meshFilter.LodFade = 1.f;
+						continue;
+					}
+
+					const glm::mat4& transform = mRenderList.mMeshes[i];
+					float scale = std::max({ glm::length(glm::vec3(transform[0])), glm::length(glm::vec3(transform[1])), glm::length(glm::vec3(transform[2])) });
+					glm::vec3 center = glm::vec3(transform * glm::vec4(meshFilter.Model->GetBoundsCenter(), 1.f));
+					float distance = orthographic ? 1.f : std::max(glm::length(center - cameraPosition), 1e-3f);
+					float screenSize = meshFilter.Model->GetBoundsRadius() * scale * projection[1][1] / distance;
+
+					uint32_t lod = meshFilter.Model->SelectLod(screenSize, meshFilter.Lod);
+					if (lod != meshFilter.Lod)
+					{
+						meshFilter.PreviousLod = meshFilter.Lod;
+						meshFilter.Lod = lod;
+						meshFilter.LodFade = meshFilter.LodCrossFade ? 0.f : 1.f;
+					}
+					else
 					{
-						AudioEngine::StopChannel(audio.channelID);
-						audio.isPlaying = false;
-						audio.channelID = Borealis::AudioEngine::PlayAudio(audio, {}, audio.Volume, audio.isMute, audio.isLoop);
-						//audio.channelID = Borealis::AudioEngine::PlayAudio(audio.audio->AudioPath, {}, audio.Volume, audio.isMute, audio.isLoop);
+						meshFilter.LodFade = std::min(meshFilter.LodFade + fadeStep, 1.f);
 					}
 				}
-			}
-		}
+			});
 	}
 
-	void Scene::UpdateEditor(float dt, EditorCamera& camera)
+	// Each pass is recorded as one array in frame memory, which outlives the render thread's use of it.
+	// Resources the records point to are retained for the frame, so no packet holds a Ref.
+	void Scene::SubmitMeshes()
 	{
-		Renderer3D::Begin(camera);
 		{
 			auto group = mRegistry.group<>(entt::get<TransformComponent, LightComponent>);
-			for (auto& entity : group)
+			uint32_t count = static_cast<uint32_t>(group.size());
+			if (count)
 			{
-				auto [transform, lightComponent] = group.get<TransformComponent, LightComponent>(entity);
-				lightComponent.offset = transform.Translate;
-				Renderer3D::AddLight(lightComponent);
+				// The light engine keeps a pointer to each light, which stays valid until the frame retires
+				LightComponent* lights = FrameAllocator::NewArray<LightComponent>(count);
+				uint32_t index = 0;
+				for (auto& entity : group)
+					lights[index++] = group.get<LightComponent>(entity);
+
+				RenderThread::Submit([lights, count]()
+					{
+						for (uint32_t i = 0; i < count; i++)
+							Renderer3D::AddLight(lights[i]);
+					});
 			}
 		}
-		{
-			auto group = mRegistry.group<>(entt::get<TransformComponent, MeshFilterComponent, MeshRendererComponent>);
-			for (auto& entity : group)
-			{
-				auto [transform, meshFilter, meshRenderer] = group.get<TransformComponent, MeshFilterComponent, MeshRendererComponent>(entity);
-				auto groupLight = mRegistry.group<>(entt::get<TransformComponent, LightComponent>);
 
-				Renderer3D::DrawMesh(transform, meshFilter, meshRenderer, (int)entity);
-			}
+		auto group = mRegistry.group<>(entt::get<TransformComponent, MeshFilterComponent, MeshRendererComponent>);
+		if (group.empty())
+			return;
+
+		Renderer3D::MeshSubmission* meshes = FrameAllocator::NewArray<Renderer3D::MeshSubmission>(group.size());
+		uint32_t index = 0, count = 0;
+		for (auto& entity : group)
+		{
+			auto [meshFilter, meshRenderer] = group.get<MeshFilterComponent, MeshRendererComponent>(entity);
+			const glm::mat4& transform = mRenderList.mMeshes[index++];
+			if (!meshFilter.Model)
+				continue;
+
+			// Packed here on the game thread, the render thread draws with the snapshot while the editor changes the material
+			const Material::DrawState* material = meshRenderer.Material ? RenderThread::Retain(meshRenderer.Material->GetDrawState()) : nullptr;
+			meshes[count++] = { transform, RenderThread::Retain(meshFilter.Model), material,
+				(int)entity, meshFilter.Lod, meshFilter.PreviousLod, meshFilter.LodFade };
 		}
 
-		Renderer2D::Begin(camera);
+		if (count)
+			RenderThread::Submit([meshes, count]() { Renderer3D::DrawMeshes(meshes, count); });
+	}
+
+	void Scene::SubmitSprites()
+	{
 		{
 			auto group = mRegistry.group<>(entt::get<TransformComponent, SpriteRendererComponent>);
-			for (auto& entity : group)
+
+			// Submit by layer (world z), then by texture, so sprites sharing a texture land in the same batch
+			std::vector<uint32_t>& order = mRenderList.mSpriteOrder;
+			order.resize(group.size());
+			std::iota(order.begin(), order.end(), 0);
+			std::stable_sort(order.begin(), order.end(), [&](uint32_t first, uint32_t second)
+				{
+					float firstLayer = mRenderList.mSprites[first][3].z;
+					float secondLayer = mRenderList.mSprites[second][3].z;
+					if (firstLayer != secondLayer)
+						return firstLayer < secondLayer;
+					return group.get<SpriteRendererComponent>(*(group.begin() + first)).Texture.get() <
+						group.get<SpriteRendererComponent>(*(group.begin() + second)).Texture.get();
+				});
+
+			uint32_t count = static_cast<uint32_t>(order.size());
+			if (count)
 			{
-				auto [transform, sprite] = group.get<TransformComponent, SpriteRendererComponent>(entity);
-				Renderer2D::DrawSprite(transform, sprite, (int)entity);
+				Renderer2D::SpriteSubmission* sprites = FrameAllocator::NewArray<Renderer2D::SpriteSubmission>(count);
+				for (uint32_t i = 0; i < count; i++)
+				{
+					entt::entity entity = *(group.begin() + order[i]);
+					const SpriteRendererComponent& sprite = group.get<SpriteRendererComponent>(entity);
+					sprites[i] = { mRenderList.mSprites[order[i]], sprite.Colour, RenderThread::Retain(sprite.Texture), sprite.TilingFactor, (int)entity };
+				}
+
+				RenderThread::Submit([sprites, count]() { Renderer2D::DrawSprites(sprites, count); });
 			}
 		}
 		{
 			auto group = mRegistry.group<>(entt::get<TransformComponent, CircleRendererComponent>);
-			for (auto& entity : group)
+			uint32_t count = static_cast<uint32_t>(group.size());
+			if (count)
 			{
-				auto [transform, circle] = group.get<TransformComponent, CircleRendererComponent>(entity);
-				Renderer2D::DrawCircle(transform, circle.Colour, circle.thickness, circle.fade, (int)entity);
+				Renderer2D::CircleSubmission* circles = FrameAllocator::NewArray<Renderer2D::CircleSubmission>(count);
+				uint32_t index = 0;
+				for (auto& entity : group)
+				{
+					auto& circle = group.get<CircleRendererComponent>(entity);
+					circles[index] = { mRenderList.mCircles[index], circle.Colour, circle.thickness, circle.fade, (int)entity };
+					index++;
+				}
+
+				RenderThread::Submit([circles, count]() { Renderer2D::DrawCircles(circles, count); });
 			}
 		}
 		{
 			auto group = mRegistry.group<>(entt::get<TransformComponent, TextComponent>);
+			Renderer2D::TextSubmission* texts = FrameAllocator::NewArray<Renderer2D::TextSubmission>(group.size());
+			uint32_t index = 0, count = 0;
 			for (auto& entity : group)
 			{
-				auto [transform, text] = group.get<TransformComponent, TextComponent>(entity);
-				Renderer2D::DrawString(text.text, text.font, transform, (int)entity);
-			}
-		}
+				auto& text = group.get<TextComponent>(entity);
+				const glm::mat4& transform = mRenderList.mTexts[index++];
+				if (!text.font)
+					continue;
+
+				// A new layout replaces the old one, which the render thread may still be drawing
+				if (!text.layout || !text.layout->Matches(text.text, text.font, text.fontSize))
+					text.layout = MakeRef<TextLayout>(text.text, text.font, text.fontSize);
 
-		Renderer2D::End();
+				texts[count++] = { transform, text.colour, RenderThread::Retain(text.layout), (int)entity };
+			}
 
+			if (count)
+				RenderThread::Submit([texts, count]() { Renderer2D::DrawStrings(texts, count); });
+		}
+		{
+			// Systems only exist once the runtime has simulated them
+			auto view = mRegistry.view<ParticleSystemComponent>();
+			for (auto entity : view)
+			{
+				auto& particles = view.get<ParticleSystemComponent>(entity);
+				if (particles.System)
+					particles.System->Submit(RenderThread::Retain(particles.Texture), (int)entity);
+			}
+		}
 	}
 	Entity Scene::CreateEntity(const std::string& name)
 	{
 		static unsigned unnamedID = 1;
+		MemoryTagScope memoryTag(MemoryTag::ECS);
 		auto entity = Entity(mRegistry.create(), this);
 		entity.AddComponent<IDComponent>();
 		name == "" ? entity.AddComponent<TagComponent>("unnamedEntity" + std::to_string(unnamedID++)) : entity.AddComponent<TagComponent>(name);
@@ -308,6 +534,7 @@ namespace Borealis
 	Entity Scene::CreateEntityWithUUID(const std::string& name, uint64_t UUID)
 	{
 		static unsigned unnamedID = 1;
+		MemoryTagScope memoryTag(MemoryTag::ECS);
 		auto entity = Entity(mRegistry.create(), this);
 		entity.AddComponent<IDComponent>(UUID);
 		name == "" ? entity.AddComponent<TagComponent>("unnamedEntity" + std::to_string(unnamedID++)) : entity.AddComponent<TagComponent>(name);
@@ -317,8 +544,9 @@ namespace Borealis
 	}
 	Entity Scene::GetEntityByUUID(UUID uuid)
 	{
-		if (mEntityMap.find(uuid) != mEntityMap.end())
-			return { mEntityMap.at(uuid), this };
+		auto it = mEntityMap.find(uuid);
+		if (it != mEntityMap.end())
+			return { it->second, this };
 
 		return {};
 	}
@@ -340,7 +568,7 @@ namespace Borealis
 	}
 
 	template<>
-	static void CopyComponent<RigidBodyComponent>(Entity dst, Entity src)
+	void CopyComponent<RigidBodyComponent>(Entity dst, Entity src)
 	{
 		if (src.HasComponent<RigidBodyComponent>())
 			dst.AddOrReplaceComponent<RigidBodyComponent>(src.GetComponent<RigidBodyComponent>());
@@ -371,6 +599,7 @@ namespace Borealis
 		CopyComponent<RigidBodyComponent>(newEntity, entity);
 		CopyComponent<LightComponent>(newEntity, entity);
 		CopyComponent<CircleRendererComponent>(newEntity, entity);
+		CopyComponent<ParticleSystemComponent>(newEntity, entity);
 		CopyComponent<TextComponent>(newEntity, entity);
 		CopyComponent<AudioSourceComponent>(newEntity, entity);
 		CopyComponent<AudioListenerComponent>(newEntity, entity);
@@ -395,7 +624,7 @@ namespace Borealis
 	}
 
 	template <typename Component>
-	static void CopyComponent(entt::registry& dst, entt::registry& src, const std::unordered_map<UUID,entt::entity>& entitymap)
+	static void CopyComponent(entt::registry& dst, entt::registry& src, const FlatHashMap<UUID, entt::entity>& entitymap)
 	{
 		auto view = src.view<Component>();
 		for (auto srcEntity : view)
@@ -403,13 +632,13 @@ namespace Borealis
 			UUID uuid = src.get<IDComponent>(srcEntity).ID;
 			auto dstEntity = entitymap.at(uuid);
 
-			auto srcComponent = view.get<Component>(srcEntity);
+			auto srcComponent = view.template get<Component>(srcEntity);
 			dst.emplace_or_replace<Component>(dstEntity, srcComponent);
 		}
 	}
 
 	template <>
-	static void CopyComponent <ScriptComponent> (entt::registry& dst, entt::registry& src, const std::unordered_map<UUID, entt::entity>& entitymap)
+	void CopyComponent<ScriptComponent>(entt::registry& dst, entt::registry& src, const FlatHashMap<UUID, entt::entity>& entitymap)
 	{
 		auto view = src.view<ScriptComponent>();
 		for (auto srcEntity : view)
@@ -422,17 +651,17 @@ namespace Borealis
 			auto& newScriptComponent = dst.emplace<ScriptComponent>(dstEntity);
 
 
-			for (auto script : srcComponent.mScripts)
+			for (auto& [name, script] : srcComponent.mScripts)
 			{
-				Ref<ScriptInstance> newScript = MakeRef<ScriptInstance>(script.second->GetScriptClass());
+				Ref<ScriptInstance> newScript = MakeRef<ScriptInstance>(script->GetScriptClass());
 				newScript->Init(uuid);
-				newScriptComponent.AddScript(script.first, newScript);
+				newScriptComponent.AddScript(name, newScript);
 			}
 		}
 	}
 
 	template <>
-	static void CopyComponent <RigidBodyComponent>(entt::registry& dst, entt::registry& src, const std::unordered_map<UUID, entt::entity>& entitymap)
+	void CopyComponent<RigidBodyComponent>(entt::registry& dst, entt::registry& src, const FlatHashMap<UUID, entt::entity>& entitymap)
 	{
 		auto view = src.view<RigidBodyComponent>();
 		for (auto srcEntity : view)
@@ -464,12 +693,15 @@ namespace Borealis
 
 		newScene->mScenePath = other->mScenePath;
 		newScene->mName = other->mName;
-
-		std::unordered_map<UUID, entt::entity> UUIDtoENTT;
+		newScene->mWorldPartitionSettings = other->mWorldPartitionSettings;
 
 		auto& originalRegistry = other->mRegistry;
 		auto& newRegistry = newScene->mRegistry;
 		auto idView = originalRegistry.view<IDComponent>();
+
+		FlatHashMap<UUID, entt::entity> UUIDtoENTT;
+		UUIDtoENTT.reserve(idView.size());
+		newScene->mEntityMap.reserve(idView.size());
 		for (auto entity : idView)
 		{
 			UUID uuid = originalRegistry.get<IDComponent>(entity).ID;
@@ -488,6 +720,7 @@ namespace Borealis
 		CopyComponent<RigidBodyComponent>(newRegistry, originalRegistry, UUIDtoENTT);
 		CopyComponent<LightComponent>(newRegistry, originalRegistry, UUIDtoENTT);
 		CopyComponent<CircleRendererComponent>(newRegistry, originalRegistry, UUIDtoENTT);
+		CopyComponent<ParticleSystemComponent>(newRegistry, originalRegistry, UUIDtoENTT);
 		CopyComponent<TextComponent>(newRegistry, originalRegistry, UUIDtoENTT);
 		CopyComponent<AudioSourceComponent>(newRegistry, originalRegistry, UUIDtoENTT);
 		CopyComponent<AudioListenerComponent>(newRegistry, originalRegistry, UUIDtoENTT);
@@ -580,7 +813,7 @@ namespace Borealis
 	void Scene::OnComponentAdded<RigidBodyComponent>(Entity entity, RigidBodyComponent& component)
 	{
 		TransformComponent& transform = entity.GetComponent<TransformComponent>();
-		PhysicsSystem::addSphereBody(component.radius, transform.Translate, component);
+		PhysicsSystem::addSphereBody(component.radius, transform.Translate, component, !mDeferPhysicsBodies);
 	}
 	template<>
 	void Scene::OnComponentAdded<LightComponent>(Entity entity, LightComponent& component)
@@ -594,6 +827,12 @@ namespace Borealis
 
 	}
 
+	template<>
+	void Scene::OnComponentAdded<ParticleSystemComponent>(Entity entity, ParticleSystemComponent& component)
+	{
+
+	}
+
 	template<>
 	void Scene::OnComponentAdded<TextComponent>(Entity entity, TextComponent& component)
 	{
@@ -0,0 +1,281 @@
+/******************************************************************************/
+/*!
+\file		SceneLoader.cpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Defines the scene loader
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#include <BorealisPCH.hpp>
+#include <chrono>
+#include <Scene/SceneLoader.hpp>
+#include <Scene/SceneManager.hpp>
+#include <Scene/Serialiser.hpp>
+#include <Scene/WorldPartition.hpp>
+#include <Scene/Components.hpp>
+#include <Assets/AssetManager.hpp>
+#include <Core/JobSystem.hpp>
+#include <Core/LoggerSystem.hpp>
+#include <Scripting/ScriptInstance.hpp>
+
+namespace Borealis
+{
+	namespace
+	{
+		struct LoadRequest
+		{
+			std::string mName;
+			std::string mPath;
+			SceneLoader::LoadMode mMode;
+			SceneLoader::LoadedFn mOnLoaded;
+			JobCounter mCounter;
+
+			// Filled by the worker, read by the main thread once mCounter is done
+			Ref<Scene> mScene;				// Scene being built, the active one when adding to it
+			bool mParsed = false;
+			YAML::Node mData;
+			std::vector<YAML::Node> mEntities;	// Entities to build now, the persistent ones of a partitioned scene
+			std::vector<AssetHandle> mAssets;	// Assets the entities reference
+			Scope<WorldPartition> mPartition;
+
+			bool mPrefetched = false;
+			size_t mNextAsset = 0;
+			size_t mNextEntity = 0;
+		};
+
+		Scope<LoadRequest> sRequest;
+		std::vector<Scope<LoadRequest>> sRetired; // Replaced while the worker still had them
+	}
+
+	/*!***********************************************************************
+		\brief
+			Adds the assets an entity references to a list, once each
+	*************************************************************************/
+	static void CollectAssets(const YAML::Node& entity, std::unordered_set<AssetHandle>& seen, std::vector<AssetHandle>& assets)
+	{
+		auto add = [&](const YAML::Node& handle)
+			{
+				if (handle && seen.insert(handle.as<uint64_t>()).second)
+					assets.push_back(handle.as<uint64_t>());
+			};
+
+		if (auto sprite = entity["SpriteRendererComponent"])
+			add(sprite["Texture"]);
+		if (auto meshFilter = entity["MeshFilterComponent"])
+			add(meshFilter["Mesh"]);
+		if (auto meshRenderer = entity["MeshRendererComponent"])
+			add(meshRenderer["Material"]);
+	}
+
+	/*!***********************************************************************
+		\brief
+			Parses the scene file and works out what to build. Runs on a
+			worker, touching nothing but the request.
+	*************************************************************************/
+	static void ParseScene(LoadRequest& request)
+	{
+		PROFILE_FUNCTION();
+
+		// A malformed file leaves the request unparsed, Update reports the failure
+		try
+		{
+			request.mData = Serialiser::LoadSceneFile(request.mPath);
+		}
+		catch (const YAML::Exception& e)
+		{
+			BOREALIS_CORE_ERROR("Failed to parse scene file {0}: {1}", request.mPath, e.what());
+			return;
+		}
+		if (!request.mData)
+			return;
+
+		YAML::Node entities = request.mData["Entities"];
+		if (request.mMode == SceneLoader::LoadMode::Replace)
+		{
+			// Nothing else holds the scene yet, so it is safe to create and set up here
+			request.mScene = MakeRef<Scene>(request.mName, request.mPath);
+			request.mScene->DeferPhysicsBodies();
+			Serialiser(request.mScene).DeserialiseWorldPartition(request.mData);
+
+			WorldPartition::Settings const& settings = request.mScene->GetWorldPartitionSettings();
+			if (settings.IsEnabled() && entities)
+				request.mPartition = MakeScope<WorldPartition>(settings, entities, request.mEntities);
+		}
+
+		if (!request.mPartition && entities)
+		{
+			for (auto entity : entities)
+				request.mEntities.push_back(entity);
+		}
+
+		std::unordered_set<AssetHandle> seen;
+		for (const YAML::Node& entity : request.mEntities)
+			CollectAssets(entity, seen, request.mAssets);
+
+		request.mParsed = true;
+	}
+
+	/*!***********************************************************************
+		\brief
+			Starts the scripts of an entity, for entities joining a scene
+			whose runtime has started
+	*************************************************************************/
+	static void StartScripts(Entity entity)
+	{
+		if (!entity.HasComponent<ScriptComponent>())
+			return;
+
+		for (auto& [name, script] : entity.GetComponent<ScriptComponent>().mScripts)
+			script->Start();
+	}
+
+	/*!***********************************************************************
+		\brief
+			Makes the built scene the active one, carrying over the viewport
+			and the runtime of the scene it replaces
+	*************************************************************************/
+	static void SwapScene(LoadRequest& request)
+	{
+		Ref<Scene> scene = request.mScene;
+		Ref<Scene> previous = SceneManager::GetActiveScene();
+
+		if (previous && previous->GetViewportWidth() && previous->GetViewportHeight())
+			scene->ResizeViewport(previous->GetViewportWidth(), previous->GetViewportHeight());
+		scene->SetWorldPartition(std::move(request.mPartition));
+		scene->AddDeferredPhysicsBodies();
+		SceneManager::SetActiveScene(scene);
+
+		if (previous && previous->IsRuntimeStarted())
+		{
+			previous->RuntimeEnd();
+			scene->RuntimeStart();
+
+			auto view = scene->GetRegistry().view<ScriptComponent>();
+			for (auto entity : view)
+				StartScripts(Entity{ entity, scene.get() });
+		}
+	}
+
+	void SceneLoader::LoadAsync(std::string sceneName, LoadMode mode, LoadedFn onLoaded)
+	{
+		std::transform(sceneName.begin(), sceneName.end(), sceneName.begin(), ::tolower);
+		auto& library = SceneManager::GetSceneLibrary();
+		if (library.find(sceneName) == library.end())
+		{
+			BOREALIS_CORE_ERROR("Scene {0} not found in Scene Library", sceneName);
+			return;
+		}
+
+		if (sRequest)
+		{
+			if (!sRequest->mCounter.IsDone())
+				sRetired.push_back(std::move(sRequest));
+			sRequest.reset();
+		}
+
+		sRequest = MakeScope<LoadRequest>();
+		sRequest->mName = sceneName;
+		sRequest->mPath = library[sceneName];
+		sRequest->mMode = mode;
+		sRequest->mOnLoaded = std::move(onLoaded);
+		if (mode == LoadMode::Additive)
+			sRequest->mScene = SceneManager::GetActiveScene();
+
+		LoadRequest* request = sRequest.get();
+		JobSystem::Submit([request]() { ParseScene(*request); }, &request->mCounter);
+	}
+
+	void SceneLoader::Update()
+	{
+		PROFILE_FUNCTION();
+
+		sRetired.erase(std::remove_if(sRetired.begin(), sRetired.end(), [](const Scope<LoadRequest>& request) { return request->mCounter.IsDone(); }), sRetired.end());
+
+		if (!sRequest || !sRequest->mCounter.IsDone())
+			return;
+
+		LoadRequest& request = *sRequest;
+		if (!request.mParsed || !request.mScene)
+		{
+			BOREALIS_CORE_ERROR("Failed to load scene {0}", request.mName);
+			sRequest.reset();
+			return;
+		}
+
+		using Clock = std::chrono::steady_clock;
+		Clock::time_point start = Clock::now();
+		auto inBudget = [start]() { return std::chrono::duration<float>(Clock::now() - start).count() < FrameBudget; };
+
+		// Assets first, so the entities come in whole rather than loading them one by one.
+		// Their files are read on workers, a frame only sets up the ones already read
+		if (!request.mPrefetched)
+		{
+			for (AssetHandle handle : request.mAssets)
+				AssetManager::PrefetchAsset(handle);
+			request.mPrefetched = true;
+		}
+		while (request.mNextAsset < request.mAssets.size() && inBudget() && AssetManager::IsAssetReady(request.mAssets[request.mNextAsset]))
+			AssetManager::GetAsset<Asset>(request.mAssets[request.mNextAsset++]);
+		if (request.mNextAsset < request.mAssets.size())
+			return;
+
+		// The scene being replaced keeps running, so a new scene is only seen whole
+		Serialiser serialiser(request.mScene);
+		bool additive = request.mMode == LoadMode::Additive;
+		while (request.mNextEntity < request.mEntities.size() && inBudget())
+		{
+			const YAML::Node& node = request.mEntities[request.mNextEntity++];
+			if (additive && request.mScene->GetEntityByUUID(node["EntityID"].as<uint64_t>()))
+			{
+				BOREALIS_CORE_WARN("Entity {0} is already in the scene, skipped", node["EntityID"].as<uint64_t>());
+				continue;
+			}
+
+			Entity entity = serialiser.DeserialiseEntity(node);
+			if (additive && request.mScene->IsRuntimeStarted())
+				StartScripts(entity);
+		}
+		if (request.mNextEntity < request.mEntities.size())
+			return;
+
+		if (!additive)
+			SwapScene(request);
+
+		Scope<LoadRequest> finished = std::move(sRequest);
+		if (finished->mOnLoaded)
+			finished->mOnLoaded(finished->mScene);
+	}
+
+	bool SceneLoader::IsLoading()
+	{
+		return sRequest != nullptr;
+	}
+
+	float SceneLoader::GetProgress()
+	{
+		if (!sRequest)
+			return 1.f;
+		if (!sRequest->mCounter.IsDone())
+			return 0.f;
+
+		size_t total = sRequest->mAssets.size() + sRequest->mEntities.size();
+		return total ? static_cast<float>(sRequest->mNextAsset + sRequest->mNextEntity) / total : 1.f;
+	}
+
+	void SceneLoader::Free()
+	{
+		if (sRequest)
+			JobSystem::Wait(sRequest->mCounter);
+		for (Scope<LoadRequest>& request : sRetired)
+			JobSystem::Wait(request->mCounter);
+
+		sRequest.reset();
+		sRetired.clear();
+	}
+}
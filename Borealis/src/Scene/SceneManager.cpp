@@ -3,6 +3,7 @@
 #include <Scene/Serialiser.hpp>
 #include <Core/LoggerSystem.hpp>
 #include <Core/Core.hpp>
+#include <Graphics/RenderThread.hpp>
 
 namespace Borealis
 {
@@ -53,6 +54,8 @@ namespace Borealis
 		std::transform(sceneName.begin(), sceneName.end(), sceneName.begin(), ::tolower);
         if (mSceneLibrary.find(sceneName) != mSceneLibrary.end())
         {
+            // Deserialising loads the scene's assets, so hold the context for the whole load
+            RenderThread::ScopedContext context;
             Ref<Scene> newScene = MakeRef<Scene>(sceneName, mSceneLibrary[sceneName]);
             if (mSceneLibrary[sceneName] != "")
             {
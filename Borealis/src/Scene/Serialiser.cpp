@@ -300,6 +300,29 @@ namespace Borealis
 			out << YAML::EndMap;
 		}
 
+		if (entity.HasComponent<ParticleSystemComponent>())
+		{
+			out << YAML::Key << "ParticleSystemComponent";
+			out << YAML::BeginMap;
+
+			auto& particleSystemComponent = entity.GetComponent<ParticleSystemComponent>();
+			const ParticleProps& props = particleSystemComponent.Props;
+			out << YAML::Key << "EmitRate" << YAML::Value << particleSystemComponent.EmitRate;
+			out << YAML::Key << "MaxParticles" << YAML::Value << particleSystemComponent.MaxParticles;
+			out << YAML::Key << "Position" << YAML::Value << props.Position;
+			out << YAML::Key << "Velocity" << YAML::Value << props.Velocity;
+			out << YAML::Key << "VelocityVariation" << YAML::Value << props.VelocityVariation;
+			out << YAML::Key << "ColourBegin" << YAML::Value << props.ColourBegin;
+			out << YAML::Key << "ColourEnd" << YAML::Value << props.ColourEnd;
+			out << YAML::Key << "SizeBegin" << YAML::Value << props.SizeBegin;
+			out << YAML::Key << "SizeEnd" << YAML::Value << props.SizeEnd;
+			out << YAML::Key << "SizeVariation" << YAML::Value << props.SizeVariation;
+			out << YAML::Key << "LifeTime" << YAML::Value << props.LifeTime;
+			SerializeTexture(out, particleSystemComponent.Texture);
+
+			out << YAML::EndMap;
+		}
+
 		if (entity.HasComponent<MeshFilterComponent>())
 		{
 			out << YAML::Key << "MeshFilterComponent";
@@ -307,6 +330,7 @@ namespace Borealis
 
 			auto& meshFilterComponent = entity.GetComponent<MeshFilterComponent>();
 			out << YAML::Key << "Mesh" << YAML::Value << meshFilterComponent.Model->mAssetHandle; //UUID of Mesh
+			out << YAML::Key << "LodCrossFade" << YAML::Value << meshFilterComponent.LodCrossFade;
 			out << YAML::EndMap;
 		}
 
@@ -431,12 +455,12 @@ namespace Borealis
 
 			auto& scriptComponent = entity.GetComponent<ScriptComponent>();
 
-			for (auto[name, script]: scriptComponent.mScripts)
+			for (auto& [name, script] : scriptComponent.mScripts)
 			{
 				out << YAML::Key << name;
 				out << YAML::BeginMap;
 
-				for (auto [name,field] : script->GetScriptClass()->mFields)
+				for (const auto& [name, field] : script->GetScriptClass()->mFields)
 				{
 					if (field.mType == ScriptFieldType::Bool)
 					{
@@ -575,8 +599,19 @@ namespace Borealis
 	{
 		YAML::Emitter out;
 		out << YAML::BeginMap
-			<< YAML::Key << "Scene" << YAML::Value << mScene->GetName()
-		    << YAML::Key <<"Entities"	<<	YAML::Value << YAML::BeginSeq;
+			<< YAML::Key << "Scene" << YAML::Value << mScene->GetName();
+
+		WorldPartition::Settings const& partition = mScene->GetWorldPartitionSettings();
+		if (partition.IsEnabled())
+		{
+			out << YAML::Key << "WorldPartition" << YAML::Value << YAML::BeginMap
+				<< YAML::Key << "CellSize" << YAML::Value << partition.mCellSize
+				<< YAML::Key << "LoadRadius" << YAML::Value << partition.mLoadRadius
+				<< YAML::Key << "EntitiesPerFrame" << YAML::Value << partition.mEntitiesPerFrame
+				<< YAML::EndMap;
+		}
+
+		out << YAML::Key <<"Entities"	<<	YAML::Value << YAML::BeginSeq;
 
 		auto view = mScene->mRegistry.view<entt::entity>();
 		for (auto enttEntity : view)
@@ -602,7 +637,7 @@ namespace Borealis
 		return true;
 	}
 
-	bool Serialiser::DeserialiseScene(const std::string& filepath)
+	YAML::Node Serialiser::LoadSceneFile(const std::string& filepath)
 	{
 		std::ifstream inStream(filepath);
 		std::stringstream ss;
@@ -613,329 +648,381 @@ namespace Borealis
 		if (!data["Scene"])
 		{
 			BOREALIS_CORE_ERROR("Scene not found in file: {}", filepath);
-			return false;
+			return YAML::Node();
 		}
+		return data;
+	}
+
+	void Serialiser::DeserialiseWorldPartition(const YAML::Node& data)
+	{
+		WorldPartition::Settings settings;
+		if (auto partition = data["WorldPartition"])
+		{
+			settings.mCellSize = partition["CellSize"].as<float>();
+			settings.mLoadRadius = partition["LoadRadius"].as<float>();
+			if (partition["EntitiesPerFrame"])
+				settings.mEntitiesPerFrame = partition["EntitiesPerFrame"].as<uint32_t>();
+		}
+		mScene->SetWorldPartitionSettings(settings);
+	}
+
+	bool Serialiser::DeserialiseScene(const std::string& filepath)
+	{
+		YAML::Node data = LoadSceneFile(filepath);
+		if (!data)
+			return false;
 
 		std::string sceneName = data["Scene"].as<std::string>();
 		BOREALIS_CORE_INFO("Deserialising scene: {}", sceneName);
+		DeserialiseWorldPartition(data);
 
 		auto entities = data["Entities"];
 		if (entities)
 		{
 			for (auto entity : entities)
 			{
-				uint64_t uuid = entity["EntityID"].as<uint64_t>(); // UUID
+				DeserialiseEntity(entity);
+			}
+		}
 
-				auto tagComponent = entity["TagComponent"];
-				std::string name;
-				if (tagComponent)
-				{
-					name = tagComponent["Tag"].as<std::string>();
-				}
+		return true;
+	}
 
-				Entity loadedEntity = mScene->CreateEntityWithUUID(name, uuid);
+	Entity Serialiser::DeserialiseEntity(const YAML::Node& entity)
+	{
+		uint64_t uuid = entity["EntityID"].as<uint64_t>(); // UUID
 
-				auto transformComponent = entity["TransformComponent"];
-				if (transformComponent)
-				{
-					auto& tc = loadedEntity.GetComponent<TransformComponent>();
-					tc.Translate = entity["TransformComponent"]["Translate"].as<glm::vec3>();
-					tc.Rotation = entity["TransformComponent"]["Rotation"].as<glm::vec3>();
-					tc.Scale = entity["TransformComponent"]["Scale"].as<glm::vec3>();
-				}
+		auto tagComponent = entity["TagComponent"];
+		std::string name;
+		if (tagComponent)
+		{
+			name = tagComponent["Tag"].as<std::string>();
+		}
 
-				auto spriteRendererComponent = entity["SpriteRendererComponent"];
-				if (spriteRendererComponent)
-				{
-					auto& src = loadedEntity.AddComponent<SpriteRendererComponent>();
-					src.Colour = entity["SpriteRendererComponent"]["Colour"].as<glm::vec4>();
-					if (entity["SpriteRendererComponent"]["Texture"].IsDefined())
-					{
-						src.Texture = AssetManager::GetAsset<Texture2D>(entity["SpriteRendererComponent"]["Texture"].as<uint64_t>());
-					}
-				}
+		Entity loadedEntity = mScene->CreateEntityWithUUID(name, uuid);
 
-				auto circleRendererComponent = entity["CircleRendererComponent"];
-				if (circleRendererComponent)
-				{
-					auto& src = loadedEntity.AddComponent<CircleRendererComponent>();
-					src.Colour = entity["CircleRendererComponent"]["Colour"].as<glm::vec4>();
-					src.thickness = entity["CircleRendererComponent"]["Thickness"].as<float>();
-					src.fade = entity["CircleRendererComponent"]["Fade"].as<float>();
-				}
+		auto transformComponent = entity["TransformComponent"];
+		if (transformComponent)
+		{
+			auto& tc = loadedEntity.GetComponent<TransformComponent>();
+			tc.Translate = entity["TransformComponent"]["Translate"].as<glm::vec3>();
+			tc.Rotation = entity["TransformComponent"]["Rotation"].as<glm::vec3>();
+			tc.Scale = entity["TransformComponent"]["Scale"].as<glm::vec3>();
+		}
 
-				auto cameraComponent = entity["CameraComponent"];
-				if (cameraComponent)
-				{
-					auto& cc = loadedEntity.AddComponent<CameraComponent>();
-					cc.Camera.SetViewportSize(1920, 1080);
-					cc.Camera.SetCameraType((SceneCamera::CameraType)cameraComponent["Camera"]["CameraType"].as<int>());
-					cc.Camera.SetOrthoSize(cameraComponent["Camera"]["OrthoSize"].as<float>());
-					cc.Camera.SetOrthoNear(cameraComponent["Camera"]["OrthoNear"].as<float>());
-					cc.Camera.SetOrthoFar(cameraComponent["Camera"]["OrthoFar"].as<float>());
-					cc.Camera.SetPerspFOV(cameraComponent["Camera"]["PerspFOV"].as<float>());
-					cc.Camera.SetPerspNear(cameraComponent["Camera"]["PerspNear"].as<float>());
-					cc.Camera.SetPerspFar(cameraComponent["Camera"]["PerspFar"].as<float>());
-					cc.Primary = cameraComponent["Primary"].as<bool>();
-					cc.FixedAspectRatio = cameraComponent["FixedAspectRatio"].as<bool>();
+		auto spriteRendererComponent = entity["SpriteRendererComponent"];
+		if (spriteRendererComponent)
+		{
+			auto& src = loadedEntity.AddComponent<SpriteRendererComponent>();
+			src.Colour = entity["SpriteRendererComponent"]["Colour"].as<glm::vec4>();
+			if (entity["SpriteRendererComponent"]["Texture"].IsDefined())
+			{
+				src.Texture = AssetManager::GetAsset<Texture2D>(entity["SpriteRendererComponent"]["Texture"].as<uint64_t>());
+			}
+		}
 
-				}
+		auto circleRendererComponent = entity["CircleRendererComponent"];
+		if (circleRendererComponent)
+		{
+			auto& src = loadedEntity.AddComponent<CircleRendererComponent>();
+			src.Colour = entity["CircleRendererComponent"]["Colour"].as<glm::vec4>();
+			src.thickness = entity["CircleRendererComponent"]["Thickness"].as<float>();
+			src.fade = entity["CircleRendererComponent"]["Fade"].as<float>();
+		}
 
-				auto meshFilterComponent = entity["MeshFilterComponent"];
-				if (meshFilterComponent)
-				{
-					auto& mfc = loadedEntity.AddComponent<MeshFilterComponent>();
-					uint64_t uuid = entity["MeshFilterComponent"]["Mesh"].as<uint64_t>(); // UUID
-					mfc.Model = AssetManager::GetAsset<Model>(uuid); // TODO: Load Mesh via UUID
-					BOREALIS_CORE_INFO(mfc.Model->mAssetHandle);
-				}
+		auto particleSystemComponent = entity["ParticleSystemComponent"];
+		if (particleSystemComponent)
+		{
+			auto& psc = loadedEntity.AddComponent<ParticleSystemComponent>();
+			psc.EmitRate = particleSystemComponent["EmitRate"].as<float>();
+			psc.MaxParticles = particleSystemComponent["MaxParticles"].as<uint32_t>();
+			psc.Props.Position = particleSystemComponent["Position"].as<glm::vec3>();
+			psc.Props.Velocity = particleSystemComponent["Velocity"].as<glm::vec3>();
+			psc.Props.VelocityVariation = particleSystemComponent["VelocityVariation"].as<glm::vec3>();
+			psc.Props.ColourBegin = particleSystemComponent["ColourBegin"].as<glm::vec4>();
+			psc.Props.ColourEnd = particleSystemComponent["ColourEnd"].as<glm::vec4>();
+			psc.Props.SizeBegin = particleSystemComponent["SizeBegin"].as<float>();
+			psc.Props.SizeEnd = particleSystemComponent["SizeEnd"].as<float>();
+			psc.Props.SizeVariation = particleSystemComponent["SizeVariation"].as<float>();
+			psc.Props.LifeTime = particleSystemComponent["LifeTime"].as<float>();
+			if (particleSystemComponent["Texture"].IsDefined())
+			{
+				psc.Texture = AssetManager::GetAsset<Texture2D>(particleSystemComponent["Texture"].as<uint64_t>());
+			}
+		}
 
-				auto meshRendererComponent = entity["MeshRendererComponent"];
-				if (meshRendererComponent)
-				{
-					auto& mrc = loadedEntity.AddComponent<MeshRendererComponent>();
-					uint64_t uuid = entity["MeshRendererComponent"]["Material"].as<uint64_t>();
-					mrc.Material = AssetManager::GetAsset<Material>(uuid);
-					mrc.castShadow = meshRendererComponent["CastShadow"].as<bool>();
-				}
+		auto cameraComponent = entity["CameraComponent"];
+		if (cameraComponent)
+		{
+			auto& cc = loadedEntity.AddComponent<CameraComponent>();
+			cc.Camera.SetViewportSize(1920, 1080);
+			cc.Camera.SetCameraType((SceneCamera::CameraType)cameraComponent["Camera"]["CameraType"].as<int>());
+			cc.Camera.SetOrthoSize(cameraComponent["Camera"]["OrthoSize"].as<float>());
+			cc.Camera.SetOrthoNear(cameraComponent["Camera"]["OrthoNear"].as<float>());
+			cc.Camera.SetOrthoFar(cameraComponent["Camera"]["OrthoFar"].as<float>());
+			cc.Camera.SetPerspFOV(cameraComponent["Camera"]["PerspFOV"].as<float>());
+			cc.Camera.SetPerspNear(cameraComponent["Camera"]["PerspNear"].as<float>());
+			cc.Camera.SetPerspFar(cameraComponent["Camera"]["PerspFar"].as<float>());
+			cc.Primary = cameraComponent["Primary"].as<bool>();
+			cc.FixedAspectRatio = cameraComponent["FixedAspectRatio"].as<bool>();
 
-				auto boxColliderComponent = entity["BoxColliderComponent"];
-				if (boxColliderComponent)
-				{
-					auto& bcc = loadedEntity.AddComponent<BoxColliderComponent>();
-					bcc.isTrigger = boxColliderComponent["isTrigger"].as<bool>();
-					bcc.providesContact = boxColliderComponent["providesContact"].as<bool>();
-					bcc.Material = nullptr; // TODO: Load Material via UUID
-					bcc.Center = boxColliderComponent["Center"].as<glm::vec3>();
-					bcc.Size = boxColliderComponent["Size"].as<glm::vec3>();
-				}
+		}
 
-				auto capsuleColliderComponent = entity["CapsuleColliderComponent"];
-				if (capsuleColliderComponent)
-				{
-					auto& ccc = loadedEntity.AddComponent<CapsuleColliderComponent>();
-					ccc.isTrigger = capsuleColliderComponent["isTrigger"].as<bool>();
-					ccc.providesContact = capsuleColliderComponent["providesContact"].as<bool>();
-					ccc.Material = nullptr; // TODO: Load Material via UUID
-					ccc.radius = capsuleColliderComponent["Radius"].as<float>();
-					ccc.height = capsuleColliderComponent["Height"].as<float>();
-					ccc.direction = (CapsuleColliderComponent::Direction)capsuleColliderComponent["Direction"].as<int>();
-				}
+		auto meshFilterComponent = entity["MeshFilterComponent"];
+		if (meshFilterComponent)
+		{
+			auto& mfc = loadedEntity.AddComponent<MeshFilterComponent>();
+			uint64_t uuid = entity["MeshFilterComponent"]["Mesh"].as<uint64_t>(); // UUID
+			mfc.Model = AssetManager::GetAsset<Model>(uuid); // TODO: Load Mesh via UUID
+			BOREALIS_CORE_INFO(mfc.Model->mAssetHandle);
+			if (meshFilterComponent["LodCrossFade"])
+				mfc.LodCrossFade = meshFilterComponent["LodCrossFade"].as<bool>();
+		}
 
-				auto rigidBodyComponent = entity["RigidBodyComponent"];
-				if (rigidBodyComponent)
-				{
-					auto& rbc = loadedEntity.AddComponent<RigidBodyComponent>();
-					rbc.isBox = rigidBodyComponent["isBox"].as<bool>();
-					rbc.radius = rigidBodyComponent["Radius"].as<float>();
-					// run the update of the shape here once
-
-
-					/*rbc.mass = rigidBodyComponent["mass"].as<float>();
-					rbc.drag = rigidBodyComponent["drag"].as<float>();
-					rbc.angularDrag = rigidBodyComponent["angularDrag"].as<float>();
-					rbc.centerOfMass = rigidBodyComponent["centerOfMass"].as<glm::vec3>();
-					rbc.inertiaTensor = rigidBodyComponent["inertiaTensor"].as<glm::vec3>();
-					rbc.inertiaTensorRotation = rigidBodyComponent["inertiaTensorRotation"].as<glm::vec3>();
-					rbc.AutomaticCenterOfMass = rigidBodyComponent["AutomaticCenterOfMass"].as<bool>();
-					rbc.AutomaticTensor = rigidBodyComponent["AutomaticTensor"].as<bool>();
-					rbc.useGravity = rigidBodyComponent["useGravity"].as<bool>();
-					rbc.isKinematic = rigidBodyComponent["isKinematic"].as<bool>();*/
-				}
+		auto meshRendererComponent = entity["MeshRendererComponent"];
+		if (meshRendererComponent)
+		{
+			auto& mrc = loadedEntity.AddComponent<MeshRendererComponent>();
+			uint64_t uuid = entity["MeshRendererComponent"]["Material"].as<uint64_t>();
+			mrc.Material = AssetManager::GetAsset<Material>(uuid);
+			mrc.castShadow = meshRendererComponent["CastShadow"].as<bool>();
+		}
 
-				auto lightComponent = entity["LightComponent"];
-				if (lightComponent)
-				{
-					auto& lc = loadedEntity.AddComponent<LightComponent>();
-
-					lc.ambient = lightComponent["Ambient"].as<glm::vec3>();
-					lc.diffuse = lightComponent["Diffuse"].as<glm::vec3>();
-					lc.direction = lightComponent["Direction"].as<glm::vec3>();
-					lc.specular = lightComponent["Specular"].as<glm::vec3>();
-					lc.linear = lightComponent["Linear"].as<float>();
-					lc.quadratic = lightComponent["Quadratic"].as<float>();
-					lc.type = (LightComponent::Type)lightComponent["Type"].as<int>();
-					lc.InnerOuterSpot.x = lightComponent["InnerSpotX"].as<float>();
-					lc.InnerOuterSpot.y = lightComponent["InnerSpotY"].as<float>();
-
-					/*lc.Colour = lightComponent["Colour"].as<glm::vec4>();
-					lc.InnerOuterSpot = glm::vec2(lightComponent["InnerSpot"].as<float>(), lightComponent["OuterSpot"].as<float>());
-					lc.Temperature = lightComponent["Temperature"].as<float>();
-					lc.Intensity = lightComponent["Intensity"].as<float>();
-					lc.IndirectMultiplier = lightComponent["IndirectMultiplier"].as<float>();
-					lc.Range = lightComponent["Range"].as<float>();
-					lc.type = (LightComponent::Type)lightComponent["Type"].as<int>();
-					lc.shadowType = (LightComponent::ShadowType)lightComponent["ShadowType"].as<int>();
-					lc.lightAppearance = (LightComponent::LightAppearance)lightComponent["LightAppearance"].as<int>();*/
+		auto boxColliderComponent = entity["BoxColliderComponent"];
+		if (boxColliderComponent)
+		{
+			auto& bcc = loadedEntity.AddComponent<BoxColliderComponent>();
+			bcc.isTrigger = boxColliderComponent["isTrigger"].as<bool>();
+			bcc.providesContact = boxColliderComponent["providesContact"].as<bool>();
+			bcc.Material = nullptr; // TODO: Load Material via UUID
+			bcc.Center = boxColliderComponent["Center"].as<glm::vec3>();
+			bcc.Size = boxColliderComponent["Size"].as<glm::vec3>();
+		}
+
+		auto capsuleColliderComponent = entity["CapsuleColliderComponent"];
+		if (capsuleColliderComponent)
+		{
+			auto& ccc = loadedEntity.AddComponent<CapsuleColliderComponent>();
+			ccc.isTrigger = capsuleColliderComponent["isTrigger"].as<bool>();
+			ccc.providesContact = capsuleColliderComponent["providesContact"].as<bool>();
+			ccc.Material = nullptr; // TODO: Load Material via UUID
+			ccc.radius = capsuleColliderComponent["Radius"].as<float>();
+			ccc.height = capsuleColliderComponent["Height"].as<float>();
+			ccc.direction = (CapsuleColliderComponent::Direction)capsuleColliderComponent["Direction"].as<int>();
+		}
+
+		auto rigidBodyComponent = entity["RigidBodyComponent"];
+		if (rigidBodyComponent)
+		{
+			auto& rbc = loadedEntity.AddComponent<RigidBodyComponent>();
+			rbc.isBox = rigidBodyComponent["isBox"].as<bool>();
+			rbc.radius = rigidBodyComponent["Radius"].as<float>();
+			// run the update of the shape here once
+
+
+			/*rbc.mass = rigidBodyComponent["mass"].as<float>();
+			rbc.drag = rigidBodyComponent["drag"].as<float>();
+			rbc.angularDrag = rigidBodyComponent["angularDrag"].as<float>();
+			rbc.centerOfMass = rigidBodyComponent["centerOfMass"].as<glm::vec3>();
+			rbc.inertiaTensor = rigidBodyComponent["inertiaTensor"].as<glm::vec3>();
+			rbc.inertiaTensorRotation = rigidBodyComponent["inertiaTensorRotation"].as<glm::vec3>();
+			rbc.AutomaticCenterOfMass = rigidBodyComponent["AutomaticCenterOfMass"].as<bool>();
+			rbc.AutomaticTensor = rigidBodyComponent["AutomaticTensor"].as<bool>();
+			rbc.useGravity = rigidBodyComponent["useGravity"].as<bool>();
+			rbc.isKinematic = rigidBodyComponent["isKinematic"].as<bool>();*/
+		}
+
+		auto lightComponent = entity["LightComponent"];
+		if (lightComponent)
+		{
+			auto& lc = loadedEntity.AddComponent<LightComponent>();
+
+			lc.ambient = lightComponent["Ambient"].as<glm::vec3>();
+			lc.diffuse = lightComponent["Diffuse"].as<glm::vec3>();
+			lc.direction = lightComponent["Direction"].as<glm::vec3>();
+			lc.specular = lightComponent["Specular"].as<glm::vec3>();
+			lc.linear = lightComponent["Linear"].as<float>();
+			lc.quadratic = lightComponent["Quadratic"].as<float>();
+			lc.type = (LightComponent::Type)lightComponent["Type"].as<int>();
+			lc.InnerOuterSpot.x = lightComponent["InnerSpotX"].as<float>();
+			lc.InnerOuterSpot.y = lightComponent["InnerSpotY"].as<float>();
+
+			/*lc.Colour = lightComponent["Colour"].as<glm::vec4>();
+			lc.InnerOuterSpot = glm::vec2(lightComponent["InnerSpot"].as<float>(), lightComponent["OuterSpot"].as<float>());
+			lc.Temperature = lightComponent["Temperature"].as<float>();
+			lc.Intensity = lightComponent["Intensity"].as<float>();
+			lc.IndirectMultiplier = lightComponent["IndirectMultiplier"].as<float>();
+			lc.Range = lightComponent["Range"].as<float>();
+			lc.type = (LightComponent::Type)lightComponent["Type"].as<int>();
+			lc.shadowType = (LightComponent::ShadowType)lightComponent["ShadowType"].as<int>();
+			lc.lightAppearance = (LightComponent::LightAppearance)lightComponent["LightAppearance"].as<int>();*/
+		}
+		auto behaviourTreeComponent = entity["BehaviourTreeComponent"];
+		/*
+			extract the name of tree and root node, then iteritivly build the tree, then call the clone method by createfromname function
+			behaviourNode["name"]
+		*/
+		if (behaviourTreeComponent) 
+		{
+			//BOREALIS_CORE_TRACE("Parsed YAML: {}", behaviourTreeComponent);//used for debugging to see what is being read
+			auto& btc = loadedEntity.AddComponent<BehaviourTreeComponent>();
+			Ref<BehaviourTree> tempTree = MakeRef<BehaviourTree>();
+
+			// Access the BehaviourTree node first
+			auto behaviourTree = behaviourTreeComponent["BehaviourTree"];
+
+			// Get the root node name and depth
+			std::string treeName = behaviourTree["Tree Name"].as<std::string>();
+			tempTree->SetBehaviourTreeName(treeName);
+			std::string rootName = behaviourTree["name"].as<std::string>();
+			int rootDepth = behaviourTree["depth"].as<int>();
+
+			// Create root node using NodeFactory
+			Ref<BehaviourNode> rootNode = Borealis::NodeFactory::CreateNodeByName(rootName);
+
+			// Set the root node of the tree
+			tempTree->SetRootNode(rootNode); //sets depth to 0 by default
+			BOREALIS_CORE_TRACE("Deserialising BT {}", treeName);
+
+			// If the root node has children, parse them recursively
+			if (behaviourTree["children"]) {
+				for (auto childNode : behaviourTree["children"]) {
+					ParseTree(childNode, rootNode, *tempTree, rootDepth);
 				}
-				auto behaviourTreeComponent = entity["BehaviourTreeComponent"];
-				/*
-					extract the name of tree and root node, then iteritivly build the tree, then call the clone method by createfromname function
-					behaviourNode["name"]
-				*/
-				if (behaviourTreeComponent) 
-				{
-					//BOREALIS_CORE_TRACE("Parsed YAML: {}", behaviourTreeComponent);//used for debugging to see what is being read
-					auto& btc = loadedEntity.AddComponent<BehaviourTreeComponent>();
-					Ref<BehaviourTree> tempTree = MakeRef<BehaviourTree>();
-
-					// Access the BehaviourTree node first
-					auto behaviourTree = behaviourTreeComponent["BehaviourTree"];
-
-					// Get the root node name and depth
-					std::string treeName = behaviourTree["Tree Name"].as<std::string>();
-					tempTree->SetBehaviourTreeName(treeName);
-					std::string rootName = behaviourTree["name"].as<std::string>();
-					int rootDepth = behaviourTree["depth"].as<int>();
-
-					// Create root node using NodeFactory
-					Ref<BehaviourNode> rootNode = Borealis::NodeFactory::CreateNodeByName(rootName);
-
-					// Set the root node of the tree
-					tempTree->SetRootNode(rootNode); //sets depth to 0 by default
-					BOREALIS_CORE_TRACE("Deserialising BT {}", treeName);
-
-					// If the root node has children, parse them recursively
-					if (behaviourTree["children"]) {
-						for (auto childNode : behaviourTree["children"]) {
-							ParseTree(childNode, rootNode, *tempTree, rootDepth);
+			}
+			btc.AddTree(tempTree);
+		}
+
+		auto scriptComponent = entity["ScriptComponent"];
+		if (scriptComponent)
+		{
+			auto& sc = loadedEntity.AddComponent<ScriptComponent>();
+			for (const auto& script : scriptComponent)
+			{
+				std::string scriptName = script.first.as<std::string>();
+				auto scriptInstance = MakeRef<ScriptInstance>(ScriptingSystem::GetScriptClass(scriptName));
+				scriptInstance->Init(loadedEntity.GetUUID()); // Initialise the script instance (set the entity reference
+				sc.AddScript(scriptName, scriptInstance);
+
+				const YAML::Node& fields = script.second;
+				if (fields) {
+					for (const auto& field : fields) {
+						// Each field will have a name and a corresponding node
+						std::string fieldName = field.first.as<std::string>();
+						const YAML::Node& fieldData = field.second;
+						fieldData["Type"].as<std::string>();
+
+						if (fieldData["Type"].as<std::string>() == "Bool")
+						{
+							bool data = fieldData["Data"].as<bool>();
+							scriptInstance->SetFieldValue(fieldName, &data);
+							continue;
 						}
-					}
-					btc.AddTree(tempTree);
-				}
 
-				auto scriptComponent = entity["ScriptComponent"];
-				if (scriptComponent)
-				{
-					auto& sc = loadedEntity.AddComponent<ScriptComponent>();
-					for (const auto& script : scriptComponent)
-					{
-						std::string scriptName = script.first.as<std::string>();
-						auto scriptInstance = MakeRef<ScriptInstance>(ScriptingSystem::GetScriptClass(scriptName));
-						scriptInstance->Init(loadedEntity.GetUUID()); // Initialise the script instance (set the entity reference
-						sc.AddScript(scriptName, scriptInstance);
-
-						const YAML::Node& fields = script.second;
-						if (fields) {
-							for (const auto& field : fields) {
-								// Each field will have a name and a corresponding node
-								std::string fieldName = field.first.as<std::string>();
-								const YAML::Node& fieldData = field.second;
-								fieldData["Type"].as<std::string>();
-
-								if (fieldData["Type"].as<std::string>() == "Bool")
-								{
-									bool data = fieldData["Data"].as<bool>();
-									scriptInstance->SetFieldValue(fieldName, &data);
-									continue;
-								}
-
-								if (fieldData["Type"].as<std::string>() == "Float")
-								{
-									float data = fieldData["Data"].as<float>();
-									scriptInstance->SetFieldValue(fieldName, &data);
-									continue;
-								}
-
-								if (fieldData["Type"].as<std::string>() == "Int")
-								{
-									int data = fieldData["Data"].as<int>();
-									scriptInstance->SetFieldValue(fieldName, &data);
-									continue;
-								}
-
-								if (fieldData["Type"].as<std::string>() == "String")
-								{
-									std::string data = fieldData["Data"].as<std::string>();
-									scriptInstance->SetFieldValue(fieldName, &data);
-									continue;
-								}
-
-								if (fieldData["Type"].as<std::string>() == "Vector2")
-								{
-									glm::vec2 data = fieldData["Data"].as<glm::vec2>();
-									scriptInstance->SetFieldValue(fieldName, &data);
-									continue;
-								}
-
-								if (fieldData["Type"].as<std::string>() == "Vector3")
-								{
-									glm::vec3 data = fieldData["Data"].as<glm::vec3>();
-									scriptInstance->SetFieldValue(fieldName, &data);
-									continue;
-								}
-
-								if (fieldData["Type"].as<std::string>() == "Vector4")
-								{
-									glm::vec4 data = fieldData["Data"].as<glm::vec4>();
-									scriptInstance->SetFieldValue(fieldName, &data);
-									continue;
-								}
-
-								if (fieldData["Type"].as<std::string>() == "UChar")
-								{
-									unsigned char data = static_cast<unsigned char>(fieldData["Data"].as<unsigned>());
-									scriptInstance->SetFieldValue(fieldName, &data);
-									continue;
-								}
-
-								if (fieldData["Type"].as<std::string>() == "Char")
-								{
-									char data = fieldData["Data"].as<char>();
-									scriptInstance->SetFieldValue(fieldName, &data);
-									continue;
-								}
-
-								if (fieldData["Type"].as<std::string>() == "UShort")
-								{
-									unsigned short data = fieldData["Data"].as<unsigned short>();
-									scriptInstance->SetFieldValue(fieldName, &data);
-									continue;
-								}
-
-								if (fieldData["Type"].as<std::string>() == "Short")
-								{
-									short data = fieldData["Data"].as<short>();
-									scriptInstance->SetFieldValue(fieldName, &data);
-									continue;
-								}
-
-								if (fieldData["Type"].as<std::string>() == "UInt")
-								{
-									unsigned data = fieldData["Data"].as<unsigned>();
-									scriptInstance->SetFieldValue(fieldName, &data);
-									continue;
-								}
-
-								if (fieldData["Type"].as<std::string>() == "Long")
-								{
-									long long data = fieldData["Data"].as<long long>();
-									scriptInstance->SetFieldValue(fieldName, &data);
-									continue;
-								}
-
-								if (fieldData["Type"].as<std::string>() == "ULong")
-								{
-									unsigned long long data = fieldData["Data"].as<unsigned long long>();
-									scriptInstance->SetFieldValue(fieldName, &data);
-									continue;
-								}
-
-								if (fieldData["Type"].as<std::string>() == "Double")
-								{
-									double data = fieldData["Data"].as<double>();
-									scriptInstance->SetFieldValue(fieldName, &data);
-									continue;
-								}
-
-							}
+						if (fieldData["Type"].as<std::string>() == "Float")
+						{
+							float data = fieldData["Data"].as<float>();
+							scriptInstance->SetFieldValue(fieldName, &data);
+							continue;
+						}
+
+						if (fieldData["Type"].as<std::string>() == "Int")
+						{
+							int data = fieldData["Data"].as<int>();
+							scriptInstance->SetFieldValue(fieldName, &data);
+							continue;
+						}
+
+						if (fieldData["Type"].as<std::string>() == "String")
+						{
+							std::string data = fieldData["Data"].as<std::string>();
+							scriptInstance->SetFieldValue(fieldName, &data);
+							continue;
+						}
+
+						if (fieldData["Type"].as<std::string>() == "Vector2")
+						{
+							glm::vec2 data = fieldData["Data"].as<glm::vec2>();
+							scriptInstance->SetFieldValue(fieldName, &data);
+							continue;
+						}
+
+						if (fieldData["Type"].as<std::string>() == "Vector3")
+						{
+							glm::vec3 data = fieldData["Data"].as<glm::vec3>();
+							scriptInstance->SetFieldValue(fieldName, &data);
+							continue;
+						}
+
+						if (fieldData["Type"].as<std::string>() == "Vector4")
+						{
+							glm::vec4 data = fieldData["Data"].as<glm::vec4>();
+							scriptInstance->SetFieldValue(fieldName, &data);
+							continue;
+						}
+
+						if (fieldData["Type"].as<std::string>() == "UChar")
+						{
+							unsigned char data = static_cast<unsigned char>(fieldData["Data"].as<unsigned>());
+							scriptInstance->SetFieldValue(fieldName, &data);
+							continue;
+						}
+
+						if (fieldData["Type"].as<std::string>() == "Char")
+						{
+							char data = fieldData["Data"].as<char>();
+							scriptInstance->SetFieldValue(fieldName, &data);
+							continue;
+						}
+
+						if (fieldData["Type"].as<std::string>() == "UShort")
+						{
+							unsigned short data = fieldData["Data"].as<unsigned short>();
+							scriptInstance->SetFieldValue(fieldName, &data);
+							continue;
+						}
+
+						if (fieldData["Type"].as<std::string>() == "Short")
+						{
+							short data = fieldData["Data"].as<short>();
+							scriptInstance->SetFieldValue(fieldName, &data);
+							continue;
+						}
+
+						if (fieldData["Type"].as<std::string>() == "UInt")
+						{
+							unsigned data = fieldData["Data"].as<unsigned>();
+							scriptInstance->SetFieldValue(fieldName, &data);
+							continue;
 						}
+
+						if (fieldData["Type"].as<std::string>() == "Long")
+						{
+							long long data = fieldData["Data"].as<long long>();
+							scriptInstance->SetFieldValue(fieldName, &data);
+							continue;
+						}
+
+						if (fieldData["Type"].as<std::string>() == "ULong")
+						{
+							unsigned long long data = fieldData["Data"].as<unsigned long long>();
+							scriptInstance->SetFieldValue(fieldName, &data);
+							continue;
+						}
+
+						if (fieldData["Type"].as<std::string>() == "Double")
+						{
+							double data = fieldData["Data"].as<double>();
+							scriptInstance->SetFieldValue(fieldName, &data);
+							continue;
+						}
+
 					}
 				}
 			}
 		}
 
-		return true;
+		return loadedEntity;
 	}
 
 	bool Serialiser::DeserialiseEditorStyle()
@@ -0,0 +1,120 @@
+/******************************************************************************/
+/*!
+\file		WorldPartition.cpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Defines the world partition
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#include <BorealisPCH.hpp>
+#include <Scene/WorldPartition.hpp>
+#include <Scene/Serialiser.hpp>
+#include <Scene/Entity.hpp>
+#include <Scene/Components.hpp>
+
+namespace Borealis
+{
+	/*!***********************************************************************
+		\brief
+			Checks if an entity stays loaded while the scene is
+	*************************************************************************/
+	static bool IsPersistent(const YAML::Node& entity)
+	{
+		if (!entity["TransformComponent"] || entity["CameraComponent"] || entity["AudioListenerComponent"] || entity["ScriptComponent"])
+			return true;
+
+		auto light = entity["LightComponent"];
+		return light && static_cast<LightComponent::Type>(light["Type"].as<int>()) == LightComponent::Type::Directional;
+	}
+
+	uint64_t WorldPartition::GetCellKey(int32_t x, int32_t z)
+	{
+		return static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32 | static_cast<uint32_t>(z);
+	}
+
+	WorldPartition::WorldPartition(const Settings& settings, const YAML::Node& entities, std::vector<YAML::Node>& persistent)
+		: mSettings(settings)
+	{
+		for (auto entity : entities)
+		{
+			if (IsPersistent(entity))
+			{
+				persistent.push_back(entity);
+				continue;
+			}
+
+			// Translate is saved as an [x, y, z] sequence
+			auto translate = entity["TransformComponent"]["Translate"];
+			int32_t x = static_cast<int32_t>(std::floor(translate[0].as<float>() / mSettings.mCellSize));
+			int32_t z = static_cast<int32_t>(std::floor(translate[2].as<float>() / mSettings.mCellSize));
+
+			Cell& cell = mCells[GetCellKey(x, z)];
+			cell.mCentre = (glm::vec2(x, z) + 0.5f) * mSettings.mCellSize;
+			cell.mEntities.push_back(entity);
+		}
+	}
+
+	void WorldPartition::Update(Scene& scene, const glm::vec3& position)
+	{
+		PROFILE_FUNCTION();
+
+		glm::vec2 view(position.x, position.z);
+		uint32_t budget = mSettings.mEntitiesPerFrame;
+
+		// A cell unloads a cell width past where it loads, so one on the edge does not flicker
+		float unloadRadius = mSettings.mLoadRadius + mSettings.mCellSize;
+
+		mPending.clear();
+		mLoadedCells = 0;
+		for (auto& [key, cell] : mCells)
+		{
+			float distance = glm::distance(cell.mCentre, view);
+			if (distance > unloadRadius)
+			{
+				while (budget && !cell.mLoaded.empty())
+				{
+					// Gameplay may have destroyed it already
+					if (Entity entity = scene.GetEntityByUUID(cell.mLoaded.back()))
+						scene.DestroyEntity(entity);
+					cell.mLoaded.pop_back();
+					--budget;
+				}
+			}
+			else if (distance <= mSettings.mLoadRadius && cell.mLoaded.size() < cell.mEntities.size())
+			{
+				mPending.emplace_back(distance, &cell);
+			}
+
+			if (!cell.mLoaded.empty() && cell.mLoaded.size() == cell.mEntities.size())
+				++mLoadedCells;
+		}
+
+		if (mPending.empty() || !budget)
+			return;
+
+		std::sort(mPending.begin(), mPending.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+		// The serialiser holds a Ref, the scene outlives this call
+		Serialiser serialiser(Ref<Scene>(Ref<Scene>(), &scene));
+		for (auto& [distance, cell] : mPending)
+		{
+			while (budget && cell->mLoaded.size() < cell->mEntities.size())
+			{
+				Entity entity = serialiser.DeserialiseEntity(cell->mEntities[cell->mLoaded.size()]);
+				cell->mLoaded.push_back(entity.GetUUID());
+				--budget;
+			}
+
+			if (cell->mLoaded.size() == cell->mEntities.size())
+				++mLoadedCells;
+			if (!budget)
+				break;
+		}
+	}
+}
@@ -31,9 +31,9 @@ namespace Borealis
 		return InstantiateClass(mMonoClass);
 	}
 
-	MonoMethod* ScriptClass::GetMethod(std::string methodName, int paramCount)
+	MonoMethod* ScriptClass::GetMethod(const char* methodName, int paramCount)
 	{
-		return mono_class_get_method_from_name(mMonoClass, methodName.c_str(), paramCount);
+		return mono_class_get_method_from_name(mMonoClass, methodName, paramCount);
 	}
 
 	MonoObject* ScriptClass::InvokeMethod(MonoObject* instance, MonoMethod* method, void** params)
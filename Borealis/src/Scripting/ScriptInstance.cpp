@@ -127,12 +127,13 @@ namespace Borealis
 #define DefineMonoBehaviourMethod(methodName) \
 	void ScriptInstance::methodName() \
 	{\
-		if (mScriptClass->GetMethod( #methodName, 0) == nullptr) \
+		MonoMethod* method = mScriptClass->GetMethod(#methodName, 0); \
+		if (method == nullptr) \
 		{ \
 			return; \
 		} \
 		MonoObject* exception = nullptr; \
-		mono_runtime_invoke(mScriptClass->GetMethod(#methodName, 0), mInstance, nullptr, &exception); \
+		mono_runtime_invoke(method, mInstance, nullptr, &exception); \
 		if (exception) \
 		{ \
 			mono_print_unhandled_exception(exception); \
@@ -143,11 +144,12 @@ namespace Borealis
 #define DefineMonoBehaviourMethod(methodName) \
 	void ScriptInstance::methodName() \
 	{\
-		if (mScriptClass->GetMethod(#methodName, 0) == nullptr) \
+		MonoMethod* method = mScriptClass->GetMethod(#methodName, 0); \
+		if (method == nullptr) \
 		{ \
 			return; \
 		} \
-		mono_runtime_invoke(mScriptClass->GetMethod(#methodName, 0), mInstance, nullptr, nullptr); \
+		mono_runtime_invoke(method, mInstance, nullptr, nullptr); \
 	}\
 
 #endif
@@ -17,6 +17,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <Scripting/ScriptingSystem.hpp>
 #include <Scripting/ScriptInstance.hpp>
 #include <Scene/SceneManager.hpp>
+#include <Scene/SceneLoader.hpp>
 #include <Core/UUID.hpp>
 #include <Core/LoggerSystem.hpp>
 #include <Core/InputSystem.hpp>
@@ -24,10 +25,10 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 
 namespace Borealis
 {
-	std::unordered_map<MonoType*, HasComponentFn> GCFM::mHasComponentFunctions;
-	std::unordered_map<MonoType*, AddComponentFn> GCFM::mAddComponentFunctions;
-	std::unordered_map<MonoType*, RemoveComponentFn> GCFM::mRemoveComponentFunctions;
-#define BOREALIS_ADD_INTERNAL_CALL(Name) mono_add_internal_call("Borealis.InternalCalls::" #Name, Name)
+	FlatHashMap<MonoType*, HasComponentFn> GCFM::mHasComponentFunctions;
+	FlatHashMap<MonoType*, AddComponentFn> GCFM::mAddComponentFunctions;
+	FlatHashMap<MonoType*, RemoveComponentFn> GCFM::mRemoveComponentFunctions;
+#define BOREALIS_ADD_INTERNAL_CALL(Name) mono_add_internal_call("Borealis.InternalCalls::" #Name, reinterpret_cast<const void*>(Name))
 	void RegisterInternals()
 	{
 		//BOREALIS_ADD_INTERNAL_CALL(GetComponent<TransformComponent>);
@@ -61,6 +62,9 @@ namespace Borealis
 		BOREALIS_ADD_INTERNAL_CALL(ScriptComponent_AddComponent);
 		BOREALIS_ADD_INTERNAL_CALL(ScriptComponent_RemoveComponent);
 		BOREALIS_ADD_INTERNAL_CALL(ScriptComponent_HasComponent);
+
+		BOREALIS_ADD_INTERNAL_CALL(SceneManager_LoadScene);
+		BOREALIS_ADD_INTERNAL_CALL(SceneManager_IsLoading);
 	}
 	uint64_t GenerateUUID()
 	{
@@ -69,9 +73,8 @@ namespace Borealis
 	void Log(MonoString* text)
 	{
 		char* message = mono_string_to_utf8(text);
-		std::string logMessage = message;
+		BOREALIS_CORE_TRACE("{}", message);
 		mono_free(message);
-		BOREALIS_CORE_TRACE(logMessage.c_str());
 	}
 
 	uint64_t CreateEntity(MonoString* text)
@@ -98,9 +101,10 @@ namespace Borealis
 		}
 
 		MonoType* CPPType = mono_reflection_type_get_type(reflectionType);
-		if (GCFM::mRemoveComponentFunctions.find(CPPType) != GCFM::mRemoveComponentFunctions.end())
+		auto function = GCFM::mRemoveComponentFunctions.find(CPPType);
+		if (function != GCFM::mRemoveComponentFunctions.end())
 		{
-			GCFM::mRemoveComponentFunctions.at(CPPType)(Entity);
+			function->second(Entity);
 		}
 		else
 		{
@@ -128,9 +132,10 @@ namespace Borealis
 		}
 
 		MonoType* CPPType = mono_reflection_type_get_type(reflectionType);
-		if (GCFM::mAddComponentFunctions.find(CPPType) != GCFM::mAddComponentFunctions.end())
+		auto function = GCFM::mAddComponentFunctions.find(CPPType);
+		if (function != GCFM::mAddComponentFunctions.end())
 		{
-			GCFM::mAddComponentFunctions.at(CPPType)(Entity);
+			function->second(Entity);
 		}
 		else
 		{
@@ -158,9 +163,10 @@ namespace Borealis
 		}
 
 		MonoType* CPPType = mono_reflection_type_get_type(reflectionType);
-		if (GCFM::mHasComponentFunctions.find(CPPType) != GCFM::mHasComponentFunctions.end())
+		auto function = GCFM::mHasComponentFunctions.find(CPPType);
+		if (function != GCFM::mHasComponentFunctions.end())
 		{
-			return GCFM::mHasComponentFunctions.at(CPPType)(Entity);
+			return function->second(Entity);
 		}
 		else
 		{
@@ -338,8 +344,19 @@ namespace Borealis
 		}
 
 		MonoClass* klass = mono_class_from_mono_type(mono_reflection_type_get_type(reflectionType));
-		std::string className = mono_class_get_name(klass);
+		return Entity.GetComponent<ScriptComponent>().HasScript(mono_class_get_name(klass));
+	}
 
-		return Entity.GetComponent<ScriptComponent>().HasScript(className);
+	void SceneManager_LoadScene(MonoString* sceneName, bool additive)
+	{
+		// Swapped in at the start of a later frame, so the scene running this script is not destroyed under it
+		char* name = mono_string_to_utf8(sceneName);
+		SceneLoader::LoadAsync(name, additive ? SceneLoader::LoadMode::Additive : SceneLoader::LoadMode::Replace);
+		mono_free(name);
+	}
+
+	bool SceneManager_IsLoading()
+	{
+		return SceneLoader::IsLoading();
 	}
 }
\ No newline at end of file
@@ -24,6 +24,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <Scripting/ScriptInstance.hpp>
 #include <Core/Core.hpp>
 #include <Core/LoggerSystem.hpp>
+#include <Core/MemoryTracker.hpp>
 #include <Scene/SceneManager.hpp>
 #include <Scene/Components.hpp>
 #include <Scene/Entity.hpp>
@@ -177,6 +178,24 @@ namespace Borealis
 
 	void ScriptingSystem::InitMono()
 	{
+		// Only takes effect if the Mono build allows overriding its allocator, it must be set before any other Mono call
+		static MonoAllocatorVTable allocator =
+		{
+			MONO_ALLOCATOR_VTABLE_VERSION,
+			[](size_t size) { return MemoryTracker::Allocate(size, 16, MemoryTag::Scripting); },
+			[](void* ptr, size_t size) { return MemoryTracker::Reallocate(ptr, size, MemoryTag::Scripting); },
+			[](void* ptr) { MemoryTracker::Free(ptr); },
+			[](size_t count, size_t size)
+			{
+				void* ptr = MemoryTracker::Allocate(count * size, 16, MemoryTag::Scripting);
+				if (ptr)
+					std::memset(ptr, 0, count * size);
+				return ptr;
+			}
+		};
+		if (!mono_set_allocator_vtable(&allocator))
+			BOREALIS_CORE_TRACE("Mono does not support a custom allocator, scripting memory is not tracked");
+
 		mono_set_assemblies_path("mono/lib/4.5");
 		sData->mRootDomain = mono_jit_init("BorealisJitRuntime");
 		
@@ -0,0 +1,61 @@
+/******************************************************************************
+/*!
+\file       AudioImporter.hpp
+\author     Chua Zheng Yang
+\par        email: c.zhengyang\@digipen.edu
+\date       October 19, 2024
+\brief      Declares the audio importer, which decodes audio sources and
+            writes them out as ADPCM or PCM wave files
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef AudioImporter_HPP
+#define AudioImporter_HPP
+
+#include <cstdint>
+#include <vector>
+#include <filesystem>
+
+#include "MetaSerializer.hpp"
+
+namespace BorealisAssetCompiler
+{
+	struct AudioClip
+	{
+		std::vector<int16_t> mSamples;	// Interleaved
+		uint32_t mChannels = 0;
+		uint32_t mSampleRate = 0;
+		uint32_t mFrameCount = 0;		// Samples per channel
+	};
+
+	class AudioImporter
+	{
+	public:
+		/*!***********************************************************************
+			\brief
+				Decodes an audio source and writes it to the cache as a wave
+				file. The cache path gets a .wav extension.
+			\param[in] sourcePath
+				Source file, any format FMOD can open
+			\param[in, out] cachePath
+				Where to write the imported file
+			\param[in] settings
+				Import settings of the asset
+			\return
+				The settings with the load mode resolved
+		*************************************************************************/
+		static AudioImportSettings SaveFile(std::filesystem::path const& sourcePath, std::filesystem::path& cachePath, AudioImportSettings settings);
+
+	private:
+		static bool DecodeFile(std::filesystem::path const& sourcePath, AudioClip& clip);
+		static void DownmixToMono(AudioClip& clip);
+		static void SavePCMFile(std::filesystem::path const& cachePath, AudioClip const& clip);
+		static void SaveADPCMFile(std::filesystem::path const& cachePath, AudioClip const& clip);
+	};
+}
+
+#endif
@@ -20,6 +20,8 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 
 #include <glm/glm.hpp>
 
+#include "MetaSerializer.hpp"
+
 namespace BorealisAssetCompiler
 {
 	struct Vertex 
@@ -36,21 +38,36 @@ namespace BorealisAssetCompiler
 
 		uint32_t mVerticesCount;
 		uint32_t mIndicesCount; 
+
+		std::vector<std::vector<unsigned int>> mLodIndices; // Triangle lists of LOD 1 onwards, over the same vertices
 	};
 
 	struct Model
 	{
 	public:
 		std::vector<Mesh> mMeshes;
+		std::vector<float> mLodErrors; // Distance each LOD strays from the full mesh, LOD 0 first
 	};
 
 	class MeshImporter
 	{
 	public:
-		static void SaveFile(std::filesystem::path const& sourcePath, std::filesystem::path& cachePath);
+		/*!***********************************************************************
+			\brief
+				Imports a mesh, builds its LOD chain and writes it to the cache.
+				The cache path gets a .mesh extension.
+			\param[in] sourcePath
+				Source file, any format assimp can open
+			\param[in, out] cachePath
+				Where to write the imported file
+			\param[in] settings
+				Import settings of the asset
+		*************************************************************************/
+		static void SaveFile(std::filesystem::path const& sourcePath, std::filesystem::path& cachePath, MeshImportSettings const& settings);
 
 	private:
 		static void LoadFBXModel(Model & model, const std::string& path);
+		static void BuildLods(Model& model, MeshImportSettings const& settings);
 		static void SaveModel(Model const& model, std::filesystem::path& cachePath);
 	};
 }
@@ -0,0 +1,50 @@
+/******************************************************************************
+/*!
+\file       MeshSimplifier.hpp
+\author     Chua Zheng Yang
+\par        email: c.zhengyang\@digipen.edu
+\date       October 19, 2024
+\brief      Declares the quadric error mesh simplifier used to build the
+            levels of detail of imported meshes
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef MeshSimplifier_HPP
+#define MeshSimplifier_HPP
+
+#include <vector>
+
+#include "Importer/MeshImporter.hpp"
+
+namespace BorealisAssetCompiler
+{
+	class MeshSimplifier
+	{
+	public:
+		/*!***********************************************************************
+			\brief
+				Simplifies a triangle list by collapsing edges onto one of their
+				vertices, cheapest quadric error first. No vertex is moved or
+				created, so the result indexes the same vertex buffer. Vertices
+				on UV or normal seams and on open borders are never removed.
+			\param[in] vertices
+				Vertices of the mesh
+			\param[in] indices
+				Triangle list to simplify
+			\param[in] targetIndexCount
+				Index count to stop at
+			\param[out] error
+				Largest distance a collapse moved the surface, in model units
+			\return
+				The simplified triangle list, longer than the target when no
+				more edges can be collapsed
+		*************************************************************************/
+		static std::vector<unsigned int> Simplify(std::vector<Vertex> const& vertices, std::vector<unsigned int> const& indices, size_t targetIndexCount, float& error);
+	};
+}
+
+#endif
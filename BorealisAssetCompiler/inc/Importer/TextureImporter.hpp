@@ -15,6 +15,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #ifndef TextureImporter_HPP
 #define TextureImporter_HPP
 
+#include <cstring>
 #include <string>
 #include <vector>
 #include <iostream>
@@ -22,6 +23,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <filesystem>
 
 #include "ispc_texcomp.h"
+#include "MetaSerializer.hpp"
 
 namespace BorealisAssetCompiler
 {
@@ -64,12 +66,15 @@ namespace BorealisAssetCompiler
     class TextureImporter
     {
     public:
-        static void SaveFile(std::filesystem::path const& sourcePath, std::filesystem::path& cachePath);
+        static void SaveFile(std::filesystem::path const& sourcePath, std::filesystem::path& cachePath, TextureImportSettings const& settings);
 
         template <typename T>
         static void SaveFile(const T * bitmap, int width, int height, std::filesystem::path& cachePath);
     private:
-        static void SaveDDSFile(const std::string& filePath, int width, int height, const std::vector<uint8_t>& compressedData);
+        static TextureUsage ResolveUsage(std::filesystem::path const& sourcePath, TextureUsage usage);
+        static void SaveImage(std::vector<uint8_t> const& rgba, int width, int height, TextureUsage usage, bool generateMips, std::filesystem::path const& cachePath);
+        static std::vector<uint8_t> CompressLevel(std::vector<uint8_t> const& rgba, int width, int height, TextureUsage usage, bool hasAlpha);
+        static void SaveDDSFile(const std::string& filePath, int width, int height, uint32_t dxgiFormat, const std::vector<std::vector<uint8_t>>& levels);
     };
 
     //OPTIMIZE IT
@@ -94,28 +99,12 @@ namespace BorealisAssetCompiler
     void TextureImporter::SaveFile(const T * bitmap, int width, int height, std::filesystem::path& cachePath)
     {
         int totalSize = width * height * 4;  // Assuming 4 bytes per pixel (RGBA)
-        std::vector<T> bitmapCopy(bitmap, bitmap + totalSize);
+        std::vector<uint8_t> bitmapCopy(bitmap, bitmap + totalSize);
 
         //FlipBitmapVertically(bitmapCopy, width, height, 4);
 
-
-        bc7_enc_settings settings;
-        GetProfile_alpha_basic(&settings);
-
-        rgba_surface srcSurface;
-        srcSurface.ptr = bitmapCopy.data();
-        srcSurface.width = width;
-        srcSurface.height = height;
-        srcSurface.stride = width * 4;
-
-        int compressedSize = (width / 4) * (height / 4) * 16;
-        std::vector<uint8_t> compressedData(compressedSize);
-
-        //CompressBlocksBC7(&srcSurface, compressedData.data(), &settings);
-
-        CompressBlocksBC3(&srcSurface, compressedData.data());
-
-        SaveDDSFile(cachePath.string(), width, height, compressedData);
+        // Distance fields are sampled at one size, mips would only blur the edges
+        SaveImage(bitmapCopy, width, height, TextureUsage::Colour, false, cachePath);
     }
 }
 
@@ -34,6 +34,49 @@ namespace BorealisAssetCompiler
 		Scene,
 	};
 
+	enum class AudioFormat
+	{
+		ADPCM,
+		PCM
+	};
+
+	enum class AudioLoadMode
+	{
+		Auto,
+		DecompressOnLoad,
+		CompressedInMemory,
+		Stream
+	};
+
+	struct AudioImportSettings
+	{
+		AudioFormat Format = AudioFormat::ADPCM;
+		AudioLoadMode LoadMode = AudioLoadMode::Auto;
+		float StreamThreshold = 10.0f;		// Seconds
+		bool ForceMono = false;
+		bool Streaming = false;				// Resolved by the audio importer
+	};
+
+	enum class TextureUsage
+	{
+		Auto,
+		Colour,		// BC7
+		NormalMap,	// BC5
+		Mask		// BC4
+	};
+
+	struct TextureImportSettings
+	{
+		TextureUsage Usage = TextureUsage::Auto;
+		bool GenerateMips = true;
+	};
+
+	struct MeshImportSettings
+	{
+		uint32_t LodCount = 4;
+		float LodReduction = 0.5f;
+	};
+
 	struct AssetMetaData
 	{
 		std::string name;
@@ -46,6 +89,10 @@ namespace BorealisAssetCompiler
 
 		std::time_t importDate;
 		std::time_t cacheCreationDate;
+
+		AudioImportSettings AudioSettings;
+		TextureImportSettings TextureSettings;
+		MeshImportSettings MeshSettings;
 	};
 
 
@@ -16,6 +16,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include "Importer/TextureImporter.hpp"
 #include "Importer/FontImporter.hpp"
 #include "Importer/MeshImporter.hpp"
+#include "Importer/AudioImporter.hpp"
 
 namespace BorealisAssetCompiler
 {
@@ -53,13 +54,16 @@ namespace BorealisAssetCompiler
 		switch (metaData.Type)
 		{
 		case AssetType::Texture2D:
-			TextureImporter::SaveFile(metaData.SourcePath, cachePath);
+			TextureImporter::SaveFile(metaData.SourcePath, cachePath, metaData.TextureSettings);
 			break;
 		case AssetType::Font:
 			FontImporter::SaveFile(metaData.SourcePath, cachePath);
 			break;
 		case AssetType::Mesh:
-			MeshImporter::SaveFile(metaData.SourcePath, cachePath);
+			MeshImporter::SaveFile(metaData.SourcePath, cachePath, metaData.MeshSettings);
+			break;
+		case AssetType::Audio:
+			metaData.AudioSettings = AudioImporter::SaveFile(metaData.SourcePath, cachePath, metaData.AudioSettings);
 			break;
 		case AssetType::None:
 		default:
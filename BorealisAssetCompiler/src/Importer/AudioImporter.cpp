@@ -0,0 +1,315 @@
+/******************************************************************************
+/*!
+\file       AudioImporter.cpp
+\author     Chua Zheng Yang
+\par        email: c.zhengyang\@digipen.edu
+\date       October 19, 2024
+\brief      Defines the audio importer
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+#include <FMOD/fmod.hpp>
+
+#include "Importer/AudioImporter.hpp"
+
+#define WAVE_FORMAT_PCM 0x0001
+#define WAVE_FORMAT_IMA_ADPCM 0x0011
+
+namespace BorealisAssetCompiler
+{
+	namespace
+	{
+		const int sIndexTable[16] = { -1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8 };
+
+		const int sStepTable[89] = {
+			7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+			50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+			253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+			1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+			3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487,
+			12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+		};
+
+		struct ADPCMChannelState
+		{
+			int mPredictor = 0;
+			int mIndex = 0;
+		};
+
+		/*!***********************************************************************
+			\brief
+				Encodes one sample, updating the state the same way the decoder
+				will so rounding errors do not accumulate
+		*************************************************************************/
+		uint8_t EncodeADPCMSample(ADPCMChannelState& state, int16_t sample)
+		{
+			int step = sStepTable[state.mIndex];
+			int diff = sample - state.mPredictor;
+			uint8_t nibble = 0;
+			if (diff < 0)
+			{
+				nibble = 8;
+				diff = -diff;
+			}
+
+			int delta = step >> 3;
+			if (diff >= step) { nibble |= 4; diff -= step; delta += step; }
+			step >>= 1;
+			if (diff >= step) { nibble |= 2; diff -= step; delta += step; }
+			step >>= 1;
+			if (diff >= step) { nibble |= 1; delta += step; }
+
+			state.mPredictor += (nibble & 8) ? -delta : delta;
+			state.mPredictor = std::clamp(state.mPredictor, -32768, 32767);
+			state.mIndex = std::clamp(state.mIndex + sIndexTable[nibble], 0, 88);
+			return nibble;
+		}
+
+		template <typename T>
+		void Write(std::ofstream& out, T value)
+		{
+			out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+		}
+
+		void WriteWaveHeader(std::ofstream& out, uint32_t dataSize, uint32_t fmtSize, uint32_t factSize)
+		{
+			out.write("RIFF", 4);
+			Write<uint32_t>(out, 4 + (8 + fmtSize) + (factSize ? 8 + factSize : 0) + (8 + dataSize));
+			out.write("WAVE", 4);
+			out.write("fmt ", 4);
+			Write<uint32_t>(out, fmtSize);
+		}
+
+		int16_t ToSample16(const uint8_t* data, FMOD_SOUND_FORMAT format)
+		{
+			switch (format)
+			{
+			case FMOD_SOUND_FORMAT_PCM8:
+				return static_cast<int16_t>(static_cast<int8_t>(data[0]) * 256);
+			case FMOD_SOUND_FORMAT_PCM16:
+			{
+				int16_t value;
+				std::memcpy(&value, data, sizeof(value));
+				return value;
+			}
+			case FMOD_SOUND_FORMAT_PCM24:
+				return static_cast<int16_t>(data[1] | (data[2] << 8));
+			case FMOD_SOUND_FORMAT_PCM32:
+			{
+				int32_t value;
+				std::memcpy(&value, data, sizeof(value));
+				return static_cast<int16_t>(value >> 16);
+			}
+			case FMOD_SOUND_FORMAT_PCMFLOAT:
+			{
+				float value;
+				std::memcpy(&value, data, sizeof(value));
+				return static_cast<int16_t>(std::clamp(value, -1.0f, 1.0f) * 32767.0f);
+			}
+			default:
+				return 0;
+			}
+		}
+	}
+
+	AudioImportSettings AudioImporter::SaveFile(std::filesystem::path const& sourcePath, std::filesystem::path& cachePath, AudioImportSettings settings)
+	{
+		AudioClip clip;
+		if (!DecodeFile(sourcePath, clip))
+		{
+			std::cerr << "Failed to decode audio " << sourcePath << std::endl;
+			return settings;
+		}
+
+		if (settings.ForceMono)
+			DownmixToMono(clip);
+
+		// Long clips only keep a streaming buffer in memory, short ones are decoded once when loaded
+		float seconds = static_cast<float>(clip.mFrameCount) / clip.mSampleRate;
+		if (settings.LoadMode == AudioLoadMode::Auto)
+			settings.Streaming = seconds > settings.StreamThreshold;
+		else
+			settings.Streaming = settings.LoadMode == AudioLoadMode::Stream;
+
+		cachePath.replace_extension(".wav");
+		if (settings.Format == AudioFormat::PCM)
+			SavePCMFile(cachePath, clip);
+		else
+			SaveADPCMFile(cachePath, clip);
+
+		return settings;
+	}
+
+	bool AudioImporter::DecodeFile(std::filesystem::path const& sourcePath, AudioClip& clip)
+	{
+		FMOD::System* system = nullptr;
+		if (FMOD::System_Create(&system) != FMOD_OK)
+			return false;
+
+		// Decoding only, nothing is mixed or played
+		system->setOutput(FMOD_OUTPUTTYPE_NOSOUND_NRT);
+		if (system->init(1, FMOD_INIT_NORMAL, nullptr) != FMOD_OK)
+		{
+			system->release();
+			return false;
+		}
+
+		FMOD::Sound* sound = nullptr;
+		bool decoded = false;
+		if (system->createSound(sourcePath.string().c_str(), FMOD_OPENONLY | FMOD_ACCURATETIME, nullptr, &sound) == FMOD_OK)
+		{
+			FMOD_SOUND_FORMAT format;
+			int channels = 0, bits = 0;
+			float frequency = 0.0f;
+			unsigned int frameCount = 0;
+			sound->getFormat(nullptr, &format, &channels, &bits);
+			sound->getDefaults(&frequency, nullptr);
+			sound->getLength(&frameCount, FMOD_TIMEUNIT_PCM);
+
+			uint32_t bytesPerSample = static_cast<uint32_t>(bits / 8);
+			if (channels > 0 && bytesPerSample > 0 && frequency > 0.0f)
+			{
+				clip.mChannels = static_cast<uint32_t>(channels);
+				clip.mSampleRate = static_cast<uint32_t>(frequency);
+				clip.mSamples.reserve(static_cast<size_t>(frameCount) * channels);
+
+				std::vector<uint8_t> buffer(64 * 1024 - (64 * 1024) % (bytesPerSample * channels));
+				unsigned int read = 0;
+				FMOD_RESULT result;
+				do
+				{
+					result = sound->readData(buffer.data(), static_cast<unsigned int>(buffer.size()), &read);
+					for (unsigned int offset = 0; offset + bytesPerSample <= read; offset += bytesPerSample)
+						clip.mSamples.push_back(ToSample16(buffer.data() + offset, format));
+				} while (result == FMOD_OK && read > 0);
+
+				clip.mFrameCount = static_cast<uint32_t>(clip.mSamples.size() / clip.mChannels);
+				decoded = clip.mFrameCount > 0;
+			}
+			sound->release();
+		}
+
+		system->release();
+		return decoded;
+	}
+
+	void AudioImporter::DownmixToMono(AudioClip& clip)
+	{
+		if (clip.mChannels <= 1)
+			return;
+
+		for (uint32_t frame = 0; frame < clip.mFrameCount; ++frame)
+		{
+			int sum = 0;
+			for (uint32_t channel = 0; channel < clip.mChannels; ++channel)
+				sum += clip.mSamples[frame * clip.mChannels + channel];
+			clip.mSamples[frame] = static_cast<int16_t>(sum / static_cast<int>(clip.mChannels));
+		}
+		clip.mSamples.resize(clip.mFrameCount);
+		clip.mChannels = 1;
+	}
+
+	void AudioImporter::SavePCMFile(std::filesystem::path const& cachePath, AudioClip const& clip)
+	{
+		std::ofstream outFile(cachePath, std::ios::binary);
+		if (!outFile.is_open())
+			return;
+
+		uint32_t dataSize = static_cast<uint32_t>(clip.mSamples.size() * sizeof(int16_t));
+		uint16_t blockAlign = static_cast<uint16_t>(clip.mChannels * sizeof(int16_t));
+
+		WriteWaveHeader(outFile, dataSize, 16, 0);
+		Write<uint16_t>(outFile, WAVE_FORMAT_PCM);
+		Write<uint16_t>(outFile, static_cast<uint16_t>(clip.mChannels));
+		Write<uint32_t>(outFile, clip.mSampleRate);
+		Write<uint32_t>(outFile, clip.mSampleRate * blockAlign);
+		Write<uint16_t>(outFile, blockAlign);
+		Write<uint16_t>(outFile, 16);
+
+		outFile.write("data", 4);
+		Write<uint32_t>(outFile, dataSize);
+		outFile.write(reinterpret_cast<const char*>(clip.mSamples.data()), dataSize);
+	}
+
+	void AudioImporter::SaveADPCMFile(std::filesystem::path const& cachePath, AudioClip const& clip)
+	{
+		std::ofstream outFile(cachePath, std::ios::binary);
+		if (!outFile.is_open())
+			return;
+
+		// Standard IMA block sizes, each block restarts the predictor so streams can seek to any block
+		uint32_t channels = clip.mChannels;
+		uint32_t blockAlign = (clip.mSampleRate <= 22050 ? 512 : 1024) * channels;
+		uint32_t samplesPerBlock = (blockAlign - 4 * channels) * 8 / (4 * channels) + 1;
+		uint32_t blockCount = (clip.mFrameCount + samplesPerBlock - 1) / samplesPerBlock;
+		uint32_t dataSize = blockCount * blockAlign;
+
+		WriteWaveHeader(outFile, dataSize, 20, 4);
+		Write<uint16_t>(outFile, WAVE_FORMAT_IMA_ADPCM);
+		Write<uint16_t>(outFile, static_cast<uint16_t>(channels));
+		Write<uint32_t>(outFile, clip.mSampleRate);
+		Write<uint32_t>(outFile, static_cast<uint32_t>(static_cast<uint64_t>(clip.mSampleRate) * blockAlign / samplesPerBlock));
+		Write<uint16_t>(outFile, static_cast<uint16_t>(blockAlign));
+		Write<uint16_t>(outFile, 4);
+		Write<uint16_t>(outFile, 2);
+		Write<uint16_t>(outFile, static_cast<uint16_t>(samplesPerBlock));
+
+		// The fact chunk holds the real length, the last block is padded with silence
+		outFile.write("fact", 4);
+		Write<uint32_t>(outFile, 4);
+		Write<uint32_t>(outFile, clip.mFrameCount);
+
+		outFile.write("data", 4);
+		Write<uint32_t>(outFile, dataSize);
+
+		auto sampleAt = [&clip](uint32_t frame, uint32_t channel) -> int16_t
+			{
+				return frame < clip.mFrameCount ? clip.mSamples[frame * clip.mChannels + channel] : 0;
+			};
+
+		std::vector<uint8_t> block(blockAlign);
+		std::vector<ADPCMChannelState> states(channels);
+		for (uint32_t blockIndex = 0; blockIndex < blockCount; ++blockIndex)
+		{
+			uint32_t firstFrame = blockIndex * samplesPerBlock;
+			std::fill(block.begin(), block.end(), uint8_t(0));
+
+			// Header per channel, the first sample stored as is
+			for (uint32_t channel = 0; channel < channels; ++channel)
+			{
+				ADPCMChannelState& state = states[channel];
+				state.mPredictor = sampleAt(firstFrame, channel);
+				int16_t predictor = static_cast<int16_t>(state.mPredictor);
+				std::memcpy(&block[channel * 4], &predictor, sizeof(predictor));
+				block[channel * 4 + 2] = static_cast<uint8_t>(state.mIndex);
+			}
+
+			// Channels are interleaved in groups of 8 samples, 4 bytes each, low nibble first
+			uint8_t* data = block.data() + 4 * channels;
+			for (uint32_t group = 0; group < (samplesPerBlock - 1) / 8; ++group)
+			{
+				for (uint32_t channel = 0; channel < channels; ++channel)
+				{
+					for (uint32_t i = 0; i < 8; ++i)
+					{
+						uint32_t frame = firstFrame + 1 + group * 8 + i;
+						uint8_t nibble = EncodeADPCMSample(states[channel], sampleAt(frame, channel));
+						data[i / 2] |= (i & 1) ? static_cast<uint8_t>(nibble << 4) : nibble;
+					}
+					data += 4;
+				}
+			}
+
+			outFile.write(reinterpret_cast<const char*>(block.data()), blockAlign);
+		}
+	}
+}
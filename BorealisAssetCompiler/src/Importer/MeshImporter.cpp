@@ -12,6 +12,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
  */
  /******************************************************************************/
 
+#include <algorithm>
 #include <fstream>
 
 #include <assimp/Importer.hpp>
@@ -19,14 +20,20 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <assimp/postprocess.h>
 
 #include "Importer/MeshImporter.hpp"
+#include "Importer/MeshSimplifier.hpp"
 
 namespace BorealisAssetCompiler
 {
-	void MeshImporter::SaveFile(std::filesystem::path const& sourcePath, std::filesystem::path& cachePath)
+	constexpr uint32_t sMeshFileMagic = 0x48534D42; // "BMSH", files without it hold a single LOD
+	constexpr uint32_t sMeshFileVersion = 2;
+	constexpr uint32_t sMaxLodCount = 8;
+
+	void MeshImporter::SaveFile(std::filesystem::path const& sourcePath, std::filesystem::path& cachePath, MeshImportSettings const& settings)
 	{
 		Model model;
 
 		LoadFBXModel(model, sourcePath.string());
+		BuildLods(model, settings);
 
 		cachePath.replace_extension(".mesh");
 		SaveModel(model, cachePath);
@@ -99,7 +106,9 @@ namespace BorealisAssetCompiler
 	void MeshImporter::LoadFBXModel(Model& model, const std::string& path)
 	{
 		Assimp::Importer importer;
-		const aiScene* scene = importer.ReadFile(path, aiProcess_Triangulate | aiProcess_FlipUVs);
+		// Welded so the simplifier sees connected surfaces, and reordered for the post transform cache
+		const aiScene* scene = importer.ReadFile(path, aiProcess_Triangulate | aiProcess_FlipUVs | aiProcess_JoinIdenticalVertices |
+			aiProcess_GenSmoothNormals | aiProcess_ImproveCacheLocality);
 
 		if (!scene || scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !scene->mRootNode)
 		{
@@ -109,13 +118,55 @@ namespace BorealisAssetCompiler
 		ProcessNode(scene->mRootNode, scene, model);
 	}
 
+	void MeshImporter::BuildLods(Model& model, MeshImportSettings const& settings)
+	{
+		model.mLodErrors = { 0.f };
+
+		uint32_t lodCount = std::clamp(settings.LodCount, 1u, sMaxLodCount);
+		float reduction = std::clamp(settings.LodReduction, 0.05f, 0.95f);
+		for (uint32_t lod = 1; lod < lodCount; ++lod)
+		{
+			size_t previousIndices = 0, lodIndices = 0;
+			float lodError = 0.f;
+			std::vector<std::vector<unsigned int>> meshLods;
+			for (Mesh const& mesh : model.mMeshes)
+			{
+				std::vector<unsigned int> const& previous = mesh.mLodIndices.empty() ? mesh.mIndices : mesh.mLodIndices.back();
+				size_t target = static_cast<size_t>(static_cast<float>(previous.size() / 3) * reduction) * 3;
+
+				float error = 0.f;
+				meshLods.push_back(MeshSimplifier::Simplify(mesh.mVertices, previous, target, error));
+				lodError = std::max(lodError, error);
+				previousIndices += previous.size();
+				lodIndices += meshLods.back().size();
+			}
+
+			// Stop once the seams and borders leave too little to collapse for another level to pay off
+			if (lodIndices == 0 || static_cast<float>(lodIndices) > 0.9f * static_cast<float>(previousIndices))
+				break;
+
+			for (size_t i = 0; i < model.mMeshes.size(); ++i)
+				model.mMeshes[i].mLodIndices.push_back(std::move(meshLods[i]));
+
+			// Each level is simplified from the one before, so the errors add up
+			model.mLodErrors.push_back(model.mLodErrors.back() + lodError);
+		}
+	}
+
 	void MeshImporter::SaveModel(Model const& model, std::filesystem::path& cachePath)
 	{
 		std::ofstream outFile(cachePath, std::ios::binary);
 
+		outFile.write(reinterpret_cast<const char*>(&sMeshFileMagic), sizeof(sMeshFileMagic));
+		outFile.write(reinterpret_cast<const char*>(&sMeshFileVersion), sizeof(sMeshFileVersion));
+
 		uint32_t meshCount = static_cast<uint32_t>(model.mMeshes.size());
 		outFile.write(reinterpret_cast<const char*>(&meshCount), sizeof(meshCount));
 
+		uint32_t lodCount = static_cast<uint32_t>(model.mLodErrors.size());
+		outFile.write(reinterpret_cast<const char*>(&lodCount), sizeof(lodCount));
+		outFile.write(reinterpret_cast<const char*>(model.mLodErrors.data()), lodCount * sizeof(float));
+
 		for (const Mesh& mesh : model.mMeshes) {
 			uint32_t verticesCount = mesh.mVerticesCount;
 			uint32_t indicesCount = mesh.mIndicesCount;
@@ -125,6 +176,13 @@ namespace BorealisAssetCompiler
 			outFile.write(reinterpret_cast<const char*>(mesh.mVertices.data()), verticesCount * sizeof(Vertex));
 
 			outFile.write(reinterpret_cast<const char*>(mesh.mIndices.data()), indicesCount * sizeof(uint32_t));
+
+			for (std::vector<unsigned int> const& lod : mesh.mLodIndices)
+			{
+				uint32_t lodIndicesCount = static_cast<uint32_t>(lod.size());
+				outFile.write(reinterpret_cast<const char*>(&lodIndicesCount), sizeof(lodIndicesCount));
+				outFile.write(reinterpret_cast<const char*>(lod.data()), lodIndicesCount * sizeof(uint32_t));
+			}
 		}
 
 		outFile.close();
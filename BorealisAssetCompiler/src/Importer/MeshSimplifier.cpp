@@ -0,0 +1,315 @@
+/******************************************************************************
+/*!
+\file       MeshSimplifier.cpp
+\author     Chua Zheng Yang
+\par        email: c.zhengyang\@digipen.edu
+\date       October 19, 2024
+\brief      Defines the quadric error mesh simplifier
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <queue>
+#include <unordered_map>
+
+#include "Importer/MeshSimplifier.hpp"
+
+namespace BorealisAssetCompiler
+{
+	namespace
+	{
+		// Symmetric 4x4 matrix summing the squared distances to a set of planes
+		struct Quadric
+		{
+			double a2 = 0, ab = 0, ac = 0, ad = 0;
+			double b2 = 0, bc = 0, bd = 0;
+			double c2 = 0, cd = 0;
+			double d2 = 0;
+
+			void AddPlane(glm::dvec3 const& n, double d)
+			{
+				a2 += n.x * n.x; ab += n.x * n.y; ac += n.x * n.z; ad += n.x * d;
+				b2 += n.y * n.y; bc += n.y * n.z; bd += n.y * d;
+				c2 += n.z * n.z; cd += n.z * d;
+				d2 += d * d;
+			}
+
+			Quadric& operator+=(Quadric const& other)
+			{
+				a2 += other.a2; ab += other.ab; ac += other.ac; ad += other.ad;
+				b2 += other.b2; bc += other.bc; bd += other.bd;
+				c2 += other.c2; cd += other.cd;
+				d2 += other.d2;
+				return *this;
+			}
+
+			double Evaluate(glm::dvec3 const& p) const
+			{
+				double error = a2 * p.x * p.x + 2 * ab * p.x * p.y + 2 * ac * p.x * p.z + 2 * ad * p.x
+					+ b2 * p.y * p.y + 2 * bc * p.y * p.z + 2 * bd * p.y
+					+ c2 * p.z * p.z + 2 * cd * p.z
+					+ d2;
+				return std::max(error, 0.0);
+			}
+		};
+
+		struct Collapse
+		{
+			double mCost;
+			uint32_t mFrom, mTo;
+			uint32_t mFromVersion, mToVersion;
+
+			bool operator<(Collapse const& other) const { return mCost > other.mCost; }
+		};
+
+		struct PositionHash
+		{
+			size_t operator()(glm::vec3 const& p) const
+			{
+				uint32_t bits[3];
+				std::memcpy(bits, &p, sizeof(bits));
+				return (bits[0] * 73856093u) ^ (bits[1] * 19349663u) ^ (bits[2] * 83492791u);
+			}
+		};
+
+		struct SimplifierState
+		{
+			std::vector<Vertex> const& mVertices;
+			std::vector<unsigned int> mTriangles;			// Three indices per triangle
+			std::vector<bool> mTriangleAlive;
+			std::vector<std::vector<uint32_t>> mVertexTriangles;	// Triangles around each vertex, dead ones included
+			std::vector<Quadric> mQuadrics;
+			std::vector<uint32_t> mVersions;
+			std::vector<bool> mLocked;
+			std::vector<bool> mRemoved;
+			std::priority_queue<Collapse> mQueue;
+
+			glm::dvec3 Position(uint32_t vertex) const { return glm::dvec3(mVertices[vertex].Position); }
+
+			void Push(uint32_t from, uint32_t to)
+			{
+				if (mLocked[from] || from == to)
+					return;
+				Quadric quadric = mQuadrics[from];
+				quadric += mQuadrics[to];
+				mQueue.push({ quadric.Evaluate(Position(to)), from, to, mVersions[from], mVersions[to] });
+			}
+
+			/*!***********************************************************************
+				\brief
+					Checks that moving a vertex onto another keeps the mesh
+					manifold and does not fold any triangle over
+			*************************************************************************/
+			bool CanCollapse(uint32_t from, uint32_t to) const
+			{
+				std::vector<uint32_t> fromNeighbours, toNeighbours;
+				uint32_t sharedTriangles = 0;
+				for (uint32_t triangle : mVertexTriangles[from])
+				{
+					if (!mTriangleAlive[triangle])
+						continue;
+
+					unsigned int const* corners = &mTriangles[triangle * 3];
+					bool shared = corners[0] == to || corners[1] == to || corners[2] == to;
+					sharedTriangles += shared;
+					for (int i = 0; i < 3; ++i)
+						if (corners[i] != from)
+							fromNeighbours.push_back(corners[i]);
+					if (shared)
+						continue;
+
+					// The triangle keeps its orientation once the vertex moves
+					glm::dvec3 p[3], moved[3];
+					for (int i = 0; i < 3; ++i)
+					{
+						p[i] = Position(corners[i]);
+						moved[i] = corners[i] == from ? Position(to) : p[i];
+					}
+					glm::dvec3 before = glm::cross(p[1] - p[0], p[2] - p[0]);
+					glm::dvec3 after = glm::cross(moved[1] - moved[0], moved[2] - moved[0]);
+					double afterLength = glm::length(after);
+					if (afterLength <= 1e-12 || glm::dot(before, after) <= 0.2 * glm::length(before) * afterLength)
+						return false;
+				}
+
+				for (uint32_t triangle : mVertexTriangles[to])
+				{
+					if (!mTriangleAlive[triangle])
+						continue;
+					unsigned int const* corners = &mTriangles[triangle * 3];
+					for (int i = 0; i < 3; ++i)
+						if (corners[i] != to)
+							toNeighbours.push_back(corners[i]);
+				}
+
+				// Link condition, the only vertices both ends see are the ones opposite the edge
+				std::sort(fromNeighbours.begin(), fromNeighbours.end());
+				fromNeighbours.erase(std::unique(fromNeighbours.begin(), fromNeighbours.end()), fromNeighbours.end());
+				std::sort(toNeighbours.begin(), toNeighbours.end());
+				toNeighbours.erase(std::unique(toNeighbours.begin(), toNeighbours.end()), toNeighbours.end());
+
+				std::vector<uint32_t> common;
+				std::set_intersection(fromNeighbours.begin(), fromNeighbours.end(), toNeighbours.begin(), toNeighbours.end(), std::back_inserter(common));
+				return common.size() == sharedTriangles;
+			}
+		};
+	}
+
+	std::vector<unsigned int> MeshSimplifier::Simplify(std::vector<Vertex> const& vertices, std::vector<unsigned int> const& indices, size_t targetIndexCount, float& error)
+	{
+		error = 0.f;
+		SimplifierState state{ vertices };
+		size_t vertexCount = vertices.size();
+
+		for (size_t i = 0; i + 2 < indices.size(); i += 3)
+		{
+			if (indices[i] == indices[i + 1] || indices[i + 1] == indices[i + 2] || indices[i] == indices[i + 2])
+				continue;
+			state.mTriangles.insert(state.mTriangles.end(), { indices[i], indices[i + 1], indices[i + 2] });
+		}
+		size_t triangleCount = state.mTriangles.size() / 3;
+		size_t aliveIndices = state.mTriangles.size();
+
+		// Vertices split at seams share a position, work out the topology on positions
+		std::unordered_map<glm::vec3, uint32_t, PositionHash> firstAtPosition;
+		std::vector<uint32_t> canonical(vertexCount);
+		std::vector<uint32_t> sharedCount(vertexCount, 0);
+		for (uint32_t vertex = 0; vertex < vertexCount; ++vertex)
+		{
+			canonical[vertex] = firstAtPosition.emplace(vertices[vertex].Position, vertex).first->second;
+			sharedCount[canonical[vertex]]++;
+		}
+
+		std::unordered_map<uint64_t, uint32_t> edgeUses;
+		for (size_t i = 0; i < state.mTriangles.size(); i += 3)
+		{
+			for (int corner = 0; corner < 3; ++corner)
+			{
+				uint64_t a = canonical[state.mTriangles[i + corner]];
+				uint64_t b = canonical[state.mTriangles[i + (corner + 1) % 3]];
+				edgeUses[std::min(a, b) << 32 | std::max(a, b)]++;
+			}
+		}
+
+		state.mLocked.assign(vertexCount, false);
+		for (uint32_t vertex = 0; vertex < vertexCount; ++vertex)
+			state.mLocked[vertex] = sharedCount[canonical[vertex]] > 1;
+		for (auto const& [edge, uses] : edgeUses)
+		{
+			if (uses == 1)
+			{
+				state.mLocked[static_cast<uint32_t>(edge >> 32)] = true;
+				state.mLocked[static_cast<uint32_t>(edge & 0xFFFFFFFF)] = true;
+			}
+		}
+		// Border flags were set on the canonical vertex, pass them on to the copies
+		for (uint32_t vertex = 0; vertex < vertexCount; ++vertex)
+			if (state.mLocked[canonical[vertex]])
+				state.mLocked[vertex] = true;
+
+		state.mTriangleAlive.assign(triangleCount, true);
+		state.mVertexTriangles.resize(vertexCount);
+		state.mQuadrics.resize(vertexCount);
+		state.mVersions.assign(vertexCount, 0);
+		state.mRemoved.assign(vertexCount, false);
+		for (uint32_t triangle = 0; triangle < triangleCount; ++triangle)
+		{
+			unsigned int const* corners = &state.mTriangles[triangle * 3];
+			glm::dvec3 p0 = state.Position(corners[0]);
+			glm::dvec3 normal = glm::cross(state.Position(corners[1]) - p0, state.Position(corners[2]) - p0);
+			double length = glm::length(normal);
+			if (length > 0.0)
+				normal /= length;
+
+			Quadric plane;
+			plane.AddPlane(normal, -glm::dot(normal, p0));
+			for (int i = 0; i < 3; ++i)
+			{
+				state.mQuadrics[corners[i]] += plane;
+				state.mVertexTriangles[corners[i]].push_back(triangle);
+			}
+		}
+
+		for (uint32_t triangle = 0; triangle < triangleCount; ++triangle)
+		{
+			unsigned int const* corners = &state.mTriangles[triangle * 3];
+			for (int i = 0; i < 3; ++i)
+			{
+				state.Push(corners[i], corners[(i + 1) % 3]);
+				state.Push(corners[(i + 1) % 3], corners[i]);
+			}
+		}
+
+		double maxCost = 0.0;
+		while (aliveIndices > targetIndexCount && !state.mQueue.empty())
+		{
+			Collapse collapse = state.mQueue.top();
+			state.mQueue.pop();
+
+			uint32_t from = collapse.mFrom, to = collapse.mTo;
+			if (state.mRemoved[from] || state.mRemoved[to] ||
+				collapse.mFromVersion != state.mVersions[from] || collapse.mToVersion != state.mVersions[to])
+				continue;
+			if (!state.CanCollapse(from, to))
+				continue;
+
+			maxCost = std::max(maxCost, collapse.mCost);
+			for (uint32_t triangle : state.mVertexTriangles[from])
+			{
+				if (!state.mTriangleAlive[triangle])
+					continue;
+
+				unsigned int* corners = &state.mTriangles[triangle * 3];
+				if (corners[0] == to || corners[1] == to || corners[2] == to)
+				{
+					state.mTriangleAlive[triangle] = false;
+					aliveIndices -= 3;
+					continue;
+				}
+
+				for (int i = 0; i < 3; ++i)
+					if (corners[i] == from)
+						corners[i] = to;
+				state.mVertexTriangles[to].push_back(triangle);
+			}
+
+			state.mQuadrics[to] += state.mQuadrics[from];
+			state.mRemoved[from] = true;
+			state.mVertexTriangles[from].clear();
+			state.mVersions[to]++;
+
+			// Costs of every edge around the merged vertex changed
+			for (uint32_t triangle : state.mVertexTriangles[to])
+			{
+				if (!state.mTriangleAlive[triangle])
+					continue;
+				unsigned int const* corners = &state.mTriangles[triangle * 3];
+				for (int i = 0; i < 3; ++i)
+				{
+					if (corners[i] == to)
+						continue;
+					state.Push(to, corners[i]);
+					state.Push(corners[i], to);
+				}
+			}
+		}
+
+		std::vector<unsigned int> result;
+		result.reserve(aliveIndices);
+		for (uint32_t triangle = 0; triangle < triangleCount; ++triangle)
+		{
+			if (state.mTriangleAlive[triangle])
+				result.insert(result.end(), state.mTriangles.begin() + triangle * 3, state.mTriangles.begin() + triangle * 3 + 3);
+		}
+
+		error = static_cast<float>(std::sqrt(maxCost));
+		return result;
+	}
+}
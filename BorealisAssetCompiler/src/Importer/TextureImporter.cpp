@@ -12,70 +12,156 @@ prior written consent of DigiPen Institute of Technology is prohibited.
  */
  /******************************************************************************/
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <thread>
+
 #include "Importer/TextureImporter.hpp"
 
 #define STB_IMAGE_IMPLEMENTATION
 #include "stb_image.h"
 //#include "ispc_texcomp.h"
 
-#define FOURCC_DXT5 0x35545844  // 'DXT5' in ASCII
 #define FOURCC_DX10 0x30315844  // 'DX10' in ASCII
-#define DXGI_FORMAT_BC7_UNORM 98  // The BC7 format value for DX10 header
+#define DXGI_FORMAT_BC4_UNORM 80
+#define DXGI_FORMAT_BC5_UNORM 83
+#define DXGI_FORMAT_BC7_UNORM 98
 
 namespace BorealisAssetCompiler
 {
-    void TextureImporter::SaveDDSFile(const std::string& filePath, int width, int height, const std::vector<uint8_t>& compressedData)
+    namespace
     {
-        //DDSHeader header = {};
-        //header.dwMagic = 0x20534444;  // 'DDS '
-        //header.dwSize = 124;
-        //header.dwFlags = 0x1007;  // DDSD_CAPS | DDSD_HEIGHT | DDSD_WIDTH | DDSD_PIXELFORMAT
-        //header.dwHeight = height;
-        //header.dwWidth = width;
-        //header.dwPitchOrLinearSize = (width / 4) * (height / 4) * 16;  // Compressed size for BC7 blocks
-        //header.dwMipMapCount = 1;
-
-        //header.ddpf.dwSize = 32;
-        //header.ddpf.dwFlags = 4;  // DDPF_FOURCC
-        //header.ddpf.dwFourCC = FOURCC_DX10;  // 'DX10' FourCC for BC7
-
-        //header.ddsCaps.dwCaps1 = 0x1000;  // DDSCAPS_TEXTURE
-
-        //// DX10 extended header
-        //DDSHeaderDX10 dx10Header = {};
-        //dx10Header.dxgiFormat = DXGI_FORMAT_BC7_UNORM;
-        //dx10Header.resourceDimension = 3;  // DDS_DIMENSION_TEXTURE2D
-        //dx10Header.arraySize = 1;
-
-        //// Write the header and compressed data to the DDS file
-        //std::ofstream outFile(filePath, std::ios::binary);
-        //if (outFile.is_open()) {
-        //    outFile.write(reinterpret_cast<char*>(&header), sizeof(header));
-        //    outFile.write(reinterpret_cast<char*>(&dx10Header), sizeof(dx10Header));
-        //    outFile.write(reinterpret_cast<const char*>(compressedData.data()), compressedData.size());
-        //    outFile.close();
-        //}
+        float SrgbToLinear(float value)
+        {
+            return value <= 0.04045f ? value / 12.92f : std::pow((value + 0.055f) / 1.055f, 2.4f);
+        }
+
+        float LinearToSrgb(float value)
+        {
+            return value <= 0.0031308f ? value * 12.92f : 1.055f * std::pow(value, 1.0f / 2.4f) - 0.055f;
+        }
+
+        uint8_t ToByte(float value)
+        {
+            return static_cast<uint8_t>(std::clamp(value, 0.0f, 1.0f) * 255.0f + 0.5f);
+        }
+
+        /*!***********************************************************************
+            \brief
+                Converts 8 bit texels to the space they are filtered in. Colour
+                is linearised so mips keep their brightness, normals are
+                unpacked to vectors.
+        *************************************************************************/
+        std::vector<float> ToFilterSpace(std::vector<uint8_t> const& rgba, TextureUsage usage)
+        {
+            float srgbToLinear[256];
+            for (int i = 0; i < 256; ++i)
+                srgbToLinear[i] = SrgbToLinear(i / 255.0f);
+
+            std::vector<float> texels(rgba.size());
+            for (size_t i = 0; i < rgba.size(); ++i)
+            {
+                bool alpha = (i & 3) == 3;
+                if (usage == TextureUsage::Colour && !alpha)
+                    texels[i] = srgbToLinear[rgba[i]];
+                else if (usage == TextureUsage::NormalMap && !alpha)
+                    texels[i] = rgba[i] / 255.0f * 2.0f - 1.0f;
+                else
+                    texels[i] = rgba[i] / 255.0f;
+            }
+            return texels;
+        }
+
+        std::vector<uint8_t> FromFilterSpace(std::vector<float> const& texels, TextureUsage usage)
+        {
+            std::vector<uint8_t> rgba(texels.size());
+            for (size_t i = 0; i < texels.size(); ++i)
+            {
+                bool alpha = (i & 3) == 3;
+                if (usage == TextureUsage::Colour && !alpha)
+                    rgba[i] = ToByte(LinearToSrgb(texels[i]));
+                else if (usage == TextureUsage::NormalMap && !alpha)
+                    rgba[i] = ToByte(texels[i] * 0.5f + 0.5f);
+                else
+                    rgba[i] = ToByte(texels[i]);
+            }
+            return rgba;
+        }
+
+        /*!***********************************************************************
+            \brief
+                Halves an image with a 2x2 box filter. Normals are renormalised
+                after averaging.
+        *************************************************************************/
+        std::vector<float> Downsample(std::vector<float> const& texels, int width, int height, TextureUsage usage)
+        {
+            int dstWidth = std::max(width / 2, 1);
+            int dstHeight = std::max(height / 2, 1);
+            std::vector<float> result(static_cast<size_t>(dstWidth) * dstHeight * 4);
+
+            for (int y = 0; y < dstHeight; ++y)
+            {
+                int y0 = std::min(y * 2, height - 1);
+                int y1 = std::min(y * 2 + 1, height - 1);
+                for (int x = 0; x < dstWidth; ++x)
+                {
+                    int x0 = std::min(x * 2, width - 1);
+                    int x1 = std::min(x * 2 + 1, width - 1);
+                    float* dst = &result[(static_cast<size_t>(y) * dstWidth + x) * 4];
+                    for (int c = 0; c < 4; ++c)
+                    {
+                        dst[c] = 0.25f * (texels[(static_cast<size_t>(y0) * width + x0) * 4 + c] + texels[(static_cast<size_t>(y0) * width + x1) * 4 + c]
+                            + texels[(static_cast<size_t>(y1) * width + x0) * 4 + c] + texels[(static_cast<size_t>(y1) * width + x1) * 4 + c]);
+                    }
+
+                    if (usage == TextureUsage::NormalMap)
+                    {
+                        float length = std::sqrt(dst[0] * dst[0] + dst[1] * dst[1] + dst[2] * dst[2]);
+                        if (length > 0.0f)
+                        {
+                            dst[0] /= length;
+                            dst[1] /= length;
+                            dst[2] /= length;
+                        }
+                    }
+                }
+            }
+            return result;
+        }
+    }
+
+    void TextureImporter::SaveDDSFile(const std::string& filePath, int width, int height, uint32_t dxgiFormat, const std::vector<std::vector<uint8_t>>& levels)
+    {
+        bool hasMips = levels.size() > 1;
 
         DDSHeader header = {};
         header.dwMagic = 0x20534444;  // 'DDS '
         header.dwSize = 124;
-        header.dwFlags = 0x1007;  // DDSD_CAPS | DDSD_HEIGHT | DDSD_WIDTH | DDSD_PIXELFORMAT
+        header.dwFlags = 0x81007 | (hasMips ? 0x20000 : 0);  // DDSD_CAPS | DDSD_HEIGHT | DDSD_WIDTH | DDSD_PIXELFORMAT | DDSD_LINEARSIZE (| DDSD_MIPMAPCOUNT)
         header.dwHeight = height;
         header.dwWidth = width;
-        header.dwPitchOrLinearSize = (width / 4) * (height / 4) * 16;  // Compressed size for BC3 blocks
-        header.dwMipMapCount = 1;
+        header.dwPitchOrLinearSize = static_cast<uint32_t>(levels[0].size());
+        header.dwMipMapCount = static_cast<uint32_t>(levels.size());
 
         header.ddpf.dwSize = 32;
         header.ddpf.dwFlags = 4;  // DDPF_FOURCC
-        header.ddpf.dwFourCC = FOURCC_DXT5;  // 'DXT5' FourCC for BC3 (DXT5)
+        header.ddpf.dwFourCC = FOURCC_DX10;  // Block formats past BC3 need the DX10 header
 
-        header.ddsCaps.dwCaps1 = 0x1000;  // DDSCAPS_TEXTURE
+        header.ddsCaps.dwCaps1 = 0x1000 | (hasMips ? 0x400008 : 0);  // DDSCAPS_TEXTURE (| DDSCAPS_COMPLEX | DDSCAPS_MIPMAP)
 
-        // Write the header and compressed data to the DDS file
+        DDSHeaderDX10 dx10Header = {};
+        dx10Header.dxgiFormat = dxgiFormat;
+        dx10Header.resourceDimension = 3;  // DDS_DIMENSION_TEXTURE2D
+        dx10Header.arraySize = 1;
+
+        // Write the headers and every level, largest first
         std::ofstream outFile(filePath, std::ios::binary);
         if (outFile.is_open()) {
             outFile.write(reinterpret_cast<char*>(&header), sizeof(header));
-            outFile.write(reinterpret_cast<const char*>(compressedData.data()), compressedData.size());
+            outFile.write(reinterpret_cast<char*>(&dx10Header), sizeof(dx10Header));
+            for (std::vector<uint8_t> const& level : levels)
+                outFile.write(reinterpret_cast<const char*>(level.data()), level.size());
             outFile.close();
         }
     }
@@ -95,7 +181,124 @@ namespace BorealisAssetCompiler
         }
     }
 
-    void TextureImporter::SaveFile(std::filesystem::path const& sourcePath, std::filesystem::path & cachePath)
+    TextureUsage TextureImporter::ResolveUsage(std::filesystem::path const& sourcePath, TextureUsage usage)
+    {
+        if (usage != TextureUsage::Auto)
+            return usage;
+
+        std::string name = sourcePath.stem().string();
+        std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+        auto endsWith = [&name](const char* suffix)
+            {
+                size_t length = std::strlen(suffix);
+                return name.size() >= length && name.compare(name.size() - length, length, suffix) == 0;
+            };
+
+        for (const char* suffix : { "_n", "_nrm", "_normal", "_normalmap" })
+            if (endsWith(suffix)) return TextureUsage::NormalMap;
+        for (const char* suffix : { "_mask", "_metallic", "_metal", "_roughness", "_rough", "_ao", "_occlusion", "_height" })
+            if (endsWith(suffix)) return TextureUsage::Mask;
+        return TextureUsage::Colour;
+    }
+
+    std::vector<uint8_t> TextureImporter::CompressLevel(std::vector<uint8_t> const& rgba, int width, int height, TextureUsage usage, bool hasAlpha)
+    {
+        // The encoders work on whole 4x4 blocks, pad by repeating the edge texels
+        int paddedWidth = (width + 3) & ~3;
+        int paddedHeight = (height + 3) & ~3;
+        int bytesPerTexel = usage == TextureUsage::Mask ? 1 : usage == TextureUsage::NormalMap ? 2 : 4;
+        int blockBytes = usage == TextureUsage::Mask ? 8 : 16;
+
+        std::vector<uint8_t> padded(static_cast<size_t>(paddedWidth) * paddedHeight * bytesPerTexel);
+        for (int y = 0; y < paddedHeight; ++y)
+        {
+            const uint8_t* srcRow = &rgba[static_cast<size_t>(std::min(y, height - 1)) * width * 4];
+            uint8_t* dstRow = &padded[static_cast<size_t>(y) * paddedWidth * bytesPerTexel];
+            for (int x = 0; x < paddedWidth; ++x)
+                std::memcpy(dstRow + x * bytesPerTexel, srcRow + std::min(x, width - 1) * 4, bytesPerTexel);
+        }
+
+        int blocksX = paddedWidth / 4;
+        int blocksY = paddedHeight / 4;
+        std::vector<uint8_t> compressed(static_cast<size_t>(blocksX) * blocksY * blockBytes);
+
+        bc7_enc_settings settings;
+        if (hasAlpha)
+            GetProfile_alpha_basic(&settings);
+        else
+            GetProfile_basic(&settings);
+
+        // Rows of blocks are independent, hand them out to every core in small bands
+        constexpr int bandRows = 4;
+        int bandCount = (blocksY + bandRows - 1) / bandRows;
+        std::atomic<int> nextBand = 0;
+        auto worker = [&]()
+            {
+                for (int band = nextBand++; band < bandCount; band = nextBand++)
+                {
+                    int firstRow = band * bandRows;
+                    int rows = std::min(bandRows, blocksY - firstRow);
+
+                    rgba_surface surface;
+                    surface.ptr = padded.data() + static_cast<size_t>(firstRow) * 4 * paddedWidth * bytesPerTexel;
+                    surface.width = paddedWidth;
+                    surface.height = rows * 4;
+                    surface.stride = paddedWidth * bytesPerTexel;
+
+                    uint8_t* dst = compressed.data() + static_cast<size_t>(firstRow) * blocksX * blockBytes;
+                    switch (usage)
+                    {
+                    case TextureUsage::NormalMap:	CompressBlocksBC5(&surface, dst); break;
+                    case TextureUsage::Mask:		CompressBlocksBC4(&surface, dst); break;
+                    default:						CompressBlocksBC7(&surface, dst, &settings); break;
+                    }
+                }
+            };
+
+        int threadCount = std::min(static_cast<int>(std::max(std::thread::hardware_concurrency(), 1u)), bandCount);
+        std::vector<std::thread> threads;
+        for (int i = 1; i < threadCount; ++i)
+            threads.emplace_back(worker);
+        worker();
+        for (std::thread& thread : threads)
+            thread.join();
+
+        return compressed;
+    }
+
+    void TextureImporter::SaveImage(std::vector<uint8_t> const& rgba, int width, int height, TextureUsage usage, bool generateMips, std::filesystem::path const& cachePath)
+    {
+        bool hasAlpha = false;
+        if (usage == TextureUsage::Colour)
+        {
+            for (size_t i = 3; i < rgba.size() && !hasAlpha; i += 4)
+                hasAlpha = rgba[i] != 255;
+        }
+
+        std::vector<std::vector<uint8_t>> levels;
+        levels.push_back(CompressLevel(rgba, width, height, usage, hasAlpha));
+
+        if (generateMips)
+        {
+            // Each level is filtered from the previous one in linear space, then stored back as 8 bit
+            std::vector<float> texels = ToFilterSpace(rgba, usage);
+            int levelWidth = width;
+            int levelHeight = height;
+            while (levelWidth > 1 || levelHeight > 1)
+            {
+                texels = Downsample(texels, levelWidth, levelHeight, usage);
+                levelWidth = std::max(levelWidth / 2, 1);
+                levelHeight = std::max(levelHeight / 2, 1);
+                levels.push_back(CompressLevel(FromFilterSpace(texels, usage), levelWidth, levelHeight, usage, hasAlpha));
+            }
+        }
+
+        uint32_t dxgiFormat = usage == TextureUsage::NormalMap ? DXGI_FORMAT_BC5_UNORM
+            : usage == TextureUsage::Mask ? DXGI_FORMAT_BC4_UNORM : DXGI_FORMAT_BC7_UNORM;
+        SaveDDSFile(cachePath.string(), width, height, dxgiFormat, levels);
+    }
+
+    void TextureImporter::SaveFile(std::filesystem::path const& sourcePath, std::filesystem::path & cachePath, TextureImportSettings const& settings)
     {
         int width, height, channels;
         unsigned char* imageData = stbi_load(sourcePath.string().c_str(), &width, &height, &channels, 4); // Force 4 channels (RGBA)
@@ -104,28 +307,13 @@ namespace BorealisAssetCompiler
             return;
         }
 
-        bc7_enc_settings settings;
-        GetProfile_alpha_basic(&settings);
-
         FlipBitmapVertically(imageData, width, height, 4);
 
-        rgba_surface srcSurface;
-        srcSurface.ptr = imageData;
-        srcSurface.width = width;
-        srcSurface.height = height;
-        srcSurface.stride = width * 4;
-
-        int compressedSize = (width / 4) * (height / 4) * 16;
-        std::vector<uint8_t> compressedData(compressedSize);
-
-        //CompressBlocksBC7(&srcSurface, compressedData.data(), &settings);
-        CompressBlocksBC3(&srcSurface, compressedData.data());
+        std::vector<uint8_t> rgba(imageData, imageData + static_cast<size_t>(width) * height * 4);
+        stbi_image_free(imageData);
 
         std::string cacheString = cachePath.replace_extension(".dds").string();
 
-        SaveDDSFile(cacheString.c_str(), width, height, compressedData);
-
-        stbi_image_free(imageData);
+        SaveImage(rgba, width, height, ResolveUsage(sourcePath, settings.Usage), settings.GenerateMips, cacheString);
     }
 }
-
@@ -21,6 +21,44 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 
 namespace BorealisAssetCompiler
 {
+	std::string AudioLoadModeToString(AudioLoadMode loadMode)
+	{
+		switch (loadMode)
+		{
+		case AudioLoadMode::DecompressOnLoad:	return "DecompressOnLoad";
+		case AudioLoadMode::CompressedInMemory:	return "CompressedInMemory";
+		case AudioLoadMode::Stream:				return "Stream";
+		default:								return "Auto";
+		}
+	}
+
+	AudioLoadMode StringToAudioLoadMode(std::string const& loadMode)
+	{
+		if (loadMode == "DecompressOnLoad")		return AudioLoadMode::DecompressOnLoad;
+		if (loadMode == "CompressedInMemory")	return AudioLoadMode::CompressedInMemory;
+		if (loadMode == "Stream")				return AudioLoadMode::Stream;
+		return AudioLoadMode::Auto;
+	}
+
+	std::string TextureUsageToString(TextureUsage usage)
+	{
+		switch (usage)
+		{
+		case TextureUsage::Colour:		return "Colour";
+		case TextureUsage::NormalMap:	return "NormalMap";
+		case TextureUsage::Mask:		return "Mask";
+		default:						return "Auto";
+		}
+	}
+
+	TextureUsage StringToTextureUsage(std::string const& usage)
+	{
+		if (usage == "Colour")		return TextureUsage::Colour;
+		if (usage == "NormalMap")	return TextureUsage::NormalMap;
+		if (usage == "Mask")		return TextureUsage::Mask;
+		return TextureUsage::Auto;
+	}
+
 	AssetMetaData DeserializeMetaFile(YAML::Node& node, std::filesystem::path PathToAssetFolder)
 	{
 		AssetMetaData metaData;
@@ -41,6 +79,26 @@ namespace BorealisAssetCompiler
 		metaData.SourcePath = PathToAssetFolder / str;
 		metaData.importDate = node["LastModifiedDate"].as<uint64_t>();
 
+		if (YAML::Node audioSettings = node["AudioSettings"])
+		{
+			metaData.AudioSettings.Format = audioSettings["Format"].as<std::string>() == "PCM" ? AudioFormat::PCM : AudioFormat::ADPCM;
+			metaData.AudioSettings.LoadMode = StringToAudioLoadMode(audioSettings["LoadMode"].as<std::string>());
+			metaData.AudioSettings.StreamThreshold = audioSettings["StreamThreshold"].as<float>();
+			metaData.AudioSettings.ForceMono = audioSettings["ForceMono"].as<bool>();
+		}
+
+		if (YAML::Node textureSettings = node["TextureSettings"])
+		{
+			metaData.TextureSettings.Usage = StringToTextureUsage(textureSettings["Usage"].as<std::string>());
+			metaData.TextureSettings.GenerateMips = textureSettings["GenerateMips"].as<bool>();
+		}
+
+		if (YAML::Node meshSettings = node["MeshSettings"])
+		{
+			metaData.MeshSettings.LodCount = meshSettings["LodCount"].as<uint32_t>();
+			metaData.MeshSettings.LodReduction = meshSettings["LodReduction"].as<float>();
+		}
+
 		return metaData;
 	}
 
@@ -113,6 +171,31 @@ namespace BorealisAssetCompiler
 		out << YAML::Key << "SourcePath" << YAML::Value << std::filesystem::relative(assetMetaData.SourcePath, PathToAssetFolder).string();
 		out << YAML::Key << "CachePath" << YAML::Value << std::filesystem::relative(assetMetaData.CachePath, PathToAssetFolder).string();
 		out << YAML::Key << "LastModifiedDate" << YAML::Value << assetMetaData.importDate;
+		if (assetMetaData.Type == AssetType::Audio)
+		{
+			AudioImportSettings const& settings = assetMetaData.AudioSettings;
+			out << YAML::Key << "AudioSettings" << YAML::Value << YAML::BeginMap;
+			out << YAML::Key << "Format" << YAML::Value << (settings.Format == AudioFormat::PCM ? "PCM" : "ADPCM");
+			out << YAML::Key << "LoadMode" << YAML::Value << AudioLoadModeToString(settings.LoadMode);
+			out << YAML::Key << "StreamThreshold" << YAML::Value << settings.StreamThreshold;
+			out << YAML::Key << "ForceMono" << YAML::Value << settings.ForceMono;
+			out << YAML::Key << "Streaming" << YAML::Value << settings.Streaming;
+			out << YAML::EndMap;
+		}
+		if (assetMetaData.Type == AssetType::Texture2D)
+		{
+			out << YAML::Key << "TextureSettings" << YAML::Value << YAML::BeginMap;
+			out << YAML::Key << "Usage" << YAML::Value << TextureUsageToString(assetMetaData.TextureSettings.Usage);
+			out << YAML::Key << "GenerateMips" << YAML::Value << assetMetaData.TextureSettings.GenerateMips;
+			out << YAML::EndMap;
+		}
+		if (assetMetaData.Type == AssetType::Mesh)
+		{
+			out << YAML::Key << "MeshSettings" << YAML::Value << YAML::BeginMap;
+			out << YAML::Key << "LodCount" << YAML::Value << assetMetaData.MeshSettings.LodCount;
+			out << YAML::Key << "LodReduction" << YAML::Value << assetMetaData.MeshSettings.LodReduction;
+			out << YAML::EndMap;
+		}
 		out << YAML::EndMap;
 	}
 
@@ -0,0 +1,97 @@
+/******************************************************************************
+/*!
+\file       BenchmarkLayer.hpp
+\author     Chua Zheng Yang
+\par        email: c.zhengyang@digipen.edu
+\date       October 19, 2024
+\brief      Declares the Benchmark Layer class, which runs every scenario for
+			a fixed number of frames and writes the report
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef BENCHMARK_LAYER_HPP
+#define BENCHMARK_LAYER_HPP
+#include <chrono>
+#include <Borealis.hpp>
+#include <BenchmarkReport.hpp>
+#include <MicroBenchmarks.hpp>
+#include <SceneGenerators.hpp>
+
+namespace BorealisBenchmarks
+{
+	struct BenchmarkSettings
+	{
+		GeneratorSettings mGenerator;
+		uint32_t mFrames = 600;				//!< Measured frames per scenario
+		uint32_t mWarmupFrames = 60;		//!< Frames run before measuring
+		std::string mOutputPath = "benchmark.json";
+		std::string mBaselinePath;			//!< Report to compare against, empty to skip
+		double mThreshold = 0.1;			//!< Allowed slowdown against the baseline
+		std::string mScenarioFilter;		//!< Only run the scenario with this name, empty runs all
+		bool mRunMicroBenchmarks = true;	//!< False to run the scene scenarios only
+	};
+
+	class BenchmarkLayer : public Borealis::Layer
+	{
+	public:
+		/*!***********************************************************************
+			\brief
+				Constructor of the benchmark layer
+			\param[in] settings
+				Benchmark settings
+		*************************************************************************/
+		BenchmarkLayer(const BenchmarkSettings& settings);
+
+		void Init() override;
+		void UpdateFn(float dt) override;
+		void Free() override;
+	private:
+		/*!***********************************************************************
+			\brief
+				Runs the microbenchmarks into the report, before any scenario
+		*************************************************************************/
+		void RunMicroBenchmarks();
+
+		/*!***********************************************************************
+			\brief
+				Generates, serialises and starts the next scenario
+			\return
+				False if there are no scenarios left
+		*************************************************************************/
+		bool BeginNextScenario();
+
+		/*!***********************************************************************
+			\brief
+				Summarises the samples of the current scenario into the report
+				and releases its scene
+		*************************************************************************/
+		void EndScenario();
+
+		/*!***********************************************************************
+			\brief
+				Writes the report, compares it against the baseline and closes
+				the application
+		*************************************************************************/
+		void Finish();
+
+		BenchmarkSettings mSettings;
+		BenchmarkReport mReport;
+
+		size_t mNextScenario = 0;
+		Borealis::Ref<Borealis::Scene> mScene;
+		ScenarioResult mResult;
+		uint32_t mFrame = 0;
+		bool mHasPreviousFrame = false;
+		std::chrono::steady_clock::time_point mPreviousFrame;
+
+		Borealis::MemoryTagStats mStartHeap;
+		Borealis::MemoryTagStats mStartMemory[static_cast<int>(Borealis::MemoryTag::Count)];
+		std::unordered_map<std::string, std::vector<float>> mSamples;
+	};
+}
+
+#endif
@@ -0,0 +1,110 @@
+/******************************************************************************
+/*!
+\file       BenchmarkReport.hpp
+\author     Chua Zheng Yang
+\par        email: c.zhengyang@digipen.edu
+\date       October 19, 2024
+\brief      Declares the benchmark report, which is written as JSON and can
+			be compared against a saved baseline
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef BENCHMARK_REPORT_HPP
+#define BENCHMARK_REPORT_HPP
+#include <map>
+#include <string>
+#include <vector>
+
+namespace BorealisBenchmarks
+{
+	struct SampleSummary
+	{
+		double mMean = 0.0;
+		double mP50 = 0.0;
+		double mP99 = 0.0;
+		double mMax = 0.0;
+
+		/*!***********************************************************************
+			\brief
+				Summarises a set of samples
+			\param[in] samples
+				Samples in milliseconds, sorted in place
+			\return
+				The summary
+		*************************************************************************/
+		static SampleSummary FromSamples(std::vector<float>& samples);
+	};
+
+	/*!***********************************************************************
+		\brief
+			Memory of one tag of the memory tracker over the measured frames
+	*************************************************************************/
+	struct MemoryTagReport
+	{
+		uint64_t mLiveBytes = 0;			//!< Live bytes at the end of the scenario
+		uint64_t mPeakBytes = 0;			//!< Highest live bytes since startup
+		double mAllocationsPerFrame = 0.0;
+		double mBytesPerFrame = 0.0;
+	};
+
+	struct ScenarioResult
+	{
+		std::string mName;
+		uint32_t mEntityCount = 0;
+		double mSerialiseMs = 0.0;
+		double mDeserialiseMs = -1.0;		//!< Negative if the scenario cannot be deserialised
+		double mAllocationsPerFrame = 0.0;
+		double mAllocatedBytesPerFrame = 0.0;
+		double mDrawCallsPerFrame = 0.0;
+		bool mCheckAllocations = false;		//!< True if allocations per frame must be 0
+		std::map<std::string, SampleSummary> mSystems;	//!< Frame, UpdateRuntime and every task of the frame graph
+		std::map<std::string, MemoryTagReport> mMemory;	//!< Every tag of the memory tracker
+	};
+
+	struct BenchmarkReport
+	{
+		uint32_t mSeed = 0;
+		uint32_t mCount = 0;
+		uint32_t mFrames = 0;
+		std::vector<ScenarioResult> mScenarios;
+
+		/*!***********************************************************************
+			\brief
+				Writes the report as JSON
+			\param[in] path
+				File to write
+			\return
+				True if written
+		*************************************************************************/
+		bool Write(const std::string& path) const;
+
+		/*!***********************************************************************
+			\brief
+				Compares the report against a baseline written by Write and logs
+				every system whose mean or p99 got slower by more than the
+				threshold, along with allocation and serialisation regressions
+			\param[in] path
+				Baseline file
+			\param[in] threshold
+				Allowed slowdown, e.g. 0.1 for 10%
+			\return
+				Number of regressions, or -1 if the baseline cannot be read
+		*************************************************************************/
+		int CompareToBaseline(const std::string& path, double threshold) const;
+
+		/*!***********************************************************************
+			\brief
+				Logs every scenario that must not allocate in its measured
+				frames but did
+			\return
+				Number of scenarios that allocated
+		*************************************************************************/
+		int CheckAllocations() const;
+	};
+}
+
+#endif
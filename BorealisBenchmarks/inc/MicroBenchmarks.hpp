@@ -0,0 +1,51 @@
+/******************************************************************************
+/*!
+\file       MicroBenchmarks.hpp
+\author     Chua Zheng Yang
+\par        email: c.zhengyang@digipen.edu
+\date       October 19, 2024
+\brief      Declares the microbenchmarks, which time engine containers and
+			utilities in isolation rather than running a scene
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef MICRO_BENCHMARKS_HPP
+#define MICRO_BENCHMARKS_HPP
+#include <vector>
+#include <BenchmarkReport.hpp>
+#include <SceneGenerators.hpp>
+
+namespace BorealisBenchmarks
+{
+	/*!***********************************************************************
+		\brief
+			Runs a microbenchmark
+		\param[in] settings
+			Generator settings, the count is the number of elements worked on
+		\param[in] samples
+			Number of timed passes of every measurement
+		\param[out] result
+			Result to fill, one system per measurement
+	*************************************************************************/
+	using MicroBenchmarkFn = void(*)(const GeneratorSettings& settings, uint32_t samples, ScenarioResult& result);
+
+	struct MicroBenchmark
+	{
+		const char* mName;
+		MicroBenchmarkFn mRun;
+	};
+
+	/*!***********************************************************************
+		\brief
+			Gets every microbenchmark, in the order they are run
+		\return
+			The microbenchmarks
+	*************************************************************************/
+	const std::vector<MicroBenchmark>& GetMicroBenchmarks();
+}
+
+#endif
@@ -0,0 +1,60 @@
+/******************************************************************************
+/*!
+\file       SceneGenerators.hpp
+\author     Chua Zheng Yang
+\par        email: c.zhengyang@digipen.edu
+\date       October 19, 2024
+\brief      Declares the seeded scene generators used by the benchmarks. The
+			same settings always produce the same scene.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef SCENE_GENERATORS_HPP
+#define SCENE_GENERATORS_HPP
+#include <Borealis.hpp>
+
+namespace BorealisBenchmarks
+{
+	struct GeneratorSettings
+	{
+		uint32_t mCount = 10000;		//!< Number of entities to generate
+		uint32_t mMaterialCount = 16;	//!< Number of materials shared by the mesh entities
+		uint32_t mSeed = 1234;			//!< Seed of the generator
+		uint32_t mHierarchyDepth = 64;	//!< Depth of every generated transform hierarchy
+		std::string mScriptClass;		//!< C# class attached to scripted entities
+	};
+
+	/*!***********************************************************************
+		\brief
+			Fills a scene
+		\param[in] scene
+			Scene to fill
+		\param[in] settings
+			Generator settings
+		\return
+			False if the scenario cannot run, e.g. the script class is missing
+	*************************************************************************/
+	using SceneGenerator = bool(*)(const Borealis::Ref<Borealis::Scene>& scene, const GeneratorSettings& settings);
+
+	struct Scenario
+	{
+		const char* mName;
+		SceneGenerator mGenerate;
+		bool mCanDeserialise;	//!< False if the scene references assets that need a project to load
+		bool mAllocationFree;	//!< True if the measured frames must not allocate from the heap
+	};
+
+	/*!***********************************************************************
+		\brief
+			Gets every scenario, in the order they are run
+		\return
+			The scenarios
+	*************************************************************************/
+	const std::vector<Scenario>& GetScenarios();
+}
+
+#endif
@@ -0,0 +1,194 @@
+/******************************************************************************
+/*!
+\file       BenchmarkLayer.cpp
+\author     Chua Zheng Yang
+\par        email: c.zhengyang@digipen.edu
+\date       October 19, 2024
+\brief      Defines the Benchmark Layer class
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#include <filesystem>
+#include <Graphics/Null/RendererAPINullImpl.hpp>
+#include <Scene/Serialiser.hpp>
+#include <BenchmarkLayer.hpp>
+
+namespace BorealisBenchmarks
+{
+	namespace
+	{
+		using Clock = std::chrono::steady_clock;
+
+		float MillisecondsSince(Clock::time_point start)
+		{
+			return std::chrono::duration<float, std::milli>(Clock::now() - start).count();
+		}
+	}
+
+	BenchmarkLayer::BenchmarkLayer(const BenchmarkSettings& settings) : Layer("BenchmarkLayer"), mSettings(settings)
+	{
+	}
+
+	void BenchmarkLayer::Init()
+	{
+		mReport.mSeed = mSettings.mGenerator.mSeed;
+		mReport.mCount = mSettings.mGenerator.mCount;
+		mReport.mFrames = mSettings.mFrames;
+
+		if (mSettings.mRunMicroBenchmarks)
+			RunMicroBenchmarks();
+		if (!BeginNextScenario())
+			Finish();
+	}
+
+	void BenchmarkLayer::UpdateFn(float dt)
+	{
+		if (!mScene)
+			return;
+
+		// Frame time covers everything between two updates, including the rest of the application loop
+		Clock::time_point frameStart = Clock::now();
+		bool measuring = mFrame >= mSettings.mWarmupFrames;
+		if (measuring && mHasPreviousFrame)
+			mSamples["Frame"].push_back(std::chrono::duration<float, std::milli>(frameStart - mPreviousFrame).count());
+		mPreviousFrame = frameStart;
+		mHasPreviousFrame = true;
+
+		if (mFrame == mSettings.mWarmupFrames)
+		{
+			Borealis::NullRendererAPI::ResetStatistics();
+			mStartHeap = Borealis::MemoryTracker::GetHeapStats();
+			for (int i = 0; i < static_cast<int>(Borealis::MemoryTag::Count); ++i)
+				mStartMemory[i] = Borealis::MemoryTracker::GetStats(static_cast<Borealis::MemoryTag>(i));
+		}
+
+		Borealis::RenderCommand::Clear();
+		mScene->UpdateRuntime(dt);
+
+		if (measuring)
+		{
+			mSamples["UpdateRuntime"].push_back(MillisecondsSince(frameStart));
+			for (const Borealis::TaskGraph::TaskTiming& timing : mScene->GetFrameGraph().GetTimings())
+				mSamples[timing.mName].push_back(timing.mMilliseconds);
+		}
+
+		if (++mFrame < mSettings.mWarmupFrames + mSettings.mFrames)
+			return;
+
+		EndScenario();
+		if (!BeginNextScenario())
+			Finish();
+	}
+
+	void BenchmarkLayer::Free()
+	{
+		mScene = nullptr;
+	}
+
+	void BenchmarkLayer::RunMicroBenchmarks()
+	{
+		for (const MicroBenchmark& benchmark : GetMicroBenchmarks())
+		{
+			if (!mSettings.mScenarioFilter.empty() && mSettings.mScenarioFilter != benchmark.mName)
+				continue;
+
+			APP_LOG_INFO("Running {} with {} elements", benchmark.mName, mSettings.mGenerator.mCount);
+			ScenarioResult result;
+			result.mName = benchmark.mName;
+			benchmark.mRun(mSettings.mGenerator, mSettings.mFrames, result);
+			mReport.mScenarios.push_back(std::move(result));
+		}
+	}
+
+	bool BenchmarkLayer::BeginNextScenario()
+	{
+		const std::vector<Scenario>& scenarios = GetScenarios();
+		for (; mNextScenario < scenarios.size(); ++mNextScenario)
+		{
+			const Scenario& scenario = scenarios[mNextScenario];
+			if (!mSettings.mScenarioFilter.empty() && mSettings.mScenarioFilter != scenario.mName)
+				continue;
+
+			Borealis::Ref<Borealis::Scene> scene = Borealis::MakeRef<Borealis::Scene>(scenario.mName);
+			if (!scenario.mGenerate(scene, mSettings.mGenerator))
+				continue;
+
+			mResult = {};
+			mResult.mName = scenario.mName;
+			mResult.mCheckAllocations = scenario.mAllocationFree;
+			mResult.mEntityCount = static_cast<uint32_t>(scene->GetRegistry().view<Borealis::IDComponent>().size());
+
+			std::filesystem::path path = std::filesystem::temp_directory_path() / ("BorealisBenchmark_" + mResult.mName + ".sc");
+			Clock::time_point start = Clock::now();
+			Borealis::Serialiser(scene).SerialiseScene(path.string());
+			mResult.mSerialiseMs = MillisecondsSince(start);
+
+			if (scenario.mCanDeserialise)
+			{
+				Borealis::Ref<Borealis::Scene> loaded = Borealis::MakeRef<Borealis::Scene>(scenario.mName);
+				start = Clock::now();
+				Borealis::Serialiser(loaded).DeserialiseScene(path.string());
+				mResult.mDeserialiseMs = MillisecondsSince(start);
+			}
+			std::filesystem::remove(path);
+
+			APP_LOG_INFO("Running {} with {} entities", mResult.mName, mResult.mEntityCount);
+			mScene = scene;
+			Borealis::SceneManager::SetActiveScene(mScene);
+			mScene->RuntimeStart();
+
+			mFrame = 0;
+			mHasPreviousFrame = false;
+			mSamples.clear();
+			++mNextScenario;
+			return true;
+		}
+		return false;
+	}
+
+	void BenchmarkLayer::EndScenario()
+	{
+		double frames = std::max(mSettings.mFrames, 1u);
+		Borealis::MemoryTagStats heap = Borealis::MemoryTracker::GetHeapStats();
+		mResult.mAllocationsPerFrame = (heap.TotalAllocations - mStartHeap.TotalAllocations) / frames;
+		mResult.mAllocatedBytesPerFrame = (heap.TotalBytes - mStartHeap.TotalBytes) / frames;
+		for (int i = 0; i < static_cast<int>(Borealis::MemoryTag::Count); ++i)
+		{
+			Borealis::MemoryTag tag = static_cast<Borealis::MemoryTag>(i);
+			Borealis::MemoryTagStats stats = Borealis::MemoryTracker::GetStats(tag);
+			MemoryTagReport& memory = mResult.mMemory[Borealis::MemoryTracker::GetTagName(tag)];
+			memory.mLiveBytes = stats.LiveBytes;
+			memory.mPeakBytes = stats.PeakBytes;
+			memory.mAllocationsPerFrame = (stats.TotalAllocations - mStartMemory[i].TotalAllocations) / frames;
+			memory.mBytesPerFrame = (stats.TotalBytes - mStartMemory[i].TotalBytes) / frames;
+		}
+		mResult.mDrawCallsPerFrame = Borealis::NullRendererAPI::GetStatistics().DrawCalls / frames;
+
+		for (auto& [name, samples] : mSamples)
+			mResult.mSystems[name] = SampleSummary::FromSamples(samples);
+
+		const SampleSummary& frame = mResult.mSystems["Frame"];
+		APP_LOG_INFO("{}: frame mean {:.3f}ms p99 {:.3f}ms, {:.1f} allocations per frame",
+			mResult.mName, frame.mMean, frame.mP99, mResult.mAllocationsPerFrame);
+
+		mReport.mScenarios.push_back(std::move(mResult));
+		mScene->RuntimeEnd();
+		Borealis::SceneManager::SetActiveScene(Borealis::Ref<Borealis::Scene>());
+		mScene = nullptr;
+	}
+
+	void BenchmarkLayer::Finish()
+	{
+		mReport.Write(mSettings.mOutputPath);
+		if (mReport.CheckAllocations() != 0)
+			Borealis::ApplicationManager::Get().SetExitCode(1);
+		if (!mSettings.mBaselinePath.empty() && mReport.CompareToBaseline(mSettings.mBaselinePath, mSettings.mThreshold) != 0)
+			Borealis::ApplicationManager::Get().SetExitCode(1);
+
+		Borealis::ApplicationManager::Get().Close();
+	}
+}
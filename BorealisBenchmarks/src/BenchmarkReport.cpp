@@ -0,0 +1,205 @@
+/******************************************************************************
+/*!
+\file       BenchmarkReport.cpp
+\author     Chua Zheng Yang
+\par        email: c.zhengyang@digipen.edu
+\date       October 19, 2024
+\brief      Defines the benchmark report
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <numeric>
+#include <yaml-cpp/yaml.h>
+#include <Core/LoggerSystem.hpp>
+#include <BenchmarkReport.hpp>
+
+namespace BorealisBenchmarks
+{
+	SampleSummary SampleSummary::FromSamples(std::vector<float>& samples)
+	{
+		SampleSummary summary;
+		if (samples.empty())
+			return summary;
+
+		std::sort(samples.begin(), samples.end());
+		auto percentile = [&](double p)
+			{
+				size_t rank = static_cast<size_t>(std::ceil(p * samples.size()));
+				return static_cast<double>(samples[std::clamp<size_t>(rank, 1, samples.size()) - 1]);
+			};
+
+		summary.mMean = std::accumulate(samples.begin(), samples.end(), 0.0) / samples.size();
+		summary.mP50 = percentile(0.50);
+		summary.mP99 = percentile(0.99);
+		summary.mMax = samples.back();
+		return summary;
+	}
+
+	bool BenchmarkReport::Write(const std::string& path) const
+	{
+		std::ofstream out(path);
+		if (!out)
+		{
+			APP_LOG_ERROR("Failed to write benchmark report {}", path);
+			return false;
+		}
+
+		out << std::fixed << std::setprecision(4);
+		out << "{\n";
+		out << "  \"seed\": " << mSeed << ",\n";
+		out << "  \"count\": " << mCount << ",\n";
+		out << "  \"frames\": " << mFrames << ",\n";
+		out << "  \"scenarios\": {";
+		for (size_t i = 0; i < mScenarios.size(); ++i)
+		{
+			const ScenarioResult& result = mScenarios[i];
+			out << (i ? "," : "") << "\n    \"" << result.mName << "\": {\n";
+			out << "      \"entities\": " << result.mEntityCount << ",\n";
+			out << "      \"serialise_ms\": " << result.mSerialiseMs << ",\n";
+			out << "      \"deserialise_ms\": " << result.mDeserialiseMs << ",\n";
+			out << "      \"allocations_per_frame\": " << result.mAllocationsPerFrame << ",\n";
+			out << "      \"allocated_bytes_per_frame\": " << result.mAllocatedBytesPerFrame << ",\n";
+			out << "      \"draw_calls_per_frame\": " << result.mDrawCallsPerFrame << ",\n";
+			if (result.mCheckAllocations)
+				out << "      \"allocation_free\": " << (result.mAllocationsPerFrame == 0.0 ? "true" : "false") << ",\n";
+			out << "      \"systems\": {";
+
+			bool first = true;
+			for (const auto& [name, summary] : result.mSystems)
+			{
+				out << (first ? "" : ",") << "\n        \"" << name << "\": { "
+					<< "\"mean\": " << summary.mMean << ", "
+					<< "\"p50\": " << summary.mP50 << ", "
+					<< "\"p99\": " << summary.mP99 << ", "
+					<< "\"max\": " << summary.mMax << " }";
+				first = false;
+			}
+			out << "\n      },\n";
+			out << "      \"memory\": {";
+
+			first = true;
+			for (const auto& [tag, memory] : result.mMemory)
+			{
+				out << (first ? "" : ",") << "\n        \"" << tag << "\": { "
+					<< "\"live\": " << memory.mLiveBytes << ", "
+					<< "\"peak\": " << memory.mPeakBytes << ", "
+					<< "\"allocations_per_frame\": " << memory.mAllocationsPerFrame << ", "
+					<< "\"bytes_per_frame\": " << memory.mBytesPerFrame << " }";
+				first = false;
+			}
+			out << "\n      }\n    }";
+		}
+		out << "\n  }\n}\n";
+
+		APP_LOG_INFO("Benchmark report written to {}", path);
+		return true;
+	}
+
+	int BenchmarkReport::CompareToBaseline(const std::string& path, double threshold) const
+	{
+		// The report is plain JSON, which yaml-cpp reads as flow style YAML
+		YAML::Node baseline;
+		try
+		{
+			baseline = YAML::LoadFile(path);
+		}
+		catch (const YAML::Exception& e)
+		{
+			APP_LOG_ERROR("Failed to read benchmark baseline {}: {}", path, e.what());
+			return -1;
+		}
+
+		if (baseline["seed"].as<uint32_t>(0) != mSeed || baseline["count"].as<uint32_t>(0) != mCount)
+			APP_LOG_WARN("Baseline was recorded with a different seed or entity count, the numbers may not be comparable");
+
+		int regressions = 0;
+		auto check = [&](const std::string& scenario, const std::string& metric, double base, double current)
+			{
+				// Ignore noise on metrics too small to measure reliably
+				if (base < 0.0 || current < 0.0 || std::max(base, current) < 0.01)
+					return;
+
+				double change = base > 0.0 ? (current - base) / base : 1.0;
+				if (change > threshold)
+				{
+					APP_LOG_ERROR("REGRESSION {}/{}: {:.4f} -> {:.4f} (+{:.1f}%)", scenario, metric, base, current, change * 100.0);
+					++regressions;
+				}
+				else if (change < -threshold)
+				{
+					APP_LOG_INFO("improved   {}/{}: {:.4f} -> {:.4f} ({:.1f}%)", scenario, metric, base, current, change * 100.0);
+				}
+			};
+
+		for (const ScenarioResult& result : mScenarios)
+		{
+			YAML::Node base = baseline["scenarios"][result.mName];
+			if (!base)
+			{
+				APP_LOG_WARN("Scenario {} is not in the baseline", result.mName);
+				continue;
+			}
+
+			check(result.mName, "serialise_ms", base["serialise_ms"].as<double>(-1.0), result.mSerialiseMs);
+			check(result.mName, "deserialise_ms", base["deserialise_ms"].as<double>(-1.0), result.mDeserialiseMs);
+			check(result.mName, "allocations_per_frame", base["allocations_per_frame"].as<double>(-1.0), result.mAllocationsPerFrame);
+			check(result.mName, "allocated_bytes_per_frame", base["allocated_bytes_per_frame"].as<double>(-1.0), result.mAllocatedBytesPerFrame);
+
+			for (const auto& [name, summary] : result.mSystems)
+			{
+				YAML::Node system = base["systems"][name];
+				if (!system)
+					continue;
+
+				check(result.mName, name + ".mean", system["mean"].as<double>(-1.0), summary.mMean);
+				check(result.mName, name + ".p99", system["p99"].as<double>(-1.0), summary.mP99);
+			}
+
+			for (const auto& [tag, memory] : result.mMemory)
+			{
+				YAML::Node node = base["memory"][tag];
+				if (!node)
+					continue;
+
+				check(result.mName, "memory." + tag + ".allocations_per_frame", node["allocations_per_frame"].as<double>(-1.0), memory.mAllocationsPerFrame);
+			}
+		}
+
+		APP_LOG_INFO("{} regression(s) against {} at a {:.0f}% threshold", regressions, path, threshold * 100.0);
+		return regressions;
+	}
+
+	int BenchmarkReport::CheckAllocations() const
+	{
+		int failures = 0;
+		for (const ScenarioResult& result : mScenarios)
+		{
+			if (!result.mCheckAllocations)
+				continue;
+
+			if (result.mAllocationsPerFrame == 0.0)
+			{
+				APP_LOG_INFO("{}: no heap allocations in the measured frames", result.mName);
+				continue;
+			}
+
+			APP_LOG_ERROR("ALLOCATIONS {}: {:.2f} allocations ({:.0f} bytes) per frame, expected none", result.mName,
+				result.mAllocationsPerFrame, result.mAllocatedBytesPerFrame);
+			for (const auto& [tag, memory] : result.mMemory)
+			{
+				if (memory.mAllocationsPerFrame > 0.0)
+					APP_LOG_ERROR("    {}: {:.2f} allocations per frame", tag, memory.mAllocationsPerFrame);
+			}
+			++failures;
+		}
+		return failures;
+	}
+}
@@ -0,0 +1,121 @@
+/******************************************************************************
+/*!
+\file       Main.cpp
+\author     Chua Zheng Yang
+\par        email: c.zhengyang@digipen.edu
+\date       October 19, 2024
+\brief      Defines the entry point of the benchmarks
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+#include <Borealis.hpp>
+#include <Assets/AssetManager.hpp>
+#include <BenchmarkLayer.hpp>
+#include <Core/EntryPoint.hpp>
+
+/*!***********************************************************************
+	\brief
+		Builds the benchmark settings from the command line.
+		--count <n>, --materials <n>, --seed <n>, --frames <n> and
+		--warmup <n> control the generated scenes, --depth <n> sets the
+		depth of the generated hierarchies, --scenario <name> runs a single
+		scenario, --no-micro skips the microbenchmarks, --out <file> sets
+		the report path, --baseline <file> and --threshold <percent> compare
+		the report against an earlier run, --memory-budget <Tag>=<MB> sets
+		the memory budget of a subsystem, and --project <file> with
+		--script <class> loads a project so the scripts scenario can run.
+	\param[in] args
+		Command line arguments
+	\param[out] projectPath
+		Project to load, empty if none
+	\return
+		Settings of the benchmark
+*************************************************************************/
+static BorealisBenchmarks::BenchmarkSettings ParseCommandLine(Borealis::ApplicationCommandLineArgs args, std::string& projectPath)
+{
+	BorealisBenchmarks::BenchmarkSettings settings;
+	for (int i = 1; i < args.mCount; ++i)
+	{
+		std::string arg = args[i];
+		if (arg == "--no-micro")
+		{
+			settings.mRunMicroBenchmarks = false;
+			continue;
+		}
+
+		// Every other argument takes a value
+		static const char* const valueArgs[] = { "--count", "--materials", "--seed", "--depth", "--script", "--frames", "--warmup",
+			"--scenario", "--out", "--baseline", "--threshold", "--project", "--memory-budget" };
+		if (std::find(std::begin(valueArgs), std::end(valueArgs), arg) == std::end(valueArgs))
+		{
+			APP_LOG_WARN("Unknown command line argument {}", arg);
+			continue;
+		}
+		if (i + 1 >= args.mCount)
+		{
+			APP_LOG_WARN("Missing value for command line argument {}", arg);
+			break;
+		}
+
+		std::string value = args[++i];
+		if (arg == "--count")				settings.mGenerator.mCount = std::stoul(value);
+		else if (arg == "--materials")		settings.mGenerator.mMaterialCount = std::stoul(value);
+		else if (arg == "--seed")			settings.mGenerator.mSeed = std::stoul(value);
+		else if (arg == "--depth")			settings.mGenerator.mHierarchyDepth = std::max(std::stoul(value), 1ul);
+		else if (arg == "--script")			settings.mGenerator.mScriptClass = value;
+		else if (arg == "--frames")			settings.mFrames = std::stoul(value);
+		else if (arg == "--warmup")			settings.mWarmupFrames = std::stoul(value);
+		else if (arg == "--scenario")		settings.mScenarioFilter = value;
+		else if (arg == "--out")			settings.mOutputPath = value;
+		else if (arg == "--baseline")		settings.mBaselinePath = value;
+		else if (arg == "--threshold")		settings.mThreshold = std::stod(value) / 100.0;
+		else if (arg == "--project")		projectPath = value;
+		else if (!Borealis::MemoryTracker::ParseBudget(value))
+			APP_LOG_WARN("Invalid memory budget {}, expected <Tag>=<MB>", value);
+	}
+	return settings;
+}
+
+class Benchmarks : public Borealis::ApplicationManager
+{
+public:
+	Benchmarks(const Borealis::ApplicationProperties& properties, const BorealisBenchmarks::BenchmarkSettings& settings, const std::string& projectPath)
+		: ApplicationManager(properties)
+	{
+		if (!projectPath.empty())
+		{
+			std::string activeSceneName;
+			if (Borealis::Project::SetProjectPath(projectPath, activeSceneName))
+			{
+				Borealis::AssetManager::SetRunTime();
+				Borealis::ScriptingSystem::InitCoreAssembly();
+			}
+			else
+			{
+				APP_LOG_ERROR("Failed to load project {}", projectPath);
+			}
+		}
+
+		PushLayer(new BorealisBenchmarks::BenchmarkLayer(settings));
+	}
+};
+
+
+Borealis::ApplicationManager* Borealis::CreateApplication(Borealis::ApplicationCommandLineArgs args)
+{
+	std::string projectPath;
+	BorealisBenchmarks::BenchmarkSettings settings = ParseCommandLine(args, projectPath);
+
+	// Benchmarks always run headless on one thread, ticking a fixed 60Hz step as fast as possible
+	Borealis::ApplicationProperties properties;
+	properties.mName = "Borealis Benchmarks";
+	properties.mRenderPolicy = Borealis::RenderThread::Policy::SingleThreaded;
+	properties.mIsHeadless = true;
+	properties.mFixedTimestep = 1.f / 60.f;
+	properties.mIsUnlocked = true;
+
+	return new Benchmarks(properties, settings, projectPath);
+}
@@ -0,0 +1,230 @@
+/******************************************************************************
+/*!
+\file       MicroBenchmarks.cpp
+\author     Chua Zheng Yang
+\par        email: c.zhengyang@digipen.edu
+\date       October 19, 2024
+\brief      Defines the microbenchmarks
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <unordered_map>
+#include <Core/FlatHashMap.hpp>
+#include <Scene/Components.hpp>
+#include <MicroBenchmarks.hpp>
+
+namespace BorealisBenchmarks
+{
+	namespace
+	{
+		using namespace Borealis;
+		using Clock = std::chrono::steady_clock;
+
+		// Results are summed in here so the optimiser cannot drop the work being timed
+		volatile uint64_t sSink = 0;
+
+		/*!***********************************************************************
+			\brief
+				Times a function over a number of passes into a system of the
+				result
+		*************************************************************************/
+		template <typename Fn>
+		void Measure(ScenarioResult& result, const std::string& name, uint32_t samples, Fn&& fn)
+		{
+			std::vector<float> times;
+			times.reserve(samples);
+			for (uint32_t i = 0; i < samples; ++i)
+			{
+				Clock::time_point start = Clock::now();
+				sSink = sSink + fn();
+				times.push_back(std::chrono::duration<float, std::milli>(Clock::now() - start).count());
+			}
+			result.mSystems[name] = SampleSummary::FromSamples(times);
+		}
+
+		/*!***********************************************************************
+			\brief
+				Times a map keyed by UUID, as the entity and asset lookups
+				use, and a map keyed by string looked up with string_views, as
+				the script lookups use
+		*************************************************************************/
+		template <typename UUIDMap, typename StringMap>
+		void MeasureMap(ScenarioResult& result, const std::string& mapName, uint32_t samples, const std::vector<UUID>& hits, const std::vector<UUID>& misses, const std::vector<std::string>& names)
+		{
+			Measure(result, "Insert/" + mapName, samples, [&]()
+				{
+					UUIDMap map;
+					for (UUID uuid : hits)
+						map[uuid] = static_cast<uint32_t>(uuid);
+					return static_cast<uint64_t>(map.size());
+				});
+
+			UUIDMap uuidMap;
+			for (UUID uuid : hits)
+				uuidMap[uuid] = static_cast<uint32_t>(uuid);
+
+			Measure(result, "FindHit/" + mapName, samples, [&]()
+				{
+					uint64_t sum = 0;
+					for (UUID uuid : hits)
+						sum += uuidMap.find(uuid)->second;
+					return sum;
+				});
+
+			Measure(result, "FindMiss/" + mapName, samples, [&]()
+				{
+					uint64_t found = 0;
+					for (UUID uuid : misses)
+						found += uuidMap.find(uuid) != uuidMap.end();
+					return found;
+				});
+
+			Measure(result, "Iterate/" + mapName, samples, [&]()
+				{
+					uint64_t sum = 0;
+					for (auto& [uuid, value] : uuidMap)
+						sum += value;
+					return sum;
+				});
+
+			StringMap stringMap;
+			for (const std::string& name : names)
+				stringMap[name] = static_cast<uint32_t>(name.size());
+
+			Measure(result, "FindString/" + mapName, samples, [&]()
+				{
+					uint64_t sum = 0;
+					for (const std::string& name : names)
+						sum += stringMap.find(std::string_view(name))->second;
+					return sum;
+				});
+		}
+
+		void RunHashMap(const GeneratorSettings& settings, uint32_t samples, ScenarioResult& result)
+		{
+			std::mt19937_64 rng(settings.mSeed);
+			std::vector<UUID> hits(settings.mCount), misses(settings.mCount);
+			for (UUID& uuid : hits)
+				uuid = rng();
+			for (UUID& uuid : misses)
+				uuid = rng();
+
+			// Names like the fields of a script class, looked up in a different order than inserted
+			std::vector<std::string> names;
+			names.reserve(settings.mCount);
+			for (uint32_t i = 0; i < settings.mCount; ++i)
+				names.push_back("Field" + std::to_string(rng() % 1000000) + "_" + std::to_string(i));
+			std::shuffle(names.begin(), names.end(), rng);
+
+			result.mEntityCount = settings.mCount;
+			MeasureMap<std::unordered_map<UUID, uint32_t>, std::unordered_map<std::string, uint32_t, StringHash, std::equal_to<>>>(result, "std::unordered_map", samples, hits, misses, names);
+			MeasureMap<FlatHashMap<UUID, uint32_t>, FlatHashMap<std::string, uint32_t, StringHash, std::equal_to<>>>(result, "FlatHashMap", samples, hits, misses, names);
+
+			auto mean = [&result](const std::string& name) { return result.mSystems[name].mMean; };
+			APP_LOG_INFO("HashMap: find {:.3f}ms against {:.3f}ms, iterate {:.3f}ms against {:.3f}ms for FlatHashMap and std::unordered_map",
+				mean("FindHit/FlatHashMap"), mean("FindHit/std::unordered_map"), mean("Iterate/FlatHashMap"), mean("Iterate/std::unordered_map"));
+		}
+
+		// The scene has no parenting of its own, so the hierarchy lives beside the engine's transforms
+		struct ParentComponent
+		{
+			entt::entity Parent = entt::null;
+			uint32_t Depth = 0;
+		};
+
+		struct WorldTransformComponent
+		{
+			glm::mat4 Transform{ 1.f };
+		};
+
+		/*!***********************************************************************
+			\brief
+				Times resolving the world transforms of chains of entities, by
+				walking up to the root from every entity, and in one pass over
+				the entities sorted parents first
+		*************************************************************************/
+		void RunTransformHierarchy(const GeneratorSettings& settings, uint32_t samples, ScenarioResult& result)
+		{
+			std::mt19937_64 rng(settings.mSeed);
+			std::uniform_real_distribution<float> offset(-1.f, 1.f);
+			std::uniform_real_distribution<float> angle(-30.f, 30.f);
+
+			entt::registry registry;
+			uint32_t depth = std::max(settings.mHierarchyDepth, 1u);
+			entt::entity parent = entt::null;
+			for (uint32_t i = 0; i < settings.mCount; ++i)
+			{
+				uint32_t level = i % depth;
+				if (level == 0)
+					parent = entt::null;
+
+				entt::entity entity = registry.create();
+				TransformComponent& transform = registry.emplace<TransformComponent>(entity);
+				transform.Translate = { offset(rng), offset(rng), offset(rng) };
+				transform.Rotation = { angle(rng), angle(rng), angle(rng) };
+				registry.emplace<ParentComponent>(entity, parent, level);
+				registry.emplace<WorldTransformComponent>(entity);
+				parent = entity;
+			}
+
+			// Shuffled so the walk order does not follow creation order, as after edits in a real scene
+			std::vector<uint32_t> rank(settings.mCount);
+			for (uint32_t i = 0; i < settings.mCount; ++i)
+				rank[i] = i;
+			std::shuffle(rank.begin(), rank.end(), rng);
+			registry.sort<ParentComponent>([&rank](entt::entity lhs, entt::entity rhs) { return rank[entt::to_entity(lhs)] < rank[entt::to_entity(rhs)]; });
+
+			result.mEntityCount = settings.mCount;
+			Measure(result, "Resolve/WalkToRoot", samples, [&]()
+				{
+					uint64_t sum = 0;
+					for (auto [entity, link, world] : registry.view<ParentComponent, WorldTransformComponent>().each())
+					{
+						glm::mat4 transform = registry.get<TransformComponent>(entity).GetTransform();
+						for (entt::entity ancestor = link.Parent; ancestor != entt::null; ancestor = registry.get<ParentComponent>(ancestor).Parent)
+							transform = registry.get<TransformComponent>(ancestor).GetTransform() * transform;
+						world.Transform = transform;
+						sum += static_cast<uint64_t>(std::abs(transform[3][0]));
+					}
+					return sum;
+				});
+
+			// Parents first, so every parent is resolved before its children read it
+			registry.sort<ParentComponent>([](const ParentComponent& lhs, const ParentComponent& rhs) { return lhs.Depth < rhs.Depth; });
+			Measure(result, "Resolve/ParentsFirst", samples, [&]()
+				{
+					uint64_t sum = 0;
+					for (auto [entity, link] : registry.view<ParentComponent>().each())
+					{
+						glm::mat4 transform = registry.get<TransformComponent>(entity).GetTransform();
+						if (link.Parent != entt::null)
+							transform = registry.get<WorldTransformComponent>(link.Parent).Transform * transform;
+						registry.get<WorldTransformComponent>(entity).Transform = transform;
+						sum += static_cast<uint64_t>(std::abs(transform[3][0]));
+					}
+					return sum;
+				});
+
+			auto mean = [&result](const std::string& name) { return result.mSystems[name].mMean; };
+			APP_LOG_INFO("TransformHierarchy: {:.3f}ms parents first against {:.3f}ms walking to the root, depth {}",
+				mean("Resolve/ParentsFirst"), mean("Resolve/WalkToRoot"), depth);
+		}
+	}
+
+	const std::vector<MicroBenchmark>& GetMicroBenchmarks()
+	{
+		static const std::vector<MicroBenchmark> benchmarks =
+		{
+			{ "HashMap", RunHashMap },
+			{ "TransformHierarchy", RunTransformHierarchy }
+		};
+		return benchmarks;
+	}
+}
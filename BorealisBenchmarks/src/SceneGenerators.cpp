@@ -0,0 +1,236 @@
+/******************************************************************************
+/*!
+\file       SceneGenerators.cpp
+\author     Chua Zheng Yang
+\par        email: c.zhengyang@digipen.edu
+\date       October 19, 2024
+\brief      Defines the seeded scene generators used by the benchmarks
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#include <random>
+#include <SceneGenerators.hpp>
+#include <AI/BehaviourTree/BehaviourTree.hpp>
+#include <AI/BehaviourTree/RegisterNodes.hpp>
+#include <Assets/AssetManager.hpp>
+#include <Graphics/Model.hpp>
+#include <Graphics/Material.hpp>
+
+namespace BorealisBenchmarks
+{
+	namespace
+	{
+		using namespace Borealis;
+
+		/*!***********************************************************************
+			\brief
+				Creates an entity with a UUID drawn from the generator, so the
+				scene and its serialised form are identical between runs
+		*************************************************************************/
+		Entity CreateEntity(const Ref<Scene>& scene, std::mt19937_64& rng, const std::string& name)
+		{
+			return scene->CreateEntityWithUUID(name, rng());
+		}
+
+		glm::vec3 RandomPosition(std::mt19937_64& rng, float extent)
+		{
+			std::uniform_real_distribution<float> dist(-extent, extent);
+			return { dist(rng), dist(rng), dist(rng) };
+		}
+
+		glm::vec4 RandomColour(std::mt19937_64& rng)
+		{
+			std::uniform_real_distribution<float> dist(0.f, 1.f);
+			return { dist(rng), dist(rng), dist(rng), 1.f };
+		}
+
+		void AddCamera(const Ref<Scene>& scene, std::mt19937_64& rng)
+		{
+			Entity camera = CreateEntity(scene, rng, "Camera");
+			camera.GetComponent<TransformComponent>().Translate = { 0.f, 0.f, 10.f };
+			auto& cameraComponent = camera.AddComponent<CameraComponent>();
+			cameraComponent.Primary = true;
+			cameraComponent.Camera.SetViewportSize(1920, 1080);
+		}
+
+		Ref<Model> CreateCube()
+		{
+			static const glm::vec3 normals[6] = { {1,0,0}, {-1,0,0}, {0,1,0}, {0,-1,0}, {0,0,1}, {0,0,-1} };
+
+			std::vector<Vertex> vertices;
+			std::vector<unsigned int> indices;
+			for (const glm::vec3& normal : normals)
+			{
+				glm::vec3 tangent = normal.x != 0.f ? glm::vec3(0, 1, 0) : glm::vec3(1, 0, 0);
+				glm::vec3 bitangent = glm::cross(normal, tangent);
+				unsigned int base = static_cast<unsigned int>(vertices.size());
+
+				vertices.push_back({ (normal - tangent - bitangent) * 0.5f, normal, { 0.f, 0.f } });
+				vertices.push_back({ (normal + tangent - bitangent) * 0.5f, normal, { 1.f, 0.f } });
+				vertices.push_back({ (normal + tangent + bitangent) * 0.5f, normal, { 1.f, 1.f } });
+				vertices.push_back({ (normal - tangent + bitangent) * 0.5f, normal, { 0.f, 1.f } });
+				indices.insert(indices.end(), { base, base + 1, base + 2, base + 2, base + 3, base });
+			}
+
+			Ref<Model> model = MakeRef<Model>();
+			model->mMeshes.emplace_back(vertices, indices);
+			return model;
+		}
+
+		bool GenerateSprites(const Ref<Scene>& scene, const GeneratorSettings& settings)
+		{
+			std::mt19937_64 rng(settings.mSeed);
+			AddCamera(scene, rng);
+
+			std::uniform_int_distribution<int> layer(0, 9);
+			for (uint32_t i = 0; i < settings.mCount; ++i)
+			{
+				Entity entity = CreateEntity(scene, rng, "Sprite");
+				glm::vec3 position = RandomPosition(rng, 100.f);
+				position.z = layer(rng) * 0.1f;
+				entity.GetComponent<TransformComponent>().Translate = position;
+				entity.AddComponent<SpriteRendererComponent>(RandomColour(rng));
+			}
+			return true;
+		}
+
+		bool GenerateMeshes(const Ref<Scene>& scene, const GeneratorSettings& settings)
+		{
+			std::mt19937_64 rng(settings.mSeed);
+			AddCamera(scene, rng);
+
+			Entity light = CreateEntity(scene, rng, "Light");
+			light.AddComponent<LightComponent>();
+
+			// Registered in memory under seeded handles, so the serialised scene loads them back
+			Ref<Model> cube = CreateCube();
+			cube->mAssetHandle = rng();
+			cube->mAssetType = AssetType::Mesh;
+			AssetManager::AddMemoryAsset(cube, "BenchmarkCube");
+
+			Ref<Shader> shader = Shader::Create("engineResources/Shaders/Renderer3D_Material.glsl");
+			std::vector<Ref<Material>> materials;
+			for (uint32_t i = 0; i < std::max(settings.mMaterialCount, 1u); ++i)
+			{
+				Ref<Material> material = MakeRef<Material>(shader);
+				material->SetTextureMapColor(Material::Albedo, RandomColour(rng));
+				material->mAssetHandle = rng();
+				material->mAssetType = AssetType::Material;
+				AssetManager::AddMemoryAsset(material, "BenchmarkMaterial" + std::to_string(i));
+				materials.push_back(material);
+			}
+
+			std::uniform_int_distribution<size_t> pick(0, materials.size() - 1);
+			for (uint32_t i = 0; i < settings.mCount; ++i)
+			{
+				Entity entity = CreateEntity(scene, rng, "Mesh");
+				entity.GetComponent<TransformComponent>().Translate = RandomPosition(rng, 100.f);
+				entity.AddComponent<MeshFilterComponent>().Model = cube;
+				entity.AddComponent<MeshRendererComponent>().Material = materials[pick(rng)];
+			}
+			return true;
+		}
+
+		bool GenerateParticles(const Ref<Scene>& scene, const GeneratorSettings& settings)
+		{
+			static constexpr uint32_t sParticleCount = 1000000;
+
+			std::mt19937_64 rng(settings.mSeed);
+			AddCamera(scene, rng);
+
+			// Each particle lives a second and a second's worth is emitted, so the system stays near full
+			Entity emitter = CreateEntity(scene, rng, "Emitter");
+			auto& particles = emitter.AddComponent<ParticleSystemComponent>();
+			particles.MaxParticles = sParticleCount;
+			particles.EmitRate = static_cast<float>(sParticleCount);
+			particles.Props.Velocity = { 0.f, 2.f, 0.f };
+			particles.Props.VelocityVariation = { 4.f, 4.f, 4.f };
+			particles.Props.ColourBegin = RandomColour(rng);
+			particles.Props.ColourEnd = { 1.f, 1.f, 1.f, 0.f };
+			particles.Props.SizeBegin = 0.1f;
+			particles.Props.SizeVariation = 0.05f;
+			particles.Props.LifeTime = 1.f;
+			return true;
+		}
+
+		bool GenerateRigidBodies(const Ref<Scene>& scene, const GeneratorSettings& settings)
+		{
+			std::mt19937_64 rng(settings.mSeed);
+			AddCamera(scene, rng);
+
+			// Bodies start in a column above the origin so they collide on the way down
+			std::uniform_real_distribution<float> height(5.f, 200.f);
+			for (uint32_t i = 0; i < settings.mCount; ++i)
+			{
+				Entity entity = CreateEntity(scene, rng, "RigidBody");
+				glm::vec3 position = RandomPosition(rng, 20.f);
+				position.y = height(rng);
+				entity.GetComponent<TransformComponent>().Translate = position;
+				entity.AddComponent<RigidBodyComponent>();
+			}
+			return true;
+		}
+
+		bool GenerateScripts(const Ref<Scene>& scene, const GeneratorSettings& settings)
+		{
+			auto& classes = ScriptingSystem::mScriptClasses;
+			auto klass = classes.find(settings.mScriptClass);
+			if (settings.mScriptClass.empty() || klass == classes.end() || !klass->second)
+			{
+				APP_LOG_WARN("Script class '{}' is not loaded, pass --project and --script to run the scripts scenario", settings.mScriptClass);
+				return false;
+			}
+
+			std::mt19937_64 rng(settings.mSeed);
+			AddCamera(scene, rng);
+
+			for (uint32_t i = 0; i < settings.mCount; ++i)
+			{
+				Entity entity = CreateEntity(scene, rng, "Scripted");
+				entity.GetComponent<TransformComponent>().Translate = RandomPosition(rng, 100.f);
+				entity.AddComponent<ScriptComponent>().AddScript(settings.mScriptClass, MakeRef<ScriptInstance>(klass->second));
+			}
+			return true;
+		}
+
+		bool GenerateBehaviourTrees(const Ref<Scene>& scene, const GeneratorSettings& settings)
+		{
+			std::mt19937_64 rng(settings.mSeed);
+			AddCamera(scene, rng);
+
+			for (uint32_t i = 0; i < settings.mCount; ++i)
+			{
+				Entity entity = CreateEntity(scene, rng, "Agent");
+				entity.GetComponent<TransformComponent>().Translate = RandomPosition(rng, 100.f);
+
+				// Nodes keep their own state, so every agent gets its own tree
+				Ref<BehaviourTree> tree = MakeRef<BehaviourTree>();
+				Ref<BehaviourNode> root = NodeFactory::CreateNodeByName("C_Sequencer");
+				tree->AddNode(nullptr, root, 0);
+				tree->AddNode(root, NodeFactory::CreateNodeByName("L_Idle"), 1);
+				tree->AddNode(root, NodeFactory::CreateNodeByName("L_Idle"), 1);
+				entity.AddComponent<BehaviourTreeComponent>().AddTree(tree);
+			}
+			return true;
+		}
+	}
+
+	const std::vector<Scenario>& GetScenarios()
+	{
+		static const std::vector<Scenario> scenarios =
+		{
+			// Scripts run user C# that may allocate on its own, so only the engine scenes must stay allocation free
+			{ "Sprites", GenerateSprites, true, true },
+			{ "Meshes", GenerateMeshes, true, true },
+			{ "Particles", GenerateParticles, true, true },
+			{ "RigidBodies", GenerateRigidBodies, true, true },
+			{ "Scripts", GenerateScripts, true, false },
+			{ "BehaviourTrees", GenerateBehaviourTrees, true, true }
+		};
+		return scenarios;
+	}
+}
@@ -7,9 +7,12 @@ layout(location = 2) in vec2 a_TexCoord;
 layout(location = 3) in vec3 a_Tangent;
 layout(location = 4) in vec3 a_Bitangent;
 
-uniform mat4 u_ModelTransform;
+// Per draw data, one instance per draw of a batch
+layout(location = 5) in mat4 a_ModelTransform;
+layout(location = 9) in int a_EntityID;
+layout(location = 10) in float a_LodFade;
+
 uniform mat4 u_ViewProjection;
-uniform int u_EntityID;
 
 out vec2 v_TexCoord;
 out vec3 v_FragPos;
@@ -17,16 +20,17 @@ out vec3 v_Tangent;
 out vec3 v_Bitangent;
 out vec3 v_Normal;
 flat out int v_EntityID;
+flat out float v_LodFade;
 
 void main()
 {
 	//v_TexCoord = a_TexCoord;
 	v_TexCoord = vec2(a_TexCoord.x, 1.0 - a_TexCoord.y);
 
-	v_FragPos = vec3(u_ModelTransform * vec4(a_Position, 1.0));
-	//v_Normal = mat3(transpose(inverse(u_ModelTransform))) * a_Normal;
+	v_FragPos = vec3(a_ModelTransform * vec4(a_Position, 1.0));
+	//v_Normal = mat3(transpose(inverse(a_ModelTransform))) * a_Normal;
 	
-	mat3 normalMatrix = transpose(inverse(mat3(u_ModelTransform)));
+	mat3 normalMatrix = transpose(inverse(mat3(a_ModelTransform)));
     vec3 N = normalize(normalMatrix * a_Normal);
     vec3 T = normalize(normalMatrix * a_Tangent);
     T = normalize(T - dot(T, N) * N); // Gram-Schmidt orthogonalization
@@ -37,7 +41,8 @@ void main()
     v_Bitangent = B;
 
 	gl_Position = u_ViewProjection * vec4(v_FragPos, 1.0);	
-	v_EntityID = u_EntityID;
+	v_EntityID = a_EntityID;
+	v_LodFade = a_LodFade;
 }
 
 #type fragment
@@ -46,33 +51,31 @@ void main()
 layout(location = 0) out vec4 fragColor;
 layout(location = 1) out int entityIDs;
 
-struct Material {
+// Samplers cannot live in a uniform block, each map sits on the texture unit of
+// its Material::TextureMaps value
+struct MaterialMaps {
 	sampler2D albedoMap;
 	sampler2D specularMap;
 	sampler2D metallicMap;
 	sampler2D normalMap;
-	sampler2D heightMap;
-	sampler2D occlusionMap;
-	sampler2D detailMaskMap;
 	sampler2D emissionMap;
+};
 
-	vec4 albedoColor;    
-	vec4 specularColor;   
-	vec4 emissionColor;     
+// One std140 block per material in the material buffer, matches MaterialBuffer::Parameters
+layout(std140) uniform MaterialBlock {
+	vec4 albedoColor;
+	vec4 specularColor;
+	vec4 emissionColor;
 
 	vec2 tiling;
 	vec2 offset;
 	float smoothness;
 	float shininess;
 	float metallic;
+} u_Material;
 
-	bool hasAlbedoMap;
-    bool hasSpecularMap;
-    bool hasNormalMap;
-	bool hasMetallicMap;
-    bool hasEmissionMap;
-	bool hasHeightMap;
-};
+// Texture maps are selected per variant with HAS_ALBEDO_MAP, HAS_SPECULAR_MAP,
+// HAS_METALLIC_MAP, HAS_EMISSION_MAP and HAS_NORMAL_MAP, not at runtime
 
 struct Light {
 	int type; // 0 = Spotlight, 1 = Directional , 2 = Point
@@ -99,11 +102,26 @@ in vec3 v_Bitangent;
 
 uniform mat4 u_ViewProjection;
 uniform vec3 u_ViewPos;
-uniform Material u_Material;
+uniform MaterialMaps u_MaterialMaps;
 uniform Light u_Light;
 			
 uniform sampler2D u_Texture;
 
+// Level of detail cross fade, > 0 draws that fraction of the pixels, < 0 the
+// rest of them, 0 draws everything
+flat in float v_LodFade;
+
+float Dither4x4(vec2 position)
+{
+    const float bayer[16] = float[16](
+        0.0,  8.0,  2.0, 10.0,
+        12.0, 4.0, 14.0,  6.0,
+        3.0, 11.0,  1.0,  9.0,
+        15.0, 7.0, 13.0,  5.0);
+    ivec2 cell = ivec2(mod(position, 4.0));
+    return (bayer[cell.y * 4 + cell.x] + 0.5) / 16.0;
+}
+
 vec2 GetTexCoord() 
 {
 	return v_TexCoord * u_Material.tiling + u_Material.offset;
@@ -111,27 +129,38 @@ vec2 GetTexCoord()
 
 vec4 GetAlbedoColor()
 {
-	vec4 albedoColor = u_Material.hasAlbedoMap ? texture(u_Material.albedoMap, GetTexCoord()) : u_Material.albedoColor;
-	if (u_Material.hasAlbedoMap) {
-		albedoColor = mix(u_Material.albedoColor, albedoColor, 0.8);
-	}
-
-	return albedoColor;
+#ifdef HAS_ALBEDO_MAP
+	return mix(u_Material.albedoColor, texture(u_MaterialMaps.albedoMap, GetTexCoord()), 0.8);
+#else
+	return u_Material.albedoColor;
+#endif
 }
 
 vec3 GetSpecular()
 {
-	return u_Material.hasSpecularMap ? texture(u_Material.specularMap, GetTexCoord()).rgb : u_Material.specularColor.rgb;
+#ifdef HAS_SPECULAR_MAP
+	return texture(u_MaterialMaps.specularMap, GetTexCoord()).rgb;
+#else
+	return u_Material.specularColor.rgb;
+#endif
 }
 
 float GetMetallic() 
 {
-	return u_Material.hasMetallicMap ? texture(u_Material.metallicMap, GetTexCoord()).r : u_Material.metallic;
+#ifdef HAS_METALLIC_MAP
+	return texture(u_MaterialMaps.metallicMap, GetTexCoord()).r;
+#else
+	return u_Material.metallic;
+#endif
 }
 
 vec3 GetEmission()
 {
-	return u_Material.hasEmissionMap ? texture(u_Material.emissionMap, GetTexCoord()).rgb : u_Material.emissionColor.rgb;
+#ifdef HAS_EMISSION_MAP
+	return texture(u_MaterialMaps.emissionMap, GetTexCoord()).rgb;
+#else
+	return u_Material.emissionColor.rgb;
+#endif
 }
 
 vec3 ComputeDirectionalLight(vec3 normal, vec3 viewDir) 
@@ -227,22 +256,27 @@ vec3 ComputeSpotLight(vec3 normal, vec3 viewDir)
 }
 
 void main() {
+	if (v_LodFade != 0.0)
+	{
+		float dither = Dither4x4(gl_FragCoord.xy);
+		if (v_LodFade > 0.0 ? dither >= v_LodFade : dither < -v_LodFade)
+			discard;
+	}
+
 	vec3 viewDir = normalize(u_ViewPos - v_FragPos);
 
+#ifdef HAS_NORMAL_MAP
 	mat3 TBN = mat3(v_Tangent, v_Bitangent, v_Normal);
-	vec3 normal;
-    if (u_Material.hasNormalMap) 
-    {
-        // Sample normal map in tangent space
-        vec3 tangentNormal = texture(u_Material.normalMap, GetTexCoord()).rgb;
-        tangentNormal = tangentNormal * 2.0 - 1.0;  // Convert from [0, 1] to [-1, 1]
-        // Transform to world space
-        normal = normalize(TBN * tangentNormal);
-    }
-    else
-    {
-        normal = normalize(v_Normal);
-    }
+    // Sample normal map in tangent space
+    // Normal maps are BC5 and only store X and Y, rebuild Z
+    vec3 tangentNormal;
+    tangentNormal.xy = texture(u_MaterialMaps.normalMap, GetTexCoord()).rg * 2.0 - 1.0;  // Convert from [0, 1] to [-1, 1]
+    tangentNormal.z = sqrt(max(1.0 - dot(tangentNormal.xy, tangentNormal.xy), 0.0));
+    // Transform to world space
+    vec3 normal = normalize(TBN * tangentNormal);
+#else
+    vec3 normal = normalize(v_Normal);
+#endif
 
 	vec4 color;
 	if (u_Light.type == 0) 
@@ -0,0 +1,58 @@
+#type vertex
+#version 410 core
+			
+layout(location = 0) in vec3 a_Position;
+layout(location = 1) in vec3 a_AxisX;
+layout(location = 2) in vec3 a_AxisY;
+layout(location = 3) in vec4 a_UVRect;
+layout(location = 4) in vec4 a_Color;
+layout(location = 5) in int a_TexIndex;
+layout(location = 6) in float a_TexLayer;
+layout(location = 7) in float a_TilingFactor;
+layout(location = 8) in int a_EntityID;
+
+uniform mat4 u_ViewProjection;
+
+// Two triangles per instance, corners of the unit quad in 0 1 2 2 3 0 order
+const vec2 c_Corners[6] = vec2[](vec2(0.0, 0.0), vec2(1.0, 0.0), vec2(1.0, 1.0), vec2(1.0, 1.0), vec2(0.0, 1.0), vec2(0.0, 0.0));
+
+out vec2 v_TexCoord;
+out vec4 v_Color;
+flat out int v_TexIndex;
+flat out float v_TexLayer;
+out float v_TilingFactor;
+flat out int v_EntityID;
+
+void main()
+{
+	vec2 corner = c_Corners[gl_VertexID];
+	vec3 position = a_Position + a_AxisX * (corner.x - 0.5) + a_AxisY * (corner.y - 0.5);
+
+	v_Color = a_Color;
+	v_TexCoord = mix(a_UVRect.xy, a_UVRect.zw, corner);
+	v_TexIndex = a_TexIndex;
+	v_TexLayer = a_TexLayer;
+	v_TilingFactor = a_TilingFactor;
+	v_EntityID = a_EntityID;
+	gl_Position = u_ViewProjection * vec4(position, 1.0);	
+}
+
+#type fragment
+#version 410 core			
+layout(location = 0) out vec4 color;
+layout(location = 1) out int entityIDs;
+
+in vec2 v_TexCoord;
+in vec4 v_Color;
+flat in int v_TexIndex;
+flat in float v_TexLayer;
+in float v_TilingFactor;
+flat in int v_EntityID;
+			
+uniform sampler2DArray u_TextureArrays[16];
+
+void main()
+{
+	color = texture(u_TextureArrays[v_TexIndex], vec3(v_TexCoord * v_TilingFactor, v_TexLayer)) * v_Color;
+	entityIDs = v_EntityID;
+}
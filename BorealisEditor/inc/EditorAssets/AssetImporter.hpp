@@ -39,6 +39,13 @@ namespace Borealis
 		*************************************************************************/
 		static AssetHandle GetAssetHandle(std::filesystem::path const& path);
 
+		/*!***********************************************************************
+			\brief
+				Save changed import settings and run the asset through the
+				compiler again. Already loaded assets keep the old import.
+		*************************************************************************/
+		static void ReimportAsset(AssetMetaData const& metaData);
+
 		//TEMP
 		static void InsertAssetHandle(std::filesystem::path const& path, AssetHandle handle);
 
@@ -16,6 +16,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #define MetaSerializer_HPP
 
 #include <Assets/AssetMetaData.hpp>
+#include <Assets/EditorAssetManager.hpp>
 
 namespace Borealis
 {
@@ -40,17 +41,23 @@ namespace Borealis
 		*************************************************************************/
 		static AssetMetaData CreateAssetMetaFile(std::filesystem::path const& path);
 
+		/*!***********************************************************************
+			\brief
+				write meta data back to the meta file of its asset
+		*************************************************************************/
+		static void SaveMetaFile(AssetMetaData const& metaData);
+
 		/*!***********************************************************************
 			\brief
 				serialize registry
 		*************************************************************************/
-		static void SerialzeRegistry(std::filesystem::path assetRegistryPath, std::unordered_map<AssetHandle, AssetMetaData> const& assetRegistry);
+		static void SerialzeRegistry(std::filesystem::path assetRegistryPath, AssetRegistry const& assetRegistry);
 
 		/*!***********************************************************************
 			\brief
 				deserialize registry
 		*************************************************************************/
-		static void DeserializeRegistry(std::string const& registryFileString, std::unordered_map<AssetHandle, AssetMetaData>& AssetRegistry);
+		static void DeserializeRegistry(std::string const& registryFileString, AssetRegistry& assetRegistry);
 
 	private:
 		static void SaveAsFile(const std::filesystem::path& path, const char* outputFile);
@@ -19,6 +19,8 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <Borealis.hpp>
 #include <Panels/SceneHierarchyPanel.hpp>
 #include <Panels/ContentBrowserPanel.hpp>
+#include <Panels/ProfilerPanel.hpp>
+#include <Panels/MemoryPanel.hpp>
 #include <Graphics/EditorCamera.hpp>
 #include <EditorAssets/AssetImporter.hpp>
 namespace Borealis {
@@ -200,12 +202,25 @@ namespace Borealis {
 		*************************************************************************/
 		void UIToolbar();
 
+		/*!***********************************************************************
+			\brief
+				Turns a value read back from the entity ID attachment into an
+				entity of the active scene. Reads land a frame or two late, so
+				the entity may have been destroyed or the scene changed since.
+			\param[in] pickedID
+				Value read back
+			\return
+				The entity, or a null entity if it is no longer valid
+		*************************************************************************/
+		Entity GetPickedEntity(int pickedID) const;
+
 
 		OrthographicCameraController mCamera;
 		Ref<Texture2D> mTexture;
 		Ref<SubTexture2D> mSubTexture;
 		Ref<FrameBuffer> mViewportFrameBuffer;
 		Ref<FrameBuffer> mRuntimeFrameBuffer;
+		Scope<PickingService> mPicking;
 		Ref<Scene> mEditorScene;
 
 		glm::vec2 mViewportSize = { 0.0f, 0.0f };
@@ -219,6 +234,9 @@ namespace Borealis {
 
 		Entity mRuntimeCamera;
 		Entity mHoveredEntity;
+		std::vector<int> mBoxSelection;		// Entity IDs of the last marquee read
+		glm::ivec2 mBoxStart{ 0, 0 };		// Viewport pixel the marquee started at
+		bool mBoxSelecting = false;
 		
 		int mGizmoType = -1;
 		float imGuizmoClipSpace = 0.1f;
@@ -226,6 +244,8 @@ namespace Borealis {
 		EditorCamera mEditorCamera;
 		SceneHierarchyPanel SCPanel;
 		ContentBrowserPanel CBPanel;
+		ProfilerPanel PFPanel;
+		MemoryPanel MMPanel;
 		bool mLightMode = true;
 
 		float mLineThickness = 1.0f;
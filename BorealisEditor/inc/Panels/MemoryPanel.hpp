@@ -0,0 +1,32 @@
+/******************************************************************************/
+/*!
+\file		MemoryPanel.hpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Declares the class Memory Panel in Level Editor, which shows the
+			memory tracker counters and budgets of each subsystem
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ *
+ /******************************************************************************/
+
+#ifndef MEMORY_PANEL_HPP
+#define MEMORY_PANEL_HPP
+
+namespace Borealis
+{
+	class MemoryPanel
+	{
+	public:
+		/*!***********************************************************************
+			\brief
+				Render the Memory Panel
+		*************************************************************************/
+		void ImGuiRender();
+	};
+}
+
+#endif
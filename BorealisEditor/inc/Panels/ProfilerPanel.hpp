@@ -0,0 +1,56 @@
+/******************************************************************************/
+/*!
+\file		ProfilerPanel.hpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Declares the class Profiler Panel in Level Editor, which shows the
+			frames kept by the frame profiler as a timeline
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ *
+ /******************************************************************************/
+
+#ifndef PROFILER_PANEL_HPP
+#define PROFILER_PANEL_HPP
+#include <vector>
+#include <Debugging/FrameProfiler.hpp>
+
+namespace Borealis
+{
+	class ProfilerPanel
+	{
+	public:
+		/*!***********************************************************************
+			\brief
+				Render the Profiler Panel
+		*************************************************************************/
+		void ImGuiRender();
+
+	private:
+		/*!***********************************************************************
+			\brief
+				Draws the zones of a frame, one lane per thread and one row per
+				nesting depth
+			\param[in] frame
+				Frame to draw
+		*************************************************************************/
+		void DrawTimeline(const ProfiledFrame& frame);
+
+		/*!***********************************************************************
+			\brief
+				Lists the zones of a frame by total time, and its counters
+			\param[in] frame
+				Frame to list
+		*************************************************************************/
+		void DrawSummary(const ProfiledFrame& frame);
+
+		std::vector<ProfiledFrame> mFrames;
+		int mSelectedFrame = -1;	//!< Index into mFrames, -1 follows the newest frame
+		char mTracePath[256] = "BorealisTrace.json";
+	};
+}
+
+#endif
@@ -65,7 +65,20 @@ namespace Borealis {
 			\param[in] entity
 				The entity to be set as selected
 		*************************************************************************/
-		void SetSelectedEntity(const Entity& entity) { mSelectedEntity = entity; }
+		void SetSelectedEntity(const Entity& entity) { mSelectedEntity = entity; mSelectedEntities.clear(); }
+
+		/*!***********************************************************************
+			\brief
+				Sets the entities picked by a marquee. The first one is shown in
+				the inspector and the gizmo, the rest are highlighted.
+			\param[in] entities
+				The entities to be set as selected
+		*************************************************************************/
+		void SetSelectedEntities(const std::vector<Entity>& entities)
+		{
+			mSelectedEntities = entities;
+			mSelectedEntity = entities.empty() ? Entity{} : entities.front();
+		}
 	private:
 
 		/*!***********************************************************************
@@ -85,6 +98,7 @@ namespace Borealis {
 		void DrawComponents(Entity entity);
 		Ref<Scene> mContext;
 		Entity mSelectedEntity;
+		std::vector<Entity> mSelectedEntities; //!< Marquee selection, empty after a single pick
 	};
 }
 
@@ -39,7 +39,7 @@ namespace Borealis
 	};
 
 
-	ApplicationManager* CreateApplication()
+	ApplicationManager* CreateApplication(ApplicationCommandLineArgs args)
 	{
 		return new LevelEditor();
 	}
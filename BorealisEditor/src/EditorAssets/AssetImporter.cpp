@@ -83,6 +83,7 @@ namespace Borealis
 		case AssetType::Mesh:
 		case AssetType::Texture2D:
 		case AssetType::Font:
+		case AssetType::Audio:
 			imported = ImportAssetTEMP(meta);
 			metaPath = path;
 			meta = MetaFileSerializer::GetAssetMetaDataFile(metaPath.replace_extension(".meta"));
@@ -142,6 +143,20 @@ namespace Borealis
 		return false;
 	}
 
+	void AssetImporter::ReimportAsset(AssetMetaData const& metaData)
+	{
+		// The compiler reads its settings from the meta file and writes the result back into it
+		MetaFileSerializer::SaveMetaFile(metaData);
+		ImportAssetTEMP(metaData);
+
+		std::filesystem::path metaPath = metaData.SourcePath;
+		AssetMetaData imported = MetaFileSerializer::GetAssetMetaDataFile(metaPath.replace_extension(".meta"));
+
+		AssetRegistry& assetRegistry = Project::GetEditorAssetsManager()->GetAssetRegistry();
+		assetRegistry[imported.Handle] = imported;
+		MetaFileSerializer::SerialzeRegistry(mAssetRegistryPathStatic, assetRegistry);
+	}
+
 	void AssetImporter::SerializeRegistry()
 	{
 		MetaFileSerializer::SerialzeRegistry(mAssetRegistryPath, Project::GetEditorAssetsManager()->GetAssetRegistry());
@@ -166,6 +181,7 @@ namespace Borealis
 			case AssetType::Mesh:
 			case AssetType::Texture2D:
 			case AssetType::Font:
+			case AssetType::Audio:
 				imported = ImportAsset(meta);
 				metaPath = path;
 				meta = MetaFileSerializer::GetAssetMetaDataFile(metaPath.replace_extension(".meta"));
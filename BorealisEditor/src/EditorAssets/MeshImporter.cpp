@@ -43,6 +43,7 @@ namespace Borealis
 		//BOREALIS_CORE_TRACE("FBX load from {0}", path);
 		Model model;
 		ProcessNode(scene->mRootNode, scene, model);
+		model.ComputeBounds();
 		return MakeRef<Model>(model);
 	}
 
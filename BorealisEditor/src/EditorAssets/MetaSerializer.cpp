@@ -36,6 +36,31 @@ namespace Borealis
 		out << YAML::Key << "SourcePath" << YAML::Value << std::filesystem::relative(assetMetaData.SourcePath, PathToAssetFolder).string();
 		out << YAML::Key << "CachePath" << YAML::Value << std::filesystem::relative(assetMetaData.CachePath, PathToAssetFolder).string();
 		out << YAML::Key << "LastModifiedDate" << YAML::Value << assetMetaData.importDate;
+		if (assetMetaData.Type == AssetType::Audio)
+		{
+			AudioImportSettings const& settings = assetMetaData.AudioSettings;
+			out << YAML::Key << "AudioSettings" << YAML::Value << YAML::BeginMap;
+			out << YAML::Key << "Format" << YAML::Value << AudioImportSettings::FormatToString(settings.Format);
+			out << YAML::Key << "LoadMode" << YAML::Value << AudioImportSettings::LoadModeToString(settings.LoadMode);
+			out << YAML::Key << "StreamThreshold" << YAML::Value << settings.StreamThreshold;
+			out << YAML::Key << "ForceMono" << YAML::Value << settings.ForceMono;
+			out << YAML::Key << "Streaming" << YAML::Value << settings.Streaming;
+			out << YAML::EndMap;
+		}
+		if (assetMetaData.Type == AssetType::Texture2D)
+		{
+			out << YAML::Key << "TextureSettings" << YAML::Value << YAML::BeginMap;
+			out << YAML::Key << "Usage" << YAML::Value << TextureImportSettings::UsageToString(assetMetaData.TextureSettings.Usage);
+			out << YAML::Key << "GenerateMips" << YAML::Value << assetMetaData.TextureSettings.GenerateMips;
+			out << YAML::EndMap;
+		}
+		if (assetMetaData.Type == AssetType::Mesh)
+		{
+			out << YAML::Key << "MeshSettings" << YAML::Value << YAML::BeginMap;
+			out << YAML::Key << "LodCount" << YAML::Value << assetMetaData.MeshSettings.LodCount;
+			out << YAML::Key << "LodReduction" << YAML::Value << assetMetaData.MeshSettings.LodReduction;
+			out << YAML::EndMap;
+		}
 		out << YAML::EndMap;
 	}
 
@@ -69,6 +94,27 @@ namespace Borealis
 
 		metaData.CachePath = PathToAssetFolder.parent_path() / str;
 		metaData.importDate = node["LastModifiedDate"].as<uint64_t>();
+
+		if (YAML::Node audioSettings = node["AudioSettings"])
+		{
+			metaData.AudioSettings.Format = AudioImportSettings::StringToFormat(audioSettings["Format"].as<std::string>());
+			metaData.AudioSettings.LoadMode = AudioImportSettings::StringToLoadMode(audioSettings["LoadMode"].as<std::string>());
+			metaData.AudioSettings.StreamThreshold = audioSettings["StreamThreshold"].as<float>();
+			metaData.AudioSettings.ForceMono = audioSettings["ForceMono"].as<bool>();
+			metaData.AudioSettings.Streaming = audioSettings["Streaming"].as<bool>();
+		}
+
+		if (YAML::Node textureSettings = node["TextureSettings"])
+		{
+			metaData.TextureSettings.Usage = TextureImportSettings::StringToUsage(textureSettings["Usage"].as<std::string>());
+			metaData.TextureSettings.GenerateMips = textureSettings["GenerateMips"].as<bool>();
+		}
+
+		if (YAML::Node meshSettings = node["MeshSettings"])
+		{
+			metaData.MeshSettings.LodCount = meshSettings["LodCount"].as<uint32_t>();
+			metaData.MeshSettings.LodReduction = meshSettings["LodReduction"].as<float>();
+		}
 		
 		return metaData;
 	}
@@ -115,15 +161,26 @@ namespace Borealis
 		return metaData;
 	}
 
-	void MetaFileSerializer::SerialzeRegistry(std::filesystem::path assetRegistryPath, std::unordered_map<AssetHandle, AssetMetaData> const& assetRegistry)
+	void MetaFileSerializer::SaveMetaFile(AssetMetaData const& metaData)
+	{
+		std::filesystem::path metaFilePath = metaData.SourcePath;
+		metaFilePath.replace_extension(".meta");
+
+		YAML::Emitter out;
+		SerializeMetaFile(out, metaData, PathToAssetFolder);
+
+		SaveAsFile(metaFilePath, out.c_str());
+	}
+
+	void MetaFileSerializer::SerialzeRegistry(std::filesystem::path assetRegistryPath, AssetRegistry const& assetRegistry)
 	{
 		YAML::Emitter out;
 		out << YAML::BeginMap
 			<< YAML::Key << "Assets" << YAML::Value << YAML::BeginSeq;
 
-		for (auto metaData : assetRegistry)
+		for (auto& [handle, metaData] : assetRegistry)
 		{
-			SerializeMetaFile(out, metaData.second, PathToAssetFolder);
+			SerializeMetaFile(out, metaData, PathToAssetFolder);
 		}
 
 		out << YAML::EndSeq
@@ -132,7 +189,7 @@ namespace Borealis
 		SaveAsFile(assetRegistryPath, out.c_str());
 	}
 
-	void MetaFileSerializer::DeserializeRegistry(std::string const& registryFileString, std::unordered_map<AssetHandle, AssetMetaData>& AssetRegistry)
+	void MetaFileSerializer::DeserializeRegistry(std::string const& registryFileString, AssetRegistry& assetRegistry)
 	{
 		YAML::Node registryRoot = YAML::Load(registryFileString);
 
@@ -145,7 +202,7 @@ namespace Borealis
 			{
 				AssetMetaData metaData = DeserializeMetaFile(metaInfo, pathToAssetFolder);
 
-				AssetRegistry.insert({ metaData.Handle, metaData });
+				assetRegistry.insert({ metaData.Handle, metaData });
 			}
 		}
 	}
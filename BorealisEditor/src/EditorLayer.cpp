@@ -63,6 +63,7 @@ namespace Borealis {
 		FrameBufferProperties props{ 1280, 720, false };
 		props.Attachments = { FramebufferTextureFormat::RGBA8,  FramebufferTextureFormat::RedInteger, FramebufferTextureFormat::Depth };
 		mViewportFrameBuffer = FrameBuffer::Create(props);
+		mPicking = PickingService::Create();
 		
 		FrameBufferProperties propsRuntime{ 1280, 720, false };
 		propsRuntime.Attachments = { FramebufferTextureFormat::RGBA8, FramebufferTextureFormat::RedInteger,FramebufferTextureFormat::Depth };
@@ -124,8 +125,6 @@ namespace Borealis {
 			mEditorCamera.UpdateFn(dt);
 		}
 
-
-		Renderer2D::ResetStats();
 		{
 			PROFILE_SCOPE("Renderer::Prep");
 			mViewportFrameBuffer->Bind();
@@ -153,19 +152,41 @@ namespace Borealis {
 			int mouseX = (int)mx;
 			int mouseY = (int)my;
 
+			// The hovered entity lags a frame or two behind the mouse, in exchange for never stalling on the read
 			if (mViewportHovered)
 			{
-				if (mViewportFrameBuffer->ReadPixel(1, mouseX, mouseY) != -1)
-				{
-					//int id_ent = mViewportFrameBuffer->ReadPixel(1, mouseX, mouseY);
-					mHoveredEntity = { (entt::entity)mViewportFrameBuffer->ReadPixel(1, mouseX, mouseY), SceneManager::GetActiveScene().get()};
-					//BOREALIS_CORE_INFO("picking id {}", id_ent);
-					//BOREALIS_CORE_INFO("Name : {}", mHoveredEntity.GetName());
-				}
-				else
+				mPicking->QueryPixel(mViewportFrameBuffer, 1, mouseX, mouseY);
+			}
+
+			// Shift dragging in the viewport selects everything inside the marquee when the button is let go
+			bool shiftHeld = InputSystem::IsKeyPressed(Key::LeftShift) || InputSystem::IsKeyPressed(Key::RightShift);
+			if (!mBoxSelecting && mViewportHovered && shiftHeld && InputSystem::IsMouseButtonTriggered(Mouse::ButtonLeft) && !ImGuizmo::IsOver())
+			{
+				mBoxSelecting = true;
+				mBoxStart = { mouseX, mouseY };
+			}
+			else if (mBoxSelecting && !InputSystem::IsMouseButtonPressed(Mouse::ButtonLeft))
+			{
+				mBoxSelecting = false;
+				mPicking->QueryRect(mViewportFrameBuffer, 1, mBoxStart.x, mBoxStart.y, mouseX, mouseY);
+			}
+			mPicking->Update();
+
+			int pickedID;
+			if (mPicking->PollPixel(pickedID) && mViewportHovered)
+			{
+				mHoveredEntity = GetPickedEntity(pickedID);
+			}
+
+			if (mPicking->PollRect(mBoxSelection))
+			{
+				std::vector<Entity> selection;
+				for (int id : mBoxSelection)
 				{
-					mHoveredEntity = {};
+					if (Entity entity = GetPickedEntity(id))
+						selection.push_back(entity);
 				}
+				SCPanel.SetSelectedEntities(selection);
 			}
 			mViewportFrameBuffer->Unbind();
 
@@ -268,12 +289,39 @@ namespace Borealis {
 				float fps = 1.0f / dt;
 				std::string FPSNote = "FPS: " + std::to_string(fps);
 				ImGui::Text(FPSNote.c_str());
-				auto stats = Renderer2D::GetStats();
+				auto stats = Renderer2D::GetLastFrameStats();
 				ImGui::Text("Renderer2D Stats:");
 				ImGui::Text("Draw Calls: %d", stats.DrawCalls);
 				ImGui::Text("Quads: %d", stats.QuadCount);
 				ImGui::Text("Vertices: %d", stats.GetTotalVertexCount());
 				ImGui::Text("Indices: %d", stats.GetTotalIndexCount());
+
+				RenderStatistics renderStats = RendererAPI::GetLastFrameStatistics();
+				ImGui::Text("Renderer Stats:");
+				ImGui::Text("Draw Calls: %u", renderStats.DrawCalls);
+				ImGui::Text("Triangles: %u", renderStats.Triangles);
+				ImGui::Text("State Changes: %u", renderStats.StateChanges);
+				ImGui::Text("Texture Binds: %u", renderStats.TextureBinds);
+				ImGui::Text("State Calls: %u issued, %u skipped", renderStats.StateCallsIssued, renderStats.StateCallsSkipped);
+				ImGui::Text("Uploaded: %.1f KB", renderStats.UploadBytes / 1024.0);
+
+				// GPU timings arrive a few frames late, so compare against the CPU time of the same frame
+				ProfiledFrame gpuFrame;
+				if (FrameProfiler::GetLatestGpuFrame(gpuFrame))
+				{
+					float gpuMs = 0.f;
+					for (const ProfileZoneRecord& zone : gpuFrame.mGpuZones)
+					{
+						if (zone.mDepth == 0)
+							gpuMs += zone.GetMilliseconds();
+					}
+					ImGui::Text("Frame %llu: CPU %.2f ms, GPU %.2f ms (%s bound)", static_cast<unsigned long long>(gpuFrame.mIndex),
+						gpuFrame.GetMilliseconds(), gpuMs, gpuMs > gpuFrame.GetMilliseconds() ? "GPU" : "CPU");
+					for (const ProfileZoneRecord& zone : gpuFrame.mGpuZones)
+					{
+						ImGui::Text("%*s%s: %.3f ms", zone.mDepth * 2 + 2, "", zone.mName, zone.GetMilliseconds());
+					}
+				}
 				if (ImGui::Button("Toggle Light/Dark Mode"))
 				{
 					if (mLightMode)
@@ -290,6 +338,26 @@ namespace Borealis {
 				}
 
 
+				// Saved with the scene, a cell size of 0 loads the scene whole
+				Ref<Scene> activeScene = SceneManager::GetActiveScene();
+				if (activeScene && ImGui::CollapsingHeader("World Partition"))
+				{
+					ImGui::BeginDisabled(mSceneState != SceneState::Edit);
+					WorldPartition::Settings settings = activeScene->GetWorldPartitionSettings();
+					bool changed = ImGui::DragFloat("Cell Size", &settings.mCellSize, 1.f, 0.f, FLT_MAX);
+					changed |= ImGui::DragFloat("Load Radius", &settings.mLoadRadius, 1.f, 0.f, FLT_MAX);
+					uint32_t minEntities = 1;
+					changed |= ImGui::DragScalar("Entities Per Frame", ImGuiDataType_U32, &settings.mEntitiesPerFrame, 1.f, &minEntities);
+					if (changed)
+						activeScene->SetWorldPartitionSettings(settings);
+					ImGui::EndDisabled();
+
+					if (WorldPartition* partition = activeScene->GetWorldPartition())
+						ImGui::Text("Cells: %u loaded of %u", partition->GetLoadedCellCount(), partition->GetCellCount());
+					else if (settings.IsEnabled())
+						ImGui::TextDisabled("Streams when the scene is loaded through the scene loader");
+				}
+
 				// Eventually move this to a separate window
 				if (ImGui::CollapsingHeader("Style Settings"))
 				{
@@ -398,6 +466,8 @@ namespace Borealis {
 
 			SCPanel.ImGuiRender();
 			CBPanel.ImGuiRender();
+			PFPanel.ImGuiRender();
+			MMPanel.ImGuiRender();
 			
 			ImGui::PushStyleVar(ImGuiStyleVar_WindowPadding, ImVec2{ 0,0 });
 			ImGui::Begin("Viewport");
@@ -448,6 +518,13 @@ namespace Borealis {
 				mViewportBounds[0] = { minBound.x, minBound.y };
 				mViewportBounds[1] = { maxBound.x, maxBound.y };
 
+				// The marquee start is in viewport pixels with y up, flip it back to screen space
+				if (mBoxSelecting)
+				{
+					ImVec2 start = { mViewportBounds[0].x + mBoxStart.x, mViewportBounds[1].y - mBoxStart.y };
+					ImGui::GetWindowDrawList()->AddRect(start, ImGui::GetMousePos(), IM_COL32(255, 255, 255, 200));
+				}
+
 				// Gizmo here:
 				Entity selectedEntity = SCPanel.GetSelectedEntity();
 				if (selectedEntity && mGizmoType != -1)
@@ -517,20 +594,31 @@ namespace Borealis {
 		ImGui::End(); // Of Dockspace
 	}
 
+	Entity EditorLayer::GetPickedEntity(int pickedID) const
+	{
+		Scene* scene = SceneManager::GetActiveScene().get();
+		entt::entity handle = static_cast<entt::entity>(pickedID);
+		if (pickedID == -1 || !scene || !scene->GetRegistry().valid(handle))
+			return {};
+
+		return { handle, scene };
+	}
+
 	bool EditorLayer::onMousePressed(EventMouseButtonTriggered& e)
 	{
 		switch (e.GetMouseButton())
 		{
 			case Mouse::ButtonLeft:
 			{
-				if (!(InputSystem::IsKeyPressed(Key::LeftAlt) || InputSystem::IsKeyPressed(Key::RightAlt)))
+				bool modifierHeld = InputSystem::IsKeyPressed(Key::LeftAlt) || InputSystem::IsKeyPressed(Key::RightAlt) ||
+					InputSystem::IsKeyPressed(Key::LeftShift) || InputSystem::IsKeyPressed(Key::RightShift);
+				if (!modifierHeld)
 				{
-					if (mViewportHovered && mHoveredEntity && !ImGuizmo::IsOver())
+					// Revalidated, the scene may have changed since the hover was read
+					Entity hovered = mHoveredEntity ? GetPickedEntity(static_cast<int>(static_cast<entt::entity>(mHoveredEntity))) : Entity{};
+					if (mViewportHovered && hovered && !ImGuizmo::IsOver())
 					{
-						if(mHoveredEntity.IsValid())
-						{
-							SCPanel.SetSelectedEntity(mHoveredEntity);
-						}
+						SCPanel.SetSelectedEntity(hovered);
 					}
 					else if (mViewportHovered && !ImGuizmo::IsOver())
 					{
@@ -0,0 +1,77 @@
+/******************************************************************************/
+/*!
+\file		MemoryPanel.cpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Defines the class Memory Panel in Level Editor
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ *
+ /******************************************************************************/
+#include <algorithm>
+#include <imgui.h>
+#include <Core/MemoryTracker.hpp>
+#include <Panels/MemoryPanel.hpp>
+
+namespace Borealis
+{
+	static constexpr double sMegabyte = 1024.0 * 1024.0;
+
+	void MemoryPanel::ImGuiRender()
+	{
+		ImGui::Begin("Memory");
+
+		MemoryTagStats heap = MemoryTracker::GetHeapStats();
+		ImGui::Text("Heap: %.2f MB live, %.2f MB peak, %llu allocations last frame",
+			heap.LiveBytes / sMegabyte, heap.PeakBytes / sMegabyte, static_cast<unsigned long long>(heap.FrameAllocations));
+
+		ImGuiTableFlags flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingStretchProp;
+		if (ImGui::BeginTable("##MemoryTags", 6, flags))
+		{
+			ImGui::TableSetupColumn("Tag");
+			ImGui::TableSetupColumn("Live (MB)");
+			ImGui::TableSetupColumn("Peak (MB)");
+			ImGui::TableSetupColumn("Allocs / Frame");
+			ImGui::TableSetupColumn("KB / Frame");
+			ImGui::TableSetupColumn("Budget (MB)");
+			ImGui::TableHeadersRow();
+
+			for (int i = 0; i < static_cast<int>(MemoryTag::Count); ++i)
+			{
+				MemoryTag tag = static_cast<MemoryTag>(i);
+				MemoryTagStats stats = MemoryTracker::GetStats(tag);
+				bool overBudget = stats.Budget > 0 && stats.LiveBytes > stats.Budget;
+
+				ImGui::TableNextRow();
+				if (overBudget)
+					ImGui::TableSetBgColor(ImGuiTableBgTarget_RowBg1, ImGui::GetColorU32(ImVec4(0.6f, 0.15f, 0.15f, 0.6f)));
+
+				ImGui::TableNextColumn();
+				ImGui::TextUnformatted(MemoryTracker::GetTagName(tag));
+				ImGui::TableNextColumn();
+				ImGui::Text("%.2f", stats.LiveBytes / sMegabyte);
+				ImGui::TableNextColumn();
+				ImGui::Text("%.2f", stats.PeakBytes / sMegabyte);
+				ImGui::TableNextColumn();
+				ImGui::Text("%llu", static_cast<unsigned long long>(stats.FrameAllocations));
+				ImGui::TableNextColumn();
+				ImGui::Text("%.1f", stats.FrameBytes / 1024.0);
+
+				// Budgets are edited in MB, 0 removes the budget
+				ImGui::TableNextColumn();
+				float budget = static_cast<float>(stats.Budget / sMegabyte);
+				ImGui::PushID(i);
+				ImGui::SetNextItemWidth(-1.f);
+				if (ImGui::InputFloat("##Budget", &budget, 0.f, 0.f, "%.0f", ImGuiInputTextFlags_EnterReturnsTrue))
+					MemoryTracker::SetBudget(tag, static_cast<uint64_t>(std::max(budget, 0.f) * sMegabyte));
+				ImGui::PopID();
+			}
+			ImGui::EndTable();
+		}
+
+		ImGui::End();
+	}
+}
@@ -0,0 +1,198 @@
+/******************************************************************************/
+/*!
+\file		ProfilerPanel.cpp
+\author 	Chua Zheng Yang
+\par    	email: c.zhengyang\@digipen.edu
+\date   	October 19, 2024
+\brief		Defines the class Profiler Panel in Level Editor
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ *
+ /******************************************************************************/
+#include <algorithm>
+#include <map>
+#include <string>
+#include <imgui.h>
+#include <Panels/ProfilerPanel.hpp>
+
+namespace Borealis
+{
+	static ImU32 ZoneColour(const char* name)
+	{
+		// Stable colour per zone name
+		size_t hash = std::hash<std::string>{}(name);
+		float hue = (hash % 360) / 360.f;
+		float r, g, b;
+		ImGui::ColorConvertHSVtoRGB(hue, 0.5f, 0.85f, r, g, b);
+		return ImGui::GetColorU32(ImVec4(r, g, b, 1.f));
+	}
+
+	void ProfilerPanel::ImGuiRender()
+	{
+		ImGui::Begin("Profiler");
+
+		bool enabled = FrameProfiler::IsEnabled();
+		if (ImGui::Checkbox("Record", &enabled))
+			FrameProfiler::SetEnabled(enabled);
+		ImGui::SameLine();
+		bool paused = FrameProfiler::IsPaused();
+		if (ImGui::Checkbox("Pause", &paused))
+			FrameProfiler::SetPaused(paused);
+		ImGui::SameLine();
+		if (ImGui::Button("Export Chrome Trace"))
+			FrameProfiler::ExportChromeTrace(mTracePath);
+		ImGui::SameLine();
+		ImGui::SetNextItemWidth(-1.f);
+		ImGui::InputText("##TracePath", mTracePath, sizeof(mTracePath));
+
+		// Keep the last copy while paused so the selection stays put
+		if (!paused || mFrames.empty())
+			FrameProfiler::GetFrames(mFrames);
+		if (mFrames.empty())
+		{
+			ImGui::TextDisabled("No frames recorded");
+			ImGui::End();
+			return;
+		}
+
+		std::vector<float> frameTimes(mFrames.size());
+		for (size_t i = 0; i < mFrames.size(); ++i)
+			frameTimes[i] = mFrames[i].GetMilliseconds();
+
+		if (mSelectedFrame >= static_cast<int>(mFrames.size()))
+			mSelectedFrame = -1;
+		int selected = mSelectedFrame < 0 ? static_cast<int>(mFrames.size()) - 1 : mSelectedFrame;
+		const ProfiledFrame& frame = mFrames[selected];
+
+		float worst = *std::max_element(frameTimes.begin(), frameTimes.end());
+		std::string overlay = "Frame " + std::to_string(frame.mIndex) + ": " + std::to_string(frame.GetMilliseconds()) + " ms";
+		ImGui::PlotHistogram("##FrameTimes", frameTimes.data(), static_cast<int>(frameTimes.size()), 0, overlay.c_str(), 0.f, worst, ImVec2(-1.f, 60.f));
+		if (ImGui::IsItemClicked())
+		{
+			float t = (ImGui::GetMousePos().x - ImGui::GetItemRectMin().x) / ImGui::GetItemRectSize().x;
+			mSelectedFrame = std::clamp(static_cast<int>(t * mFrames.size()), 0, static_cast<int>(mFrames.size()) - 1);
+		}
+		if (mSelectedFrame >= 0)
+		{
+			ImGui::SameLine();
+			if (ImGui::SmallButton("Follow"))
+				mSelectedFrame = -1;
+		}
+		ImGui::TextDisabled("Click a bar to inspect that frame, hover a zone for its time");
+
+		DrawTimeline(frame);
+		DrawSummary(frame);
+
+		ImGui::End();
+	}
+
+	void ProfilerPanel::DrawTimeline(const ProfiledFrame& frame)
+	{
+		constexpr float rowHeight = 18.f;
+		constexpr float laneGap = 6.f;
+
+		// Lay out one lane per thread that recorded something, then the GPU
+		std::map<uint32_t, uint32_t> laneDepths;
+		for (const ProfileZoneRecord& zone : frame.mZones)
+			laneDepths[zone.mThread] = std::max(laneDepths[zone.mThread], zone.mDepth + 1);
+		uint32_t gpuDepth = 0;
+		for (const ProfileZoneRecord& zone : frame.mGpuZones)
+			gpuDepth = std::max(gpuDepth, zone.mDepth + 1);
+
+		float height = 0.f;
+		for (auto& [thread, depth] : laneDepths)
+			height += depth * rowHeight + laneGap;
+		height += gpuDepth * rowHeight + laneGap;
+
+		ImVec2 origin = ImGui::GetCursorScreenPos();
+		float width = ImGui::GetContentRegionAvail().x;
+		ImGui::InvisibleButton("##Timeline", ImVec2(width, std::max(height, rowHeight)));
+		bool hovered = ImGui::IsItemHovered();
+		ImVec2 mouse = ImGui::GetMousePos();
+		ImDrawList* drawList = ImGui::GetWindowDrawList();
+
+		double duration = static_cast<double>(std::max<int64_t>(frame.mEnd - frame.mStart, 1));
+		auto drawZones = [&](const std::vector<ProfileZoneRecord>& zones, float top, bool isGpu, uint32_t thread)
+			{
+				for (const ProfileZoneRecord& zone : zones)
+				{
+					if (!isGpu && zone.mThread != thread)
+						continue;
+
+					int64_t start = isGpu ? zone.mStart : zone.mStart - frame.mStart;
+					int64_t end = isGpu ? zone.mEnd : zone.mEnd - frame.mStart;
+					float x0 = origin.x + static_cast<float>(std::clamp(start / duration, 0.0, 1.0) * width);
+					float x1 = origin.x + static_cast<float>(std::clamp(end / duration, 0.0, 1.0) * width);
+					x1 = std::max(x1, x0 + 1.f);
+					float y0 = top + zone.mDepth * rowHeight;
+					float y1 = y0 + rowHeight - 1.f;
+
+					drawList->AddRectFilled(ImVec2(x0, y0), ImVec2(x1, y1), ZoneColour(zone.mName));
+					if (x1 - x0 > 30.f)
+					{
+						drawList->PushClipRect(ImVec2(x0, y0), ImVec2(x1, y1), true);
+						drawList->AddText(ImVec2(x0 + 2.f, y0 + 1.f), IM_COL32(0, 0, 0, 255), zone.mName);
+						drawList->PopClipRect();
+					}
+
+					if (hovered && mouse.x >= x0 && mouse.x < x1 && mouse.y >= y0 && mouse.y < y1)
+						ImGui::SetTooltip("%s%s\n%.3f ms", isGpu ? "GPU: " : "", zone.mName, zone.GetMilliseconds());
+				}
+			};
+
+		float top = origin.y;
+		for (auto& [thread, depth] : laneDepths)
+		{
+			drawZones(frame.mZones, top, false, thread);
+			top += depth * rowHeight + laneGap;
+		}
+		drawZones(frame.mGpuZones, top, true, 0);
+	}
+
+	void ProfilerPanel::DrawSummary(const ProfiledFrame& frame)
+	{
+		if (ImGui::CollapsingHeader("Zones", ImGuiTreeNodeFlags_DefaultOpen))
+		{
+			std::map<std::string, std::pair<float, uint32_t>> totals;
+			for (const ProfileZoneRecord& zone : frame.mZones)
+			{
+				auto& [milliseconds, count] = totals[zone.mName];
+				milliseconds += zone.GetMilliseconds();
+				++count;
+			}
+			for (const ProfileZoneRecord& zone : frame.mGpuZones)
+			{
+				auto& [milliseconds, count] = totals[std::string("GPU: ") + zone.mName];
+				milliseconds += zone.GetMilliseconds();
+				++count;
+			}
+
+			std::vector<std::pair<std::string, std::pair<float, uint32_t>>> sorted(totals.begin(), totals.end());
+			std::sort(sorted.begin(), sorted.end(), [](const auto& a, const auto& b) { return a.second.first > b.second.first; });
+
+			if (ImGui::BeginTable("##ZoneTotals", 3, ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders))
+			{
+				ImGui::TableSetupColumn("Zone");
+				ImGui::TableSetupColumn("Total (ms)");
+				ImGui::TableSetupColumn("Calls");
+				ImGui::TableHeadersRow();
+				for (const auto& [name, total] : sorted)
+				{
+					ImGui::TableNextRow();
+					ImGui::TableNextColumn(); ImGui::TextUnformatted(name.c_str());
+					ImGui::TableNextColumn(); ImGui::Text("%.3f", total.first);
+					ImGui::TableNextColumn(); ImGui::Text("%u", total.second);
+				}
+				ImGui::EndTable();
+			}
+		}
+
+		if (!frame.mCounters.empty() && ImGui::CollapsingHeader("Counters", ImGuiTreeNodeFlags_DefaultOpen))
+		{
+			for (const ProfileCounterRecord& counter : frame.mCounters)
+				ImGui::Text("%s: %.0f", counter.mName, counter.mValue);
+		}
+	}
+}
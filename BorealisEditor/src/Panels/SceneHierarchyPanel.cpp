@@ -175,7 +175,7 @@ namespace Borealis
 	void SceneHierarchyPanel::SetContext(const Ref<Scene>& scene)
 	{
 		mContext = scene;
-		mSelectedEntity = {};
+		SetSelectedEntity({});
 	}
 	void SceneHierarchyPanel::ImGuiRender()
 	{
@@ -218,7 +218,7 @@ namespace Borealis
 								SceneManager::SaveActiveScene();
 								SceneManager::SetActiveScene(name);
 								mContext = SceneManager::GetActiveScene();
-								mSelectedEntity = {};
+								SetSelectedEntity({});
 							}
 						}
 						ImGui::EndPopup();
@@ -236,7 +236,7 @@ namespace Borealis
 
 		if (ImGui::IsMouseDown(0) && ImGui::IsWindowHovered()) // Deselect
 		{
-			mSelectedEntity = {};
+			SetSelectedEntity({});
 		}
 
 		// Right click on blank space	
@@ -276,11 +276,66 @@ namespace Borealis
 				case AssetType::Texture2D:
 				{
 					MaterialEditor::SetMaterial(0);
+
+					// Edits a copy, nothing changes until the asset is reimported
+					static AssetHandle sEditedTexture = 0;
+					static TextureImportSettings sTextureSettings;
+					if (sEditedTexture != metadata.Handle)
+					{
+						sEditedTexture = metadata.Handle;
+						sTextureSettings = metadata.TextureSettings;
+					}
+
+					ImGui::SeparatorText("Import Settings");
+					const char* usages[] = { "Auto", "Colour (BC7)", "Normal Map (BC5)", "Mask (BC4)" };
+					int usage = static_cast<int>(sTextureSettings.Usage);
+					if (ImGui::Combo("Usage", &usage, usages, IM_ARRAYSIZE(usages)))
+						sTextureSettings.Usage = static_cast<TextureUsage>(usage);
+					ImGui::Checkbox("Generate Mips", &sTextureSettings.GenerateMips);
+
+					if (ImGui::Button("Reimport"))
+					{
+						AssetMetaData reimported = metadata;
+						reimported.TextureSettings = sTextureSettings;
+						AssetImporter::ReimportAsset(reimported);
+					}
 					break;
 				}
 				case AssetType::Audio:
 				{
 					MaterialEditor::SetMaterial(0);
+
+					// Edits a copy, nothing changes until the asset is reimported
+					static AssetHandle sEditedAudio = 0;
+					static AudioImportSettings sAudioSettings;
+					if (sEditedAudio != metadata.Handle)
+					{
+						sEditedAudio = metadata.Handle;
+						sAudioSettings = metadata.AudioSettings;
+					}
+
+					ImGui::SeparatorText("Import Settings");
+					const char* formats[] = { "ADPCM", "PCM" };
+					int format = static_cast<int>(sAudioSettings.Format);
+					if (ImGui::Combo("Format", &format, formats, IM_ARRAYSIZE(formats)))
+						sAudioSettings.Format = static_cast<AudioFormat>(format);
+
+					const char* loadModes[] = { "Auto", "Decompress On Load", "Compressed In Memory", "Stream" };
+					int loadMode = static_cast<int>(sAudioSettings.LoadMode);
+					if (ImGui::Combo("Load Mode", &loadMode, loadModes, IM_ARRAYSIZE(loadModes)))
+						sAudioSettings.LoadMode = static_cast<AudioLoadMode>(loadMode);
+
+					if (sAudioSettings.LoadMode == AudioLoadMode::Auto)
+						ImGui::DragFloat("Stream Above (s)", &sAudioSettings.StreamThreshold, 0.5f, 0.0f, 600.0f);
+					ImGui::Checkbox("Force Mono", &sAudioSettings.ForceMono);
+					ImGui::Text(metadata.AudioSettings.Streaming ? "Imported as: Stream" : "Imported as: In Memory");
+
+					if (ImGui::Button("Reimport"))
+					{
+						AssetMetaData reimported = metadata;
+						reimported.AudioSettings = sAudioSettings;
+						AssetImporter::ReimportAsset(reimported);
+					}
 					break;
 				}
 				case AssetType::Shader:
@@ -315,13 +370,14 @@ namespace Borealis
 	void SceneHierarchyPanel::DrawEntityNode(Entity entity)
 	{
 		auto& tag = entity.GetComponent<TagComponent>().Tag;
-		ImGuiTreeNodeFlags flags = ((mSelectedEntity == entity) ? ImGuiTreeNodeFlags_Selected : 0) | ImGuiTreeNodeFlags_OpenOnArrow;
+		bool selected = mSelectedEntity == entity || std::find(mSelectedEntities.begin(), mSelectedEntities.end(), entity) != mSelectedEntities.end();
+		ImGuiTreeNodeFlags flags = (selected ? ImGuiTreeNodeFlags_Selected : 0) | ImGuiTreeNodeFlags_OpenOnArrow;
 		flags |= ImGuiTreeNodeFlags_SpanAvailWidth;
 		uint64_t entityID = static_cast<uint64_t>((uint32_t)entity);
 		bool opened = ImGui::TreeNodeEx((void*)entityID, flags, tag.c_str());
 		if (ImGui::IsItemClicked())
 		{
-			mSelectedEntity = entity;
+			SetSelectedEntity(entity);
 		}
 
 		bool entityDeleted = false;
@@ -621,6 +677,7 @@ namespace Borealis
 	
 			SearchBar<SpriteRendererComponent>(search_text, mSelectedEntity, "Sprite Renderer", search_buffer);
 			SearchBar<CircleRendererComponent>( search_text, mSelectedEntity, "Circle Renderer", search_buffer);
+			SearchBar<ParticleSystemComponent>( search_text, mSelectedEntity, "Particle System", search_buffer);
 			SearchBar<CameraComponent>			(search_text, mSelectedEntity, "Camera", search_buffer);
 			SearchBar<MeshFilterComponent	  >(search_text, mSelectedEntity,"Mesh Filter", search_buffer);
 			SearchBar<MeshRendererComponent	  >(search_text, mSelectedEntity,"Mesh Renderer", search_buffer);
@@ -755,6 +812,33 @@ namespace Borealis
 				ImGui::DragFloat("fade", &component.fade, 0.005f, 0.0f, 1.0f);
 			});
 
+		DrawComponent<ParticleSystemComponent>("Particle System", mSelectedEntity, [](auto& component)
+			{
+				ImGui::DragFloat("Emit Rate", &component.EmitRate, 1.f, 0.f, 1000000.f);
+				int maxParticles = static_cast<int>(component.MaxParticles);
+				if (ImGui::DragInt("Max Particles", &maxParticles, 100.f, 1, 1000000))
+					component.MaxParticles = static_cast<uint32_t>(maxParticles);
+				ImGui::DragFloat3("Offset", glm::value_ptr(component.Props.Position), 0.1f);
+				ImGui::DragFloat3("Velocity", glm::value_ptr(component.Props.Velocity), 0.1f);
+				ImGui::DragFloat3("Velocity Variation", glm::value_ptr(component.Props.VelocityVariation), 0.1f);
+				ImGui::ColorEdit4("Colour Begin", glm::value_ptr(component.Props.ColourBegin));
+				ImGui::ColorEdit4("Colour End", glm::value_ptr(component.Props.ColourEnd));
+				ImGui::DragFloat("Size Begin", &component.Props.SizeBegin, 0.01f, 0.f, 100.f);
+				ImGui::DragFloat("Size End", &component.Props.SizeEnd, 0.01f, 0.f, 100.f);
+				ImGui::DragFloat("Size Variation", &component.Props.SizeVariation, 0.01f, 0.f, 100.f);
+				ImGui::DragFloat("Life Time", &component.Props.LifeTime, 0.01f, 0.f, 100.f);
+				ImGui::Button("Texture");
+				if (ImGui::BeginDragDropTarget())
+				{
+					if (const ImGuiPayload* payload = ImGui::AcceptDragDropPayload("DragDropImageItem"))
+					{
+						AssetHandle data = *(const uint64_t*)payload->Data;
+						component.Texture = AssetManager::GetAsset<Texture2D>(data);
+					}
+					ImGui::EndDragDropTarget();
+				}
+			});
+
 		DrawComponent<MeshFilterComponent>("Mesh Filter", mSelectedEntity, [](auto& component)
 			{
 				ImGui::Button("Mesh");
@@ -787,6 +871,10 @@ namespace Borealis
 					}
 					ImGui::EndDragDropTarget();
 				}
+
+				ImGui::Checkbox("LOD Cross Fade", &component.LodCrossFade);
+				if (component.Model)
+					ImGui::Text("LOD: %u / %u", component.Lod, component.Model->GetLodCount() - 1);
 			});
 		DrawComponent<MeshRendererComponent>("Mesh Renderer", mSelectedEntity, [](auto& component)
 			{
@@ -1033,6 +1121,8 @@ namespace Borealis
 
 				ImGui::InputInt("Text Size", &textSize);
 
+				ImGui::ColorEdit4("Colour", glm::value_ptr(component.colour));
+
 				component.text = inputText;
 				component.fontSize = textSize;
 			});
@@ -1063,6 +1153,10 @@ namespace Borealis
 
 					// DragFloat for volume control (range: -80 dB to 0 dB)
 					ImGui::DragFloat("Volume", &component.Volume, 0.5f, -80.0f, 0.0f);
+					// Lower values win when there are more sounds than real voices
+					ImGui::DragInt("Priority", &component.Priority, 1.0f, 0, 256);
+					ImGui::DragFloat("Min Distance", &component.MinDistance, 0.1f, 0.0f, component.MaxDistance);
+					ImGui::DragFloat("Max Distance", &component.MaxDistance, 0.1f, component.MinDistance, 10000.0f);
 					if (ImGui::Button("Play"))
 					{
 						component.isPlaying = true;
@@ -15,12 +15,97 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <RuntimeLayer.hpp>
 #include <Core/EntryPoint.hpp>
 
+/*!***********************************************************************
+	\brief
+		Builds the application properties from the command line.
+		--headless runs without a window or graphics device,
+		--tick <hz|unlocked> sets the fixed tick rate, or ticks as fast as
+		possible, --frames <count> closes the runtime after that many frames,
+		--record <file> records the input of the session, --replay <file>
+		plays a recorded session back with its recorded frame times,
+		--trace <file> writes the last profiled frames as a Chrome trace on exit
+		and --memory-budget <Tag>=<MB> sets the memory budget of a subsystem,
+		repeated once per subsystem.
+	\param[in] args
+		Command line arguments
+	\return
+		Properties of the runtime
+*************************************************************************/
+static Borealis::ApplicationProperties ParseCommandLine(Borealis::ApplicationCommandLineArgs args)
+{
+	Borealis::ApplicationProperties properties;
+	properties.mName = "Game App";
+	properties.mRenderPolicy = Borealis::RenderThread::Policy::MultiThreaded;
+
+	bool tickSet = false;
+	for (int i = 1; i < args.mCount; ++i)
+	{
+		std::string arg = args[i];
+		bool hasValue = i + 1 < args.mCount;
+		if (arg == "--headless")
+		{
+			properties.mIsHeadless = true;
+			// Nothing to overlap with the Null API, keep the frame on one thread
+			properties.mRenderPolicy = Borealis::RenderThread::Policy::SingleThreaded;
+		}
+		else if (arg == "--tick" && hasValue)
+		{
+			std::string value = args[++i];
+			if (value == "unlocked")
+			{
+				properties.mIsUnlocked = true;
+			}
+			else
+			{
+				float rate = std::strtof(value.c_str(), nullptr);
+				properties.mFixedTimestep = rate > 0.f ? 1.f / rate : 0.f;
+			}
+			tickSet = true;
+		}
+		else if (arg == "--frames" && hasValue)
+		{
+			properties.mMaxFrames = std::strtoull(args[++i], nullptr, 10);
+		}
+		else if (arg == "--record" && hasValue)
+		{
+			properties.mRecordInputPath = args[++i];
+		}
+		else if (arg == "--replay" && hasValue)
+		{
+			properties.mReplayInputPath = args[++i];
+		}
+		else if (arg == "--trace" && hasValue)
+		{
+			properties.mTracePath = args[++i];
+		}
+		else if (arg == "--memory-budget" && hasValue)
+		{
+			std::string budget = args[++i];
+			if (!Borealis::MemoryTracker::ParseBudget(budget))
+				APP_LOG_WARN("Invalid memory budget {}, expected <Tag>=<MB>", budget);
+		}
+		else
+		{
+			APP_LOG_WARN("Unknown command line argument {}", arg);
+		}
+	}
+
+	// Headless runs simulate 60Hz ticks as fast as the CPU allows unless told otherwise
+	if (properties.mIsHeadless && properties.mFixedTimestep == 0.f)
+	{
+		properties.mFixedTimestep = 1.f / 60.f;
+		if (!tickSet)
+			properties.mIsUnlocked = true;
+	}
+	return properties;
+}
+
 class Runtime : public Borealis::ApplicationManager
 {
 public:
-	Runtime() : ApplicationManager("Game App")
+	Runtime(const Borealis::ApplicationProperties& properties) : ApplicationManager(properties)
 	{
-#ifndef _DIST
+#if !defined(_DIST) && defined(_MSC_VER)
 		_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF | _CRTDBG_LEAK_CHECK_DF);
 #endif
 		//PushLayer(new gameLayer());
@@ -36,8 +121,7 @@ public:
 };
 
 
-Borealis::ApplicationManager* Borealis::CreateApplication()
+Borealis::ApplicationManager* Borealis::CreateApplication(Borealis::ApplicationCommandLineArgs args)
 {
-	return new Runtime();
+	return new Runtime(ParseCommandLine(args));
 }
-
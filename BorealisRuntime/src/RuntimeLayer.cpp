@@ -58,7 +58,6 @@ namespace BorealisRuntime
 	}
 	void RuntimeLayer::UpdateFn(float dt)
 	{
-		Borealis::Renderer2D::ResetStats();
 		Borealis::RenderCommand::Clear();
 		Borealis::RenderCommand::SetClearColor({ 0.f, 0.0f, 0.0f, 1 });
 		Borealis::SceneManager::GetActiveScene()->UpdateRuntime(dt);
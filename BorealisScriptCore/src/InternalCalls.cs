@@ -84,5 +84,12 @@ namespace Borealis
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
         internal extern static void ScriptComponent_RemoveComponent(ulong entityID, Type type);
         #endregion
+
+        #region SceneManager
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        internal extern static void SceneManager_LoadScene(string sceneName, bool additive);
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        internal extern static bool SceneManager_IsLoading();
+        #endregion
     }
 }
\ No newline at end of file
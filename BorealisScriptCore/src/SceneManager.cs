@@ -0,0 +1,23 @@
+﻿namespace Borealis
+{
+    public class SceneManager
+    {
+        public static bool isLoading
+        {
+            get
+            {
+                return InternalCalls.SceneManager_IsLoading();
+            }
+        }
+
+        public static void LoadScene(string sceneName)
+        {
+            InternalCalls.SceneManager_LoadScene(sceneName, false);
+        }
+
+        public static void LoadSceneAdditive(string sceneName)
+        {
+            InternalCalls.SceneManager_LoadScene(sceneName, true);
+        }
+    }
+}
@@ -55,6 +55,8 @@ workspace "Borealis"
 	LibraryDir["IMGUI_Release"] = "lib/IMGUI/lib/Rel"
 	LibraryDir["RTTR_Debug"] = "lib/RTTR/lib/Deb"
 	LibraryDir["RTTR_Release"] = "lib/RTTR/lib/Rel"
+	LibraryDir["Linux_Debug"] = "lib/Linux/Deb"
+	LibraryDir["Linux_Release"] = "lib/Linux/Rel"
 
 	Library = {}
 	Library["FMOD_Debug"] = "%{LibraryDir.FMOD}/fmodL_vc.lib"
@@ -93,10 +95,54 @@ workspace "Borealis"
 	Library["RTTR_Debug"] = "%{LibraryDir.RTTR_Debug}/librttr_core.lib"
 	Library["RTTR_Release"] = "%{LibraryDir.RTTR_Release}/librttr_core.lib"
 
+	-- Links the engine and the libraries it depends on into a Linux executable.
+	-- The libraries are the same ones as the Windows builds, built as static
+	-- archives into Borealis/lib/Linux/Deb and Borealis/lib/Linux/Rel. They are
+	-- not checked in, so they have to be built from the matching library
+	-- sources before the Linux targets link
+	LinuxLibraries = { "fmod", "monosgen-2.0", "GLAD", "glfw3", "Jolt", "yaml-cpp", "IMGUI", "rttr_core" }
+
+	if os.istarget("linux") then
+		for _, dir in ipairs({ LibraryDir["Linux_Debug"], LibraryDir["Linux_Release"] }) do
+			for _, lib in ipairs(LinuxLibraries) do
+				if not os.isfile("Borealis/" .. dir .. "/lib" .. lib .. ".a") and not os.isfile("Borealis/" .. dir .. "/lib" .. lib .. ".so") then
+					premake.warn("Borealis/%s is missing lib%s, the Linux targets will compile but not link", dir, lib)
+				end
+			end
+		end
+	end
+
+	function LinuxEngineLinks()
+		filter { "system:linux", "configurations:Debug" }
+			libdirs { "Borealis/%{LibraryDir.Linux_Debug}" }
+
+		filter { "system:linux", "configurations:Release or Distribution" }
+			libdirs { "Borealis/%{LibraryDir.Linux_Release}" }
+
+		filter "system:linux"
+			toolset "gcc"
+			linkgroups "On"
+			links { "Tracy" }
+			links(LinuxLibraries)
+			links
+			{
+				"GL",
+				"X11",
+				"pthread",
+				"dl"
+			}
+
+		filter {}
+	end
+
+	-- Only the engine, runtime and benchmarks build on Linux; the editor
+	-- tool chain depends on Windows only libraries
 	group "Dependencies"
-		include "Borealis/lib/Tracy"
-		include "BorealisEditor/lib/Assimp"
-		include "BorealisEditor/lib/imgui-node-editor"
+		include "Borealis/lib/tracy"
+		if os.istarget("windows") then
+			include "BorealisEditor/lib/Assimp"
+			include "BorealisEditor/lib/imgui-node-editor"
+		end
 	group ""
 
 	project "Borealis"
@@ -105,7 +151,6 @@ workspace "Borealis"
 		language "C++"
 		cppdialect "C++20"
 		staticruntime "on"
-		systemversion "latest"
 
 		targetdir ("build/" .. outputdir .. "/%{prj.name}")
 		objdir ("build-int/" .. outputdir .. "/%{prj.name}")
@@ -156,7 +201,6 @@ workspace "Borealis"
 
 		links
 		{
-			"opengl32.lib",
 			"Tracy",
 		}
 
@@ -174,24 +218,25 @@ workspace "Borealis"
 
 		filter "files:Borealis/lib/ImGuizmo/**.cpp"
 		flags {"NoPCH"}
-		
-		
+
+		filter "system:windows"
+			systemversion "latest"
+			links
+			{
+				"opengl32.lib"
+			}
+
+		-- A static library does not carry its dependencies on Linux, so the
+		-- executables list them through LinuxEngineLinks
+		filter "system:linux"
+			pic "On"
+			toolset "gcc"
+
 
 		filter "configurations:Debug"
 			defines "_DEB"
 			symbols "On"
 			runtime "Debug"
-			links
-			{
-				"%{Library.FMOD_Debug}",
-				"%{Library.Mono_Debug}",
-				"%{Library.GLAD_Debug}",
-				"%{Library.GLFW_Debug}",
-				"%{Library.Jolt_Debug}",
-				"%{Library.YAML_Debug}",
-				"%{Library.IMGUI_Debug}",
-				"%{Library.RTTR_Debug}"
-			}
 			postbuildcommands {
 				"{COPY} \"engineResources\" \"../BorealisEditor/engineResources\""
 			 }
@@ -200,17 +245,6 @@ workspace "Borealis"
 			defines "_REL"
 			optimize "On"
 			runtime "Release"
-			links
-			{
-				"%{Library.FMOD_Release}",
-				"%{Library.Mono_Release}",
-				"%{Library.GLAD_Release}",
-				"%{Library.GLFW_Release}",
-				"%{Library.Jolt_Release}",
-				"%{Library.YAML_Release}",
-				"%{Library.IMGUI_Release}",
-				"%{Library.RTTR_Release}"
-			}
 			postbuildcommands {
 				"{COPY} \"engineResources\" \"../BorealisEditor/engineResources\""
 			 }
@@ -219,6 +253,24 @@ workspace "Borealis"
 			defines "_DIST"
 			optimize "On"
 			runtime "Release"
+			postbuildcommands {
+				"{COPY} \"engineResources\" \"../BorealisEditor/engineResources\""
+			 }
+
+		filter { "system:windows", "configurations:Debug" }
+			links
+			{
+				"%{Library.FMOD_Debug}",
+				"%{Library.Mono_Debug}",
+				"%{Library.GLAD_Debug}",
+				"%{Library.GLFW_Debug}",
+				"%{Library.Jolt_Debug}",
+				"%{Library.YAML_Debug}",
+				"%{Library.IMGUI_Debug}",
+				"%{Library.RTTR_Debug}"
+			}
+
+		filter { "system:windows", "configurations:Release or Distribution" }
 			links
 			{
 				"%{Library.FMOD_Release}",
@@ -230,10 +282,8 @@ workspace "Borealis"
 				"%{Library.IMGUI_Release}",
 				"%{Library.RTTR_Release}"
 			}
-			postbuildcommands {
-				"{COPY} \"engineResources\" \"../BorealisEditor/engineResources\""
-			 }
 
+	if os.istarget("windows") then
 	project "BorealisEditor"
 		location "BorealisEditor"
 		kind "ConsoleApp"
@@ -416,13 +466,14 @@ workspace "Borealis"
 			optimize "Full"
 			symbols "Off"
 
+	end
+
 	project "BorealisRuntime"
 		location "BorealisRuntime"
 		kind "ConsoleApp"
 		language "C++"
 		cppdialect "C++20"
 		staticruntime "on"
-		systemversion "latest"
 
 		targetdir("BorealisEditor")
 		objdir ("BorealisEditor/Resources/Scripts/Core/Intermediate")
@@ -462,24 +513,111 @@ workspace "Borealis"
 			symbols "On"
 			runtime "Debug"
 
-		links
-		{
-			"Borealis/%{Library.Jolt_Debug}",
-		}
 		filter "configurations:Release"
 			defines "_REL"
 			optimize "On"
 			runtime "Release"
+
+		filter "configurations:Distribution"
+			defines "_DIST"
+			optimize "On"
+			runtime "Release"
+
+		filter "system:windows"
+			systemversion "latest"
+
+		filter { "system:windows", "configurations:Debug" }
+			links
+			{
+				"Borealis/%{Library.Jolt_Debug}",
+			}
+
+		filter { "system:windows", "configurations:Release or Distribution" }
+			links
+			{
+				"Borealis/%{Library.Jolt_Release}",
+			}
+
+		LinuxEngineLinks()
+
+	-- Baselines are only comparable on the machine and platform that recorded
+	-- them. The suite has only been run on Windows, the Linux configuration
+	-- compiles but has not been linked or run, so there is no Linux baseline
+	project "BorealisBenchmarks"
+		location "BorealisBenchmarks"
+		kind "ConsoleApp"
+		language "C++"
+		cppdialect "C++20"
+		staticruntime "on"
+
+		targetdir("BorealisEditor")
+		objdir ("BorealisEditor/Resources/Scripts/Core/Intermediate")
+
+		files
+		{
+			"%{prj.name}/inc/**.hpp",
+			"%{prj.name}/src/**.cpp"
+		}
+
+		includedirs
+		{
+			"Borealis",
+			"Borealis/inc",
+			"Borealis/lib/spdlog/include",
+			"%{IncludeDir.GLM}",
+			"%{IncludeDir.ImGui}",
+			"%{prj.name}/inc",
+			"%{IncludeDir.ENTT}",
+			"%{IncludeDir.YAML}"
+		}
+
+		defines
+		{
+			"_SILENCE_ALL_MS_EXT_DEPRECATION_WARNINGS",
+			"JPH_FLOATING_POINT_EXCEPTIONS_ENABLED",
+			"JPH_CROSS_PLATFORM_DETERMINISTIC",
+			"JPH_ENABLE_ASSERTS",
+			"YAML_CPP_STATIC_DEFINE"
+		}
+
 		links
 		{
-			"Borealis/%{Library.Jolt_Release}",
+			"Borealis"
 		}
 
+		filter "configurations:Debug"
+			defines "_DEB"
+			symbols "On"
+			runtime "Debug"
+
+		filter "configurations:Release"
+			defines "_REL"
+			optimize "On"
+			runtime "Release"
+
 		filter "configurations:Distribution"
 			defines "_DIST"
 			optimize "On"
 			runtime "Release"
 
+		filter "system:windows"
+			systemversion "latest"
+
+		filter { "system:windows", "configurations:Debug" }
+			links
+			{
+				"Borealis/%{Library.Jolt_Debug}",
+			}
+
+		filter { "system:windows", "configurations:Release or Distribution" }
+			links
+			{
+				"Borealis/%{Library.Jolt_Release}",
+			}
+
+		LinuxEngineLinks()
+
+	if os.istarget("windows") then
 	project "BorealisAssetCompiler"
 		location "BorealisAssetCompiler"
 		kind "ConsoleApp"
@@ -505,7 +643,8 @@ workspace "Borealis"
 			"%{IncludeDir.assimp}",
 			"%{IncludeDir.MSDF}",
 			"%{IncludeDir.STBI_Compiler}",
-			"%{IncludeDir.ISPC}"
+			"%{IncludeDir.ISPC}",
+			"%{IncludeDir.FMOD}"
 		}
 
 		defines
@@ -528,7 +667,8 @@ workspace "Borealis"
 		}
 
 		postbuildcommands {
-			"{COPYFILE} \"../BorealisAssetCompiler/lib/ispc/dll/ispc_texcomp.dll\" \"$(TargetDir)\""
+			"{COPYFILE} \"../BorealisAssetCompiler/lib/ispc/dll/ispc_texcomp.dll\" \"$(TargetDir)\"",
+			"{COPYFILE} \"../Borealis/lib/FMOD/dll/fmod.dll\" \"$(TargetDir)\""
 		 }
 
 		filter "configurations:Debug"
@@ -545,7 +685,8 @@ workspace "Borealis"
 				"%{Library.MSDF_Debug_LibBZ2}",
 				"%{Library.MSDF_Debug_LibBrotli}",
 				"%{Library.MSDF_Debug_LibBrotliCommon}",
-				"Borealis/%{Library.YAML_Debug}"
+				"Borealis/%{Library.YAML_Debug}",
+				"Borealis/%{Library.FMOD_Release}"
 			}
 
 		filter "configurations:Release"
@@ -562,7 +703,8 @@ workspace "Borealis"
 				"%{Library.MSDF_Release_LibBZ2}",
 				"%{Library.MSDF_Release_LibBrotli}",
 				"%{Library.MSDF_Release_LibBrotliCommon}",
-				"Borealis/%{Library.YAML_Release}"
+				"Borealis/%{Library.YAML_Release}",
+				"Borealis/%{Library.FMOD_Release}"
 			}
 
 		filter "configurations:Distribution"
@@ -579,5 +721,7 @@ workspace "Borealis"
 				"%{Library.MSDF_Release_LibBZ2}",
 				"%{Library.MSDF_Release_LibBrotli}",
 				"%{Library.MSDF_Release_LibBrotliCommon}",
-				"Borealis/%{Library.YAML_Release}"
+				"Borealis/%{Library.YAML_Release}",
+				"Borealis/%{Library.FMOD_Release}"
 			}
+	end